@@ -173,6 +173,7 @@ private:
     typedef base_atomic this_type;
     typedef T value_type;
     typedef lockpool::scoped_lock guard_type;
+    typedef lockpool::scoped_reader reader_type;
 
 protected:
     typedef value_type const& value_arg_type;
@@ -195,10 +196,14 @@ public:
     load(memory_order /*order*/ = memory_order_seq_cst) volatile const BOOST_NOEXCEPT
     {
         char * storage = storage_ptr();
-        guard_type guard(storage);
+        reader_type reader(storage);
 
         value_type v;
-        memcpy(&v, storage, sizeof(value_type));
+        do
+        {
+            reader.read(&v, storage, sizeof(value_type));
+        }
+        while (reader.retry());
         return v;
     }
 
@@ -272,6 +277,7 @@ private:
     typedef T value_type;
     typedef T difference_type;
     typedef lockpool::scoped_lock guard_type;
+    typedef lockpool::scoped_reader reader_type;
 
 protected:
     typedef value_type value_arg_type;
@@ -291,9 +297,14 @@ public:
     value_type
     load(memory_order /*order*/ = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
     {
-        guard_type guard(const_cast<value_type *>(&v_));
+        reader_type reader(const_cast<value_type *>(&v_));
 
-        value_type v = const_cast<const volatile value_type &>(v_);
+        value_type v;
+        do
+        {
+            reader.read(&v, &v_, sizeof(value_type));
+        }
+        while (reader.retry());
         return v;
     }
 
@@ -404,6 +415,7 @@ private:
     typedef T * value_type;
     typedef std::ptrdiff_t difference_type;
     typedef lockpool::scoped_lock guard_type;
+    typedef lockpool::scoped_reader reader_type;
 
 protected:
     typedef value_type value_arg_type;
@@ -422,9 +434,14 @@ public:
     value_type
     load(memory_order /*order*/ = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
     {
-        guard_type guard(const_cast<value_type *>(&v_));
+        reader_type reader(const_cast<value_type *>(&v_));
 
-        value_type v = const_cast<const volatile value_type &>(v_);
+        value_type v;
+        do
+        {
+            reader.read(&v, &v_, sizeof(value_type));
+        }
+        while (reader.retry());
         return v;
     }
 
@@ -503,6 +520,7 @@ private:
     typedef std::ptrdiff_t difference_type;
     typedef void * value_type;
     typedef lockpool::scoped_lock guard_type;
+    typedef lockpool::scoped_reader reader_type;
 
 protected:
     typedef value_type value_arg_type;
@@ -521,9 +539,14 @@ public:
     value_type
     load(memory_order /*order*/ = memory_order_seq_cst) const volatile BOOST_NOEXCEPT
     {
-        guard_type guard(const_cast<value_type *>(&v_));
+        reader_type reader(const_cast<value_type *>(&v_));
 
-        value_type v = const_cast<const volatile value_type &>(v_);
+        value_type v;
+        do
+        {
+            reader.read(&v, &v_, sizeof(value_type));
+        }
+        while (reader.retry());
         return v;
     }
 
@@ -7,6 +7,8 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <string.h>
+#include <cstddef>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/link.hpp>
 #ifndef BOOST_ATOMIC_FLAG_LOCK_FREE
@@ -41,6 +43,30 @@ public:
         BOOST_DELETED_FUNCTION(scoped_lock& operator=(scoped_lock const&))
     };
 
+    // Without lock-free operations readers have to lock the object as well.
+    // The read never has to be repeated.
+    class scoped_reader :
+        public scoped_lock
+    {
+    public:
+        explicit scoped_reader(const volatile void * addr) : scoped_lock(addr)
+        {
+        }
+
+        bool retry(void) const
+        {
+            return false;
+        }
+
+        void read(void * to, const volatile void * from, std::size_t size) const
+        {
+            memcpy(to, const_cast<const void *>(from), size);
+        }
+
+        BOOST_DELETED_FUNCTION(scoped_reader(scoped_reader const&))
+        BOOST_DELETED_FUNCTION(scoped_reader& operator=(scoped_reader const&))
+    };
+
 private:
     static BOOST_ATOMIC_DECL lock_type& get_lock_for(const volatile void * addr);
 };
@@ -52,6 +78,12 @@ class lockpool
 public:
     typedef atomic_flag lock_type;
 
+    // Every lock in the pool is paired with a sequence counter, which makes it
+    // a sequence lock: the counter is odd while an object protected by the lock
+    // is being modified. Modifications are made under scoped_lock, which
+    // maintains the counter, while scoped_reader only reads the counter
+    // and repeats the read if a modification was in progress. This way
+    // readers never write to the shared cache line.
     class scoped_lock
     {
     private:
@@ -67,10 +99,12 @@ public:
                 BOOST_ATOMIC_X86_PAUSE();
 #endif
             }
+            begin_write(flag_);
         }
 
         ~scoped_lock(void)
         {
+            end_write(flag_);
             flag_.clear(memory_order_release);
         }
 
@@ -78,8 +112,58 @@ public:
         BOOST_DELETED_FUNCTION(scoped_lock& operator=(const scoped_lock &))
     };
 
+    class scoped_reader
+    {
+    private:
+        atomic_flag& flag_;
+        unsigned int sequence_;
+
+    public:
+        explicit
+        scoped_reader(const volatile void * addr) : flag_(get_lock_for(addr)), sequence_(read_begin(flag_))
+        {
+        }
+
+        // Returns true if the object could have been modified since the
+        // read started, in which case the read has to be repeated
+        bool retry(void)
+        {
+            if (read_validate(flag_, sequence_))
+                return false;
+            sequence_ = read_begin(flag_);
+            return true;
+        }
+
+        // Copies the object, which a writer may be modifying at the same time.
+        // The bytes are read with relaxed atomic loads, so that the race with
+        // the writer is benign, and the copy is discarded by retry().
+        void read(void * to, const volatile void * from, std::size_t size) const
+        {
+            unsigned char * dst = static_cast<unsigned char *>(to);
+            const volatile unsigned char * src = static_cast<const volatile unsigned char *>(from);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+#if (defined(__GNUC__) && ((__GNUC__ * 100 + __GNUC_MINOR__) >= 407) && !defined(BOOST_INTEL_CXX_VERSION))\
+    || (defined(BOOST_CLANG) && ((__clang_major__ * 100 + __clang_minor__) >= 302))
+                dst[i] = __atomic_load_n(const_cast<const unsigned char *>(src + i), __ATOMIC_RELAXED);
+#else
+                // Byte loads are atomic on all supported platforms, volatile
+                // keeps the compiler from merging or repeating them
+                dst[i] = src[i];
+#endif
+            }
+        }
+
+        BOOST_DELETED_FUNCTION(scoped_reader(const scoped_reader &))
+        BOOST_DELETED_FUNCTION(scoped_reader& operator=(const scoped_reader &))
+    };
+
 private:
     static BOOST_ATOMIC_DECL lock_type& get_lock_for(const volatile void * addr);
+    static BOOST_ATOMIC_DECL void begin_write(lock_type& lock);
+    static BOOST_ATOMIC_DECL void end_write(lock_type& lock);
+    static BOOST_ATOMIC_DECL unsigned int read_begin(lock_type& lock);
+    static BOOST_ATOMIC_DECL bool read_validate(lock_type& lock, unsigned int sequence);
 };
 
 #endif
@@ -0,0 +1,873 @@
+// Concurrent circular buffers for producer/consumer pipelines.
+
+// Copyright (C) 2026 agent <agent@local>
+
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See www.boost.org/libs/circular_buffer for documentation.
+
+#if !defined(BOOST_CIRCULAR_BUFFER_CONCURRENT_HPP)
+#define BOOST_CIRCULAR_BUFFER_CONCURRENT_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <boost/circular_buffer_fwd.hpp>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/move/move.hpp>
+#include <boost/smart_ptr/detail/yield_k.hpp>
+#include <boost/type_traits/has_nothrow_copy.hpp>
+#include <boost/type_traits/is_nothrow_move_constructible.hpp>
+#include <boost/type_traits/is_scalar.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <stdexcept>
+#if defined(__linux__)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <climits>
+#endif
+
+namespace boost {
+
+namespace cb_details {
+
+//! Distance kept between the positions updated by producers and consumers to avoid false sharing.
+const std::size_t cache_line_size = 64;
+
+//! Number of failed attempts a blocking operation retries before going to sleep.
+const unsigned int spin_count = 64;
+
+/*!
+    \class event_count
+    \brief Lets threads sleep until a condition checked without locks may have changed.
+
+    A waiter calls <code>prepare_wait()</code>, checks its condition again and calls <code>wait()</code>
+    with the returned key only if the condition still does not hold (otherwise <code>cancel_wait()</code>).
+    A notifier changes the condition and then calls <code>notify()</code>, which enters the kernel only
+    if there are waiters. In Linux waiters sleep on a futex; elsewhere they yield the processor.
+*/
+class event_count {
+public:
+    event_count() : m_key(0), m_waiters(0) {}
+
+    boost::uint32_t prepare_wait() {
+        m_waiters.fetch_add(1, memory_order_relaxed);
+        // Orders the registration before the recheck of the condition by the caller.
+        atomic_thread_fence(memory_order_seq_cst);
+        return m_key.load(memory_order_relaxed);
+    }
+
+    void cancel_wait() { m_waiters.fetch_sub(1, memory_order_relaxed); }
+
+    void wait(boost::uint32_t key) {
+#if defined(__linux__)
+        BOOST_STATIC_ASSERT(sizeof(m_key) == sizeof(boost::uint32_t));
+        ::syscall(SYS_futex, reinterpret_cast<boost::uint32_t*>(&m_key), FUTEX_WAIT_PRIVATE, key, 0, 0, 0);
+#else
+        for (unsigned int k = 0; m_key.load(memory_order_relaxed) == key; ++k)
+            boost::detail::yield(k);
+#endif
+        m_waiters.fetch_sub(1, memory_order_relaxed);
+    }
+
+    void notify(std::size_t count) {
+        // Orders the change of the condition by the caller before the check of waiters.
+        atomic_thread_fence(memory_order_seq_cst);
+        if (m_waiters.load(memory_order_relaxed) == 0)
+            return;
+        m_key.fetch_add(1, memory_order_relaxed);
+#if defined(__linux__)
+        ::syscall(SYS_futex, reinterpret_cast<boost::uint32_t*>(&m_key), FUTEX_WAKE_PRIVATE,
+            count < std::size_t(INT_MAX) ? int(count) : INT_MAX, 0, 0, 0);
+#else
+        (void)count;
+#endif
+    }
+
+private:
+    event_count(const event_count&);              // Disabled copy constructor
+    event_count& operator = (const event_count&); // Disabled assign operator
+
+    boost::atomic<boost::uint32_t> m_key;
+    boost::atomic<boost::uint32_t> m_waiters;
+};
+
+} // namespace cb_details
+
+/*!
+    \class circular_buffer_spsc
+    \brief Lock-free circular buffer for one producer thread and one consumer thread.
+    \tparam T The type of the elements stored in the <code>circular_buffer_spsc</code>.
+    \tparam Alloc The allocator type used for the internal buffer.
+
+    The producer inserts elements at the back with <code>try_push_back()</code> or <code>push_back()</code> and the
+    consumer removes them from the front with <code>try_pop_front()</code> or <code>pop_front()</code>. Neither
+    operation locks: each thread only writes its own position and reads the position of the other thread.
+
+    The consumer can also process the stored elements in place: <code>array_one()</code> and
+    <code>array_two()</code> return the elements available for reading as at most two continuous arrays and
+    <code>erase_begin(size_type)</code> removes the processed elements, making room for the producer.
+
+    The capacity is fixed at construction. Blocking operations spin and then yield the processor while the
+    buffer is full or empty; use <code>circular_buffer_mpmc</code> if threads should sleep instead.
+*/
+template <class T, class Alloc>
+class circular_buffer_spsc
+{
+public:
+// Basic types
+
+    //! The type of this <code>circular_buffer_spsc</code>.
+    typedef circular_buffer_spsc<T, Alloc> this_type;
+
+    //! The type of elements stored in the <code>circular_buffer_spsc</code>.
+    typedef typename Alloc::value_type value_type;
+
+    //! A pointer to an element.
+    typedef typename Alloc::pointer pointer;
+
+    //! A const pointer to the element.
+    typedef typename Alloc::const_pointer const_pointer;
+
+    //! The size type.
+    typedef typename Alloc::size_type size_type;
+
+    //! The type of an allocator used in the <code>circular_buffer_spsc</code>.
+    typedef Alloc allocator_type;
+
+    //! An array range (a pointer to the first element and the number of elements).
+    typedef std::pair<pointer, size_type> array_range;
+
+    //! A type representing the "best" way to pass the value_type to a method.
+    typedef const value_type& param_value_type;
+
+    //! A type representing rvalue from param type.
+    typedef BOOST_RV_REF(value_type) rvalue_type;
+
+private:
+    BOOST_STATIC_ASSERT(sizeof(size_type) <= sizeof(std::size_t));
+
+// Member variables
+
+    //! The internal buffer, with one more slot than the capacity.
+    pointer m_buff;
+
+    //! The number of slots of the internal buffer.
+    size_type m_slots;
+
+    //! The allocator.
+    allocator_type m_alloc;
+
+    char m_pad0[cb_details::cache_line_size];
+
+    //! Index of the slot where the producer inserts the next element.
+    boost::atomic<size_type> m_tail;
+
+    //! Producer's copy of <code>m_head</code>, refreshed only when the buffer seems full.
+    size_type m_head_cache;
+
+    char m_pad1[cb_details::cache_line_size];
+
+    //! Index of the slot of the first element.
+    boost::atomic<size_type> m_head;
+
+    //! Consumer's copy of <code>m_tail</code>, refreshed by <code>array_one()</code> and when the buffer seems empty.
+    size_type m_tail_cache;
+
+    char m_pad2[cb_details::cache_line_size];
+
+public:
+// Construction/Destruction
+
+    //! Create an empty <code>circular_buffer_spsc</code> with the specified capacity.
+    /*!
+        \post <code>capacity() == buffer_capacity \&\& size() == 0</code>
+        \param buffer_capacity The maximum number of elements which can be stored in the buffer.
+        \param alloc The allocator.
+        \throws An allocation error if memory is exhausted (<code>std::bad_alloc</code> if the standard allocator is
+                used).
+        \throws std::length_error if <code>buffer_capacity</code> is too big.
+    */
+    explicit circular_buffer_spsc(size_type buffer_capacity, const allocator_type& alloc = allocator_type())
+    : m_buff(0), m_slots(buffer_capacity + 1), m_alloc(alloc), m_tail(0), m_head_cache(0), m_head(0), m_tail_cache(0) {
+        if (buffer_capacity >= m_alloc.max_size())
+            throw_exception(std::length_error("circular_buffer_spsc"));
+        m_buff = m_alloc.allocate(m_slots, 0);
+    }
+
+    //! The destructor.
+    /*!
+        Destroys the stored elements. No other thread may access the buffer.
+    */
+    ~circular_buffer_spsc() {
+        erase_begin(size());
+        m_alloc.deallocate(m_buff, m_slots);
+    }
+
+// Size and capacity
+
+    //! Get the capacity of the <code>circular_buffer_spsc</code>.
+    size_type capacity() const { return m_slots - 1; }
+
+    //! Get the number of elements stored in the <code>circular_buffer_spsc</code>.
+    /*!
+        \return The exact number of elements if called by the producer or by the consumer while the other thread does
+                not access the buffer; a value that was true at some point of the call otherwise.
+    */
+    size_type size() const {
+        const size_type head = m_head.load(memory_order_acquire);
+        const size_type tail = m_tail.load(memory_order_acquire);
+        return tail >= head ? tail - head : tail + m_slots - head;
+    }
+
+    //! Is the <code>circular_buffer_spsc</code> empty?
+    bool empty() const { return size() == 0; }
+
+    //! Is the <code>circular_buffer_spsc</code> full?
+    bool full() const { return size() == capacity(); }
+
+    //! Get the allocator.
+    allocator_type get_allocator() const { return m_alloc; }
+
+// Producer operations
+
+    //! Insert a new element at the end if there is room for it.
+    /*!
+        Must be called only from the producer thread.
+        \return <code>false</code> if the buffer is full, <code>true</code> otherwise.
+        \throws Whatever <code>T::T(const T&)</code> throws; the buffer is not changed in that case.
+        \par Complexity
+             Constant.
+    */
+    bool try_push_back(param_value_type item) { return try_push_back_impl<param_value_type>(item); }
+
+    //! Insert a new element at the end if there is room for it.
+    /*!
+        Must be called only from the producer thread. <code>item</code> is moved only if it is inserted.
+        \return <code>false</code> if the buffer is full, <code>true</code> otherwise.
+        \throws Whatever <code>T::T(T&&)</code> throws; the buffer is not changed in that case.
+    */
+    bool try_push_back(rvalue_type item) { return try_push_back_impl<rvalue_type>(boost::move(item)); }
+
+    //! Insert a new element at the end, waiting while the buffer is full.
+    /*!
+        Must be called only from the producer thread.
+        \throws Whatever <code>T::T(const T&)</code> throws.
+    */
+    void push_back(param_value_type item) {
+        for (unsigned int k = 0; !try_push_back_impl<param_value_type>(item); ++k)
+            boost::detail::yield(k);
+    }
+
+    //! Insert a new element at the end, waiting while the buffer is full.
+    /*!
+        Must be called only from the producer thread.
+        \throws Whatever <code>T::T(T&&)</code> throws.
+    */
+    void push_back(rvalue_type item) {
+        for (unsigned int k = 0; !try_push_back_impl<rvalue_type>(boost::move(item)); ++k)
+            boost::detail::yield(k);
+    }
+
+// Consumer operations
+
+    //! Remove the first element if there is one.
+    /*!
+        Must be called only from the consumer thread.
+        \param item The removed element is move assigned to <code>item</code>.
+        \return <code>false</code> if the buffer is empty, <code>true</code> otherwise.
+        \throws Whatever <code>T::operator = (T&&)</code> throws; the element is not removed in that case.
+    */
+    bool try_pop_front(value_type& item) {
+        const size_type head = m_head.load(memory_order_relaxed);
+        if (head == m_tail_cache) {
+            m_tail_cache = m_tail.load(memory_order_acquire);
+            if (head == m_tail_cache)
+                return false;
+        }
+        item = boost::move(m_buff[head]);
+        erase_begin(1);
+        return true;
+    }
+
+    //! Remove the first element, waiting while the buffer is empty.
+    /*!
+        Must be called only from the consumer thread.
+        \param item The removed element is move assigned to <code>item</code>.
+        \throws Whatever <code>T::operator = (T&&)</code> throws; the element is not removed in that case.
+    */
+    void pop_front(value_type& item) {
+        for (unsigned int k = 0; !try_pop_front(item); ++k)
+            boost::detail::yield(k);
+    }
+
+    //! Get the first continuous array of the elements available for the consumer.
+    /*!
+        Must be called only from the consumer thread. Together with <code>array_two()</code> and
+        <code>erase_begin(size_type)</code> it lets the consumer process elements in place:<br><br>
+        <code>array_range ar = buff.array_one();<br>
+        process(ar.first, ar.second);<br>
+        buff.erase_begin(ar.second);</code><br><br>
+        The arrays stay valid until the elements are erased; the producer keeps inserting elements behind them.
+        \return The array range of the first continuous array, with size <code>0</code> if the buffer is empty.
+        \par Complexity
+             Constant.
+        \sa <code>array_two()</code>, <code>erase_begin(size_type)</code>
+    */
+    array_range array_one() {
+        const size_type head = m_head.load(memory_order_relaxed);
+        const size_type tail = m_tail_cache = m_tail.load(memory_order_acquire);
+        return array_range(m_buff + head, (tail >= head ? tail : m_slots) - head);
+    }
+
+    //! Get the second continuous array of the elements available for the consumer.
+    /*!
+        Must be called only from the consumer thread, after <code>array_one()</code>. The array follows the one
+        returned by <code>array_one()</code> if the available elements wrap around the end of the internal buffer.
+        \return The array range of the second continuous array, with size <code>0</code> if the available elements
+                are continuous.
+        \par Complexity
+             Constant.
+        \sa <code>array_one()</code>
+    */
+    array_range array_two() {
+        // Uses the position of the producer seen by array_one() so that both arrays are consecutive
+        const size_type head = m_head.load(memory_order_relaxed);
+        return array_range(m_buff, m_tail_cache < head ? m_tail_cache : 0);
+    }
+
+    //! Remove first <code>n</code> elements, making room for the producer.
+    /*!
+        Must be called only from the consumer thread.
+        \pre <code>n</code> is not greater than the number of elements returned by the last calls to
+             <code>array_one()</code> and <code>array_two()</code>.
+        \par Complexity
+             Constant for scalar types; linear (in <code>n</code>) for other types.
+    */
+    void erase_begin(size_type n) {
+        const size_type head = m_head.load(memory_order_relaxed);
+        BOOST_ASSERT(n <= size());
+        destroy(head, n, is_scalar<value_type>());
+        const size_type next = head + n;
+        m_head.store(next >= m_slots ? next - m_slots : next, memory_order_release);
+    }
+
+private:
+    circular_buffer_spsc(const circular_buffer_spsc&);              // Disabled copy constructor
+    circular_buffer_spsc& operator = (const circular_buffer_spsc&); // Disabled assign operator
+
+// Helper methods
+
+    template <class ValT>
+    bool try_push_back_impl(ValT item) {
+        const size_type tail = m_tail.load(memory_order_relaxed);
+        const size_type next = tail + 1 == m_slots ? 0 : tail + 1;
+        if (next == m_head_cache) {
+            m_head_cache = m_head.load(memory_order_acquire);
+            if (next == m_head_cache)
+                return false;
+        }
+        ::new (m_buff + tail) value_type(static_cast<ValT>(item));
+        m_tail.store(next, memory_order_release);
+        return true;
+    }
+
+    void destroy(size_type, size_type, const true_type&) {}
+
+    void destroy(size_type index, size_type n, const false_type&) {
+        for (; n > 0; --n) {
+            m_alloc.destroy(m_buff + index);
+            if (++index == m_slots)
+                index = 0;
+        }
+    }
+};
+
+/*!
+    \class circular_buffer_mpmc
+    \brief Circular buffer for several producer threads and several consumer threads.
+    \tparam T The type of the elements stored in the <code>circular_buffer_mpmc</code>.
+    \par Type Requirements T
+         The move constructor of <code>T</code> must not throw: either
+         <code>boost::is_nothrow_move_constructible<T></code> or <code>boost::has_nothrow_move<T></code> must be
+         true (the latter can be specialized for types that cannot declare <code>noexcept</code>). This is checked
+         at compile time, since an element is constructed in a slot after claiming it, when the slot cannot be
+         given back any more.
+    \tparam Alloc The allocator type used for the internal buffer.
+
+    Each slot of the buffer carries a sequence number telling whether it is free or holds an element that has
+    been published. Producers claim a slot at the back and consumers claim elements at the front with a single
+    compare-and-swap each, so threads only contend when they access the same end of the buffer at the same time.
+
+    Blocking operations sleep while the buffer is full or empty (on a futex in Linux) and are woken by the thread
+    that makes room or inserts an element. A thread that does not have to wake anybody makes no system call.
+
+    Consumers can also claim several elements at once with <code>try_acquire_front(size_type)</code>, process
+    them in place through the <code>array_one()</code> and <code>array_two()</code> methods of the returned
+    <code>batch</code> and give the slots back to the producers with <code>release(batch&)</code>.
+*/
+template <class T, class Alloc>
+class circular_buffer_mpmc
+{
+public:
+// Basic types
+
+    //! The type of this <code>circular_buffer_mpmc</code>.
+    typedef circular_buffer_mpmc<T, Alloc> this_type;
+
+    //! The type of elements stored in the <code>circular_buffer_mpmc</code>.
+    typedef typename Alloc::value_type value_type;
+
+    //! A pointer to an element.
+    typedef typename Alloc::pointer pointer;
+
+    //! A const pointer to the element.
+    typedef typename Alloc::const_pointer const_pointer;
+
+    //! The size type.
+    typedef typename Alloc::size_type size_type;
+
+    //! The type of an allocator used in the <code>circular_buffer_mpmc</code>.
+    typedef Alloc allocator_type;
+
+    //! An array range (a pointer to the first element and the number of elements).
+    typedef std::pair<pointer, size_type> array_range;
+
+    //! A type representing the "best" way to pass the value_type to a method.
+    typedef const value_type& param_value_type;
+
+    //! A type representing rvalue from param type.
+    typedef BOOST_RV_REF(value_type) rvalue_type;
+
+    /*!
+        \class batch
+        \brief Elements claimed by a consumer with <code>try_acquire_front(size_type)</code>.
+
+        The elements belong to the consumer until the batch is passed to <code>release(batch&)</code>.
+    */
+    class batch {
+    public:
+        //! Create an empty batch.
+        batch() : m_buff(0), m_capacity(0), m_position(0), m_index(0), m_size(0) {}
+
+        //! Get the number of elements of the batch.
+        size_type size() const { return m_size; }
+
+        //! Is the batch empty?
+        bool empty() const { return m_size == 0; }
+
+        //! Get the first continuous array of the elements of the batch.
+        array_range array_one() const {
+            return array_range(m_buff + m_index, m_size < m_capacity - m_index ? m_size : m_capacity - m_index);
+        }
+
+        //! Get the second continuous array of the elements of the batch (empty if they do not wrap around).
+        array_range array_two() const {
+            return array_range(m_buff, m_size - array_one().second);
+        }
+
+    private:
+        friend class circular_buffer_mpmc;
+
+        batch(pointer buff, size_type capacity, size_type position, size_type index, size_type n)
+        : m_buff(buff), m_capacity(capacity), m_position(position), m_index(index), m_size(n) {}
+
+        pointer m_buff;
+        size_type m_capacity;
+        size_type m_position;
+        size_type m_index;
+        size_type m_size;
+    };
+
+private:
+    BOOST_STATIC_ASSERT(sizeof(size_type) <= sizeof(std::size_t));
+    // Elements are moved into slots already claimed (see try_push_back_impl())
+    BOOST_STATIC_ASSERT((is_nothrow_move_constructible<value_type>::value || has_nothrow_move<value_type>::value));
+
+    typedef boost::atomic<size_type> sequence_type;
+    typedef typename Alloc::template rebind<sequence_type>::other sequence_allocator;
+
+// Member variables
+
+    //! The internal buffer.
+    pointer m_buff;
+
+    //! The sequence number of each slot of the internal buffer.
+    sequence_type* m_sequences;
+
+    //! The capacity.
+    size_type m_capacity;
+
+    //! Positions are counted modulo this multiple of the capacity.
+    size_type m_positions;
+
+    //! The allocator.
+    allocator_type m_alloc;
+
+    char m_pad0[cb_details::cache_line_size];
+
+    //! Position of the next slot to be claimed by a producer.
+    boost::atomic<size_type> m_tail;
+
+    char m_pad1[cb_details::cache_line_size];
+
+    //! Position of the next element to be claimed by a consumer.
+    boost::atomic<size_type> m_head;
+
+    char m_pad2[cb_details::cache_line_size];
+
+    //! Consumers waiting for elements.
+    cb_details::event_count m_not_empty;
+
+    //! Producers waiting for free slots.
+    cb_details::event_count m_not_full;
+
+public:
+// Construction/Destruction
+
+    //! Create an empty <code>circular_buffer_mpmc</code> with the specified capacity.
+    /*!
+        \pre <code>buffer_capacity > 1</code>
+        \post <code>capacity() == buffer_capacity \&\& size() == 0</code>
+        \param buffer_capacity The maximum number of elements which can be stored in the buffer.
+        \param alloc The allocator.
+        \throws An allocation error if memory is exhausted (<code>std::bad_alloc</code> if the standard allocator is
+                used).
+        \throws std::length_error if <code>buffer_capacity</code> is too big.
+    */
+    explicit circular_buffer_mpmc(size_type buffer_capacity, const allocator_type& alloc = allocator_type())
+    : m_buff(0), m_sequences(0), m_capacity(buffer_capacity), m_positions(0), m_alloc(alloc), m_tail(0), m_head(0) {
+        // With a single slot a published element could not be told apart from a free slot
+        BOOST_ASSERT(buffer_capacity > 1);
+        // Producers and consumers must tell positions of consecutive laps apart
+        const size_type max_positions = (std::numeric_limits<size_type>::max)() / 2;
+        if (buffer_capacity > max_positions / 2 || buffer_capacity > m_alloc.max_size())
+            throw_exception(std::length_error("circular_buffer_mpmc"));
+        m_positions = max_positions - max_positions % buffer_capacity;
+        sequence_allocator seq_alloc(m_alloc);
+        m_sequences = seq_alloc.allocate(buffer_capacity, 0);
+        for (size_type i = 0; i < buffer_capacity; ++i)
+            ::new (m_sequences + i) sequence_type(i);
+        BOOST_TRY {
+            m_buff = m_alloc.allocate(buffer_capacity, 0);
+        } BOOST_CATCH(...) {
+            seq_alloc.deallocate(m_sequences, buffer_capacity);
+            BOOST_RETHROW
+        }
+        BOOST_CATCH_END
+    }
+
+    //! The destructor.
+    /*!
+        Destroys the stored elements. No other thread may access the buffer.
+    */
+    ~circular_buffer_mpmc() {
+        for (batch b = try_acquire_front(m_capacity); !b.empty(); b = try_acquire_front(m_capacity))
+            release(b);
+        m_alloc.deallocate(m_buff, m_capacity);
+        sequence_allocator(m_alloc).deallocate(m_sequences, m_capacity);
+    }
+
+// Size and capacity
+
+    //! Get the capacity of the <code>circular_buffer_mpmc</code>.
+    size_type capacity() const { return m_capacity; }
+
+    //! Get the number of slots claimed by producers and not yet released by consumers.
+    /*!
+        \return The exact number of elements if no other thread accesses the buffer; a value that was true at some
+                point of the call otherwise.
+    */
+    size_type size() const {
+        const size_type head = m_head.load(memory_order_acquire);
+        const size_type tail = m_tail.load(memory_order_acquire);
+        const size_type n = tail >= head ? tail - head : tail + m_positions - head;
+        return n < m_capacity ? n : m_capacity;
+    }
+
+    //! Is the <code>circular_buffer_mpmc</code> empty?
+    bool empty() const { return size() == 0; }
+
+    //! Is the <code>circular_buffer_mpmc</code> full?
+    bool full() const { return size() == capacity(); }
+
+    //! Get the allocator.
+    allocator_type get_allocator() const { return m_alloc; }
+
+// Producer operations
+
+    //! Insert a new element at the end if there is room for it.
+    /*!
+        \return <code>false</code> if the buffer is full, <code>true</code> otherwise.
+        \throws Whatever <code>T::T(const T&)</code> throws; the buffer is not changed in that case.
+    */
+    bool try_push_back(param_value_type item) { return try_push_back_copy(item, has_nothrow_copy<value_type>()); }
+
+    //! Insert a new element at the end if there is room for it.
+    /*!
+        <code>item</code> is moved only if it is inserted.
+        \return <code>false</code> if the buffer is full, <code>true</code> otherwise.
+        \throws Nothing.
+    */
+    bool try_push_back(rvalue_type item) { return try_push_back_impl<rvalue_type>(boost::move(item)); }
+
+    //! Insert a new element at the end, waiting while the buffer is full.
+    /*!
+        \throws Whatever <code>T::T(const T&)</code> throws; the buffer is not changed in that case.
+    */
+    void push_back(param_value_type item) { push_back_copy(item, has_nothrow_copy<value_type>()); }
+
+    //! Insert a new element at the end, waiting while the buffer is full.
+    void push_back(rvalue_type item) { push_back_impl<rvalue_type>(boost::move(item)); }
+
+// Consumer operations
+
+    //! Claim up to <code>max_count</code> elements from the front.
+    /*!
+        The claimed elements stay in the buffer and can be processed in place; they must be given back with
+        <code>release(batch&)</code>. Elements inserted by producers that have not finished yet are not claimed.
+        \pre <code>max_count > 0</code>
+        \return A batch with at least one element, or an empty batch if there are no elements.
+    */
+    batch try_acquire_front(size_type max_count) {
+        BOOST_ASSERT(max_count > 0);
+        size_type head = m_head.load(memory_order_relaxed);
+        for (;;) {
+            const size_type index = head % m_capacity;
+            const size_type sequence = m_sequences[index].load(memory_order_acquire);
+            if (sequence == add(head, 1)) {
+                // Count the published elements that follow
+                size_type n = 1;
+                for (size_type i = index; n < max_count && n < m_capacity; ++n) {
+                    if (++i == m_capacity)
+                        i = 0;
+                    if (m_sequences[i].load(memory_order_acquire) != add(head, n + 1))
+                        break;
+                }
+                if (m_head.compare_exchange_weak(head, add(head, n), memory_order_relaxed))
+                    return batch(m_buff, m_capacity, head, index, n);
+            } else if (is_empty_slot(sequence, head)) {
+                return batch();
+            } else {
+                head = m_head.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    //! Claim up to <code>max_count</code> elements from the front, waiting while the buffer is empty.
+    /*!
+        \pre <code>max_count > 0</code>
+        \return A batch with at least one element.
+        \sa <code>try_acquire_front(size_type)</code>
+    */
+    batch acquire_front(size_type max_count) {
+        for (unsigned int k = 0;; ++k) {
+            batch b = try_acquire_front(max_count);
+            if (!b.empty())
+                return b;
+            if (k < cb_details::spin_count) {
+                boost::detail::yield(k);
+                continue;
+            }
+            const boost::uint32_t key = m_not_empty.prepare_wait();
+            if (!is_front_published()) {
+                m_not_empty.wait(key);
+            } else {
+                m_not_empty.cancel_wait();
+            }
+        }
+    }
+
+    //! Destroy the elements of a batch and give their slots back to the producers.
+    /*!
+        \post <code>b.empty()</code>
+    */
+    void release(batch& b) {
+        size_type position = b.m_position;
+        size_type index = b.m_index;
+        for (size_type n = b.m_size; n > 0; --n) {
+            destroy(m_buff + index, is_scalar<value_type>());
+            m_sequences[index].store(add(position, m_capacity), memory_order_release);
+            position = add(position, 1);
+            if (++index == m_capacity)
+                index = 0;
+        }
+        if (b.m_size > 0)
+            m_not_full.notify(b.m_size);
+        b = batch();
+    }
+
+    //! Remove the first element if there is one.
+    /*!
+        \param item The removed element is move assigned to <code>item</code>.
+        \return <code>false</code> if the buffer is empty, <code>true</code> otherwise.
+        \throws Whatever <code>T::operator = (T&&)</code> throws; the element is removed anyway.
+    */
+    bool try_pop_front(value_type& item) {
+        batch b = try_acquire_front(1);
+        if (b.empty())
+            return false;
+        pop_batch(b, item);
+        return true;
+    }
+
+    //! Remove the first element, waiting while the buffer is empty.
+    /*!
+        \param item The removed element is move assigned to <code>item</code>.
+        \throws Whatever <code>T::operator = (T&&)</code> throws; the element is removed anyway.
+    */
+    void pop_front(value_type& item) {
+        batch b = acquire_front(1);
+        pop_batch(b, item);
+    }
+
+private:
+    circular_buffer_mpmc(const circular_buffer_mpmc&);              // Disabled copy constructor
+    circular_buffer_mpmc& operator = (const circular_buffer_mpmc&); // Disabled assign operator
+
+// Helper methods
+
+    //! Add <code>n</code> to a position.
+    size_type add(size_type position, size_type n) const {
+        return n < m_positions - position ? position + n : position + n - m_positions;
+    }
+
+    //! Is the slot for <code>position</code> not free for a producer?
+    /*!
+        The slot is still used by the element of the previous lap, being constructed by a producer, published or
+        claimed by a consumer that has not released it.
+    */
+    bool is_full_slot(size_type sequence, size_type position) const {
+        const size_type previous_lap = add(sequence, m_capacity);
+        return previous_lap == position || previous_lap == add(position, 1);
+    }
+
+    //! Is the slot at the back free (or claimed by other producer)?
+    bool is_back_free() const {
+        const size_type tail = m_tail.load(memory_order_relaxed);
+        return !is_full_slot(m_sequences[tail % m_capacity].load(memory_order_acquire), tail);
+    }
+
+    //! Is there no element at <code>position</code> for a consumer?
+    /*!
+        Either the element has not been published yet or the slot still holds the element of the previous lap,
+        claimed by a consumer that has not released it.
+    */
+    bool is_empty_slot(size_type sequence, size_type position) const {
+        return sequence == position || add(sequence, m_capacity) == add(position, 1);
+    }
+
+    //! Has the element at the front been published (or claimed by other consumer)?
+    bool is_front_published() const {
+        const size_type head = m_head.load(memory_order_relaxed);
+        return !is_empty_slot(m_sequences[head % m_capacity].load(memory_order_acquire), head);
+    }
+
+    //! Claim the slot at the back and construct an element in it.
+    template <class ValT>
+    bool try_push_back_impl(ValT item) {
+        size_type tail = m_tail.load(memory_order_relaxed);
+        for (;;) {
+            const size_type index = tail % m_capacity;
+            const size_type sequence = m_sequences[index].load(memory_order_acquire);
+            if (sequence == tail) {
+                if (m_tail.compare_exchange_weak(tail, add(tail, 1), memory_order_relaxed)) {
+                    // The slot is claimed and cannot be given back, so construction must not fail: ValT is
+                    // either an rvalue (moved) or a reference the copy constructor of which does not throw
+                    construct(m_buff + index, static_cast<ValT>(item));
+                    m_sequences[index].store(add(tail, 1), memory_order_release);
+                    m_not_empty.notify(1);
+                    return true;
+                }
+            } else if (is_full_slot(sequence, tail)) {
+                return false;
+            } else {
+                tail = m_tail.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    //! Insert an element, sleeping while the buffer is full.
+    template <class ValT>
+    void push_back_impl(ValT item) {
+        for (unsigned int k = 0; !try_push_back_impl<ValT>(static_cast<ValT>(item)); ++k) {
+            if (k < cb_details::spin_count) {
+                boost::detail::yield(k);
+                continue;
+            }
+            const boost::uint32_t key = m_not_full.prepare_wait();
+            if (!is_back_free()) {
+                m_not_full.wait(key);
+            } else {
+                m_not_full.cancel_wait();
+            }
+        }
+    }
+
+    bool try_push_back_copy(param_value_type item, const true_type&) {
+        return try_push_back_impl<param_value_type>(item);
+    }
+
+    bool try_push_back_copy(param_value_type item, const false_type&) {
+        if (full())
+            return false;
+        // Copy before claiming a slot as the copy constructor may throw
+        value_type tmp(item);
+        return try_push_back_impl<movable_ref>(movable_ref(tmp));
+    }
+
+    void push_back_copy(param_value_type item, const true_type&) {
+        push_back_impl<param_value_type>(item);
+    }
+
+    void push_back_copy(param_value_type item, const false_type&) {
+        // Copy before claiming a slot as the copy constructor may throw
+        value_type tmp(item);
+        push_back_impl<movable_ref>(movable_ref(tmp));
+    }
+
+    void pop_batch(batch& b, value_type& item) {
+        BOOST_TRY {
+            item = boost::move(*b.array_one().first);
+        } BOOST_CATCH(...) {
+            release(b);
+            BOOST_RETHROW
+        }
+        BOOST_CATCH_END
+        release(b);
+    }
+
+    //! An element that can be moved into the buffer.
+    struct movable_ref {
+        explicit movable_ref(value_type& item) : m_item(item) {}
+        value_type& m_item;
+    };
+
+    void construct(pointer p, param_value_type item) { ::new (p) value_type(item); }
+
+    void construct(pointer p, rvalue_type item) { ::new (p) value_type(boost::move(item)); }
+
+    void construct(pointer p, const movable_ref& item) { ::new (p) value_type(boost::move(item.m_item)); }
+
+    void destroy(pointer, const true_type&) {}
+
+    void destroy(pointer p, const false_type&) { m_alloc.destroy(p); }
+};
+
+} // namespace boost
+
+#endif // #if !defined(BOOST_CIRCULAR_BUFFER_CONCURRENT_HPP)
@@ -1,4 +1,4 @@
-// Forward declaration of the circular buffer and its adaptor.
+// Forward declaration of the circular buffer, its adaptor and its concurrent variants.
 
 // Copyright (c) 2003-2008 Jan Gaspar
 
@@ -36,6 +36,12 @@ class circular_buffer;
 template <class T, class Alloc = BOOST_CB_DEFAULT_ALLOCATOR(T)>
 class circular_buffer_space_optimized;
 
+template <class T, class Alloc = BOOST_CB_DEFAULT_ALLOCATOR(T)>
+class circular_buffer_spsc;
+
+template <class T, class Alloc = BOOST_CB_DEFAULT_ALLOCATOR(T)>
+class circular_buffer_mpmc;
+
 #undef BOOST_CB_DEFAULT_ALLOCATOR
 
 } // namespace boost
@@ -0,0 +1,18 @@
+
+// Copyright (C) 2026 agent <agent@local>.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org/libs/unordered for documentation
+
+#ifndef BOOST_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
+#define BOOST_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/concurrent_unordered_map.hpp>
+
+#endif // BOOST_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
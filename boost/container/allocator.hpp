@@ -0,0 +1,309 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_ALLOCATOR_HPP
+#define BOOST_CONTAINER_ALLOCATOR_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/multiallocation_chain.hpp>
+#include <boost/container/detail/version_type.hpp>
+#include <boost/container/detail/utilities.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/smart_ptr/detail/atomic_count.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/type_with_alignment.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+//!\file
+//!Describes an allocator that obtains the nodes of node-based containers in bursts.
+
+namespace boost {
+namespace container {
+
+/// @cond
+
+namespace container_detail {
+
+//Nodes obtained in a burst are placed in a single memory block that starts with
+//a count of live nodes. Each node is preceded by a pointer to the start of its
+//block, so that nodes can be individually deallocated in any order: the
+//block is returned to the system when its last node is deallocated.
+template<class T>
+struct burst_allocator_impl
+{
+   typedef boost::detail::atomic_count counter_t;
+
+   static const std::size_t ValueAlign = boost::alignment_of<T>::value;
+   static const std::size_t Alignment =
+      ValueAlign > boost::alignment_of<void*>::value ? ValueAlign : boost::alignment_of<void*>::value;
+   //Free nodes are linked through their storage in multiallocation chains
+   static const std::size_t PayloadSize =
+      ct_rounded_size<(sizeof(T) > sizeof(void*) ? sizeof(T) : sizeof(void*)), Alignment>::value;
+   static const std::size_t PrefixSize = ct_rounded_size<sizeof(counter_t*), Alignment>::value;
+   static const std::size_t HeaderSize = ct_rounded_size<sizeof(counter_t), Alignment>::value;
+   static const std::size_t SlotSize   = PrefixSize + PayloadSize;
+   //Bigger bursts are split so that a few live nodes don't retain
+   //big blocks of memory
+   static const std::size_t MaxBurstBytes = 16384u;
+   static const std::size_t MaxBurst = MaxBurstBytes/SlotSize ? MaxBurstBytes/SlotSize : 1u;
+
+   //Blocks are obtained from ::operator new
+   BOOST_STATIC_ASSERT((Alignment <= boost::alignment_of<boost::detail::max_align>::value));
+
+   //Allocates "n" nodes in a single block. Calls "push(void*)" for each node.
+   template<class Push>
+   static void allocate_burst(std::size_t n, Push push)
+   {
+      char *const block = static_cast<char*>(::operator new(HeaderSize + n*SlotSize));
+      counter_t *const counter = ::new(block) counter_t(static_cast<long>(n));
+      char *slot = block + HeaderSize;
+      for(std::size_t i = 0; i != n; ++i, slot += SlotSize){
+         *reinterpret_cast<counter_t**>(slot + PrefixSize - sizeof(counter_t*)) = counter;
+         push(static_cast<void*>(slot + PrefixSize));
+      }
+   }
+
+   static void *allocate_one()
+   {
+      void *ret = 0;
+      allocate_burst(1u, single_push(ret));
+      return ret;
+   }
+
+   static void deallocate_one(void *p)
+   {
+      counter_t *const counter =
+         *reinterpret_cast<counter_t**>(static_cast<char*>(p) - sizeof(counter_t*));
+      if(--*counter == 0){
+         counter->~counter_t();
+         ::operator delete(static_cast<void*>(counter));
+      }
+   }
+
+   private:
+   struct single_push
+   {
+      explicit single_push(void *&r) : m_r(r) {}
+      void operator()(void *p) const { m_r = p; }
+      void *&m_r;
+   };
+};
+
+}  //namespace container_detail {
+
+/// @endcond
+
+//! This class is an extended STL-compatible allocator that offers, with Version 2,
+//! the node allocation interface used by node-based containers (list, slist, set,
+//! multiset, map, multimap and stable_vector) to allocate many nodes in a single call.
+//!
+//! When a container is range constructed, range assigned or a range is inserted,
+//! all the nodes are obtained in bursts: each burst places nodes contiguously in a
+//! single memory block, improving locality and dividing the number of calls to the
+//! system allocator by the number of nodes in the burst. Nodes can be deallocated in
+//! any order and a block is returned to the system when all its nodes are deallocated.
+//!
+//! Arrays (e.g. the buffer of a vector or string) are allocated with ::operator new.
+//!
+//! All instances are equal and nodes can be deallocated by any of them.
+//! With Version 1 the allocator behaves like std::allocator.
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+template<class T, unsigned Version = 2>
+#else
+template<class T, unsigned Version>
+#endif
+class allocator
+{
+   /// @cond
+   typedef unsigned int allocation_type;
+   typedef container_detail::burst_allocator_impl<T>   burst_impl;
+
+   BOOST_STATIC_ASSERT((Version == 1 || Version == 2));
+   /// @endcond
+
+   public:
+   typedef T                                    value_type;
+   typedef T *                                  pointer;
+   typedef const T *                            const_pointer;
+   typedef typename container_detail::
+      add_reference<T>::type                    reference;
+   typedef typename container_detail::
+      add_reference<const T>::type              const_reference;
+   typedef std::size_t                          size_type;
+   typedef std::ptrdiff_t                       difference_type;
+
+   typedef container_detail::version_type<allocator, Version>  version;
+
+   /// @cond
+   typedef container_detail::basic_multiallocation_chain<void*>     void_multiallocation_chain;
+   /// @endcond
+
+   typedef container_detail::transform_multiallocation_chain
+      <void_multiallocation_chain, T>           multiallocation_chain;
+
+   //!Obtains an allocator that allocates
+   //!objects of type T2
+   template<class T2>
+   struct rebind
+   {
+      typedef allocator<T2, Version> other;
+   };
+
+   //!Default constructor
+   //!Never throws
+   allocator() BOOST_CONTAINER_NOEXCEPT
+   {}
+
+   //!Constructor from other allocator.
+   //!Never throws
+   allocator(const allocator &) BOOST_CONTAINER_NOEXCEPT
+   {}
+
+   //!Constructor from related allocator.
+   //!Never throws
+   template<class T2>
+   allocator(const allocator<T2, Version> &) BOOST_CONTAINER_NOEXCEPT
+   {}
+
+   //!Allocates memory for an array of count elements.
+   //!Throws std::bad_alloc if there is no enough memory
+   pointer allocate(size_type count, const void * = 0)
+   {
+      if(count > this->max_size())
+         boost::container::throw_bad_alloc();
+      return static_cast<pointer>(::operator new(count*sizeof(T)));
+   }
+
+   //!Deallocates previously allocated memory.
+   //!Never throws
+   void deallocate(const pointer &ptr, size_type) BOOST_CONTAINER_NOEXCEPT
+   {  ::operator delete(static_cast<void*>(ptr));  }
+
+   //!Returns the maximum number of elements that could be allocated.
+   //!Never throws
+   size_type max_size() const BOOST_CONTAINER_NOEXCEPT
+   {  return size_type(-1)/sizeof(T);  }
+
+   //!Swaps two allocators, does nothing
+   //!because this allocator is stateless
+   friend void swap(allocator &, allocator &) BOOST_CONTAINER_NOEXCEPT
+   {}
+
+   //!An allocator always compares to true, as memory allocated with one
+   //!instance can be deallocated by another instance
+   friend bool operator==(const allocator &, const allocator &) BOOST_CONTAINER_NOEXCEPT
+   {  return true;   }
+
+   //!An allocator always compares to false, as memory allocated with one
+   //!instance can be deallocated by another instance
+   friend bool operator!=(const allocator &, const allocator &) BOOST_CONTAINER_NOEXCEPT
+   {  return false;   }
+
+   //!An advanced function that offers in-place expansion shrink to fit and new allocation
+   //!capabilities. Memory allocated with this function can only be deallocated with deallocate().
+   //!Only new allocations are supported: if "command" does not contain allocate_new,
+   //!returns a null pointer (nothrow_allocation) or throws std::bad_alloc.
+   std::pair<pointer, bool>
+      allocation_command(allocation_type command,
+                         size_type limit_size,
+                         size_type preferred_size,
+                         size_type &received_size, pointer = pointer())
+   {
+      std::pair<pointer, bool> ret(pointer(), false);
+      if(command & allocate_new){
+         received_size = preferred_size;
+         if(preferred_size > this->max_size()){
+            received_size = limit_size;
+         }
+         if(received_size <= this->max_size()){
+            ret.first = static_cast<pointer>(::operator new(received_size*sizeof(T), std::nothrow));
+         }
+      }
+      if(!ret.first && !(command & nothrow_allocation)){
+         boost::container::throw_bad_alloc();
+      }
+      return ret;
+   }
+
+   //!Allocates just one object. Memory allocated with this function
+   //!must be deallocated only with deallocate_one().
+   //!Throws std::bad_alloc if there is no enough memory
+   pointer allocate_one()
+   {  return static_cast<pointer>(burst_impl::allocate_one());  }
+
+   //!Deallocates memory previously allocated with allocate_one().
+   //!You should never use deallocate_one to deallocate memory allocated
+   //!with other functions different from allocate_one() or allocate_individual().
+   //!Never throws
+   void deallocate_one(const pointer &p) BOOST_CONTAINER_NOEXCEPT
+   {  burst_impl::deallocate_one(p);  }
+
+   //!Allocates many elements of size == 1 in bursts of contiguous nodes.
+   //!Elements must be individually deallocated with deallocate_one() or
+   //!deallocate_individual().
+   //!Throws std::bad_alloc if there is no enough memory
+   void allocate_individual(std::size_t num_elements, multiallocation_chain &chain)
+   {
+      multiallocation_chain bursts;
+      BOOST_TRY{
+         while(num_elements){
+            const std::size_t n = num_elements < burst_impl::MaxBurst ? num_elements : burst_impl::MaxBurst;
+            burst_impl::allocate_burst(n, chain_push(bursts));
+            num_elements -= n;
+         }
+      }
+      BOOST_CATCH(...){
+         this->deallocate_individual(bursts);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      if(!bursts.empty()){
+         chain.splice_after(chain.last(), bursts, bursts.before_begin(), bursts.last(), bursts.size());
+      }
+   }
+
+   //!Deallocates memory allocated with allocate_one() or allocate_individual().
+   //!Never throws
+   void deallocate_individual(multiallocation_chain &chain) BOOST_CONTAINER_NOEXCEPT
+   {
+      while(!chain.empty()){
+         burst_impl::deallocate_one(chain.pop_front());
+      }
+   }
+
+   /// @cond
+   private:
+   struct chain_push
+   {
+      explicit chain_push(multiallocation_chain &c) : m_c(c) {}
+      void operator()(void *p) const { m_c.push_back(static_cast<pointer>(p)); }
+      multiallocation_chain &m_c;
+   };
+   /// @endcond
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_ALLOCATOR_HPP
@@ -32,6 +32,7 @@ namespace bi = boost::intrusive;
 
 }}}
 
+#include <cstddef>
 #include <utility>
 #include <memory>
 #include <functional>
@@ -57,6 +58,17 @@ template <class T
          ,class Allocator = std::allocator<T> >
 class stable_vector;
 
+//small_vector class
+template <class T
+         ,std::size_t N
+         ,class Allocator = std::allocator<T> >
+class small_vector;
+
+//devector class
+template <class T
+         ,class Allocator = std::allocator<T> >
+class devector;
+
 //vector class
 template <class T
          ,class Allocator = std::allocator<T> >
@@ -124,12 +136,47 @@ template <class Key
          ,class Allocator = std::allocator<std::pair<Key, T> > >
 class flat_multimap;
 
+//btree_set class
+template <class Key
+         ,class Compare  = std::less<Key>
+         ,class Allocator = std::allocator<Key>
+         ,std::size_t NodeSize = 256u>
+class btree_set;
+
+//btree_multiset class
+template <class Key
+         ,class Compare  = std::less<Key>
+         ,class Allocator = std::allocator<Key>
+         ,std::size_t NodeSize = 256u>
+class btree_multiset;
+
+//btree_map class
+template <class Key
+         ,class T
+         ,class Compare  = std::less<Key>
+         ,class Allocator = std::allocator<std::pair<Key, T> >
+         ,std::size_t NodeSize = 256u>
+class btree_map;
+
+//btree_multimap class
+template <class Key
+         ,class T
+         ,class Compare  = std::less<Key>
+         ,class Allocator = std::allocator<std::pair<Key, T> >
+         ,std::size_t NodeSize = 256u>
+class btree_multimap;
+
 //basic_string class
 template <class CharT
          ,class Traits = std::char_traits<CharT>
          ,class Allocator  = std::allocator<CharT> >
 class basic_string;
 
+//allocator class
+template <class T
+         ,unsigned Version = 2>
+class allocator;
+
 //! Type used to tag that the input range is
 //! guaranteed to be ordered
 struct ordered_range_t
@@ -0,0 +1,1585 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_BTREE_HPP
+#define BOOST_CONTAINER_DETAIL_BTREE_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+
+#include <boost/move/utility.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/aligned_storage.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
+#include <boost/container/detail/utilities.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/pair.hpp>
+#include <boost/container/detail/destroyers.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/assert.hpp>
+#ifndef BOOST_CONTAINER_PERFECT_FORWARDING
+#include <boost/container/detail/preprocessor.hpp>
+#endif
+
+#include <cstring>   //std::memmove
+#include <utility>   //std::pair
+#include <iterator>
+#include <algorithm>
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+template<class Compare, class Value, class KeyOfValue>
+class btree_value_compare
+   : private Compare
+{
+   typedef Value              first_argument_type;
+   typedef Value              second_argument_type;
+   typedef bool               return_type;
+   public:
+   btree_value_compare()
+      : Compare()
+   {}
+
+   btree_value_compare(const Compare &pred)
+      : Compare(pred)
+   {}
+
+   //Also compares the movable values stored in the nodes
+   template<class V1, class V2>
+   bool operator()(const V1& lhs, const V2& rhs) const
+   {
+      KeyOfValue key_extract;
+      return Compare::operator()(key_extract(lhs), key_extract(rhs));
+   }
+
+   const Compare &get_comp() const
+      {  return *this;  }
+
+   Compare &get_comp()
+      {  return *this;  }
+};
+
+//Maps store container_detail::pair objects, which are movable also in C++03
+//compilers, and iterators expose them as std::pair, as flat_map does.
+template<class Value, class KeyOfValue>
+struct btree_stored_value
+{
+   typedef Value type;
+};
+
+template<class K, class T>
+struct btree_stored_value< std::pair<K, T>, select1st< std::pair<K, T> > >
+{
+   typedef container_detail::pair<K, T> type;
+};
+
+//Values that can be moved between and inside nodes with memmove
+template<class T>
+struct btree_is_trivially_relocatable
+{
+   static const bool value = boost::has_trivial_copy<T>::value &&
+                             boost::has_trivial_destructor<T>::value;
+};
+
+template<class K, class T>
+struct btree_is_trivially_relocatable< container_detail::pair<K, T> >
+{
+   static const bool value = btree_is_trivially_relocatable<K>::value &&
+                             btree_is_trivially_relocatable<T>::value;
+};
+
+//Layout of the fields of each node that precede the values
+template<class VoidPointer>
+struct btree_node_header
+{
+   VoidPointer    parent;
+   unsigned short position;
+   unsigned short count;
+   bool           leaf;
+};
+
+//Number of values that fit in a leaf node of NodeSize bytes. At least three values
+//are needed so that splitting and merging nodes always leaves them non-empty.
+template<class VoidPointer, class Value, std::size_t NodeSize>
+struct btree_node_capacity
+{
+   static const std::size_t alignment   = boost::alignment_of<Value>::value;
+   static const std::size_t header_size =
+      (sizeof(btree_node_header<VoidPointer>) + alignment - 1u)/alignment*alignment;
+   static const std::size_t fitting     = NodeSize > header_size ? (NodeSize - header_size)/sizeof(Value) : 0u;
+   static const std::size_t max_field   = 0xFFFFu;
+   static const std::size_t value = fitting < 3u ? 3u : (fitting > max_field ? max_field : fitting);
+};
+
+template<class VoidPointer, class Value, std::size_t NodeSize>
+struct btree_internal_node;
+
+//Leaf node: values are stored contiguously so that a lookup in a node touches
+//few cache lines. Internal nodes append max_values + 1 children to the leaf layout.
+//The capacity is only computed when nodes are used, so that containers of
+//incomplete types can be declared.
+template<class VoidPointer, class Value, std::size_t NodeSize>
+struct btree_node
+{
+   typedef typename boost::intrusive::pointer_traits<VoidPointer>::template
+      rebind_pointer<btree_node>::type                            node_ptr;
+   typedef btree_internal_node<VoidPointer, Value, NodeSize>      internal_node_type;
+   typedef unsigned short                                         field_type;
+   static const std::size_t max_values = btree_node_capacity<VoidPointer, Value, NodeSize>::value;
+
+   explicit btree_node(bool is_leaf)
+      : parent(), position(0u), count(0u), leaf(is_leaf)
+   {}
+
+   Value *values()
+   {  return static_cast<Value*>(m_storage.address());  }
+
+   const Value *values() const
+   {  return static_cast<const Value*>(m_storage.address());  }
+
+   node_ptr &child(std::size_t i)
+   {  BOOST_ASSERT(!leaf);  return static_cast<internal_node_type*>(this)->children[i];  }
+
+   const node_ptr &child(std::size_t i) const
+   {  BOOST_ASSERT(!leaf);  return static_cast<const internal_node_type*>(this)->children[i];  }
+
+   node_ptr    parent;
+   field_type  position;   //Index of this node in parent's children
+   field_type  count;      //Number of constructed values
+   bool        leaf;
+   boost::aligned_storage<sizeof(Value)*max_values, boost::alignment_of<Value>::value> m_storage;
+};
+
+template<class VoidPointer, class Value, std::size_t NodeSize>
+struct btree_internal_node
+   : public btree_node<VoidPointer, Value, NodeSize>
+{
+   typedef btree_node<VoidPointer, Value, NodeSize>   base_t;
+   typedef typename base_t::node_ptr                  node_ptr;
+
+   btree_internal_node()
+      : base_t(false)
+   {
+      for(std::size_t i = 0; i != base_t::max_values + 1u; ++i){
+         children[i] = node_ptr();
+      }
+   }
+
+   node_ptr children[base_t::max_values + 1u];
+};
+
+template<class NodePtr, class Value, bool IsConst>
+class btree_iterator
+{
+   typedef NodePtr                                          node_ptr;
+   typedef boost::intrusive::pointer_traits<node_ptr>       node_ptr_traits;
+
+   public:
+   typedef std::bidirectional_iterator_tag                  iterator_category;
+   typedef Value                                            value_type;
+   typedef typename node_ptr_traits::difference_type        difference_type;
+   typedef typename if_c
+      < IsConst
+      , typename node_ptr_traits::template rebind_pointer<const Value>::type
+      , typename node_ptr_traits::template rebind_pointer<Value>::type
+      >::type                                               pointer;
+   typedef typename if_c<IsConst, const Value&, Value&>::type   reference;
+
+   btree_iterator()
+      : m_node(), m_pos(0u)
+   {}
+
+   btree_iterator(const node_ptr &n, std::size_t pos)
+      : m_node(n), m_pos(pos)
+   {}
+
+   btree_iterator(const btree_iterator<NodePtr, Value, false> &other)
+      : m_node(other.get_node()), m_pos(other.get_pos())
+   {}
+
+   reference operator*() const
+   {  return *reinterpret_cast<Value*>(m_node->values() + m_pos);  }
+
+   pointer operator->() const
+   {  return boost::intrusive::pointer_traits<pointer>::pointer_to(this->operator*());  }
+
+   btree_iterator& operator++()
+   {  this->increment();   return *this;  }
+
+   btree_iterator operator++(int)
+   {  btree_iterator tmp(*this);  this->increment();  return tmp;  }
+
+   btree_iterator& operator--()
+   {  this->decrement();   return *this;  }
+
+   btree_iterator operator--(int)
+   {  btree_iterator tmp(*this);  this->decrement();  return tmp;  }
+
+   friend bool operator==(const btree_iterator &l, const btree_iterator &r)
+   {  return l.m_node == r.m_node && l.m_pos == r.m_pos;  }
+
+   friend bool operator!=(const btree_iterator &l, const btree_iterator &r)
+   {  return !(l == r);  }
+
+   const node_ptr &get_node() const
+   {  return m_node;  }
+
+   std::size_t get_pos() const
+   {  return m_pos;  }
+
+   btree_iterator<NodePtr, Value, false> unconst() const
+   {  return btree_iterator<NodePtr, Value, false>(m_node, m_pos);  }
+
+   private:
+   void increment()
+   {
+      if(!m_node->leaf){
+         //Leftmost value of the right subtree
+         node_ptr n = m_node->child(m_pos + 1u);
+         while(!n->leaf){
+            n = n->child(0u);
+         }
+         m_node = n;
+         m_pos = 0u;
+      }
+      else if(++m_pos == m_node->count){
+         //Climb until a parent has a value after the subtree. If there
+         //is none, this was the last value and the iterator stays as end()
+         node_ptr n = m_node;
+         std::size_t pos = m_pos;
+         while(pos == n->count && n->parent){
+            pos = n->position;
+            n = n->parent;
+         }
+         if(pos != n->count){
+            m_node = n;
+            m_pos = pos;
+         }
+      }
+   }
+
+   void decrement()
+   {
+      if(!m_node->leaf){
+         //Rightmost value of the left subtree
+         node_ptr n = m_node->child(m_pos);
+         while(!n->leaf){
+            n = n->child(n->count);
+         }
+         m_node = n;
+         m_pos = n->count - 1u;
+      }
+      else if(m_pos){
+         --m_pos;
+      }
+      else{
+         node_ptr n = m_node;
+         std::size_t pos = 0u;
+         while(!pos && n->parent){
+            pos = n->position;
+            n = n->parent;
+         }
+         BOOST_ASSERT(pos);
+         m_node = n;
+         m_pos = pos - 1u;
+      }
+   }
+
+   node_ptr    m_node;
+   std::size_t m_pos;
+};
+
+//A B-tree that stores up to max_values values in each node. Values are kept
+//sorted inside the nodes, so inserting and erasing values moves other values
+//of the node and invalidates iterators and references.
+//
+//Nodes are split before inserting in a full node. Splits are biased when the
+//insertion is done at the end or at the beginning of the node, so that sorted
+//insertions produce full nodes. After erasing a value, a node with less than
+//max_values/2 values is merged with a sibling or borrows values from it.
+//
+//end() is the position past the last value of the rightmost leaf (or a null
+//node for an empty tree), so increments and decrements don't need a header node.
+template <class Key, class Value, class KeyOfValue,
+          class Compare, class Allocator, std::size_t NodeSize>
+class btree
+{
+   typedef allocator_traits<Allocator>                                  alloc_traits;
+   typedef typename btree_stored_value<Value, KeyOfValue>::type         stored_value_type;
+   typedef typename alloc_traits::void_pointer                          void_pointer;
+
+   //Node types are not instantiated here so that
+   //the tree can be declared with incomplete values
+   typedef btree_node<void_pointer, stored_value_type, NodeSize>        node_type;
+   typedef btree_internal_node<void_pointer, stored_value_type, NodeSize>  internal_node_type;
+   typedef typename boost::intrusive::pointer_traits<void_pointer>::template
+      rebind_pointer<node_type>::type                                   node_ptr;
+   typedef typename alloc_traits::template
+      portable_rebind_alloc<node_type>::type                            leaf_allocator;
+   typedef typename alloc_traits::template
+      portable_rebind_alloc<internal_node_type>::type                   internal_allocator;
+   typedef typename alloc_traits::template
+      portable_rebind_alloc<stored_value_type>::type                    value_allocator;
+   typedef allocator_traits<leaf_allocator>                             leaf_alloc_traits;
+   typedef allocator_traits<internal_allocator>                         internal_alloc_traits;
+   typedef allocator_traits<value_allocator>                            value_alloc_traits;
+   typedef typename internal_alloc_traits::pointer                      internal_ptr;
+
+   struct trivially_relocatable
+      : container_detail::bool_<btree_is_trivially_relocatable<stored_value_type>::value>
+   {};
+
+   public:
+   typedef btree_value_compare<Compare, Value, KeyOfValue>              value_compare;
+   typedef Value                                                        value_type;
+   typedef Key                                                          key_type;
+   typedef Compare                                                      key_compare;
+   typedef Allocator                                                    allocator_type;
+   typedef Allocator                                                    stored_allocator_type;
+   typedef stored_value_type                                            movable_value_type;
+   typedef typename alloc_traits::pointer                               pointer;
+   typedef typename alloc_traits::const_pointer                         const_pointer;
+   typedef typename alloc_traits::reference                             reference;
+   typedef typename alloc_traits::const_reference                       const_reference;
+   typedef typename alloc_traits::size_type                             size_type;
+   typedef typename alloc_traits::difference_type                       difference_type;
+   typedef btree_iterator<node_ptr, Value, false>                       iterator;
+   typedef btree_iterator<node_ptr, Value, true>                        const_iterator;
+   typedef std::reverse_iterator<iterator>                              reverse_iterator;
+   typedef std::reverse_iterator<const_iterator>                        const_reverse_iterator;
+
+   private:
+   struct members_holder
+      //Inherit from the allocator and value_compare to do EBO
+      : public Allocator, public value_compare
+   {
+      members_holder()
+         : Allocator(), value_compare(), m_root(), m_leftmost(), m_rightmost(), m_size(0u)
+      {}
+
+      template<class AllocConvertible>
+      members_holder(const Compare &comp, BOOST_FWD_REF(AllocConvertible) a)
+         : Allocator(boost::forward<AllocConvertible>(a)), value_compare(comp)
+         , m_root(), m_leftmost(), m_rightmost(), m_size(0u)
+      {}
+
+      void swap_nodes(members_holder &x)
+      {
+         boost::container::swap_dispatch(m_root, x.m_root);
+         boost::container::swap_dispatch(m_leftmost, x.m_leftmost);
+         boost::container::swap_dispatch(m_rightmost, x.m_rightmost);
+         boost::container::swap_dispatch(m_size, x.m_size);
+      }
+
+      node_ptr    m_root;
+      node_ptr    m_leftmost;
+      node_ptr    m_rightmost;
+      size_type   m_size;
+   };
+
+   members_holder m_data;
+   BOOST_COPYABLE_AND_MOVABLE(btree)
+
+   public:
+   btree()
+      : m_data()
+   {}
+
+   explicit btree(const Compare& comp)
+      : m_data(comp, Allocator())
+   {}
+
+   btree(const Compare& comp, const allocator_type& a)
+      : m_data(comp, a)
+   {}
+
+   explicit btree(const allocator_type& a)
+      : m_data(Compare(), a)
+   {}
+
+   template <class InputIterator>
+   btree( bool unique_insertion, InputIterator first, InputIterator last
+        , const Compare& comp = Compare(), const allocator_type& a = allocator_type())
+      : m_data(comp, a)
+   {
+      BOOST_TRY{
+         if(unique_insertion){
+            this->insert_unique(first, last);
+         }
+         else{
+            this->insert_equal(first, last);
+         }
+      }
+      BOOST_CATCH(...){
+         this->clear();
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   template <class InputIterator>
+   btree( ordered_range_t, InputIterator first, InputIterator last
+        , const Compare& comp = Compare(), const allocator_type& a = allocator_type())
+      : m_data(comp, a)
+   {
+      BOOST_TRY{
+         this->priv_append(first, last);
+      }
+      BOOST_CATCH(...){
+         this->clear();
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   btree(const btree& x)
+      : m_data( x.m_data.get_comp()
+              , alloc_traits::select_on_container_copy_construction(x.get_stored_allocator()))
+   {  this->priv_copy(x);  }
+
+   btree(BOOST_RV_REF(btree) x)
+      : m_data(x.m_data.get_comp(), boost::move(static_cast<Allocator&>(x.m_data)))
+   {  m_data.swap_nodes(x.m_data);  }
+
+   btree(const btree& x, const allocator_type &a)
+      : m_data(x.m_data.get_comp(), a)
+   {  this->priv_copy(x);  }
+
+   btree(BOOST_RV_REF(btree) x, const allocator_type &a)
+      : m_data(x.m_data.get_comp(), a)
+   {
+      if(this->get_stored_allocator() == x.get_stored_allocator()){
+         m_data.swap_nodes(x.m_data);
+      }
+      else{
+         this->priv_move_values(x);
+      }
+   }
+
+   ~btree()
+   {  this->clear();  }
+
+   btree& operator=(BOOST_COPY_ASSIGN_REF(btree) x)
+   {
+      if(&x != this){
+         Allocator &this_alloc = this->get_stored_allocator();
+         const Allocator &x_alloc = x.get_stored_allocator();
+         container_detail::bool_<alloc_traits::
+            propagate_on_container_copy_assignment::value> flag;
+         //Nodes must be freed with the old allocator
+         this->clear();
+         container_detail::assign_alloc(this_alloc, x_alloc, flag);
+         m_data.get_comp() = x.m_data.get_comp();
+         this->priv_copy(x);
+      }
+      return *this;
+   }
+
+   btree& operator=(BOOST_RV_REF(btree) x)
+   {
+      if(&x != this){
+         Allocator &this_alloc = this->get_stored_allocator();
+         Allocator &x_alloc = x.get_stored_allocator();
+         this->clear();
+         m_data.get_comp() = x.m_data.get_comp();
+         //If allocators are equal we can just swap nodes
+         if(this_alloc == x_alloc){
+            m_data.swap_nodes(x.m_data);
+            container_detail::bool_<alloc_traits::
+               propagate_on_container_move_assignment::value> flag;
+            container_detail::move_alloc(this_alloc, x_alloc, flag);
+         }
+         //If unequal allocators, then do a one by one move
+         else{
+            this->priv_move_values(x);
+         }
+      }
+      return *this;
+   }
+
+   public:
+   // accessors:
+   Compare key_comp() const
+   {  return m_data.get_comp();  }
+
+   value_compare value_comp() const
+   {  return m_data;  }
+
+   allocator_type get_allocator() const
+   {  return m_data;  }
+
+   const stored_allocator_type &get_stored_allocator() const
+   {  return m_data;  }
+
+   stored_allocator_type &get_stored_allocator()
+   {  return m_data;  }
+
+   iterator begin()
+   {  return iterator(m_data.m_leftmost, 0u);  }
+
+   const_iterator begin() const
+   {  return this->cbegin();  }
+
+   const_iterator cbegin() const
+   {  return const_iterator(m_data.m_leftmost, 0u);  }
+
+   iterator end()
+   {  return iterator(m_data.m_rightmost, m_data.m_rightmost ? m_data.m_rightmost->count : 0u);  }
+
+   const_iterator end() const
+   {  return this->cend();  }
+
+   const_iterator cend() const
+   {  return const_iterator(m_data.m_rightmost, m_data.m_rightmost ? m_data.m_rightmost->count : 0u);  }
+
+   reverse_iterator rbegin()
+   {  return reverse_iterator(this->end());  }
+
+   const_reverse_iterator rbegin() const
+   {  return this->crbegin();  }
+
+   const_reverse_iterator crbegin() const
+   {  return const_reverse_iterator(this->cend());  }
+
+   reverse_iterator rend()
+   {  return reverse_iterator(this->begin());  }
+
+   const_reverse_iterator rend() const
+   {  return this->crend();  }
+
+   const_reverse_iterator crend() const
+   {  return const_reverse_iterator(this->cbegin());  }
+
+   bool empty() const
+   {  return !m_data.m_size;  }
+
+   size_type size() const
+   {  return m_data.m_size;  }
+
+   size_type max_size() const
+   {  return alloc_traits::max_size(this->get_stored_allocator());  }
+
+   void swap(btree& x)
+   {
+      m_data.swap_nodes(x.m_data);
+      boost::container::swap_dispatch(m_data.get_comp(), x.m_data.get_comp());
+      container_detail::bool_<alloc_traits::propagate_on_container_swap::value> flag;
+      container_detail::swap_alloc(this->get_stored_allocator(), x.get_stored_allocator(), flag);
+   }
+
+   public:
+   // insert/erase
+   template<class Convertible>
+   std::pair<iterator,bool> insert_unique(BOOST_FWD_REF(Convertible) v)
+   {
+      const key_type &k = KeyOfValue()(v);
+      const Compare &key_cmp = m_data.get_comp();
+      node_ptr n = m_data.m_root;
+      size_type pos = 0u;
+      if(n){
+         while(true){
+            pos = this->priv_node_lower_bound(*n, k);
+            if(pos != n->count && !key_cmp(k, KeyOfValue()(n->values()[pos]))){
+               return std::pair<iterator,bool>(iterator(n, pos), false);
+            }
+            if(n->leaf)
+               break;
+            n = n->child(pos);
+         }
+      }
+      return std::pair<iterator,bool>(this->priv_insert_at(n, pos, ::boost::forward<Convertible>(v)), true);
+   }
+
+   template<class Convertible>
+   iterator insert_equal(BOOST_FWD_REF(Convertible) v)
+   {
+      node_ptr n;
+      size_type pos;
+      this->priv_upper_bound_leaf(KeyOfValue()(v), n, pos);
+      return this->priv_insert_at(n, pos, ::boost::forward<Convertible>(v));
+   }
+
+   template<class Convertible>
+   iterator insert_unique(const_iterator hint, BOOST_FWD_REF(Convertible) v)
+   {
+      //N1780. Props to Howard Hinnant!
+      const key_type &k = KeyOfValue()(v);
+      const Compare &key_cmp = m_data.get_comp();
+      if(hint == this->cend() || key_cmp(k, KeyOfValue()(*hint))){
+         if(hint != this->cbegin()){
+            const_iterator prev(hint);
+            --prev;
+            if(!key_cmp(KeyOfValue()(*prev), k)){
+               return key_cmp(k, KeyOfValue()(*prev))
+                  ? this->insert_unique(::boost::forward<Convertible>(v)).first
+                  : prev.unconst();
+            }
+         }
+         return this->priv_insert_before(hint, ::boost::forward<Convertible>(v));
+      }
+      else if(!key_cmp(KeyOfValue()(*hint), k)){
+         return hint.unconst();
+      }
+      return this->insert_unique(::boost::forward<Convertible>(v)).first;
+   }
+
+   template<class Convertible>
+   iterator insert_equal(const_iterator hint, BOOST_FWD_REF(Convertible) v)
+   {
+      //N1780
+      const key_type &k = KeyOfValue()(v);
+      const Compare &key_cmp = m_data.get_comp();
+      if(hint == this->cend() || !key_cmp(KeyOfValue()(*hint), k)){
+         if(hint != this->cbegin()){
+            const_iterator prev(hint);
+            --prev;
+            if(key_cmp(k, KeyOfValue()(*prev))){
+               return this->insert_equal(::boost::forward<Convertible>(v));
+            }
+         }
+         return this->priv_insert_before(hint, ::boost::forward<Convertible>(v));
+      }
+      else{
+         node_ptr n;
+         size_type pos;
+         this->priv_lower_bound_leaf(k, n, pos);
+         return this->priv_insert_at(n, pos, ::boost::forward<Convertible>(v));
+      }
+   }
+
+   template <class InputIterator>
+   void insert_unique(InputIterator first, InputIterator last)
+   {
+      //Sorted ranges are appended in constant time thanks to the end() hint
+      for( ; first != last; ++first){
+         this->insert_unique(this->cend(), *first);
+      }
+   }
+
+   template <class InputIterator>
+   void insert_equal(InputIterator first, InputIterator last)
+   {
+      for( ; first != last; ++first){
+         this->insert_equal(this->cend(), *first);
+      }
+   }
+
+   template <class InputIterator>
+   void insert_unique(ordered_unique_range_t, InputIterator first, InputIterator last)
+   {
+      if(this->empty()){
+         this->priv_append(first, last);
+      }
+      else{
+         const_iterator pos(this->cend());
+         for( ; first != last; ++first){
+            pos = this->insert_unique(pos, *first);
+            ++pos;
+         }
+      }
+   }
+
+   template <class InputIterator>
+   void insert_equal(ordered_range_t, InputIterator first, InputIterator last)
+   {
+      if(this->empty()){
+         this->priv_append(first, last);
+      }
+      else{
+         const_iterator pos(this->cend());
+         for( ; first != last; ++first){
+            pos = this->insert_equal(pos, *first);
+            ++pos;
+         }
+      }
+   }
+
+   #ifdef BOOST_CONTAINER_PERFECT_FORWARDING
+
+   template <class... Args>
+   std::pair<iterator, bool> emplace_unique(Args&&... args)
+   {
+      aligned_storage<sizeof(stored_value_type), alignment_of<stored_value_type>::value> v;
+      stored_value_type &val = *static_cast<stored_value_type *>(v.address());
+      value_allocator a(this->get_stored_allocator());
+      value_alloc_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<value_allocator> d(a, val);
+      return this->insert_unique(::boost::move(val));
+   }
+
+   template <class... Args>
+   iterator emplace_hint_unique(const_iterator hint, Args&&... args)
+   {
+      aligned_storage<sizeof(stored_value_type), alignment_of<stored_value_type>::value> v;
+      stored_value_type &val = *static_cast<stored_value_type *>(v.address());
+      value_allocator a(this->get_stored_allocator());
+      value_alloc_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<value_allocator> d(a, val);
+      return this->insert_unique(hint, ::boost::move(val));
+   }
+
+   template <class... Args>
+   iterator emplace_equal(Args&&... args)
+   {
+      aligned_storage<sizeof(stored_value_type), alignment_of<stored_value_type>::value> v;
+      stored_value_type &val = *static_cast<stored_value_type *>(v.address());
+      value_allocator a(this->get_stored_allocator());
+      value_alloc_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<value_allocator> d(a, val);
+      return this->insert_equal(::boost::move(val));
+   }
+
+   template <class... Args>
+   iterator emplace_hint_equal(const_iterator hint, Args&&... args)
+   {
+      aligned_storage<sizeof(stored_value_type), alignment_of<stored_value_type>::value> v;
+      stored_value_type &val = *static_cast<stored_value_type *>(v.address());
+      value_allocator a(this->get_stored_allocator());
+      value_alloc_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<value_allocator> d(a, val);
+      return this->insert_equal(hint, ::boost::move(val));
+   }
+
+   #else //#ifdef BOOST_CONTAINER_PERFECT_FORWARDING
+
+   #define BOOST_PP_LOCAL_MACRO(n)                                                        \
+   BOOST_PP_EXPR_IF(n, template<) BOOST_PP_ENUM_PARAMS(n, class P) BOOST_PP_EXPR_IF(n, >) \
+   std::pair<iterator, bool>                                                              \
+      emplace_unique(BOOST_PP_ENUM(n, BOOST_CONTAINER_PP_PARAM_LIST, _))                  \
+   {                                                                                      \
+      aligned_storage<sizeof(stored_value_type)                                           \
+                     , alignment_of<stored_value_type>::value> v;                         \
+      stored_value_type &val = *static_cast<stored_value_type *>(v.address());            \
+      value_allocator a(this->get_stored_allocator());                                    \
+      value_alloc_traits::construct(a, &val                                               \
+         BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _) );                \
+      value_destructor<value_allocator> d(a, val);                                        \
+      return this->insert_unique(::boost::move(val));                                     \
+   }                                                                                      \
+                                                                                          \
+   BOOST_PP_EXPR_IF(n, template<) BOOST_PP_ENUM_PARAMS(n, class P) BOOST_PP_EXPR_IF(n, >) \
+   iterator emplace_hint_unique(const_iterator hint                                       \
+                        BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_LIST, _))      \
+   {                                                                                      \
+      aligned_storage<sizeof(stored_value_type)                                           \
+                     , alignment_of<stored_value_type>::value> v;                         \
+      stored_value_type &val = *static_cast<stored_value_type *>(v.address());            \
+      value_allocator a(this->get_stored_allocator());                                    \
+      value_alloc_traits::construct(a, &val                                               \
+         BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _) );                \
+      value_destructor<value_allocator> d(a, val);                                        \
+      return this->insert_unique(hint, ::boost::move(val));                               \
+   }                                                                                      \
+                                                                                          \
+   BOOST_PP_EXPR_IF(n, template<) BOOST_PP_ENUM_PARAMS(n, class P) BOOST_PP_EXPR_IF(n, >) \
+   iterator emplace_equal(BOOST_PP_ENUM(n, BOOST_CONTAINER_PP_PARAM_LIST, _))             \
+   {                                                                                      \
+      aligned_storage<sizeof(stored_value_type)                                           \
+                     , alignment_of<stored_value_type>::value> v;                         \
+      stored_value_type &val = *static_cast<stored_value_type *>(v.address());            \
+      value_allocator a(this->get_stored_allocator());                                    \
+      value_alloc_traits::construct(a, &val                                               \
+         BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _) );                \
+      value_destructor<value_allocator> d(a, val);                                        \
+      return this->insert_equal(::boost::move(val));                                      \
+   }                                                                                      \
+                                                                                          \
+   BOOST_PP_EXPR_IF(n, template<) BOOST_PP_ENUM_PARAMS(n, class P) BOOST_PP_EXPR_IF(n, >) \
+   iterator emplace_hint_equal(const_iterator hint                                        \
+                      BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_LIST, _))        \
+   {                                                                                      \
+      aligned_storage<sizeof(stored_value_type)                                           \
+                     , alignment_of<stored_value_type>::value> v;                         \
+      stored_value_type &val = *static_cast<stored_value_type *>(v.address());            \
+      value_allocator a(this->get_stored_allocator());                                    \
+      value_alloc_traits::construct(a, &val                                               \
+         BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _) );                \
+      value_destructor<value_allocator> d(a, val);                                        \
+      return this->insert_equal(hint, ::boost::move(val));                                \
+   }                                                                                      \
+   //!
+   #define BOOST_PP_LOCAL_LIMITS (0, BOOST_CONTAINER_MAX_CONSTRUCTOR_PARAMETERS)
+   #include BOOST_PP_LOCAL_ITERATE()
+
+   #endif   //#ifdef BOOST_CONTAINER_PERFECT_FORWARDING
+
+   iterator erase(const_iterator position)
+   {
+      BOOST_ASSERT(position != this->cend());
+      return this->priv_erase(position.get_node(), position.get_pos());
+   }
+
+   size_type erase(const key_type& k)
+   {
+      //"k" might be a reference to a stored value, so count the
+      //equivalent values before any value is moved
+      const Compare &key_cmp = m_data.get_comp();
+      iterator it(this->lower_bound(k));
+      const iterator end_it(this->end());
+      size_type n = 0u;
+      for(iterator i(it); i != end_it && !key_cmp(k, KeyOfValue()(*i)); ++i){
+         ++n;
+      }
+      for(size_type i = n; i; --i){
+         it = this->erase(it);
+      }
+      return n;
+   }
+
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      if(first == this->cbegin() && last == this->cend()){
+         this->clear();
+         return this->end();
+      }
+      //Erasing values invalidates "last", so count the values to be erased
+      size_type n = static_cast<size_type>(std::distance(first, last));
+      iterator it(first.unconst());
+      while(n--){
+         it = this->erase(it);
+      }
+      return it;
+   }
+
+   void clear()
+   {
+      if(m_data.m_root){
+         this->priv_destroy_subtree(m_data.m_root);
+         m_data.m_root = m_data.m_leftmost = m_data.m_rightmost = node_ptr();
+         m_data.m_size = 0u;
+      }
+   }
+
+   // set operations:
+   iterator find(const key_type& k)
+   {
+      iterator i = this->lower_bound(k);
+      iterator end_it = this->end();
+      if (i != end_it && m_data.get_comp()(k, KeyOfValue()(*i))){
+         i = end_it;
+      }
+      return i;
+   }
+
+   const_iterator find(const key_type& k) const
+   {
+      const_iterator i = this->lower_bound(k);
+      const_iterator end_it = this->cend();
+      if (i != end_it && m_data.get_comp()(k, KeyOfValue()(*i))){
+         i = end_it;
+      }
+      return i;
+   }
+
+   size_type count(const key_type& k) const
+   {
+      std::pair<const_iterator, const_iterator> p = this->equal_range(k);
+      return static_cast<size_type>(std::distance(p.first, p.second));
+   }
+
+   iterator lower_bound(const key_type& k)
+   {
+      node_ptr n;
+      size_type pos;
+      this->priv_lower_bound_leaf(k, n, pos);
+      return this->priv_normalize(n, pos);
+   }
+
+   const_iterator lower_bound(const key_type& k) const
+   {  return const_cast<btree&>(*this).lower_bound(k);  }
+
+   iterator upper_bound(const key_type& k)
+   {
+      node_ptr n;
+      size_type pos;
+      this->priv_upper_bound_leaf(k, n, pos);
+      return this->priv_normalize(n, pos);
+   }
+
+   const_iterator upper_bound(const key_type& k) const
+   {  return const_cast<btree&>(*this).upper_bound(k);  }
+
+   std::pair<iterator,iterator> equal_range(const key_type& k)
+   {  return std::pair<iterator,iterator>(this->lower_bound(k), this->upper_bound(k));  }
+
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+   {  return std::pair<const_iterator,const_iterator>(this->lower_bound(k), this->upper_bound(k));  }
+
+   //Non-standard observers
+
+   //! Number of levels of the tree
+   size_type height() const
+   {
+      size_type h = 0u;
+      for(node_ptr n = m_data.m_root; n; n = n->leaf ? node_ptr() : n->child(0u)){
+         ++h;
+      }
+      return h;
+   }
+
+   //! Maximum number of values stored in each node
+   static size_type node_capacity()
+   {  return node_type::max_values;  }
+
+   private:
+   //////////////////////////////////////////////
+   //
+   //             node management
+   //
+   //////////////////////////////////////////////
+
+   node_ptr priv_allocate_node(bool leaf)
+   {
+      if(leaf){
+         leaf_allocator a(this->get_stored_allocator());
+         node_ptr n = leaf_alloc_traits::allocate(a, 1u);
+         ::new(container_detail::to_raw_pointer(n)) node_type(true);
+         return n;
+      }
+      else{
+         internal_allocator a(this->get_stored_allocator());
+         internal_ptr p = internal_alloc_traits::allocate(a, 1u);
+         internal_node_type *const raw = ::new(container_detail::to_raw_pointer(p)) internal_node_type;
+         return boost::intrusive::pointer_traits<node_ptr>::pointer_to(*raw);
+      }
+   }
+
+   void priv_deallocate_node(const node_ptr &n)
+   {
+      if(n->leaf){
+         leaf_allocator a(this->get_stored_allocator());
+         leaf_alloc_traits::deallocate(a, n, 1u);
+      }
+      else{
+         internal_allocator a(this->get_stored_allocator());
+         internal_alloc_traits::deallocate(a, boost::intrusive::pointer_traits<internal_ptr>::
+            pointer_to(static_cast<internal_node_type&>(*n)), 1u);
+      }
+   }
+
+   void priv_destroy_subtree(const node_ptr &n)
+   {
+      if(!n->leaf){
+         for(size_type i = 0u; i <= n->count; ++i){
+            //Children can be null if copying the tree threw
+            if(n->child(i)){
+               this->priv_destroy_subtree(n->child(i));
+            }
+         }
+      }
+      this->priv_destroy_values(n->values(), n->values() + n->count, trivially_relocatable());
+      this->priv_deallocate_node(n);
+   }
+
+   static void priv_set_child(const node_ptr &parent, size_type i, const node_ptr &c)
+   {
+      parent->child(i) = c;
+      c->parent = parent;
+      c->position = static_cast<typename node_type::field_type>(i);
+   }
+
+   //////////////////////////////////////////////
+   //
+   //             value management
+   //
+   //////////////////////////////////////////////
+
+   template<class Convertible>
+   void priv_construct(stored_value_type *p, BOOST_FWD_REF(Convertible) v)
+   {
+      value_allocator a(this->get_stored_allocator());
+      value_alloc_traits::construct(a, p, ::boost::forward<Convertible>(v));
+   }
+
+   void priv_destroy(stored_value_type *p)
+   {
+      value_allocator a(this->get_stored_allocator());
+      value_alloc_traits::destroy(a, p);
+   }
+
+   void priv_destroy_values(stored_value_type *, stored_value_type *, container_detail::true_type)
+   {}
+
+   void priv_destroy_values(stored_value_type *first, stored_value_type *last, container_detail::false_type)
+   {
+      for(; first != last; ++first){
+         this->priv_destroy(first);
+      }
+   }
+
+   //Moves the values of [first, last) to the uninitialized range that starts
+   //at dest and destroys the moved values. Ranges can overlap.
+   void priv_relocate(stored_value_type *first, stored_value_type *last, stored_value_type *dest)
+   {  this->priv_relocate(first, last, dest, trivially_relocatable());  }
+
+   void priv_relocate(stored_value_type *first, stored_value_type *last, stored_value_type *dest, container_detail::true_type)
+   {
+      if(first != last){
+         std::memmove(static_cast<void*>(dest), static_cast<void*>(first), sizeof(stored_value_type)*std::size_t(last - first));
+      }
+   }
+
+   void priv_relocate(stored_value_type *first, stored_value_type *last, stored_value_type *dest, container_detail::false_type)
+   {
+      if(dest < first){
+         for(; first != last; ++first, ++dest){
+            this->priv_construct(dest, ::boost::move(*first));
+            this->priv_destroy(first);
+         }
+      }
+      else if(dest != first){
+         dest += last - first;
+         while(last != first){
+            --last;
+            --dest;
+            this->priv_construct(dest, ::boost::move(*last));
+            this->priv_destroy(last);
+         }
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                  lookup
+   //
+   //////////////////////////////////////////////
+
+   size_type priv_node_lower_bound(const node_type &n, const key_type &k) const
+   {
+      const Compare &key_cmp = m_data.get_comp();
+      const stored_value_type *const vals = n.values();
+      KeyOfValue key_extract;
+      size_type first = 0u;
+      size_type len = n.count;
+      while(len){
+         const size_type half = len >> 1u;
+         if(key_cmp(key_extract(vals[first + half]), k)){
+            first += half + 1u;
+            len -= half + 1u;
+         }
+         else{
+            len = half;
+         }
+      }
+      return first;
+   }
+
+   size_type priv_node_upper_bound(const node_type &n, const key_type &k) const
+   {
+      const Compare &key_cmp = m_data.get_comp();
+      const stored_value_type *const vals = n.values();
+      KeyOfValue key_extract;
+      size_type first = 0u;
+      size_type len = n.count;
+      while(len){
+         const size_type half = len >> 1u;
+         if(key_cmp(k, key_extract(vals[first + half]))){
+            len = half;
+         }
+         else{
+            first += half + 1u;
+            len -= half + 1u;
+         }
+      }
+      return first;
+   }
+
+   //Leaf position where a value should be inserted before all the values not less than k
+   void priv_lower_bound_leaf(const key_type &k, node_ptr &n, size_type &pos) const
+   {
+      n = m_data.m_root;
+      pos = 0u;
+      if(n){
+         while(true){
+            pos = this->priv_node_lower_bound(*n, k);
+            if(n->leaf)
+               break;
+            n = n->child(pos);
+         }
+      }
+   }
+
+   //Leaf position where a value should be inserted after all the values not greater than k
+   void priv_upper_bound_leaf(const key_type &k, node_ptr &n, size_type &pos) const
+   {
+      n = m_data.m_root;
+      pos = 0u;
+      if(n){
+         while(true){
+            pos = this->priv_node_upper_bound(*n, k);
+            if(n->leaf)
+               break;
+            n = n->child(pos);
+         }
+      }
+   }
+
+   //Converts a leaf position, that might be past the last value of the
+   //leaf, to the iterator pointing to the next value
+   iterator priv_normalize(node_ptr n, size_type pos) const
+   {
+      if(!n){
+         return iterator();
+      }
+      while(pos == n->count && n->parent){
+         pos = n->position;
+         n = n->parent;
+      }
+      return pos == n->count ? const_cast<btree&>(*this).end() : iterator(n, pos);
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                insertion
+   //
+   //////////////////////////////////////////////
+
+   template<class Convertible>
+   iterator priv_insert_before(const_iterator position, BOOST_FWD_REF(Convertible) v)
+   {
+      //Values are always inserted in leaves: the position
+      //before an internal value is after its predecessor
+      node_ptr n(position.get_node());
+      size_type pos = position.get_pos();
+      if(n && !n->leaf){
+         n = n->child(pos);
+         while(!n->leaf){
+            n = n->child(n->count);
+         }
+         pos = n->count;
+      }
+      return this->priv_insert_at(n, pos, ::boost::forward<Convertible>(v));
+   }
+
+   template<class Convertible>
+   iterator priv_insert_at(node_ptr n, size_type pos, BOOST_FWD_REF(Convertible) v)
+   {
+      //The new value is built before moving any value, as v might
+      //be a reference to a value of the tree
+      aligned_storage<sizeof(stored_value_type), alignment_of<stored_value_type>::value> tmp;
+      stored_value_type &val = *static_cast<stored_value_type *>(tmp.address());
+      value_allocator a(this->get_stored_allocator());
+      value_alloc_traits::construct(a, &val, ::boost::forward<Convertible>(v));
+      value_destructor<value_allocator> d(a, val);
+
+      if(!n){
+         n = this->priv_allocate_node(true);
+         m_data.m_root = m_data.m_leftmost = m_data.m_rightmost = n;
+         pos = 0u;
+      }
+      else if(n->count == node_type::max_values){
+         this->priv_split(n, pos);
+      }
+      stored_value_type *const vals = n->values();
+      this->priv_relocate(vals + pos, vals + n->count, vals + pos + 1u);
+      BOOST_TRY{
+         this->priv_construct(vals + pos, ::boost::move(val));
+      }
+      BOOST_CATCH(...){
+         this->priv_relocate(vals + pos + 1u, vals + n->count + 1u, vals + pos);
+         if(!m_data.m_size){
+            this->priv_deallocate_node(n);
+            m_data.m_root = m_data.m_leftmost = m_data.m_rightmost = node_ptr();
+         }
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      ++n->count;
+      ++m_data.m_size;
+      return iterator(n, pos);
+   }
+
+   //Splits the full node n, moving its upper values to a new right sibling.
+   //On return n and pos are updated to the node and position where the value
+   //to be inserted in the original position must be placed.
+   void priv_split(node_ptr &n, size_type &pos)
+   {
+      BOOST_ASSERT(n->count == node_type::max_values);
+      node_ptr parent = n->parent;
+      if(parent && parent->count == node_type::max_values){
+         node_ptr p(parent);
+         size_type ppos = n->position;
+         this->priv_split(p, ppos);
+         parent = n->parent;
+      }
+      //Allocate nodes before changing the tree
+      node_ptr right = this->priv_allocate_node(n->leaf);
+      if(!parent){
+         BOOST_TRY{
+            parent = this->priv_allocate_node(false);
+         }
+         BOOST_CATCH(...){
+            this->priv_deallocate_node(right);
+            BOOST_RETHROW
+         }
+         BOOST_CATCH_END
+         this->priv_set_child(parent, 0u, n);
+         m_data.m_root = parent;
+      }
+      //Keep the node full if values are being appended or prepended
+      const size_type max = node_type::max_values;
+      const size_type split = pos == max ? max - 1u
+                            : pos == 0u  ? 0u
+                            : max/2u;
+      const size_type moved = max - split - 1u;
+      stored_value_type *const vals = n->values();
+      this->priv_relocate(vals + split + 1u, vals + max, right->values());
+      if(!n->leaf){
+         for(size_type i = 0u; i <= moved; ++i){
+            this->priv_set_child(right, i, n->child(split + 1u + i));
+         }
+      }
+      right->count = static_cast<typename node_type::field_type>(moved);
+      //The median value and the new node are inserted in the parent
+      const size_type p = n->position;
+      const size_type pcount = parent->count;
+      stored_value_type *const pvals = parent->values();
+      this->priv_relocate(pvals + p, pvals + pcount, pvals + p + 1u);
+      this->priv_relocate(vals + split, vals + split + 1u, pvals + p);
+      for(size_type i = pcount + 1u; i > p + 1u; --i){
+         this->priv_set_child(parent, i, parent->child(i - 1u));
+      }
+      this->priv_set_child(parent, p + 1u, right);
+      ++parent->count;
+      n->count = static_cast<typename node_type::field_type>(split);
+      if(n == m_data.m_rightmost){
+         m_data.m_rightmost = right;
+      }
+      if(pos > split){
+         n = right;
+         pos -= split + 1u;
+      }
+   }
+
+   template<class InputIterator>
+   void priv_append(InputIterator first, InputIterator last)
+   {
+      for( ; first != last; ++first){
+         this->priv_insert_at(m_data.m_rightmost, m_data.m_rightmost ? m_data.m_rightmost->count : 0u, *first);
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                 erasure
+   //
+   //////////////////////////////////////////////
+
+   iterator priv_erase(node_ptr n, size_type pos)
+   {
+      //Values are always erased from leaves: an internal
+      //value is replaced by its predecessor
+      const bool internal = !n->leaf;
+      if(internal){
+         node_ptr l = n->child(pos);
+         while(!l->leaf){
+            l = l->child(l->count);
+         }
+         n->values()[pos] = ::boost::move(l->values()[l->count - 1u]);
+         n = l;
+         pos = l->count - 1u;
+      }
+      stored_value_type *const vals = n->values();
+      this->priv_destroy(vals + pos);
+      this->priv_relocate(vals + pos + 1u, vals + n->count, vals + pos);
+      --n->count;
+      --m_data.m_size;
+      //The leaf position of the erased value is updated when rebalancing moves it
+      node_ptr gap_node(n);
+      size_type gap_pos = pos;
+      this->priv_rebalance(n, gap_node, gap_pos);
+      iterator ret(this->priv_normalize(gap_node, gap_pos));
+      //The predecessor now is in the position of the erased value
+      if(internal){
+         ++ret;
+      }
+      return ret;
+   }
+
+   void priv_rebalance(node_ptr n, node_ptr &gap_node, size_type &gap_pos)
+   {
+      while(n != m_data.m_root){
+         if(n->count >= node_type::max_values/2u){
+            return;
+         }
+         const node_ptr parent(n->parent);
+         const size_type p = n->position;
+         const node_ptr left (p ? parent->child(p - 1u) : node_ptr());
+         const node_ptr right(p < parent->count ? parent->child(p + 1u) : node_ptr());
+         if(left && left->count + n->count < node_type::max_values){
+            if(gap_node == n){
+               gap_node = left;
+               gap_pos += left->count + 1u;
+            }
+            this->priv_merge(left, n);
+         }
+         else if(right && n->count + right->count < node_type::max_values){
+            if(gap_node == right){
+               gap_node = n;
+               gap_pos += n->count + 1u;
+            }
+            this->priv_merge(n, right);
+         }
+         else if(left){
+            const size_type k = (left->count - n->count + 1u)/2u;
+            if(gap_node == n){
+               gap_pos += k;
+            }
+            this->priv_borrow_left(left, n, k);
+            return;
+         }
+         else{
+            BOOST_ASSERT(right);
+            const size_type k = (right->count - n->count + 1u)/2u;
+            if(gap_node == right){
+               if(gap_pos < k){
+                  gap_node = n;
+                  gap_pos += n->count + 1u;
+               }
+               else{
+                  gap_pos -= k;
+               }
+            }
+            this->priv_borrow_right(n, right, k);
+            return;
+         }
+         n = parent;
+      }
+      //The root can be left empty
+      if(!n->count){
+         if(n->leaf){
+            m_data.m_root = m_data.m_leftmost = m_data.m_rightmost = node_ptr();
+            gap_node = node_ptr();
+            gap_pos = 0u;
+         }
+         else{
+            const node_ptr c(n->child(0u));
+            c->parent = node_ptr();
+            c->position = 0u;
+            m_data.m_root = c;
+         }
+         this->priv_deallocate_node(n);
+      }
+   }
+
+   //Moves the separator and all the values of right to left and frees right
+   void priv_merge(const node_ptr &left, const node_ptr &right)
+   {
+      const node_ptr parent(left->parent);
+      const size_type s  = left->position;
+      const size_type lc = left->count;
+      const size_type rc = right->count;
+      stored_value_type *const lvals = left->values();
+      stored_value_type *const pvals = parent->values();
+      this->priv_relocate(pvals + s, pvals + s + 1u, lvals + lc);
+      this->priv_relocate(right->values(), right->values() + rc, lvals + lc + 1u);
+      if(!left->leaf){
+         for(size_type i = 0u; i <= rc; ++i){
+            this->priv_set_child(left, lc + 1u + i, right->child(i));
+         }
+      }
+      left->count = static_cast<typename node_type::field_type>(lc + 1u + rc);
+      //Remove the separator and right from the parent
+      const size_type pc = parent->count;
+      this->priv_relocate(pvals + s + 1u, pvals + pc, pvals + s);
+      for(size_type i = s + 1u; i < pc; ++i){
+         this->priv_set_child(parent, i, parent->child(i + 1u));
+      }
+      parent->child(pc) = node_ptr();
+      --parent->count;
+      if(right == m_data.m_rightmost){
+         m_data.m_rightmost = left;
+      }
+      right->count = 0u;
+      this->priv_deallocate_node(right);
+   }
+
+   //Rotates k values from left to its right sibling n through the parent
+   void priv_borrow_left(const node_ptr &left, const node_ptr &n, size_type k)
+   {
+      const node_ptr parent(n->parent);
+      const size_type s  = left->position;
+      const size_type lc = left->count;
+      const size_type nc = n->count;
+      stored_value_type *const lvals = left->values();
+      stored_value_type *const nvals = n->values();
+      stored_value_type *const pvals = parent->values();
+      this->priv_relocate(nvals, nvals + nc, nvals + k);
+      this->priv_relocate(pvals + s, pvals + s + 1u, nvals + k - 1u);
+      this->priv_relocate(lvals + lc - k + 1u, lvals + lc, nvals);
+      this->priv_relocate(lvals + lc - k, lvals + lc - k + 1u, pvals + s);
+      if(!n->leaf){
+         for(size_type i = nc + 1u; i--; ){
+            this->priv_set_child(n, i + k, n->child(i));
+         }
+         for(size_type i = 0u; i != k; ++i){
+            this->priv_set_child(n, i, left->child(lc - k + 1u + i));
+         }
+      }
+      left->count = static_cast<typename node_type::field_type>(lc - k);
+      n->count    = static_cast<typename node_type::field_type>(nc + k);
+   }
+
+   //Rotates k values from right to its left sibling n through the parent
+   void priv_borrow_right(const node_ptr &n, const node_ptr &right, size_type k)
+   {
+      const node_ptr parent(n->parent);
+      const size_type s  = n->position;
+      const size_type nc = n->count;
+      const size_type rc = right->count;
+      stored_value_type *const nvals = n->values();
+      stored_value_type *const rvals = right->values();
+      stored_value_type *const pvals = parent->values();
+      this->priv_relocate(pvals + s, pvals + s + 1u, nvals + nc);
+      this->priv_relocate(rvals, rvals + k - 1u, nvals + nc + 1u);
+      this->priv_relocate(rvals + k - 1u, rvals + k, pvals + s);
+      this->priv_relocate(rvals + k, rvals + rc, rvals);
+      if(!n->leaf){
+         for(size_type i = 0u; i != k; ++i){
+            this->priv_set_child(n, nc + 1u + i, right->child(i));
+         }
+         for(size_type i = 0u; i <= rc - k; ++i){
+            this->priv_set_child(right, i, right->child(i + k));
+         }
+      }
+      n->count     = static_cast<typename node_type::field_type>(nc + k);
+      right->count = static_cast<typename node_type::field_type>(rc - k);
+   }
+
+   //////////////////////////////////////////////
+   //
+   //              copy and move
+   //
+   //////////////////////////////////////////////
+
+   void priv_copy(const btree &x)
+   {
+      if(x.m_data.m_root){
+         m_data.m_root = this->priv_allocate_node(x.m_data.m_root->leaf);
+         BOOST_TRY{
+            this->priv_clone(x.m_data.m_root, m_data.m_root);
+         }
+         BOOST_CATCH(...){
+            this->priv_destroy_subtree(m_data.m_root);
+            m_data.m_root = node_ptr();
+            BOOST_RETHROW
+         }
+         BOOST_CATCH_END
+         node_ptr l(m_data.m_root), r(m_data.m_root);
+         while(!l->leaf){
+            l = l->child(0u);
+            r = r->child(r->count);
+         }
+         m_data.m_leftmost  = l;
+         m_data.m_rightmost = r;
+         m_data.m_size = x.m_data.m_size;
+      }
+   }
+
+   //Copies the values and the subtree of src to the empty node dst
+   void priv_clone(const node_ptr &src, const node_ptr &dst)
+   {
+      const stored_value_type *const svals = src->values();
+      stored_value_type *const dvals = dst->values();
+      for(size_type i = 0u, c = src->count; i != c; ++i){
+         this->priv_construct(dvals + i, svals[i]);
+         ++dst->count;
+      }
+      if(!src->leaf){
+         for(size_type i = 0u; i <= src->count; ++i){
+            const node_ptr c(this->priv_allocate_node(src->child(i)->leaf));
+            this->priv_set_child(dst, i, c);
+            this->priv_clone(src->child(i), c);
+         }
+      }
+   }
+
+   void priv_move_values(btree &x)
+   {
+      for(iterator it(x.begin()), itend(x.end()); it != itend; ++it){
+         this->priv_insert_at( m_data.m_rightmost, m_data.m_rightmost ? m_data.m_rightmost->count : 0u
+                             , ::boost::move(it.get_node()->values()[it.get_pos()]));
+      }
+      x.clear();
+   }
+};
+
+template <class Key, class Value, class KeyOfValue,
+          class Compare, class A, std::size_t N>
+inline bool
+operator==(const btree<Key,Value,KeyOfValue,Compare,A,N>& x,
+           const btree<Key,Value,KeyOfValue,Compare,A,N>& y)
+{
+  return x.size() == y.size() &&
+         std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class Key, class Value, class KeyOfValue,
+          class Compare, class A, std::size_t N>
+inline bool
+operator<(const btree<Key,Value,KeyOfValue,Compare,A,N>& x,
+          const btree<Key,Value,KeyOfValue,Compare,A,N>& y)
+{
+  return std::lexicographical_compare(x.begin(), x.end(),
+                                      y.begin(), y.end());
+}
+
+template <class Key, class Value, class KeyOfValue,
+          class Compare, class A, std::size_t N>
+inline bool
+operator!=(const btree<Key,Value,KeyOfValue,Compare,A,N>& x,
+           const btree<Key,Value,KeyOfValue,Compare,A,N>& y)
+   {  return !(x == y); }
+
+template <class Key, class Value, class KeyOfValue,
+          class Compare, class A, std::size_t N>
+inline bool
+operator>(const btree<Key,Value,KeyOfValue,Compare,A,N>& x,
+          const btree<Key,Value,KeyOfValue,Compare,A,N>& y)
+   {  return y < x;  }
+
+template <class Key, class Value, class KeyOfValue,
+          class Compare, class A, std::size_t N>
+inline bool
+operator<=(const btree<Key,Value,KeyOfValue,Compare,A,N>& x,
+           const btree<Key,Value,KeyOfValue,Compare,A,N>& y)
+   {  return !(y < x);  }
+
+template <class Key, class Value, class KeyOfValue,
+          class Compare, class A, std::size_t N>
+inline bool
+operator>=(const btree<Key,Value,KeyOfValue,Compare,A,N>& x,
+           const btree<Key,Value,KeyOfValue,Compare,A,N>& y)
+   {  return !(x < y);  }
+
+template <class Key, class Value, class KeyOfValue,
+          class Compare, class A, std::size_t N>
+inline void
+swap(btree<Key,Value,KeyOfValue,Compare,A,N>& x,
+     btree<Key,Value,KeyOfValue,Compare,A,N>& y)
+   {  x.swap(y);  }
+
+}  //namespace container_detail {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_DETAIL_BTREE_HPP
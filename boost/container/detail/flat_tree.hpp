@@ -26,6 +26,7 @@
 
 #include <boost/type_traits/has_trivial_destructor.hpp>
 #include <boost/move/utility.hpp>
+#include <boost/move/iterator.hpp>
 
 #include <boost/container/detail/utilities.hpp>
 #include <boost/container/detail/pair.hpp>
@@ -73,6 +74,22 @@ class flat_tree_value_compare
       {  return *this;  }
 };
 
+//Compares pointers to values, used to sort a sequence without moving its
+//elements until their final position is known.
+template<class ValueCompare, class Value>
+class flat_tree_indirect_compare
+{
+   const ValueCompare *m_comp;
+
+   public:
+   explicit flat_tree_indirect_compare(const ValueCompare &comp)
+      : m_comp(&comp)
+   {}
+
+   bool operator()(const Value *lhs, const Value *rhs) const
+   {  return (*m_comp)(*lhs, *rhs);  }
+};
+
 template<class Pointer>
 struct get_flat_tree_iterators
 {
@@ -189,6 +206,7 @@ class flat_tree
 
    //!Standard extension
    typedef allocator_type                             stored_allocator_type;
+   typedef vector_t                                   sequence_type;
 
    private:
    typedef allocator_traits<stored_allocator_type> stored_allocator_traits;
@@ -240,19 +258,14 @@ class flat_tree
             , const allocator_type& a = allocator_type())
       : m_data(comp, a)
    {
-      //Use cend() as hint to achieve linear time for
-      //ordered ranges as required by the standard
+      //Range insertion sorts the new elements in a buffer, which
+      //is linear for ordered ranges as required by the standard
       //for the constructor
-      //Call end() every iteration as reallocation might have invalidated iterators
       if(unique_insertion){
-         for ( ; first != last; ++first){
-            this->insert_unique(this->cend(), *first);
-         }
+         this->insert_unique(first, last);
       }
       else{
-         for ( ; first != last; ++first){
-            this->insert_equal(this->cend(), *first);
-         }
+         this->insert_equal(first, last);
       }
    }
 
@@ -395,36 +408,26 @@ class flat_tree
       return this->priv_insert_commit(data, boost::move(mval));
    }
 
+   //Unordered ranges are appended to a buffer that is sorted and then
+   //merged with the tree in a single backwards pass, so inserting N elements
+   //costs N log(N) plus a linear merge instead of N shifts of the vector.
    template <class InIt>
    void insert_unique(InIt first, InIt last)
    {
-      for ( ; first != last; ++first){
-         this->insert_unique(*first);
-      }
+      sequence_type seq(this->m_data.m_vect.get_stored_allocator());
+      seq.insert(seq.cend(), first, last);
+      this->priv_sort(seq);
+      this->priv_unique(seq);
+      this->priv_merge_unique(seq);
    }
 
    template <class InIt>
-   void insert_equal(InIt first, InIt last
-      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
-      , typename container_detail::enable_if_c
-         < container_detail::is_input_iterator<InIt>::value
-         >::type * = 0
-      #endif
-      )
-   {  this->priv_insert_equal_loop(first, last);  }
-
-   template <class InIt>
-   void insert_equal(InIt first, InIt last
-      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
-      , typename container_detail::enable_if_c
-         < !container_detail::is_input_iterator<InIt>::value
-         >::type * = 0
-      #endif
-      )
+   void insert_equal(InIt first, InIt last)
    {
-      const size_type len = static_cast<size_type>(std::distance(first, last));
-      this->reserve(this->size()+len);
-      this->priv_insert_equal_loop(first, last);
+      sequence_type seq(this->m_data.m_vect.get_stored_allocator());
+      seq.insert(seq.cend(), first, last);
+      this->priv_sort(seq);
+      this->priv_merge_equal(seq);
    }
 
    //Ordered
@@ -692,6 +695,41 @@ class flat_tree
    void shrink_to_fit()
    {  this->m_data.m_vect.shrink_to_fit();  }
 
+   sequence_type extract_sequence()
+   {
+      sequence_type seq(boost::move(this->m_data.m_vect));
+      this->m_data.m_vect.clear();
+      return boost::move(seq);
+   }
+
+   sequence_type &get_sequence_ref()
+   {  return this->m_data.m_vect;  }
+
+   void adopt_sequence_unique(BOOST_RV_REF(sequence_type) seq)
+   {
+      this->priv_sort(seq);
+      this->priv_unique(seq);
+      this->m_data.m_vect = boost::move(seq);
+   }
+
+   void adopt_sequence_unique(ordered_unique_range_t, BOOST_RV_REF(sequence_type) seq)
+   {
+      BOOST_ASSERT(this->priv_is_sorted(seq, true));
+      this->m_data.m_vect = boost::move(seq);
+   }
+
+   void adopt_sequence_equal(BOOST_RV_REF(sequence_type) seq)
+   {
+      this->priv_sort(seq);
+      this->m_data.m_vect = boost::move(seq);
+   }
+
+   void adopt_sequence_equal(ordered_range_t, BOOST_RV_REF(sequence_type) seq)
+   {
+      BOOST_ASSERT(this->priv_is_sorted(seq, false));
+      this->m_data.m_vect = boost::move(seq);
+   }
+
    // set operations:
    iterator find(const key_type& k)
    {
@@ -929,11 +967,133 @@ class flat_tree
       return std::pair<RanIt, RanIt>(first, first);
    }
 
-   template<class InIt>
-   void priv_insert_equal_loop(InIt first, InIt last)
+   bool priv_is_sorted(const sequence_type &seq, bool unique) const
    {
-      for ( ; first != last; ++first){
-         this->insert_equal(*first);
+      const value_compare &value_comp = this->m_data;
+      typename sequence_type::const_iterator it(seq.cbegin());
+      const typename sequence_type::const_iterator itend(seq.cend());
+      if(it == itend)
+         return true;
+      for(typename sequence_type::const_iterator prev(it); ++it != itend; prev = it){
+         if(unique ? !value_comp(*prev, *it) : value_comp(*it, *prev))
+            return false;
+      }
+      return true;
+   }
+
+   //Stable sort that only moves elements, so it also works for movable but
+   //non-copyable values: pointers to the elements are sorted and then the
+   //permutation is applied following its cycles, moving each element once.
+   void priv_sort(sequence_type &seq) const
+   {
+      if(this->priv_is_sorted(seq, false))
+         return;
+
+      typedef flat_tree_indirect_compare<value_compare, value_type> indirect_compare;
+      const size_type n = seq.size();
+      value_type *const base = container_detail::to_raw_pointer(seq.data());
+      boost::container::vector<value_type*> ptrs(n);
+      for(size_type i = 0; i != n; ++i){
+         ptrs[i] = base + i;
+      }
+      std::stable_sort(ptrs.begin(), ptrs.end(), indirect_compare(this->m_data));
+
+      for(size_type i = 0; i != n; ++i){
+         if(ptrs[i] == base + i)
+            continue;
+         value_type tmp(boost::move(base[i]));
+         size_type j = i;
+         while(true){
+            const size_type src = static_cast<size_type>(ptrs[j] - base);
+            ptrs[j] = base + j;
+            if(src == i){
+               base[j] = boost::move(tmp);
+               break;
+            }
+            base[j] = boost::move(base[src]);
+            j = src;
+         }
+      }
+   }
+
+   //Removes elements equivalent to a preceding one from a sorted
+   //sequence, keeping the first one as insert_unique would
+   void priv_unique(sequence_type &seq) const
+   {
+      const value_compare &value_comp = this->m_data;
+      typename sequence_type::iterator it(seq.begin()), out(it);
+      const typename sequence_type::iterator itend(seq.end());
+      if(it == itend)
+         return;
+      while(++it != itend){
+         if(value_comp(*out, *it) && ++out != it){
+            *out = boost::move(*it);
+         }
+      }
+      seq.erase(++out, itend);
+   }
+
+   //Merges a sorted sequence of unique values into the tree, skipping the
+   //ones already present. The insertion points are found with a single
+   //forward pass of binary searches and then all the elements are inserted
+   //in one backwards pass, so each existing element is moved at most once.
+   void priv_merge_unique(sequence_type &seq)
+   {
+      if(this->priv_adopt_if_empty(seq))
+         return;
+      const value_compare &value_comp = this->m_data;
+      boost::container::vector<size_type> positions;
+      positions.reserve(seq.size());
+      const const_iterator b(this->cbegin()), e(this->cend());
+      const_iterator pos(b);
+      typename sequence_type::iterator out(seq.begin());
+      for(typename sequence_type::iterator it(out), itend(seq.end()); it != itend; ++it){
+         pos = this->priv_lower_bound(pos, e, KeyOfValue()(*it));
+         //Check if already present
+         if(pos != e && !value_comp(*it, *pos))
+            continue;
+         positions.push_back(static_cast<size_type>(pos - b));
+         if(out != it){
+            *out = boost::move(*it);
+         }
+         ++out;
+      }
+      seq.erase(out, seq.end());
+      this->priv_insert_ordered(seq, positions);
+   }
+
+   //Merges a sorted sequence into the tree, equivalent values are placed
+   //after the existing ones as insert_equal would
+   void priv_merge_equal(sequence_type &seq)
+   {
+      if(this->priv_adopt_if_empty(seq))
+         return;
+      boost::container::vector<size_type> positions;
+      positions.reserve(seq.size());
+      const const_iterator b(this->cbegin()), e(this->cend());
+      const_iterator pos(b);
+      for(typename sequence_type::iterator it(seq.begin()), itend(seq.end()); it != itend; ++it){
+         pos = this->priv_upper_bound(pos, e, KeyOfValue()(*it));
+         positions.push_back(static_cast<size_type>(pos - b));
+      }
+      this->priv_insert_ordered(seq, positions);
+   }
+
+   //An empty tree without enough capacity just takes the buffer
+   bool priv_adopt_if_empty(sequence_type &seq)
+   {
+      if(!this->m_data.m_vect.empty() || this->m_data.m_vect.capacity() >= seq.size())
+         return false;
+      this->m_data.m_vect.swap(seq);
+      return true;
+   }
+
+   void priv_insert_ordered(sequence_type &seq, const boost::container::vector<size_type> &positions)
+   {
+      BOOST_ASSERT(seq.size() == positions.size());
+      if(!seq.empty()){
+         this->m_data.m_vect.insert_ordered_at
+            (seq.size(), positions.cend(), boost::make_move_iterator(seq.end()));
       }
    }
 
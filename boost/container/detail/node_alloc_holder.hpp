@@ -276,6 +276,60 @@ struct node_alloc_holder
       }
    }
 
+   //Like allocate_many_and_construct, but "inserter" returns false if it
+   //rejects the node. Memory of rejected nodes is reused for the next
+   //element and unused memory is deallocated at the end.
+   template<class FwdIterator, class Inserter>
+   void allocate_many_and_construct_if
+      (FwdIterator beg, difference_type n, Inserter inserter)
+   {
+      if(n){
+         typedef typename node_allocator_version_traits_type::multiallocation_chain multiallocation_chain;
+
+         //Try to allocate memory in a single block
+         multiallocation_chain mem;
+         NodeAlloc &nalloc = this->node_alloc();
+         node_allocator_version_traits_type::allocate_individual(nalloc, n, mem);
+         Node *p = 0;
+         BOOST_TRY{
+            while(n--){
+               p = container_detail::to_raw_pointer(mem.pop_front());
+               //This can throw
+               boost::container::construct_in_place(nalloc, container_detail::addressof(p->m_data), beg);
+               ++beg;
+               //This does not throw
+               typedef typename Node::hook_type hook_type;
+               ::new(static_cast<hook_type*>(p)) hook_type;
+               bool inserted = false;
+               {
+                  //This can throw in some containers (predicate might throw).
+                  //sdestructor will destruct the node if it is not inserted
+                  container_detail::scoped_destructor<NodeAlloc> sdestructor(nalloc, p);
+                  inserted = inserter(*p);
+                  if(inserted){
+                     sdestructor.release();
+                  }
+               }
+               if(!inserted){
+                  mem.push_front(p);
+               }
+               p = 0;
+            }
+         }
+         BOOST_CATCH(...){
+            if(p){
+               mem.push_front(p);
+            }
+            node_allocator_version_traits_type::deallocate_individual(nalloc, mem);
+            BOOST_RETHROW
+         }
+         BOOST_CATCH_END
+         if(!mem.empty()){
+            node_allocator_version_traits_type::deallocate_individual(nalloc, mem);
+         }
+      }
+   }
+
    void clear(allocator_v1)
    {  this->icont().clear_and_dispose(Destroyer(this->node_alloc()));   }
 
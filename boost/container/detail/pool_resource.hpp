@@ -0,0 +1,314 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_POOL_RESOURCE_HPP
+#define BOOST_CONTAINER_DETAIL_POOL_RESOURCE_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/pool_options.hpp>
+#include <boost/container/detail/math_functions.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace container {
+namespace pmr {
+namespace pmr_detail {
+
+//Common implementation of unsynchronized_pool_resource and synchronized_pool_resource.
+//
+//Blocks are grouped in pools of power of two sizes, from min_block_size up to
+//largest_required_pool_block. Each pool keeps a free list of blocks and the list
+//of chunks obtained from the upstream resource. Each new chunk of a pool holds twice
+//as many blocks as the previous one, up to max_blocks_per_chunk. Deallocated blocks
+//are cached in the free list until release() is called.
+//
+//Bigger blocks, and blocks with an alignment bigger than max_align, are obtained
+//directly from the upstream resource and linked in a list so that release()
+//can free them.
+class pool_resource
+{
+   //Header of each chunk, placed at the beginning of the memory
+   struct chunk_header
+   {
+      chunk_header *next;
+      std::size_t   size;
+   };
+
+   //Header of each block obtained directly from upstream,
+   //placed just before the returned memory
+   struct oversized_header
+   {
+      oversized_header *prev;
+      oversized_header *next;
+      std::size_t       bytes;
+      std::size_t       alignment;
+   };
+
+   struct pool_data
+   {
+      void           *free_list;
+      chunk_header   *chunks;
+      std::size_t     next_blocks_per_chunk;
+   };
+
+   static std::size_t round_to_max_align(std::size_t n)
+   {  return (n + memory_resource::max_align - 1u) & ~(memory_resource::max_align - 1u);  }
+
+   static std::size_t oversized_header_size(std::size_t alignment)
+   {
+      const std::size_t s = round_to_max_align(sizeof(oversized_header));
+      return alignment > s ? alignment : s;
+   }
+
+   pool_options      m_options;
+   memory_resource  &m_upstream;
+   pool_data        *m_pools;
+   std::size_t       m_pool_count;
+   oversized_header  m_oversized;   //Header of a circular list
+
+   pool_resource(const pool_resource &);
+   pool_resource &operator=(const pool_resource &);
+
+   void priv_init_options()
+   {
+      std::size_t &max_blocks = m_options.max_blocks_per_chunk;
+      if(!max_blocks || max_blocks > pool_options_maximum_max_blocks_per_chunk){
+         max_blocks = max_blocks ? pool_options_maximum_max_blocks_per_chunk
+                                 : pool_options_default_max_blocks_per_chunk;
+      }
+      std::size_t &largest = m_options.largest_required_pool_block;
+      if(!largest){
+         largest = pool_options_default_largest_required_pool_block;
+      }
+      else if(largest > pool_options_maximum_largest_required_pool_block){
+         largest = pool_options_maximum_largest_required_pool_block;
+      }
+      else if(largest < min_block_size){
+         largest = min_block_size;
+      }
+      largest = container_detail::upper_power_of_2(largest);
+      m_pool_count = container_detail::floor_log2(largest) - container_detail::floor_log2(min_block_size) + 1u;
+      m_oversized.prev = m_oversized.next = &m_oversized;
+   }
+
+   void priv_init_pools()
+   {
+      m_pools = static_cast<pool_data*>(m_upstream.allocate(sizeof(pool_data)*m_pool_count));
+      for(std::size_t i = 0; i != m_pool_count; ++i){
+         m_pools[i].free_list = 0;
+         m_pools[i].chunks    = 0;
+         m_pools[i].next_blocks_per_chunk = initial_blocks_per_chunk < m_options.max_blocks_per_chunk
+            ? initial_blocks_per_chunk : m_options.max_blocks_per_chunk;
+      }
+   }
+
+   //Obtains a new chunk for the pool and puts its blocks in the free list
+   void priv_replenish(std::size_t pool_idx)
+   {
+      pool_data &pool = m_pools[pool_idx];
+      const std::size_t block_size = this->pool_block(pool_idx);
+      const std::size_t header_size = round_to_max_align(sizeof(chunk_header));
+      const std::size_t max_blocks = (std::size_t(-1)/2u)/block_size;
+      const std::size_t blocks = pool.next_blocks_per_chunk < max_blocks ? pool.next_blocks_per_chunk : max_blocks;
+      const std::size_t size = header_size + blocks*block_size;
+      chunk_header *const c = static_cast<chunk_header*>(m_upstream.allocate(size));
+      c->next = pool.chunks;
+      c->size = size;
+      pool.chunks = c;
+      //Link blocks in the free list, the first one will be allocated first
+      char *const first = reinterpret_cast<char*>(c) + header_size;
+      void *free_list = pool.free_list;
+      for(std::size_t i = blocks; i; --i){
+         void *const b = first + (i - 1u)*block_size;
+         *static_cast<void**>(b) = free_list;
+         free_list = b;
+      }
+      pool.free_list = free_list;
+      if(blocks <= m_options.max_blocks_per_chunk/2u){
+         pool.next_blocks_per_chunk = blocks*2u;
+      }
+      else{
+         pool.next_blocks_per_chunk = m_options.max_blocks_per_chunk;
+      }
+   }
+
+   void *priv_allocate_oversized(std::size_t bytes, std::size_t alignment)
+   {
+      const std::size_t header_size = oversized_header_size(alignment);
+      if(bytes > std::size_t(-1) - header_size){
+         throw_bad_alloc();
+      }
+      char *const raw = static_cast<char*>(m_upstream.allocate
+         (bytes + header_size, alignment > memory_resource::max_align ? alignment : memory_resource::max_align));
+      char *const p = raw + header_size;
+      oversized_header *const h = reinterpret_cast<oversized_header*>(p) - 1;
+      h->bytes = bytes;
+      h->alignment = alignment;
+      h->prev = &m_oversized;
+      h->next = m_oversized.next;
+      m_oversized.next->prev = h;
+      m_oversized.next = h;
+      return p;
+   }
+
+   void priv_deallocate_oversized(void *p)
+   {
+      oversized_header *const h = static_cast<oversized_header*>(p) - 1;
+      h->prev->next = h->next;
+      h->next->prev = h->prev;
+      this->priv_free_oversized(h);
+   }
+
+   void priv_free_oversized(oversized_header *h)
+   {
+      const std::size_t alignment = h->alignment;
+      const std::size_t header_size = oversized_header_size(alignment);
+      m_upstream.deallocate(reinterpret_cast<char*>(h + 1) - header_size, h->bytes + header_size
+         , alignment > memory_resource::max_align ? alignment : memory_resource::max_align);
+   }
+
+   bool priv_is_oversized(std::size_t bytes, std::size_t alignment) const
+   {
+      return bytes > m_options.largest_required_pool_block ||
+             alignment > memory_resource::max_align;
+   }
+
+   public:
+   static const std::size_t min_block_size = 2u*sizeof(void*);
+   static const std::size_t initial_blocks_per_chunk = 4u;
+   static const std::size_t pool_options_default_max_blocks_per_chunk = 256u;
+   static const std::size_t pool_options_maximum_max_blocks_per_chunk = std::size_t(1u) << 16u;
+   static const std::size_t pool_options_default_largest_required_pool_block = 4096u;
+   static const std::size_t pool_options_maximum_largest_required_pool_block = std::size_t(1u) << 20u;
+
+   pool_resource(const pool_options& opts, memory_resource* upstream) BOOST_CONTAINER_NOEXCEPT
+      : m_options(opts)
+      , m_upstream(upstream ? *upstream : *::boost::container::pmr::get_default_resource())
+      , m_pools(0)
+      , m_pool_count(0u)
+   {  this->priv_init_options();  }
+
+   ~pool_resource()
+   {  this->release();  }
+
+   void release()
+   {
+      if(m_pools){
+         for(std::size_t i = 0; i != m_pool_count; ++i){
+            chunk_header *c = m_pools[i].chunks;
+            while(c){
+               chunk_header *const next = c->next;
+               m_upstream.deallocate(c, c->size);
+               c = next;
+            }
+         }
+         m_upstream.deallocate(m_pools, sizeof(pool_data)*m_pool_count);
+         m_pools = 0;
+      }
+      while(m_oversized.next != &m_oversized){
+         oversized_header *const h = m_oversized.next;
+         m_oversized.next = h->next;
+         this->priv_free_oversized(h);
+      }
+      m_oversized.prev = &m_oversized;
+   }
+
+   memory_resource* upstream_resource() const
+   {  return &m_upstream;  }
+
+   pool_options options() const
+   {  return m_options;  }
+
+   void* do_allocate(std::size_t bytes, std::size_t alignment)
+   {
+      if(this->priv_is_oversized(bytes, alignment)){
+         return this->priv_allocate_oversized(bytes, alignment);
+      }
+      if(!m_pools){
+         this->priv_init_pools();
+      }
+      const std::size_t idx = this->pool_index(bytes > alignment ? bytes : alignment);
+      pool_data &pool = m_pools[idx];
+      if(!pool.free_list){
+         this->priv_replenish(idx);
+      }
+      void *const p = pool.free_list;
+      pool.free_list = *static_cast<void**>(p);
+      return p;
+   }
+
+   void do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+   {
+      if(this->priv_is_oversized(bytes, alignment)){
+         this->priv_deallocate_oversized(p);
+      }
+      else{
+         BOOST_ASSERT(m_pools);
+         pool_data &pool = m_pools[this->pool_index(bytes > alignment ? bytes : alignment)];
+         *static_cast<void**>(p) = pool.free_list;
+         pool.free_list = p;
+      }
+   }
+
+   //Non-standard observers
+
+   std::size_t pool_count() const
+   {  return m_pool_count;  }
+
+   std::size_t pool_index(std::size_t bytes) const
+   {
+      return bytes <= min_block_size ? 0u
+         : container_detail::floor_log2(bytes - 1u) + 1u - container_detail::floor_log2(min_block_size);
+   }
+
+   std::size_t pool_next_blocks_per_chunk(std::size_t pool_idx) const
+   {
+      BOOST_ASSERT(pool_idx < m_pool_count);
+      return m_pools ? m_pools[pool_idx].next_blocks_per_chunk
+         : (initial_blocks_per_chunk < m_options.max_blocks_per_chunk
+            ? initial_blocks_per_chunk : m_options.max_blocks_per_chunk);
+   }
+
+   std::size_t pool_block(std::size_t pool_idx) const
+   {
+      BOOST_ASSERT(pool_idx < m_pool_count);
+      return min_block_size << pool_idx;
+   }
+
+   std::size_t pool_cached_blocks(std::size_t pool_idx) const
+   {
+      BOOST_ASSERT(pool_idx < m_pool_count);
+      std::size_t n = 0;
+      if(m_pools){
+         for(void *p = m_pools[pool_idx].free_list; p; p = *static_cast<void**>(p)){
+            ++n;
+         }
+      }
+      return n;
+   }
+};
+
+}  //namespace pmr_detail {
+}  //namespace pmr {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_DETAIL_POOL_RESOURCE_HPP
@@ -192,6 +192,30 @@ class insert_equal_end_hint_functor
    {  this->icont_.insert_equal(this->icont_.cend(), n); }
 };
 
+template<class Node, class Icont, class KeyOfValue, class KeyNodeCompare>
+class insert_unique_end_hint_functor
+{
+   Icont &icont_;
+   KeyNodeCompare comp_;
+
+   public:
+   insert_unique_end_hint_functor(Icont &icont, const KeyNodeCompare &comp)
+      :  icont_(icont), comp_(comp)
+   {}
+
+   //Returns false if an equivalent element was already present
+   bool operator()(Node &n)
+   {
+      typename Icont::insert_commit_data data;
+      if(!this->icont_.insert_unique_check
+            (this->icont_.cend(), KeyOfValue()(n.get_data()), this->comp_, data).second){
+         return false;
+      }
+      this->icont_.insert_unique_commit(n, data);
+      return true;
+   }
+};
+
 template<class Node, class Icont>
 class push_back_functor
 {
@@ -462,13 +486,10 @@ class rbtree
       : AllocHolder(a, value_compare(comp))
    {
       if(unique_insertion){
-         //Use cend() as hint to achieve linear time for
-         //ordered ranges as required by the standard
-         //for the constructor
-         const const_iterator end_it(this->cend());
-         for ( ; first != last; ++first){
-            this->insert_unique(end_it, *first);
-         }
+         //Optimized allocation and construction. Use cend() as hint
+         //to achieve linear time for ordered ranges as required by
+         //the standard for the constructor
+         this->insert_unique(first, last);
       }
       else{
          //Optimized allocation and construction
@@ -902,12 +923,37 @@ class rbtree
    }
 
    template <class InputIterator>
-   void insert_unique(InputIterator first, InputIterator last)
+   void insert_unique(InputIterator first, InputIterator last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::enable_if_c
+         < container_detail::is_input_iterator<InputIterator>::value
+            || container_detail::is_same<alloc_version, allocator_v1>::value
+         >::type * = 0
+      #endif
+      )
    {
       for( ; first != last; ++first)
          this->insert_unique(*first);
    }
 
+   #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   template <class FwdIt>
+   void insert_unique(FwdIt first, FwdIt last
+      , typename container_detail::enable_if_c
+         < !(container_detail::is_input_iterator<FwdIt>::value
+            || container_detail::is_same<alloc_version, allocator_v1>::value)
+         >::type * = 0
+      )
+   {
+      //Optimized allocation and construction. Nodes of
+      //elements already present are reused or deallocated
+      this->allocate_many_and_construct_if
+         ( first, std::distance(first, last)
+         , insert_unique_end_hint_functor<Node, Icont, KeyOfValue, KeyNodeCompare>
+            (this->icont(), KeyNodeCompare(value_comp())));
+   }
+   #endif
+
    iterator insert_equal(const value_type& v)
    {
       NodePtr tmp(AllocHolder::create_node(v));
@@ -947,12 +993,35 @@ class rbtree
    }
 
    template <class InputIterator>
-   void insert_equal(InputIterator first, InputIterator last)
+   void insert_equal(InputIterator first, InputIterator last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::enable_if_c
+         < container_detail::is_input_iterator<InputIterator>::value
+            || container_detail::is_same<alloc_version, allocator_v1>::value
+         >::type * = 0
+      #endif
+      )
    {
       for( ; first != last; ++first)
          this->insert_equal(*first);
    }
 
+   #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   template <class FwdIt>
+   void insert_equal(FwdIt first, FwdIt last
+      , typename container_detail::enable_if_c
+         < !(container_detail::is_input_iterator<FwdIt>::value
+            || container_detail::is_same<alloc_version, allocator_v1>::value)
+         >::type * = 0
+      )
+   {
+      //Optimized allocation and construction
+      this->allocate_many_and_construct
+         ( first, std::distance(first, last)
+         , insert_equal_end_hint_functor<Node, Icont>(this->icont()));
+   }
+   #endif
+
    iterator erase(const_iterator position)
    {  return iterator(this->icont().erase_and_dispose(position.get(), Destroyer(this->node_alloc()))); }
 
@@ -0,0 +1,1576 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_CONTAINER_DEVECTOR_HPP
+#define BOOST_CONTAINER_CONTAINER_DEVECTOR_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <boost/detail/no_exceptions_support.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <boost/type_traits/has_nothrow_constructor.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/detail/utilities.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/preprocessor.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/move/iterator.hpp>
+#include <boost/move/algorithm.hpp>
+#include <boost/move/detail/move_helpers.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/detail/advanced_insert_int.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace container {
+
+/// @cond
+
+namespace container_detail {
+
+//!This struct deallocates and allocated memory. Elements live
+//!in [m_start + m_front, m_start + m_back)
+template <class Allocator>
+struct devector_alloc_holder
+   : public Allocator
+{
+   private:
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(devector_alloc_holder)
+
+   public:
+   typedef boost::container::allocator_traits<Allocator> allocator_traits_type;
+   typedef typename allocator_traits_type::pointer       pointer;
+   typedef typename allocator_traits_type::size_type     size_type;
+
+   //Constructor, does not throw
+   devector_alloc_holder()
+      BOOST_CONTAINER_NOEXCEPT_IF(::boost::has_nothrow_default_constructor<Allocator>::value)
+      : Allocator(), m_start(), m_capacity(), m_front(), m_back()
+   {}
+
+   //Constructor, does not throw
+   template<class AllocConvertible>
+   explicit devector_alloc_holder(BOOST_FWD_REF(AllocConvertible) a) BOOST_CONTAINER_NOEXCEPT
+      : Allocator(boost::forward<AllocConvertible>(a)), m_start(), m_capacity(), m_front(), m_back()
+   {}
+
+   devector_alloc_holder(BOOST_RV_REF(devector_alloc_holder) holder) BOOST_CONTAINER_NOEXCEPT
+      : Allocator(boost::move(static_cast<Allocator&>(holder)))
+      , m_start(holder.m_start)
+      , m_capacity(holder.m_capacity)
+      , m_front(holder.m_front)
+      , m_back(holder.m_back)
+   {
+      holder.m_start = pointer();
+      holder.m_capacity = holder.m_front = holder.m_back = 0;
+   }
+
+   ~devector_alloc_holder() BOOST_CONTAINER_NOEXCEPT
+   {
+      if(this->m_capacity){
+         this->alloc().deallocate(this->m_start, this->m_capacity);
+      }
+   }
+
+   size_type next_capacity(size_type additional_objects) const
+   {
+      return get_next_capacity( allocator_traits_type::max_size(this->alloc())
+                              , this->m_capacity, additional_objects);
+   }
+
+   void swap(devector_alloc_holder &x) BOOST_CONTAINER_NOEXCEPT
+   {
+      boost::container::swap_dispatch(this->m_start, x.m_start);
+      boost::container::swap_dispatch(this->m_capacity, x.m_capacity);
+      boost::container::swap_dispatch(this->m_front, x.m_front);
+      boost::container::swap_dispatch(this->m_back, x.m_back);
+   }
+
+   Allocator &alloc() BOOST_CONTAINER_NOEXCEPT
+   {  return *this;  }
+
+   const Allocator &alloc() const BOOST_CONTAINER_NOEXCEPT
+   {  return *this;  }
+
+   pointer     m_start;
+   size_type   m_capacity;
+   size_type   m_front;
+   size_type   m_back;
+};
+
+}  //namespace container_detail {
+
+/// @endcond
+
+//! \class devector
+//! A devector is a double-ended vector: a sequence that supports random access
+//! to elements and contiguous storage like vector, but that also keeps free
+//! capacity before the first element, so insertion and removal of elements at
+//! the beginning take amortized constant time, as at the end.
+//!
+//! When one end runs out of free capacity and the devector is at most one third
+//! full, elements are moved to the middle of the buffer instead of allocating a
+//! new one, so a devector used as a queue does not grow without bound. Insertions
+//! in the middle shift the elements towards the nearest end.
+//!
+//! \tparam T The type of object that is stored in the devector
+//! \tparam Allocator The allocator used for all internal memory management
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+template <class T, class Allocator = std::allocator<T> >
+#else
+template <class T, class Allocator>
+#endif
+class devector
+{
+   /// @cond
+   container_detail::devector_alloc_holder<Allocator>       m_holder;
+   typedef allocator_traits<Allocator>                      allocator_traits_type;
+
+   typedef typename ::boost::container::allocator_traits
+      <Allocator>::pointer                                     pointer_impl;
+   typedef container_detail::vec_iterator<pointer_impl, false> iterator_impl;
+   typedef container_detail::vec_iterator<pointer_impl, true > const_iterator_impl;
+
+   /// @endcond
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef T                                                                           value_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer           pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_pointer     const_pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::reference         reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_reference   const_reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::size_type         size_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::difference_type   difference_type;
+   typedef Allocator                                                                   allocator_type;
+   typedef Allocator                                                                   stored_allocator_type;
+   #if defined BOOST_CONTAINER_VECTOR_ITERATOR_IS_POINTER && !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   typedef BOOST_CONTAINER_IMPDEF(pointer)                                             iterator;
+   typedef BOOST_CONTAINER_IMPDEF(const_pointer)                                       const_iterator;
+   #else
+   typedef BOOST_CONTAINER_IMPDEF(iterator_impl)                                       iterator;
+   typedef BOOST_CONTAINER_IMPDEF(const_iterator_impl)                                 const_iterator;
+   #endif
+   typedef BOOST_CONTAINER_IMPDEF(std::reverse_iterator<iterator>)                     reverse_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(std::reverse_iterator<const_iterator>)               const_reverse_iterator;
+
+   /// @cond
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(devector)
+   typedef container_detail::vector_value_traits<value_type, Allocator> value_traits;
+   typedef constant_iterator<T, difference_type>            cvalue_iterator;
+   /// @endcond
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs a devector taking the allocator as parameter.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   devector()
+      BOOST_CONTAINER_NOEXCEPT_IF(::boost::has_nothrow_default_constructor<Allocator>::value)
+      : m_holder()
+   {}
+
+   //! <b>Effects</b>: Constructs a devector taking the allocator as parameter.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit devector(const Allocator& a) BOOST_CONTAINER_NOEXCEPT
+      : m_holder(a)
+   {}
+
+   //! <b>Effects</b>: Constructs a devector and inserts n value initialized values.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor or allocation
+   //!   throws or T's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   explicit devector(size_type n)
+      : m_holder()
+   {
+      container_detail::insert_value_initialized_n_proxy<Allocator, T*> proxy(this->m_holder.alloc());
+      this->priv_insert_n(0u, n, proxy);
+   }
+
+   //! <b>Effects</b>: Constructs a devector and inserts n default initialized values.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor or allocation
+   //!   throws or T's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   devector(size_type n, default_init_t)
+      : m_holder()
+   {
+      container_detail::insert_default_initialized_n_proxy<Allocator, T*> proxy(this->m_holder.alloc());
+      this->priv_insert_n(0u, n, proxy);
+   }
+
+   //! <b>Effects</b>: Constructs a devector and inserts n copies of value.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor or allocation
+   //!   throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   devector(size_type n, const T& value)
+      : m_holder()
+   {  this->insert(this->cend(), n, value);  }
+
+   //! <b>Effects</b>: Constructs a devector that will use a copy of allocator a
+   //!   and inserts n copies of value.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   devector(size_type n, const T& value, const allocator_type& a)
+      : m_holder(a)
+   {  this->insert(this->cend(), n, value);  }
+
+   //! <b>Effects</b>: Constructs a devector and inserts a copy of the range [first, last).
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor or allocation
+   //!   throws or T's constructor taking a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   devector(InIt first, InIt last)
+      : m_holder()
+   {  this->insert(this->cend(), first, last);  }
+
+   //! <b>Effects</b>: Constructs a devector that will use a copy of allocator a
+   //!   and inserts a copy of the range [first, last).
+   //!
+   //! <b>Throws</b>: If allocation throws or T's constructor taking
+   //!   a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   devector(InIt first, InIt last, const allocator_type& a)
+      : m_holder(a)
+   {  this->insert(this->cend(), first, last);  }
+
+   //! <b>Effects</b>: Copy constructs a devector. No free capacity is reserved
+   //!   at either end.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor or allocation
+   //!   throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   devector(const devector &x)
+      : m_holder(allocator_traits_type::select_on_container_copy_construction(x.m_holder.alloc()))
+   {  this->insert(this->cend(), x.begin(), x.end());  }
+
+   //! <b>Effects</b>: Copy constructs a devector using the specified allocator.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   devector(const devector &x, const allocator_type &a)
+      : m_holder(a)
+   {  this->insert(this->cend(), x.begin(), x.end());  }
+
+   //! <b>Effects</b>: Move constructor. Moves mx's resources to *this.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   devector(BOOST_RV_REF(devector) mx) BOOST_CONTAINER_NOEXCEPT
+      : m_holder(boost::move(mx.m_holder))
+   {}
+
+   //! <b>Effects</b>: Move constructor using the specified allocator.
+   //!                 Moves mx's resources to *this if a == mx.get_allocator().
+   //!                 Otherwise elements are moved one by one.
+   //!
+   //! <b>Throws</b>: If allocation or T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant if a == mx.get_allocator(), linear otherwise.
+   devector(BOOST_RV_REF(devector) mx, const allocator_type &a)
+      : m_holder(a)
+   {
+      if(mx.m_holder.alloc() == a){
+         this->m_holder.swap(mx.m_holder);
+      }
+      else{
+         this->insert( this->cend()
+                     , boost::make_move_iterator(mx.begin())
+                     , boost::make_move_iterator(mx.end()));
+      }
+   }
+
+   //! <b>Effects</b>: Destroys the devector. All stored values are destroyed
+   //!   and used memory is deallocated.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements.
+   ~devector() BOOST_CONTAINER_NOEXCEPT
+   {
+      boost::container::destroy_alloc_n
+         (this->get_stored_allocator(), this->priv_raw_begin(), this->size());
+      //devector_alloc_holder deallocates the data
+   }
+
+   //! <b>Effects</b>: Makes *this contain the same elements as x.
+   //!
+   //! <b>Postcondition</b>: this->size() == x.size(). *this contains a copy
+   //! of each of x's elements.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in x.
+   devector& operator=(BOOST_COPY_ASSIGN_REF(devector) x)
+   {
+      if (&x != this){
+         allocator_type &this_alloc     = this->m_holder.alloc();
+         const allocator_type &x_alloc  = x.m_holder.alloc();
+         container_detail::bool_<allocator_traits_type::
+            propagate_on_container_copy_assignment::value> flag;
+         if(flag && this_alloc != x_alloc){
+            this->clear();
+            this->shrink_to_fit();
+         }
+         container_detail::assign_alloc(this_alloc, x_alloc, flag);
+         this->assign(x.begin(), x.end());
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assignment. All x's values are transferred to *this.
+   //!
+   //! <b>Postcondition</b>: x.empty(). *this contains a the elements x had
+   //!   before the function.
+   //!
+   //! <b>Throws</b>: If allocators are not equal and T's move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Constant if allocators are equal, linear otherwise.
+   devector& operator=(BOOST_RV_REF(devector) x)
+   {
+      if (&x != this){
+         allocator_type &this_alloc = this->m_holder.alloc();
+         allocator_type &x_alloc    = x.m_holder.alloc();
+         //If allocators are equal we can just swap pointers
+         if(this_alloc == x_alloc){
+            //Destroy objects but retain memory in case x reuses it in the future
+            this->clear();
+            this->m_holder.swap(x.m_holder);
+            //Move allocator if needed
+            container_detail::bool_<allocator_traits_type::
+               propagate_on_container_move_assignment::value> flag;
+            container_detail::move_alloc(this_alloc, x_alloc, flag);
+         }
+         //If unequal allocators, then do a one by one move
+         else{
+            this->assign( boost::make_move_iterator(x.begin())
+                        , boost::make_move_iterator(x.end()));
+         }
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Assigns the the range [first, last) to *this.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor/assignment or
+   //!   T's constructor/assignment from dereferencing InpIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   template <class InIt>
+   void assign(InIt first, InIt last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::enable_if_c
+         < !container_detail::is_convertible<InIt, size_type>::value
+         >::type * = 0
+      #endif
+      )
+   {
+      //Overwrite all elements we can from [first, last)
+      iterator cur = this->begin();
+      const iterator end_it = this->end();
+      for ( ; first != last && cur != end_it; ++cur, ++first){
+         *cur = *first;
+      }
+
+      if (first == last){
+         //There are no more elements in the sequence, erase remaining
+         this->erase(cur, end_it);
+      }
+      else{
+         //There are more elements in the range, insert the remaining ones
+         this->insert(this->cend(), first, last);
+      }
+   }
+
+   //! <b>Effects</b>: Assigns the n copies of val to *this.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   void assign(size_type n, const value_type& val)
+   {  this->assign(cvalue_iterator(val, n), cvalue_iterator());   }
+
+   //! <b>Effects</b>: Returns a copy of the internal allocator.
+   //!
+   //! <b>Throws</b>: If allocator's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const BOOST_CONTAINER_NOEXCEPT
+   { return this->m_holder.alloc();  }
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   stored_allocator_type &get_stored_allocator() BOOST_CONTAINER_NOEXCEPT
+   {  return this->m_holder.alloc(); }
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   const stored_allocator_type &get_stored_allocator() const BOOST_CONTAINER_NOEXCEPT
+   {  return this->m_holder.alloc(); }
+
+   //////////////////////////////////////////////
+   //
+   //                iterators
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns an iterator to the first element contained in the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator begin() BOOST_CONTAINER_NOEXCEPT
+   { return iterator(this->m_holder.m_start + this->m_holder.m_front); }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator begin() const BOOST_CONTAINER_NOEXCEPT
+   { return this->cbegin(); }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator end() BOOST_CONTAINER_NOEXCEPT
+   { return iterator(this->m_holder.m_start + this->m_holder.m_back); }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator end() const BOOST_CONTAINER_NOEXCEPT
+   { return this->cend(); }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rbegin() BOOST_CONTAINER_NOEXCEPT
+   { return reverse_iterator(this->end());      }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rbegin() const BOOST_CONTAINER_NOEXCEPT
+   { return this->crbegin(); }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rend() BOOST_CONTAINER_NOEXCEPT
+   { return reverse_iterator(this->begin());       }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rend() const BOOST_CONTAINER_NOEXCEPT
+   { return this->crend(); }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cbegin() const BOOST_CONTAINER_NOEXCEPT
+   { return const_iterator(this->m_holder.m_start + this->m_holder.m_front); }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cend() const BOOST_CONTAINER_NOEXCEPT
+   { return const_iterator(this->m_holder.m_start + this->m_holder.m_back); }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crbegin() const BOOST_CONTAINER_NOEXCEPT
+   { return const_reverse_iterator(this->cend());}
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crend() const BOOST_CONTAINER_NOEXCEPT
+   { return const_reverse_iterator(this->cbegin()); }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns true if the devector contains no elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bool empty() const BOOST_CONTAINER_NOEXCEPT
+   { return this->m_holder.m_front == this->m_holder.m_back; }
+
+   //! <b>Effects</b>: Returns the number of the elements contained in the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type size() const BOOST_CONTAINER_NOEXCEPT
+   { return this->m_holder.m_back - this->m_holder.m_front; }
+
+   //! <b>Effects</b>: Returns the largest possible size of the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type max_size() const BOOST_CONTAINER_NOEXCEPT
+   { return allocator_traits_type::max_size(this->m_holder.alloc()); }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes n. New elements are value initialized.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move or value initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size.
+   void resize(size_type new_size)
+   {
+      const size_type sz = this->size();
+      if (new_size < sz){
+         this->priv_destroy_last_n(sz - new_size);
+      }
+      else{
+         container_detail::insert_value_initialized_n_proxy<Allocator, T*> proxy(this->m_holder.alloc());
+         this->priv_insert_n(sz, new_size - sz, proxy);
+      }
+   }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes n. New elements are default initialized.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move or default initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   void resize(size_type new_size, default_init_t)
+   {
+      const size_type sz = this->size();
+      if (new_size < sz){
+         this->priv_destroy_last_n(sz - new_size);
+      }
+      else{
+         container_detail::insert_default_initialized_n_proxy<Allocator, T*> proxy(this->m_holder.alloc());
+         this->priv_insert_n(sz, new_size - sz, proxy);
+      }
+   }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes n. New elements are copy constructed from x.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size.
+   void resize(size_type new_size, const T& x)
+   {
+      const size_type sz = this->size();
+      if (new_size < sz){
+         this->priv_destroy_last_n(sz - new_size);
+      }
+      else{
+         this->insert(this->cend(), new_size - sz, x);
+      }
+   }
+
+   //! <b>Effects</b>: Number of elements for which memory has been allocated,
+   //!   including the free capacity at both ends.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type capacity() const BOOST_CONTAINER_NOEXCEPT
+   { return this->m_holder.m_capacity; }
+
+   //! <b>Effects</b>: Number of elements that can be inserted at the beginning
+   //!   without reallocating or moving the elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type front_free_capacity() const BOOST_CONTAINER_NOEXCEPT
+   { return this->m_holder.m_front; }
+
+   //! <b>Effects</b>: Number of elements that can be inserted at the end
+   //!   without reallocating or moving the elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type back_free_capacity() const BOOST_CONTAINER_NOEXCEPT
+   { return this->m_holder.m_capacity - this->m_holder.m_back; }
+
+   //! <b>Effects</b>: Same as reserve_back(new_cap).
+   //!
+   //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
+   void reserve(size_type new_cap)
+   {  this->reserve_back(new_cap);  }
+
+   //! <b>Effects</b>: If size() + back_free_capacity() is less than new_cap, reallocates
+   //!   so that new_cap - size() elements can be inserted at the end without
+   //!   further allocations. Free capacity at the beginning is preserved.
+   //!
+   //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   void reserve_back(size_type new_cap)
+   {
+      if(this->m_holder.m_capacity - this->m_holder.m_front < new_cap){
+         if(new_cap > this->max_size() - this->m_holder.m_front){
+            throw_length_error("get_next_capacity, allocator's max_size reached");
+         }
+         this->priv_reallocate(this->m_holder.m_front + new_cap, this->m_holder.m_front);
+      }
+   }
+
+   //! <b>Effects</b>: If size() + front_free_capacity() is less than new_cap, reallocates
+   //!   so that new_cap - size() elements can be inserted at the beginning without
+   //!   further allocations. Free capacity at the end is preserved.
+   //!
+   //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   void reserve_front(size_type new_cap)
+   {
+      if(this->m_holder.m_back < new_cap){
+         const size_type back_free = this->back_free_capacity();
+         if(new_cap > this->max_size() - back_free){
+            throw_length_error("get_next_capacity, allocator's max_size reached");
+         }
+         this->priv_reallocate(new_cap + back_free, new_cap - this->size());
+      }
+   }
+
+   //! <b>Effects</b>: Tries to deallocate the excess of memory created
+   //!   with previous allocations. The size of the devector is unchanged
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void shrink_to_fit()
+   {
+      const size_type sz = this->size();
+      if(sz < this->m_holder.m_capacity){
+         if(!sz){
+            this->m_holder.alloc().deallocate(this->m_holder.m_start, this->m_holder.m_capacity);
+            this->m_holder.m_start = pointer();
+            this->m_holder.m_capacity = this->m_holder.m_front = this->m_holder.m_back = 0;
+         }
+         else{
+            this->priv_reallocate(sz, 0u);
+         }
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the first
+   //!   element of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference front() BOOST_CONTAINER_NOEXCEPT
+   { return *this->priv_raw_begin(); }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a const reference to the first
+   //!   element of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference front() const BOOST_CONTAINER_NOEXCEPT
+   { return *this->priv_raw_begin(); }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the last
+   //!   element of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference back() BOOST_CONTAINER_NOEXCEPT
+   { return this->priv_raw_end()[-1]; }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a const reference to the last
+   //!   element of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference back()  const BOOST_CONTAINER_NOEXCEPT
+   { return this->priv_raw_end()[-1]; }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a reference to the nth element
+   //!   from the beginning of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference operator[](size_type n) BOOST_CONTAINER_NOEXCEPT
+   { return this->priv_raw_begin()[n]; }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a const reference to the nth element
+   //!   from the beginning of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference operator[](size_type n) const BOOST_CONTAINER_NOEXCEPT
+   { return this->priv_raw_begin()[n]; }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a reference to the nth element
+   //!   from the beginning of the container.
+   //!
+   //! <b>Throws</b>: std::range_error if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference at(size_type n)
+   { this->priv_check_range(n); return this->priv_raw_begin()[n]; }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a const reference to the nth element
+   //!   from the beginning of the container.
+   //!
+   //! <b>Throws</b>: std::range_error if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference at(size_type n) const
+   { this->priv_check_range(n); return this->priv_raw_begin()[n]; }
+
+   //////////////////////////////////////////////
+   //
+   //                 data access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Returns</b>: Allocator pointer such that [data(),data() + size()) is a valid range.
+   //!   For a non-empty devector, data() == &front().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   T* data() BOOST_CONTAINER_NOEXCEPT
+   { return this->priv_raw_begin(); }
+
+   //! <b>Returns</b>: Allocator pointer such that [data(),data() + size()) is a valid range.
+   //!   For a non-empty devector, data() == &front().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const T * data()  const BOOST_CONTAINER_NOEXCEPT
+   { return this->priv_raw_begin(); }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   #if defined(BOOST_CONTAINER_PERFECT_FORWARDING) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... in the end of the devector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws or
+   //!   T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   template<class ...Args>
+   void emplace_back(Args &&...args)
+   {
+      if (this->m_holder.m_back < this->m_holder.m_capacity){
+         //There is more memory, just construct a new object at the end
+         allocator_traits_type::construct
+            (this->m_holder.alloc(), this->priv_raw_end(), ::boost::forward<Args>(args)...);
+         ++this->m_holder.m_back;
+      }
+      else{
+         typedef container_detail::insert_emplace_proxy<Allocator, T*, Args...> type;
+         this->priv_insert_n(this->size(), 1, type(this->m_holder.alloc(), ::boost::forward<Args>(args)...));
+      }
+   }
+
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... in the beginning of the devector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws or
+   //!   T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   template<class ...Args>
+   void emplace_front(Args &&...args)
+   {
+      if (this->m_holder.m_front){
+         //There is more memory, just construct a new object at the beginning
+         allocator_traits_type::construct
+            (this->m_holder.alloc(), this->priv_raw_begin() - 1, ::boost::forward<Args>(args)...);
+         --this->m_holder.m_front;
+      }
+      else{
+         typedef container_detail::insert_emplace_proxy<Allocator, T*, Args...> type;
+         this->priv_insert_n(0u, 1, type(this->m_holder.alloc(), ::boost::forward<Args>(args)...));
+      }
+   }
+
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... before position
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws or
+   //!   T's move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: If position is begin() or end(), amortized constant time.
+   //!   Otherwise linear to the distance to the nearest end.
+   template<class ...Args>
+   iterator emplace(const_iterator position, Args && ...args)
+   {
+      typedef container_detail::insert_emplace_proxy<Allocator, T*, Args...> type;
+      return this->priv_iterator(this->priv_insert_n
+         (this->priv_index_of(position), 1, type(this->m_holder.alloc(), ::boost::forward<Args>(args)...)));
+   }
+
+   #else
+
+   #define BOOST_PP_LOCAL_MACRO(n)                                                                    \
+   BOOST_PP_EXPR_IF(n, template<) BOOST_PP_ENUM_PARAMS(n, class P) BOOST_PP_EXPR_IF(n, >)             \
+   void emplace_back(BOOST_PP_ENUM(n, BOOST_CONTAINER_PP_PARAM_LIST, _))                              \
+   {                                                                                                  \
+      if (this->m_holder.m_back < this->m_holder.m_capacity){                                         \
+         allocator_traits_type::construct (this->m_holder.alloc()                                     \
+            , this->priv_raw_end() BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _) );  \
+         ++this->m_holder.m_back;                                                                     \
+      }                                                                                               \
+      else{                                                                                           \
+         container_detail::BOOST_PP_CAT(insert_emplace_proxy_arg, n)                                  \
+            <Allocator, T* BOOST_PP_ENUM_TRAILING_PARAMS(n, P)> proxy                                 \
+            (this->m_holder.alloc() BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _));  \
+         this->priv_insert_n(this->size(), 1, proxy);                                                 \
+      }                                                                                               \
+   }                                                                                                  \
+                                                                                                      \
+   BOOST_PP_EXPR_IF(n, template<) BOOST_PP_ENUM_PARAMS(n, class P) BOOST_PP_EXPR_IF(n, >)             \
+   void emplace_front(BOOST_PP_ENUM(n, BOOST_CONTAINER_PP_PARAM_LIST, _))                             \
+   {                                                                                                  \
+      if (this->m_holder.m_front){                                                                    \
+         allocator_traits_type::construct (this->m_holder.alloc()                                     \
+            , this->priv_raw_begin() - 1                                                              \
+            BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _) );                         \
+         --this->m_holder.m_front;                                                                    \
+      }                                                                                               \
+      else{                                                                                           \
+         container_detail::BOOST_PP_CAT(insert_emplace_proxy_arg, n)                                  \
+            <Allocator, T* BOOST_PP_ENUM_TRAILING_PARAMS(n, P)> proxy                                 \
+            (this->m_holder.alloc() BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _));  \
+         this->priv_insert_n(0u, 1, proxy);                                                           \
+      }                                                                                               \
+   }                                                                                                  \
+                                                                                                      \
+   BOOST_PP_EXPR_IF(n, template<) BOOST_PP_ENUM_PARAMS(n, class P) BOOST_PP_EXPR_IF(n, >)             \
+   iterator emplace(const_iterator pos                                                                \
+                    BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_LIST, _))                      \
+   {                                                                                                  \
+      container_detail::BOOST_PP_CAT(insert_emplace_proxy_arg, n)                                     \
+         <Allocator, T* BOOST_PP_ENUM_TRAILING_PARAMS(n, P)> proxy                                    \
+            (this->m_holder.alloc() BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _));  \
+      return this->priv_iterator(this->priv_insert_n(this->priv_index_of(pos), 1, proxy));           \
+   }                                                                                                  \
+   //!
+   #define BOOST_PP_LOCAL_LIMITS (0, BOOST_CONTAINER_MAX_CONSTRUCTOR_PARAMETERS)
+   #include BOOST_PP_LOCAL_ITERATE()
+
+   #endif   //#ifdef BOOST_CONTAINER_PERFECT_FORWARDING
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts a copy of x at the end of the devector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_back(const T &x);
+
+   //! <b>Effects</b>: Constructs a new element in the end of the devector
+   //!   and moves the resources of x to this new element.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_back(T &&x);
+
+   //! <b>Effects</b>: Inserts a copy of x at the beginning of the devector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_front(const T &x);
+
+   //! <b>Effects</b>: Constructs a new element in the beginning of the devector
+   //!   and moves the resources of x to this new element.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_front(T &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH(push_back, T, void, priv_push_back)
+   BOOST_MOVE_CONVERSION_AWARE_CATCH(push_front, T, void, priv_push_front)
+   #endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert a copy of x before position.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: If position is begin() or end(), amortized constant time.
+   //!   Otherwise linear to the distance to the nearest end.
+   iterator insert(const_iterator position, const T &x);
+
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert a new element before position with x's resources.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   //!
+   //! <b>Complexity</b>: If position is begin() or end(), amortized constant time.
+   //!   Otherwise linear to the distance to the nearest end.
+   iterator insert(const_iterator position, T &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH_1ARG(insert, T, iterator, priv_insert, const_iterator, const_iterator)
+   #endif
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert n copies of x before pos.
+   //!
+   //! <b>Returns</b>: an iterator to the first inserted element or p if n is 0.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n plus the distance from p to the nearest end.
+   iterator insert(const_iterator p, size_type n, const T& x)
+   {
+      container_detail::insert_n_copies_proxy<Allocator, T*> proxy(this->m_holder.alloc(), x);
+      return this->priv_iterator(this->priv_insert_n(this->priv_index_of(p), n, proxy));
+   }
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert a copy of the [first, last) range before pos.
+   //!
+   //! <b>Returns</b>: an iterator to the first inserted element or pos if first == last.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, T's constructor from a
+   //!   dereferenced InpIt throws or T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to std::distance [first, last) plus the
+   //!   distance from pos to the nearest end.
+   template <class InIt>
+   iterator insert(const_iterator pos, InIt first, InIt last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::enable_if_c
+         < !container_detail::is_convertible<InIt, size_type>::value
+            && container_detail::is_input_iterator<InIt>::value
+         >::type * = 0
+      #endif
+      )
+   {
+      const size_type n_pos = this->priv_index_of(pos);
+      iterator it(this->priv_iterator(this->priv_raw_begin() + n_pos));
+      for(;first != last; ++first){
+         it = this->emplace(it, *first);
+         ++it;
+      }
+      return this->begin() + n_pos;
+   }
+
+   #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   template <class FwdIt>
+   iterator insert(const_iterator pos, FwdIt first, FwdIt last
+      , typename container_detail::enable_if_c
+         < !container_detail::is_convertible<FwdIt, size_type>::value
+            && !container_detail::is_input_iterator<FwdIt>::value
+         >::type * = 0
+      )
+   {
+      container_detail::insert_range_proxy<Allocator, FwdIt, T*> proxy(this->m_holder.alloc(), first);
+      return this->priv_iterator(this->priv_insert_n
+         (this->priv_index_of(pos), static_cast<size_type>(std::distance(first, last)), proxy));
+   }
+   #endif
+
+   //! <b>Effects</b>: Removes the last element from the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   void pop_back() BOOST_CONTAINER_NOEXCEPT
+   {  this->priv_destroy_last_n(1u);  }
+
+   //! <b>Effects</b>: Removes the first element from the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   void pop_front() BOOST_CONTAINER_NOEXCEPT
+   {
+      this->priv_destroy(this->priv_raw_begin());
+      ++this->m_holder.m_front;
+   }
+
+   //! <b>Effects</b>: Erases the element at position pos.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the distance from pos to the nearest end.
+   iterator erase(const_iterator position)
+   {  return this->erase(position, position + 1);  }
+
+   //! <b>Effects</b>: Erases the elements pointed by [first, last).
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the distance between first and last
+   //!   plus the distance to the nearest end.
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      T* const raw_first = container_detail::to_raw_pointer(vector_iterator_get_ptr(first));
+      T* const raw_last  = container_detail::to_raw_pointer(vector_iterator_get_ptr(last));
+      T* const old_begin = this->priv_raw_begin();
+      T* const old_end   = this->priv_raw_end();
+      const size_type n  = static_cast<size_type>(raw_last - raw_first);
+      if(!n){
+         return this->priv_iterator(raw_first);
+      }
+      //Shift the elements on the shortest side
+      else if((raw_first - old_begin) < (old_end - raw_last)){
+         boost::move_backward(old_begin, raw_first, raw_last);
+         boost::container::destroy_alloc_n(this->get_stored_allocator(), old_begin, n);
+         this->m_holder.m_front += n;
+         return this->priv_iterator(raw_last);
+      }
+      else{
+         boost::move(raw_last, old_end, raw_first);
+         this->priv_destroy_last_n(n);
+         return this->priv_iterator(raw_first);
+      }
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(devector& x) BOOST_CONTAINER_NOEXCEPT
+   {
+      this->m_holder.swap(x.m_holder);
+      container_detail::bool_<allocator_traits_type::propagate_on_container_swap::value> flag;
+      container_detail::swap_alloc(this->m_holder.alloc(), x.m_holder.alloc(), flag);
+   }
+
+   //! <b>Effects</b>: Erases all the elements of the devector. The whole capacity
+   //!   becomes free capacity at the end.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the devector.
+   void clear() BOOST_CONTAINER_NOEXCEPT
+   {
+      boost::container::destroy_alloc_n
+         (this->get_stored_allocator(), this->priv_raw_begin(), this->size());
+      this->m_holder.m_front = this->m_holder.m_back = 0;
+   }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(devector& x, devector& y)
+   {  x.swap(y);  }
+
+   /// @cond
+
+   private:
+
+   T *priv_raw_begin() const BOOST_CONTAINER_NOEXCEPT
+   {  return container_detail::to_raw_pointer(this->m_holder.m_start) + this->m_holder.m_front;  }
+
+   T *priv_raw_end() const BOOST_CONTAINER_NOEXCEPT
+   {  return container_detail::to_raw_pointer(this->m_holder.m_start) + this->m_holder.m_back;  }
+
+   iterator priv_iterator(T *p) const BOOST_CONTAINER_NOEXCEPT
+   {
+      return iterator(this->m_holder.m_start +
+         (p - container_detail::to_raw_pointer(this->m_holder.m_start)));
+   }
+
+   size_type priv_index_of(const const_iterator &p) const BOOST_CONTAINER_NOEXCEPT
+   {
+      return static_cast<size_type>
+         (container_detail::to_raw_pointer(vector_iterator_get_ptr(p)) - this->priv_raw_begin());
+   }
+
+   void priv_check_range(size_type n) const
+   {
+      //If n is out of range, throw an out_of_range exception
+      if (n >= this->size()){
+         throw_out_of_range("devector::at out of range");
+      }
+   }
+
+   void priv_destroy(value_type* p) BOOST_CONTAINER_NOEXCEPT
+   {
+      if(!value_traits::trivial_dctr)
+         allocator_traits_type::destroy(this->get_stored_allocator(), p);
+   }
+
+   void priv_destroy_last_n(size_type n) BOOST_CONTAINER_NOEXCEPT
+   {
+      boost::container::destroy_alloc_n(this->get_stored_allocator(), this->priv_raw_end() - n, n);
+      this->m_holder.m_back -= n;
+   }
+
+   //Destroys moved elements and deallocates the old buffer
+   //before new_start is adopted
+   void priv_adopt_buffer(const pointer &new_start, size_type new_cap, size_type new_front, size_type new_size)
+   {
+      if(!value_traits::trivial_dctr_after_move)
+         boost::container::destroy_alloc_n(this->get_stored_allocator(), this->priv_raw_begin(), this->size());
+      if(this->m_holder.m_capacity){
+         this->m_holder.alloc().deallocate(this->m_holder.m_start, this->m_holder.m_capacity);
+      }
+      this->m_holder.m_start     = new_start;
+      this->m_holder.m_capacity  = new_cap;
+      this->m_holder.m_front     = new_front;
+      this->m_holder.m_back      = new_front + new_size;
+   }
+
+   void priv_reallocate(size_type new_cap, size_type new_front)
+   {
+      const size_type sz = this->size();
+      BOOST_ASSERT(new_front + sz <= new_cap);
+      pointer new_start = this->m_holder.alloc().allocate(new_cap);
+      container_detail::scoped_array_deallocator<Allocator> new_buffer_deallocator
+         (new_start, this->m_holder.alloc(), new_cap);
+      ::boost::container::uninitialized_move_alloc_n
+         ( this->m_holder.alloc(), this->priv_raw_begin(), sz
+         , container_detail::to_raw_pointer(new_start) + new_front);
+      new_buffer_deallocator.release();
+      this->priv_adopt_buffer(new_start, new_cap, new_front, sz);
+   }
+
+   //Moves the elements inside the buffer so that the first one is placed
+   //at new_front. Source and destination ranges might overlap.
+   void priv_relocate(size_type new_front)
+   {
+      const size_type old_front = this->m_holder.m_front;
+      const size_type sz = this->size();
+      T* const raw_start = container_detail::to_raw_pointer(this->m_holder.m_start);
+      T* const old_begin = raw_start + old_front;
+      T* const new_begin = raw_start + new_front;
+      Allocator &a = this->m_holder.alloc();
+      if(new_front < old_front){
+         //Moving towards the beginning: the first part of the destination is raw memory
+         const size_type raw_n = container_detail::min_value(sz, old_front - new_front);
+         ::boost::container::uninitialized_move_alloc_n(a, old_begin, raw_n, new_begin);
+         boost::move(old_begin + raw_n, old_begin + sz, new_begin + raw_n);
+         boost::container::destroy_alloc_n(a, old_begin + (sz - raw_n), raw_n);
+      }
+      else if(old_front < new_front){
+         //Moving towards the end: the last part of the destination is raw memory
+         const size_type raw_n = container_detail::min_value(sz, new_front - old_front);
+         ::boost::container::uninitialized_move_alloc_n(a, old_begin + (sz - raw_n), raw_n, new_begin + (sz - raw_n));
+         boost::move_backward(old_begin, old_begin + (sz - raw_n), new_begin + (sz - raw_n));
+         boost::container::destroy_alloc_n(a, old_begin, raw_n);
+      }
+      this->m_holder.m_front = new_front;
+      this->m_holder.m_back  = new_front + sz;
+   }
+
+   //Inserts n elements at idx and returns a pointer to the first one.
+   //Elements are shifted towards the nearest end. If that end has not
+   //enough free capacity and the buffer is at most one third full, elements
+   //are centered in the buffer, otherwise a new buffer is allocated.
+   template <class InsertionProxy>
+   T* priv_insert_n(const size_type idx, const size_type n, InsertionProxy proxy)
+   {
+      if(!n){
+         return this->priv_raw_begin() + idx;
+      }
+      const size_type sz = this->size();
+      const bool towards_front = idx < (sz - idx);
+      if(towards_front ? this->m_holder.m_front < n : this->back_free_capacity() < n){
+         if(this->m_holder.m_capacity/3u < sz + n){
+            return this->priv_insert_new_allocation(idx, n, proxy, towards_front);
+         }
+         else if(idx == 0 || idx == sz){
+            return this->priv_insert_relocating(towards_front, n, proxy);
+         }
+         this->priv_relocate((this->m_holder.m_capacity - sz)/2u);
+      }
+      T* const pos = this->priv_raw_begin() + idx;
+      if(towards_front){
+         this->priv_insert_expand_front(pos, n, proxy);
+         return pos - n;
+      }
+      else{
+         this->priv_insert_expand_back(pos, n, proxy);
+         return pos;
+      }
+   }
+
+   template <class InsertionProxy>
+   T* priv_insert_new_allocation
+      (const size_type idx, const size_type n, InsertionProxy &proxy, const bool towards_front)
+   {
+      const size_type sz = this->size();
+      const size_type new_cap = this->m_holder.next_capacity(n);
+      //Free capacity at the other end is preserved
+      const size_type new_front = towards_front
+         ? new_cap - sz - n - this->back_free_capacity()
+         : this->m_holder.m_front;
+      Allocator &a = this->m_holder.alloc();
+      pointer new_start = a.allocate(new_cap);
+      container_detail::scoped_array_deallocator<Allocator> new_buffer_deallocator(new_start, a, new_cap);
+      T* const old_begin = this->priv_raw_begin();
+      T* const new_begin = container_detail::to_raw_pointer(new_start) + new_front;
+
+      //New elements are constructed first, as the proxy might refer to an old element
+      proxy.uninitialized_copy_n_and_update(new_begin + idx, n);
+      container_detail::scoped_destructor_n<Allocator> new_values_destroyer(new_start + (new_front + idx), a, n);
+      ::boost::container::uninitialized_move_alloc_n(a, old_begin, idx, new_begin);
+      container_detail::scoped_destructor_n<Allocator> before_values_destroyer(new_start + new_front, a, idx);
+      ::boost::container::uninitialized_move_alloc_n(a, old_begin + idx, sz - idx, new_begin + idx + n);
+      before_values_destroyer.release();
+      new_values_destroyer.release();
+      new_buffer_deallocator.release();
+
+      this->priv_adopt_buffer(new_start, new_cap, new_front, sz + n);
+      return new_begin + idx;
+   }
+
+   template <class InsertionProxy>
+   T* priv_insert_relocating(const bool at_front, const size_type n, InsertionProxy &proxy)
+   {
+      //As the buffer is at most one third full after the insertion, the memory where
+      //new elements go after centering is not used by the old elements, so they can
+      //be constructed first and the proxy can safely refer to an old element.
+      const size_type sz = this->size();
+      const size_type free_half = (this->m_holder.m_capacity - sz - n)/2u;
+      const size_type new_front = at_front ? free_half + n : free_half;
+      T* const new_values = container_detail::to_raw_pointer(this->m_holder.m_start)
+         + (at_front ? free_half : free_half + sz);
+      proxy.uninitialized_copy_n_and_update(new_values, n);
+      BOOST_TRY{
+         this->priv_relocate(new_front);
+      }
+      BOOST_CATCH(...){
+         boost::container::destroy_alloc_n(this->get_stored_allocator(), new_values, n);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      if(at_front){
+         this->m_holder.m_front -= n;
+      }
+      else{
+         this->m_holder.m_back += n;
+      }
+      return new_values;
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_expand_back(T* const pos, const size_type n, InsertionProxy &proxy)
+   {
+      T* const old_end = this->priv_raw_end();
+      const size_type elems_after = static_cast<size_type>(old_end - pos);
+      if(!elems_after){
+         proxy.uninitialized_copy_n_and_update(old_end, n);
+         this->m_holder.m_back += n;
+      }
+      else if(elems_after >= n){
+         //New elements can be copied taking into account the existing ones
+         ::boost::container::uninitialized_move_alloc_n
+            (this->m_holder.alloc(), old_end - n, n, old_end);
+         this->m_holder.m_back += n;
+         boost::move_backward(pos, old_end - n, old_end);
+         proxy.copy_n_and_update(pos, n);
+      }
+      else{
+         //The new elements go partly to the old zone and partly to raw memory
+         ::boost::container::uninitialized_move_alloc
+            (this->m_holder.alloc(), pos, old_end, pos + n);
+         BOOST_TRY{
+            proxy.copy_n_and_update(pos, elems_after);
+            proxy.uninitialized_copy_n_and_update(old_end, n - elems_after);
+         }
+         BOOST_CATCH(...){
+            boost::container::destroy_alloc_n(this->get_stored_allocator(), pos + n, elems_after);
+            BOOST_RETHROW
+         }
+         BOOST_CATCH_END
+         this->m_holder.m_back += n;
+      }
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_expand_front(T* const pos, const size_type n, InsertionProxy &proxy)
+   {
+      T* const old_begin = this->priv_raw_begin();
+      const size_type elems_before = static_cast<size_type>(pos - old_begin);
+      if(!elems_before){
+         proxy.uninitialized_copy_n_and_update(old_begin - n, n);
+         this->m_holder.m_front -= n;
+      }
+      else if(elems_before >= n){
+         //New elements can be copied taking into account the existing ones
+         ::boost::container::uninitialized_move_alloc_n
+            (this->m_holder.alloc(), old_begin, n, old_begin - n);
+         this->m_holder.m_front -= n;
+         boost::move(old_begin + n, pos, old_begin);
+         proxy.copy_n_and_update(pos - n, n);
+      }
+      else{
+         //The new elements go partly to raw memory and partly to the old zone
+         ::boost::container::uninitialized_move_alloc
+            (this->m_holder.alloc(), old_begin, pos, old_begin - n);
+         BOOST_TRY{
+            proxy.uninitialized_copy_n_and_update(pos - n, n - elems_before);
+         }
+         BOOST_CATCH(...){
+            boost::container::destroy_alloc_n(this->get_stored_allocator(), old_begin - n, elems_before);
+            BOOST_RETHROW
+         }
+         BOOST_CATCH_END
+         this->m_holder.m_front -= n;
+         proxy.copy_n_and_update(old_begin, elems_before);
+      }
+   }
+
+   template<class U>
+   iterator priv_insert(const const_iterator &p, BOOST_FWD_REF(U) x)
+   {
+      return this->priv_iterator(this->priv_insert_n
+         ( this->priv_index_of(p), 1u, container_detail::get_insert_value_proxy<T*>(this->m_holder.alloc()
+         , ::boost::forward<U>(x))));
+   }
+
+   void priv_push_back(const T &x)
+   {
+      if (this->m_holder.m_back < this->m_holder.m_capacity){
+         //There is more memory, just construct a new object at the end
+         allocator_traits_type::construct(this->m_holder.alloc(), this->priv_raw_end(), x);
+         ++this->m_holder.m_back;
+      }
+      else{
+         container_detail::insert_copy_proxy<Allocator, T*> proxy(this->m_holder.alloc(), x);
+         this->priv_insert_n(this->size(), 1u, proxy);
+      }
+   }
+
+   void priv_push_back(BOOST_RV_REF(T) x)
+   {
+      if (this->m_holder.m_back < this->m_holder.m_capacity){
+         //There is more memory, just construct a new object at the end
+         allocator_traits_type::construct(this->m_holder.alloc(), this->priv_raw_end(), ::boost::move(x));
+         ++this->m_holder.m_back;
+      }
+      else{
+         container_detail::insert_move_proxy<Allocator, T*> proxy(this->m_holder.alloc(), x);
+         this->priv_insert_n(this->size(), 1u, proxy);
+      }
+   }
+
+   void priv_push_front(const T &x)
+   {
+      if (this->m_holder.m_front){
+         //There is more memory, just construct a new object at the beginning
+         allocator_traits_type::construct(this->m_holder.alloc(), this->priv_raw_begin() - 1, x);
+         --this->m_holder.m_front;
+      }
+      else{
+         container_detail::insert_copy_proxy<Allocator, T*> proxy(this->m_holder.alloc(), x);
+         this->priv_insert_n(0u, 1u, proxy);
+      }
+   }
+
+   void priv_push_front(BOOST_RV_REF(T) x)
+   {
+      if (this->m_holder.m_front){
+         //There is more memory, just construct a new object at the beginning
+         allocator_traits_type::construct(this->m_holder.alloc(), this->priv_raw_begin() - 1, ::boost::move(x));
+         --this->m_holder.m_front;
+      }
+      else{
+         container_detail::insert_move_proxy<Allocator, T*> proxy(this->m_holder.alloc(), x);
+         this->priv_insert_n(0u, 1u, proxy);
+      }
+   }
+   /// @endcond
+};
+
+template <class T, class Allocator>
+inline bool
+operator==(const devector<T, Allocator>& x, const devector<T, Allocator>& y)
+{
+   //Check first size and each element if needed
+   return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class T, class Allocator>
+inline bool
+operator!=(const devector<T, Allocator>& x, const devector<T, Allocator>& y)
+{
+   //Check first size and each element if needed
+  return x.size() != y.size() || !std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class T, class Allocator>
+inline bool
+operator<(const devector<T, Allocator>& x, const devector<T, Allocator>& y)
+{
+   return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+}}
+
+/// @cond
+
+namespace boost {
+
+//!has_trivial_destructor_after_move<> == true_type
+//!specialization for optimizations
+template <class T, class Allocator>
+struct has_trivial_destructor_after_move<boost::container::devector<T, Allocator> >
+   : public ::boost::has_trivial_destructor_after_move<Allocator>
+{};
+
+}
+
+/// @endcond
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //   #ifndef  BOOST_CONTAINER_CONTAINER_DEVECTOR_HPP
@@ -117,6 +117,7 @@ class flat_map
    typedef typename impl_tree_t::value_type              impl_value_type;
    typedef typename impl_tree_t::const_iterator          impl_const_iterator;
    typedef typename impl_tree_t::allocator_type          impl_allocator_type;
+   typedef typename impl_tree_t::sequence_type           impl_sequence_type;
    typedef container_detail::flat_tree_value_compare
       < Compare
       , container_detail::select1st< std::pair<Key, T> >
@@ -156,6 +157,7 @@ class flat_map
    typedef BOOST_CONTAINER_IMPDEF(reverse_iterator_impl)                            reverse_iterator;
    typedef BOOST_CONTAINER_IMPDEF(const_reverse_iterator_impl)                      const_reverse_iterator;
    typedef BOOST_CONTAINER_IMPDEF(impl_value_type)                                  movable_value_type;
+   typedef boost::container::vector<value_type, Allocator>                          sequence_type;
 
    public:
    //////////////////////////////////////////////
@@ -673,8 +675,8 @@ class flat_map
    //! <b>Effects</b>: inserts each element from the range [first,last) if and only
    //!   if there is no element with key equivalent to the key of that element.
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) (N is the distance from first to last) to sort
+   //!   the new elements, plus N log(size()) search time and size()+N insertion time.
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    template <class InputIterator>
@@ -756,6 +758,37 @@ class flat_map
    void clear() BOOST_CONTAINER_NOEXCEPT
       { m_flat_tree.clear(); }
 
+   //! <b>Effects</b>: Extracts the internal sequence of sorted elements, leaving the
+   //!   container empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   sequence_type extract_sequence()
+   {  return boost::move(container_detail::force<sequence_type>(m_flat_tree.get_sequence_ref()));  }
+
+   //! <b>Effects</b>: Discards the elements of the container and takes ownership of
+   //!   seq, which is sorted and then stripped of elements with keys equivalent to
+   //!   the key of a preceding element.
+   //!
+   //! <b>Complexity</b>: N log(N) (N is seq.size()), linear if seq is already sorted.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_unique(boost::move(container_detail::force<impl_sequence_type>(seq)));  }
+
+   //! <b>Requires</b>: seq must be ordered according to the predicate and must be
+   //!   unique values.
+   //!
+   //! <b>Effects</b>: Discards the elements of the container and takes ownership of
+   //!   seq without sorting it.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(ordered_unique_range_t, BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_unique(ordered_unique_range, boost::move(container_detail::force<impl_sequence_type>(seq)));  }
+
    //////////////////////////////////////////////
    //
    //                observers
@@ -987,6 +1020,7 @@ class flat_multimap
    typedef typename impl_tree_t::value_type              impl_value_type;
    typedef typename impl_tree_t::const_iterator          impl_const_iterator;
    typedef typename impl_tree_t::allocator_type          impl_allocator_type;
+   typedef typename impl_tree_t::sequence_type           impl_sequence_type;
    typedef container_detail::flat_tree_value_compare
       < Compare
       , container_detail::select1st< std::pair<Key, T> >
@@ -1026,6 +1060,7 @@ class flat_multimap
    typedef BOOST_CONTAINER_IMPDEF(reverse_iterator_impl)                            reverse_iterator;
    typedef BOOST_CONTAINER_IMPDEF(const_reverse_iterator_impl)                      const_reverse_iterator;
    typedef BOOST_CONTAINER_IMPDEF(impl_value_type)                                  movable_value_type;
+   typedef boost::container::vector<value_type, Allocator>                          sequence_type;
 
    //////////////////////////////////////////////
    //
@@ -1469,8 +1504,8 @@ class flat_multimap
    //!
    //! <b>Effects</b>: inserts each element from the range [first,last) .
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) (N is the distance from first to last) to sort
+   //!   the new elements, plus N log(size()) search time and size()+N insertion time.
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    template <class InputIterator>
@@ -1551,6 +1586,35 @@ class flat_multimap
    void clear() BOOST_CONTAINER_NOEXCEPT
       { m_flat_tree.clear(); }
 
+   //! <b>Effects</b>: Extracts the internal sequence of sorted elements, leaving the
+   //!   container empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   sequence_type extract_sequence()
+   {  return boost::move(container_detail::force<sequence_type>(m_flat_tree.get_sequence_ref()));  }
+
+   //! <b>Effects</b>: Discards the elements of the container and takes ownership of
+   //!   seq, which is sorted keeping the relative order of equivalent elements.
+   //!
+   //! <b>Complexity</b>: N log(N) (N is seq.size()), linear if seq is already sorted.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_equal(boost::move(container_detail::force<impl_sequence_type>(seq)));  }
+
+   //! <b>Requires</b>: seq must be ordered according to the predicate.
+   //!
+   //! <b>Effects</b>: Discards the elements of the container and takes ownership of
+   //!   seq without sorting it.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(ordered_range_t, BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_equal(ordered_range, boost::move(container_detail::force<impl_sequence_type>(seq)));  }
+
    //////////////////////////////////////////////
    //
    //                observers
@@ -97,6 +97,7 @@ class flat_set
    typedef typename BOOST_CONTAINER_IMPDEF(tree_t::const_iterator)                     const_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(tree_t::reverse_iterator)                   reverse_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(tree_t::const_reverse_iterator)             const_reverse_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(tree_t::sequence_type)                      sequence_type;
 
    public:
    //////////////////////////////////////////////
@@ -520,8 +521,8 @@ class flat_set
    //! <b>Effects</b>: inserts each element from the range [first,last) if and only
    //!   if there is no element with key equivalent to the key of that element.
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) (N is the distance from first to last) to sort
+   //!   the new elements, plus N log(size()) search time and size()+N insertion time.
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    template <class InputIterator>
@@ -592,6 +593,37 @@ class flat_set
    void clear() BOOST_CONTAINER_NOEXCEPT
       { m_flat_tree.clear(); }
 
+   //! <b>Effects</b>: Extracts the internal sequence of sorted elements, leaving the
+   //!   container empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   sequence_type extract_sequence()
+   {  return m_flat_tree.extract_sequence();  }
+
+   //! <b>Effects</b>: Discards the elements of the container and takes ownership of
+   //!   seq, which is sorted and then stripped of elements with keys equivalent to
+   //!   the key of a preceding element.
+   //!
+   //! <b>Complexity</b>: N log(N) (N is seq.size()), linear if seq is already sorted.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_unique(boost::move(seq));  }
+
+   //! <b>Requires</b>: seq must be ordered according to the predicate and must be
+   //!   unique values.
+   //!
+   //! <b>Effects</b>: Discards the elements of the container and takes ownership of
+   //!   seq without sorting it.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(ordered_unique_range_t, BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_unique(ordered_unique_range, boost::move(seq));  }
+
    //////////////////////////////////////////////
    //
    //                observers
@@ -810,6 +842,7 @@ class flat_multiset
    typedef typename BOOST_CONTAINER_IMPDEF(tree_t::const_iterator)                     const_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(tree_t::reverse_iterator)                   reverse_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(tree_t::const_reverse_iterator)             const_reverse_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(tree_t::sequence_type)                      sequence_type;
 
    //! <b>Effects</b>: Default constructs an empty flat_multiset.
    //!
@@ -1196,8 +1229,8 @@ class flat_multiset
    //!
    //! <b>Effects</b>: inserts each element from the range [first,last) .
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) (N is the distance from first to last) to sort
+   //!   the new elements, plus N log(size()) search time and size()+N insertion time.
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    template <class InputIterator>
@@ -1267,6 +1300,35 @@ class flat_multiset
    void clear() BOOST_CONTAINER_NOEXCEPT
       { m_flat_tree.clear(); }
 
+   //! <b>Effects</b>: Extracts the internal sequence of sorted elements, leaving the
+   //!   container empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   sequence_type extract_sequence()
+   {  return m_flat_tree.extract_sequence();  }
+
+   //! <b>Effects</b>: Discards the elements of the container and takes ownership of
+   //!   seq, which is sorted keeping the relative order of equivalent elements.
+   //!
+   //! <b>Complexity</b>: N log(N) (N is seq.size()), linear if seq is already sorted.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_equal(boost::move(seq));  }
+
+   //! <b>Requires</b>: seq must be ordered according to the predicate.
+   //!
+   //! <b>Effects</b>: Discards the elements of the container and takes ownership of
+   //!   seq without sorting it.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(ordered_range_t, BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_equal(ordered_range, boost::move(seq));  }
+
    //////////////////////////////////////////////
    //
    //                observers
@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_PMR_GLOBAL_RESOURCE_HPP
+#define BOOST_CONTAINER_PMR_GLOBAL_RESOURCE_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/smart_ptr/detail/spinlock_pool.hpp>
+#include <cstddef>
+#include <new>
+
+namespace boost {
+namespace container {
+namespace pmr {
+
+/// @cond
+
+namespace pmr_detail {
+
+//Memory resource that uses ::operator new and ::operator delete.
+//Alignments bigger than max_align are obtained allocating extra
+//memory and storing the original address just before the returned one.
+class new_delete_resource_imp
+   : public memory_resource
+{
+   protected:
+   virtual void* do_allocate(std::size_t bytes, std::size_t alignment)
+   {
+      if(alignment <= memory_resource::max_align){
+         return ::operator new(bytes);
+      }
+      char *const raw = static_cast<char*>(::operator new(bytes + alignment + sizeof(void*)));
+      const std::size_t addr = reinterpret_cast<std::size_t>(raw + sizeof(void*));
+      char *const aligned = raw + sizeof(void*) + ((alignment - (addr & (alignment - 1u))) & (alignment - 1u));
+      reinterpret_cast<void**>(aligned)[-1] = raw;
+      return aligned;
+   }
+
+   virtual void do_deallocate(void* p, std::size_t, std::size_t alignment)
+   {
+      if(alignment <= memory_resource::max_align){
+         ::operator delete(p);
+      }
+      else{
+         ::operator delete(static_cast<void**>(p)[-1]);
+      }
+   }
+
+   virtual bool do_is_equal(const memory_resource& other) const BOOST_CONTAINER_NOEXCEPT
+   {  return &other == this;  }
+};
+
+//Memory resource that always fails
+class null_memory_resource_imp
+   : public memory_resource
+{
+   protected:
+   virtual void* do_allocate(std::size_t, std::size_t)
+   {
+      throw_bad_alloc();
+      return 0;
+   }
+
+   virtual void do_deallocate(void*, std::size_t, std::size_t)
+   {}
+
+   virtual bool do_is_equal(const memory_resource& other) const BOOST_CONTAINER_NOEXCEPT
+   {  return &other == this;  }
+};
+
+//The default resource is stored in a static data member of
+//a class template so that it's shared by all translation units.
+//A null pointer means new_delete_resource().
+template<int Dummy>
+struct default_resource_holder
+{
+   static memory_resource *resource;
+
+   //Spinlocks from the pool are statically initialized, so they can
+   //be used even before dynamic initialization of globals
+   typedef boost::detail::spinlock_pool<2> spinlock_pool_t;
+};
+
+template<int Dummy>
+memory_resource *default_resource_holder<Dummy>::resource = 0;
+
+}  //namespace pmr_detail {
+
+/// @endcond
+
+//! <b>Returns</b>: A pointer to a static-duration object of a type derived from
+//!   memory_resource that can serve as a resource for allocating memory using
+//!   global `operator new` and global `operator delete`. The same value is returned every time this function
+//!   is called. For return value p and memory resource r, p->is_equal(r) returns &r == p.
+inline memory_resource* new_delete_resource() BOOST_CONTAINER_NOEXCEPT
+{
+   static pmr_detail::new_delete_resource_imp instance;
+   return &instance;
+}
+
+//! <b>Returns</b>: A pointer to a static-duration object of a type derived from
+//!   memory_resource for which allocate() always throws bad_alloc and for which
+//!   deallocate() has no effect. The same value is returned every time this function
+//!   is called. For return value p and memory resource r, p->is_equal(r) returns &r == p.
+inline memory_resource* null_memory_resource() BOOST_CONTAINER_NOEXCEPT
+{
+   static pmr_detail::null_memory_resource_imp instance;
+   return &instance;
+}
+
+//! <b>Effects</b>: If r is non-null, sets the value of the default memory resource
+//!   pointer to r, otherwise sets the default memory resource pointer to new_delete_resource().
+//!
+//! <b>Postconditions</b>: get_default_resource() == r.
+//!
+//! <b>Returns</b>: The previous value of the default memory resource pointer.
+//!
+//! <b>Remarks</b>: Calling the set_default_resource and get_default_resource functions shall
+//!   not incur a data race. A call to the set_default_resource function shall synchronize
+//!   with subsequent calls to the set_default_resource and get_default_resource functions.
+inline memory_resource* set_default_resource(memory_resource* r) BOOST_CONTAINER_NOEXCEPT
+{
+   typedef pmr_detail::default_resource_holder<0> holder_t;
+   memory_resource *old;
+   {
+      holder_t::spinlock_pool_t::scoped_lock lock(&holder_t::resource);
+      old = holder_t::resource;
+      holder_t::resource = r;
+   }
+   return old ? old : new_delete_resource();
+}
+
+//! <b>Returns</b>: The current value of the default
+//!   memory resource pointer.
+inline memory_resource* get_default_resource() BOOST_CONTAINER_NOEXCEPT
+{
+   typedef pmr_detail::default_resource_holder<0> holder_t;
+   memory_resource *current;
+   {
+      holder_t::spinlock_pool_t::scoped_lock lock(&holder_t::resource);
+      current = holder_t::resource;
+   }
+   return current ? current : new_delete_resource();
+}
+
+}  //namespace pmr {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_PMR_GLOBAL_RESOURCE_HPP
@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_PMR_MAP_HPP
+#define BOOST_CONTAINER_PMR_MAP_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/map.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+
+namespace boost {
+namespace container {
+namespace pmr {
+
+#if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
+
+//! Alias template for map that uses polymorphic_allocator
+template <class Key
+         ,class T
+         ,class Compare = std::less<Key> >
+using map = boost::container::map
+   <Key, T, Compare, polymorphic_allocator<std::pair<const Key, T> > >;
+
+#endif
+
+//! A portable metafunction to obtain a map
+//! that uses a polymorphic allocator
+template <class Key
+         ,class T
+         ,class Compare = std::less<Key> >
+struct map_of
+{
+   typedef boost::container::map
+      < Key, T, Compare, polymorphic_allocator<std::pair<const Key, T> > > type;
+};
+
+#if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
+
+//! Alias template for multimap that uses polymorphic_allocator
+template <class Key
+         ,class T
+         ,class Compare = std::less<Key> >
+using multimap = boost::container::multimap
+   <Key, T, Compare, polymorphic_allocator<std::pair<const Key, T> > >;
+
+#endif
+
+//! A portable metafunction to obtain a multimap
+//! that uses a polymorphic allocator
+template <class Key
+         ,class T
+         ,class Compare = std::less<Key> >
+struct multimap_of
+{
+   typedef boost::container::multimap
+      < Key, T, Compare, polymorphic_allocator<std::pair<const Key, T> > > type;
+};
+
+}  //namespace pmr {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_PMR_MAP_HPP
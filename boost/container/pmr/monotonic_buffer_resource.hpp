@@ -0,0 +1,269 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_PMR_MONOTONIC_BUFFER_RESOURCE_HPP
+#define BOOST_CONTAINER_PMR_MONOTONIC_BUFFER_RESOURCE_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace container {
+namespace pmr {
+
+//! A monotonic_buffer_resource is a special-purpose memory resource intended for
+//! very fast memory allocations in situations where memory is used to build up a
+//! few objects and then is released all at once when the memory resource object
+//! is destroyed. It has the following qualities:
+//!
+//! - A call to deallocate has no effect, thus the amount of memory consumed increases
+//!   monotonically until the resource is destroyed.
+//!
+//! - The program can supply an initial buffer, which the allocator uses to satisfy
+//!   memory requests.
+//!
+//! - When the initial buffer (if any) is exhausted, it obtains additional buffers
+//!   from an upstream memory resource supplied at construction. Each additional
+//!   buffer is larger than the previous one, following a geometric progression.
+//!
+//! - It is intended for access from one thread of control at a time. Specifically,
+//!   calls to allocate and deallocate do not synchronize with one another.
+//!
+//! - It owns the allocated memory and frees it on destruction, even if deallocate has
+//!   not been called for some of the allocated blocks.
+class monotonic_buffer_resource
+   : public memory_resource
+{
+   /// @cond
+   //Header of each buffer obtained from the upstream resource.
+   //Buffers form a singly linked list so that release() can free them.
+   struct block_header
+   {
+      block_header *next;
+      std::size_t   size;
+   };
+
+   static const std::size_t header_size =
+      (sizeof(block_header) + memory_resource::max_align - 1u) & ~(memory_resource::max_align - 1u);
+
+   memory_resource * const m_upstream;
+   block_header     *m_blocks;
+   void * const      m_initial_buffer;
+   const std::size_t m_initial_buffer_size;
+   char             *m_current_buffer;
+   std::size_t       m_current_buffer_size;
+   std::size_t       m_next_buffer_size;
+
+   monotonic_buffer_resource(const monotonic_buffer_resource &);
+   monotonic_buffer_resource &operator=(const monotonic_buffer_resource &);
+
+   void priv_increase_next_buffer_size()
+   {
+      if(m_next_buffer_size <= std::size_t(-1)/2u){
+         m_next_buffer_size *= 2u;
+      }
+   }
+
+   //Obtains a new buffer from the upstream resource big enough to hold
+   //"bytes" bytes aligned to "alignment" and makes it the current buffer
+   void priv_allocate_new_buffer(std::size_t bytes, std::size_t alignment)
+   {
+      std::size_t min_size = bytes + (alignment > memory_resource::max_align ? alignment : 0u);
+      if(min_size < bytes || min_size > std::size_t(-1) - header_size){
+         throw_bad_alloc();
+      }
+      min_size += header_size;
+      while(m_next_buffer_size < min_size){
+         const std::size_t old = m_next_buffer_size;
+         this->priv_increase_next_buffer_size();
+         if(old == m_next_buffer_size){
+            m_next_buffer_size = min_size;
+         }
+      }
+      const std::size_t size = m_next_buffer_size;
+      block_header *const h = static_cast<block_header*>
+         (m_upstream->allocate(size, memory_resource::max_align));
+      h->next = m_blocks;
+      h->size = size;
+      m_blocks = h;
+      m_current_buffer = reinterpret_cast<char*>(h) + header_size;
+      m_current_buffer_size = size - header_size;
+      this->priv_increase_next_buffer_size();
+   }
+
+   //Returns the number of bytes to skip in the current buffer
+   //so that the next allocation is aligned to "alignment"
+   std::size_t priv_alignment_offset(std::size_t alignment) const
+   {
+      const std::size_t addr = reinterpret_cast<std::size_t>(m_current_buffer);
+      return (alignment - (addr & (alignment - 1u))) & (alignment - 1u);
+   }
+   /// @endcond
+
+   public:
+
+   //! The number of bytes that will be requested by the default
+   //! in the first call to the upstream allocator
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   static const std::size_t initial_next_buffer_size = 32u*sizeof(void*);
+
+   //! <b>Requires</b>: `upstream` shall be the address of a valid memory resource or `nullptr`
+   //!
+   //! <b>Effects</b>: If `upstream` is not nullptr, sets the internal resource to `upstream`,
+   //!   to get_default_resource() otherwise.
+   //!   Sets the internal `current_buffer` to `nullptr` and the internal `next_buffer_size` to an
+   //!   implementation-defined size.
+   explicit monotonic_buffer_resource(memory_resource* upstream = 0) BOOST_CONTAINER_NOEXCEPT
+      : m_upstream(upstream ? upstream : ::boost::container::pmr::get_default_resource())
+      , m_blocks(0)
+      , m_initial_buffer(0)
+      , m_initial_buffer_size(0u)
+      , m_current_buffer(0)
+      , m_current_buffer_size(0u)
+      , m_next_buffer_size(initial_next_buffer_size)
+   {}
+
+   //! <b>Requires</b>: `upstream` shall be the address of a valid memory resource or `nullptr`.
+   //!   `initial_size` shall be greater than zero.
+   //!
+   //! <b>Effects</b>: If `upstream` is not nullptr, sets the internal resource to `upstream`,
+   //!   to get_default_resource() otherwise. Sets the internal `current_buffer` to `nullptr` and
+   //!   `next_buffer_size` to at least `initial_size`.
+   explicit monotonic_buffer_resource(std::size_t initial_size, memory_resource* upstream = 0) BOOST_CONTAINER_NOEXCEPT
+      : m_upstream(upstream ? upstream : ::boost::container::pmr::get_default_resource())
+      , m_blocks(0)
+      , m_initial_buffer(0)
+      , m_initial_buffer_size(0u)
+      , m_current_buffer(0)
+      , m_current_buffer_size(0u)
+      , m_next_buffer_size(initial_size > initial_next_buffer_size ? initial_size : initial_next_buffer_size)
+   {}
+
+   //! <b>Requires</b>: `upstream` shall be the address of a valid memory resource or `nullptr`.
+   //!   `buffer_size` shall be no larger than the number of bytes in buffer.
+   //!
+   //! <b>Effects</b>: If `upstream` is not nullptr, sets the internal resource to `upstream`,
+   //!   to get_default_resource() otherwise. Sets the internal `current_buffer` to `buffer`,
+   //!   and `next_buffer_size` to at least `buffer_size` (but not less than an implementation-defined size),
+   //!   then increases `next_buffer_size` by an implementation-defined growth factor.
+   monotonic_buffer_resource(void* buffer, std::size_t buffer_size, memory_resource* upstream = 0) BOOST_CONTAINER_NOEXCEPT
+      : m_upstream(upstream ? upstream : ::boost::container::pmr::get_default_resource())
+      , m_blocks(0)
+      , m_initial_buffer(buffer)
+      , m_initial_buffer_size(buffer_size)
+      , m_current_buffer(static_cast<char*>(buffer))
+      , m_current_buffer_size(buffer_size)
+      , m_next_buffer_size(buffer_size > initial_next_buffer_size ? buffer_size : initial_next_buffer_size)
+   {  this->priv_increase_next_buffer_size();  }
+
+   //! <b>Effects</b>: Calls
+   //!   `this->release()`.
+   virtual ~monotonic_buffer_resource()
+   {  this->release();  }
+
+   //! <b>Effects</b>: `upstream_resource()->deallocate()` as necessary to release all allocated memory.
+   //!   The initial buffer, if supplied, is reused for subsequent allocations.
+   //!   [Note: memory is released back to `upstream_resource()` even if some blocks that were allocated
+   //!   from this have not been deallocated from this. - end note]
+   void release() BOOST_CONTAINER_NOEXCEPT
+   {
+      while(m_blocks){
+         block_header *const next = m_blocks->next;
+         m_upstream->deallocate(m_blocks, m_blocks->size, memory_resource::max_align);
+         m_blocks = next;
+      }
+      m_current_buffer      = static_cast<char*>(m_initial_buffer);
+      m_current_buffer_size = m_initial_buffer_size;
+   }
+
+   //! <b>Returns</b>: The value of
+   //!   the internal resource.
+   memory_resource* upstream_resource() const BOOST_CONTAINER_NOEXCEPT
+   {  return m_upstream;   }
+
+   //! <b>Returns</b>:
+   //!   The number of bytes of storage available for the specified alignment
+   //!   in the current buffer without requesting more memory from the upstream resource.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   std::size_t remaining_storage(std::size_t alignment = 1u) const BOOST_CONTAINER_NOEXCEPT
+   {
+      const std::size_t off = this->priv_alignment_offset(alignment);
+      return off > m_current_buffer_size ? 0u : m_current_buffer_size - off;
+   }
+
+   //! <b>Returns</b>:
+   //!   The number of bytes that will be requested to the upstream
+   //!   resource the next time a buffer is needed.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   std::size_t next_buffer_size() const BOOST_CONTAINER_NOEXCEPT
+   {  return m_next_buffer_size;  }
+
+   protected:
+
+   //! <b>Returns</b>: A pointer to allocated storage with a size of at least `bytes`.
+   //!   The size and alignment of the allocated memory shall meet the requirements for
+   //!   a class derived from `memory_resource`.
+   //!
+   //! <b>Effects</b>: If the unused space in the internal `current_buffer` can fit a block with the specified
+   //!   bytes and alignment, then allocate the return block from the internal `current_buffer`; otherwise sets
+   //!   the internal `current_buffer` to `upstream_resource()->allocate(n, m)`, where `n` is not less than
+   //!   `max(bytes, next_buffer_size)` and `m` is not less than alignment, and increase
+   //!   `next_buffer_size` by an implementation-defined growth factor, then allocate the return block
+   //!   from the newly-allocated internal `current_buffer`.
+   //!
+   //! <b>Throws</b>: Nothing unless `upstream_resource()->allocate()` throws.
+   virtual void* do_allocate(std::size_t bytes, std::size_t alignment)
+   {
+      if(!bytes){
+         bytes = 1u;
+      }
+      if(this->remaining_storage(alignment) < bytes){
+         this->priv_allocate_new_buffer(bytes, alignment);
+      }
+      const std::size_t off = this->priv_alignment_offset(alignment);
+      char *const p = m_current_buffer + off;
+      m_current_buffer      += off + bytes;
+      m_current_buffer_size -= off + bytes;
+      return p;
+   }
+
+   //! <b>Effects</b>: None
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Remarks</b>: Memory used by this resource increases monotonically until its destruction.
+   virtual void do_deallocate(void*, std::size_t, std::size_t) BOOST_CONTAINER_NOEXCEPT
+   {}
+
+   //! <b>Returns</b>:
+   //!   `this == dynamic_cast<const monotonic_buffer_resource*>(&other)`.
+   virtual bool do_is_equal(const memory_resource& other) const BOOST_CONTAINER_NOEXCEPT
+   {  return this == dynamic_cast<const monotonic_buffer_resource*>(&other);  }
+};
+
+}  //namespace pmr {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_PMR_MONOTONIC_BUFFER_RESOURCE_HPP
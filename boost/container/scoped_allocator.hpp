@@ -1395,6 +1395,24 @@ class scoped_allocator_adaptor
                  , BOOST_RV_REF_BEG container_detail::pair<U, V> BOOST_RV_REF_END x)
    {  this->construct_pair(p, x);   }
 
+   template <class T1, class T2, class U, class V>
+   void construct(container_detail::pair<T1, T2>* p, const std::pair<U, V>& x)
+   {  this->construct_pair(p, x);   }
+
+   template <class T1, class T2, class U, class V>
+   void construct( container_detail::pair<T1, T2>* p
+                 , BOOST_RV_REF_BEG std::pair<U, V> BOOST_RV_REF_END x)
+   {  this->construct_pair(p, x);   }
+
+   template <class T1, class T2, class U, class V>
+   void construct(std::pair<T1, T2>* p, const container_detail::pair<U, V>& x)
+   {  this->construct_pair(p, x);   }
+
+   template <class T1, class T2, class U, class V>
+   void construct( std::pair<T1, T2>* p
+                 , BOOST_RV_REF_BEG container_detail::pair<U, V> BOOST_RV_REF_END x)
+   {  this->construct_pair(p, x);   }
+
    /// @cond
    private:
    template <class Pair>
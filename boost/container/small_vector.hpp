@@ -0,0 +1,517 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_CONTAINER_SMALL_VECTOR_HPP
+#define BOOST_CONTAINER_CONTAINER_SMALL_VECTOR_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+
+#include <cstddef>
+#include <boost/container/vector.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/detail/utilities.hpp>
+#include <boost/container/detail/version_type.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/move/iterator.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/has_nothrow_constructor.hpp>
+
+namespace boost {
+namespace container {
+
+/// @cond
+
+namespace container_detail {
+
+//!The allocator used by small_vector. It's just Allocator with
+//!a distinct type so that vector selects the holder with internal storage.
+//!It always declares version 1, as in-place expansion makes no sense
+//!for the internal buffer.
+template<class T, std::size_t N, class Allocator>
+class small_vector_allocator
+   : public Allocator
+{
+   public:
+   typedef T value_type;
+   typedef boost::container::container_detail::version_type<small_vector_allocator, 1> version;
+
+   small_vector_allocator()
+      BOOST_CONTAINER_NOEXCEPT_IF(::boost::has_nothrow_default_constructor<Allocator>::value)
+      : Allocator()
+   {}
+
+   small_vector_allocator(const Allocator &a) BOOST_CONTAINER_NOEXCEPT
+      : Allocator(a)
+   {}
+
+   small_vector_allocator(const small_vector_allocator &a) BOOST_CONTAINER_NOEXCEPT
+      : Allocator(static_cast<const Allocator&>(a))
+   {}
+
+   small_vector_allocator & operator=(const small_vector_allocator &a) BOOST_CONTAINER_NOEXCEPT
+   {
+      static_cast<Allocator&>(*this) = static_cast<const Allocator&>(a);
+      return *this;
+   }
+
+   const Allocator &get_underlying_allocator() const BOOST_CONTAINER_NOEXCEPT
+   {  return *this;  }
+
+   friend bool operator==(const small_vector_allocator &l, const small_vector_allocator &r) BOOST_CONTAINER_NOEXCEPT
+   {  return static_cast<const Allocator&>(l) == static_cast<const Allocator&>(r);  }
+
+   friend bool operator!=(const small_vector_allocator &l, const small_vector_allocator &r) BOOST_CONTAINER_NOEXCEPT
+   {  return !(l == r);  }
+};
+
+//Avoid calling the inherited std::allocator::construct, as is done for std::allocator
+template <class T, std::size_t N, class Allocator>
+struct is_std_allocator< small_vector_allocator<T, N, Allocator> >
+   : is_std_allocator<Allocator>
+{};
+
+//!This struct holds the internal buffer of a small_vector and
+//!deallocates dynamically allocated memory. When the buffer in use is
+//!the internal one, moving and swapping must move the elements one by one.
+template <class T, std::size_t N, class Allocator, class AllocatorVersion>
+struct vector_alloc_holder<small_vector_allocator<T, N, Allocator>, AllocatorVersion>
+   : public small_vector_allocator<T, N, Allocator>
+{
+   private:
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(vector_alloc_holder)
+   typedef small_vector_allocator<T, N, Allocator>                allocator_type;
+
+   public:
+   typedef boost::container::allocator_traits<allocator_type>     allocator_traits_type;
+   typedef typename allocator_traits_type::pointer                pointer;
+   typedef typename allocator_traits_type::size_type              size_type;
+   typedef typename allocator_traits_type::value_type             value_type;
+
+   static const size_type internal_capacity = N;
+
+   //Constructor, does not throw
+   vector_alloc_holder()
+      BOOST_CONTAINER_NOEXCEPT_IF(::boost::has_nothrow_default_constructor<allocator_type>::value)
+      : allocator_type(), m_start(this->internal_storage()), m_size(), m_capacity(N)
+   {}
+
+   //Constructor, does not throw
+   template<class AllocConvertible>
+   explicit vector_alloc_holder(BOOST_FWD_REF(AllocConvertible) a) BOOST_CONTAINER_NOEXCEPT
+      : allocator_type(boost::forward<AllocConvertible>(a))
+      , m_start(this->internal_storage()), m_size(), m_capacity(N)
+   {}
+
+   //Constructor, does not throw
+   template<class AllocConvertible>
+   explicit vector_alloc_holder(uninitialized_size_t, BOOST_FWD_REF(AllocConvertible) a, size_type initial_size)
+      : allocator_type(boost::forward<AllocConvertible>(a))
+      , m_start(this->internal_storage())
+      , m_size(initial_size)  //Size is initialized here so vector should only call uninitialized_xxx after this
+      , m_capacity(N)
+   {
+      this->first_allocation(initial_size);
+   }
+
+   //Constructor, does not throw
+   explicit vector_alloc_holder(uninitialized_size_t, size_type initial_size)
+      : allocator_type()
+      , m_start(this->internal_storage())
+      , m_size(initial_size)  //Size is initialized here so vector should only call uninitialized_xxx after this
+      , m_capacity(N)
+   {
+      this->first_allocation(initial_size);
+   }
+
+   vector_alloc_holder(BOOST_RV_REF(vector_alloc_holder) holder)
+      : allocator_type(boost::move(static_cast<allocator_type&>(holder)))
+      , m_start(this->internal_storage()), m_size(), m_capacity(N)
+   {
+      this->move_from_empty(holder);
+   }
+
+   void first_allocation(size_type cap)
+   {
+      if(cap > N){
+         m_start = this->alloc().allocate(cap);
+         m_capacity = cap;
+      }
+   }
+
+   void first_allocation_same_allocator_type(size_type cap)
+   {  this->first_allocation(cap);  }
+
+   ~vector_alloc_holder() BOOST_CONTAINER_NOEXCEPT
+   {
+      this->deallocate(this->m_start, this->m_capacity);
+   }
+
+   //Hides the allocator's deallocate, as vector calls it to release
+   //the old buffer and that buffer might be the internal one
+   void deallocate(const pointer &p, size_type n) BOOST_CONTAINER_NOEXCEPT
+   {
+      if(n && p != this->internal_storage()){
+         this->alloc().deallocate(p, n);
+      }
+   }
+
+   std::pair<pointer, bool>
+      allocation_command(allocation_type command,
+                         size_type limit_size,
+                         size_type preferred_size,
+                         size_type &received_size, const pointer &reuse = pointer())
+   {
+      return allocator_version_traits<allocator_type>::allocation_command
+         (this->alloc(), command, limit_size, preferred_size, received_size, reuse);
+   }
+
+   size_type next_capacity(size_type additional_objects) const
+   {
+      return get_next_capacity( allocator_traits_type::max_size(this->alloc())
+                              , this->m_capacity, additional_objects);
+   }
+
+   pointer     m_start;
+   size_type   m_size;
+   size_type   m_capacity;
+
+   void swap(vector_alloc_holder &x)
+   {
+      const bool this_internal = this->is_internal();
+      const bool x_internal    = x.is_internal();
+      if(!this_internal && !x_internal){
+         boost::container::swap_dispatch(this->m_start, x.m_start);
+         boost::container::swap_dispatch(this->m_size, x.m_size);
+         boost::container::swap_dispatch(this->m_capacity, x.m_capacity);
+      }
+      else if(this_internal && x_internal){
+         const std::size_t MaxTmpStorage = sizeof(value_type)*N;
+         value_type *const first_this = container_detail::to_raw_pointer(this->m_start);
+         value_type *const first_x = container_detail::to_raw_pointer(x.m_start);
+         if(this->m_size < x.m_size){
+            boost::container::deep_swap_alloc_n<MaxTmpStorage>(this->alloc(), first_this, this->m_size, first_x, x.m_size);
+         }
+         else{
+            boost::container::deep_swap_alloc_n<MaxTmpStorage>(this->alloc(), first_x, x.m_size, first_this, this->m_size);
+         }
+         boost::container::swap_dispatch(this->m_size, x.m_size);
+      }
+      else{
+         //One of them uses the internal buffer: its elements are moved to the
+         //other's (unused) internal buffer, and the heap buffer changes hands
+         vector_alloc_holder &in  = this_internal ? *this : x;
+         vector_alloc_holder &out = this_internal ? x : *this;
+         value_type *const in_start = container_detail::to_raw_pointer(in.m_start);
+         const size_type in_size = in.m_size;
+         ::boost::container::uninitialized_move_alloc_n
+            (this->alloc(), in_start, in_size, container_detail::to_raw_pointer(out.internal_storage()));
+         boost::container::destroy_alloc_n(this->alloc(), in_start, in_size);
+         in.m_start     = out.m_start;
+         in.m_size      = out.m_size;
+         in.m_capacity  = out.m_capacity;
+         out.m_start    = out.internal_storage();
+         out.m_size     = in_size;
+         out.m_capacity = N;
+      }
+   }
+
+   void move_from_empty(vector_alloc_holder &x)
+   {
+      if(x.is_internal()){
+         //Elements in the internal buffer can't be stolen, move them one by one
+         value_type *const x_start = container_detail::to_raw_pointer(x.m_start);
+         ::boost::container::uninitialized_move_alloc_n
+            (this->alloc(), x_start, x.m_size, container_detail::to_raw_pointer(this->m_start));
+         this->m_size = x.m_size;
+         boost::container::destroy_alloc_n(this->alloc(), x_start, x.m_size);
+         x.m_size = 0;
+      }
+      else{
+         this->m_start     = x.m_start;
+         this->m_size      = x.m_size;
+         this->m_capacity  = x.m_capacity;
+         x.m_start    = x.internal_storage();
+         x.m_size     = 0;
+         x.m_capacity = N;
+      }
+   }
+
+   allocator_type &alloc() BOOST_CONTAINER_NOEXCEPT
+   {  return *this;  }
+
+   const allocator_type &alloc() const BOOST_CONTAINER_NOEXCEPT
+   {  return *this;  }
+
+   const pointer   &start() const     BOOST_CONTAINER_NOEXCEPT {  return m_start;  }
+   const size_type &capacity() const  BOOST_CONTAINER_NOEXCEPT {  return m_capacity;  }
+   void start(const pointer &p)       BOOST_CONTAINER_NOEXCEPT {  m_start = p;  }
+   void capacity(const size_type &c)  BOOST_CONTAINER_NOEXCEPT {  m_capacity = c;  }
+
+   pointer internal_storage() const BOOST_CONTAINER_NOEXCEPT
+   {
+      return boost::intrusive::pointer_traits<pointer>::pointer_to
+         (*const_cast<value_type*>(static_cast<const value_type*>(static_cast<const void*>(&m_storage))));
+   }
+
+   bool is_internal() const BOOST_CONTAINER_NOEXCEPT
+   {  return m_start == this->internal_storage();  }
+
+   private:
+   typename boost::aligned_storage
+      <sizeof(T)*(N ? N : 1u), boost::alignment_of<T>::value>::type m_storage;
+};
+
+}  //namespace container_detail {
+
+/// @endcond
+
+//! small_vector is a vector-like container optimized for the case when it contains
+//! few elements. It contains some preallocated elements in-place, which avoid the use
+//! of dynamic storage allocation while the number of elements is not bigger than N.
+//!
+//! small_vector shares vector's implementation: when the number of elements exceeds
+//! N a buffer is obtained from Allocator and small_vector behaves exactly like vector.
+//! Unlike vector, moving or swapping a small_vector whose elements live in the
+//! internal buffer is linear and might throw, as elements must be moved one by one.
+//!
+//! \tparam T The type of object that is stored in the small_vector
+//! \tparam N The number of elements that can be stored without allocating memory
+//! \tparam Allocator The allocator used when the number of elements exceeds N
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+template <class T, std::size_t N, class Allocator = std::allocator<T> >
+#else
+template <class T, std::size_t N, class Allocator>
+#endif
+class small_vector
+   : public vector<T, container_detail::small_vector_allocator<T, N, Allocator> >
+{
+   /// @cond
+   typedef vector<T, container_detail::small_vector_allocator<T, N, Allocator> > base_t;
+   BOOST_COPYABLE_AND_MOVABLE(small_vector)
+   /// @endcond
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef typename base_t::value_type                   value_type;
+   typedef typename base_t::pointer                      pointer;
+   typedef typename base_t::const_pointer                const_pointer;
+   typedef typename base_t::reference                    reference;
+   typedef typename base_t::const_reference              const_reference;
+   typedef typename base_t::size_type                    size_type;
+   typedef typename base_t::difference_type              difference_type;
+   typedef typename base_t::allocator_type               allocator_type;
+   typedef typename base_t::stored_allocator_type        stored_allocator_type;
+   typedef typename base_t::iterator                     iterator;
+   typedef typename base_t::const_iterator               const_iterator;
+   typedef typename base_t::reverse_iterator             reverse_iterator;
+   typedef typename base_t::const_reverse_iterator       const_reverse_iterator;
+
+   //! The number of elements that are stored without allocating memory.
+   static const size_type static_capacity = N;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs an empty small_vector whose capacity is N.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   small_vector()
+      BOOST_CONTAINER_NOEXCEPT_IF(::boost::has_nothrow_default_constructor<Allocator>::value)
+      : base_t()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty small_vector taking the allocator as parameter.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit small_vector(const allocator_type &a) BOOST_CONTAINER_NOEXCEPT
+      : base_t(a)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector and inserts n value initialized values.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   explicit small_vector(size_type n)
+      : base_t(n)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector and inserts n default initialized values.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   small_vector(size_type n, default_init_t)
+      : base_t(n, default_init_t())
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector and inserts n copies of value.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   small_vector(size_type n, const T& value)
+      : base_t(n, value)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector that will use a copy of allocator a
+   //!   and inserts n copies of value.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   small_vector(size_type n, const T& value, const allocator_type &a)
+      : base_t(n, value, a)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector and inserts a copy of the range [first, last).
+   //!
+   //! <b>Throws</b>: If allocation throws or T's constructor taking
+   //!   a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   small_vector(InIt first, InIt last)
+      : base_t(first, last)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector that will use a copy of allocator a
+   //!   and inserts a copy of the range [first, last).
+   //!
+   //! <b>Throws</b>: If allocation throws or T's constructor taking
+   //!   a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   small_vector(InIt first, InIt last, const allocator_type &a)
+      : base_t(first, last, a)
+   {}
+
+   //! <b>Effects</b>: Copy constructs a small_vector.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   small_vector(const small_vector &x)
+      : base_t(x)
+   {}
+
+   //! <b>Effects</b>: Copy constructs a small_vector using the specified allocator.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   small_vector(const small_vector &x, const allocator_type &a)
+      : base_t(x, a)
+   {}
+
+   //! <b>Effects</b>: Move constructor. If x uses dynamically allocated memory
+   //!   that memory is transferred to *this, otherwise elements are moved one by one.
+   //!
+   //! <b>Postcondition</b>: x.empty().
+   //!
+   //! <b>Throws</b>: If T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant if x uses dynamically allocated memory, linear otherwise.
+   small_vector(BOOST_RV_REF(small_vector) x)
+      : base_t(boost::move(static_cast<base_t&>(x)))
+   {}
+
+   //! <b>Effects</b>: Makes *this contain the same elements as x.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in x.
+   small_vector& operator=(BOOST_COPY_ASSIGN_REF(small_vector) x)
+   {
+      base_t::operator=(static_cast<const base_t&>(x));
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assignment. All x's values are transferred to *this.
+   //!
+   //! <b>Throws</b>: If T's move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Constant if x uses dynamically allocated memory, linear otherwise.
+   small_vector& operator=(BOOST_RV_REF(small_vector) x)
+   {
+      base_t::operator=(boost::move(static_cast<base_t&>(x)));
+      return *this;
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: If T's move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Constant if both use dynamically allocated memory, linear otherwise.
+   void swap(small_vector &x)
+   {  base_t::swap(x);  }
+
+   //! <b>Effects</b>: If dynamically allocated memory is in use and size() <= N, moves
+   //!   the elements back to the internal buffer and deallocates that memory.
+   //!   Otherwise behaves like vector::shrink_to_fit.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void shrink_to_fit()
+   {
+      if(this->capacity() > N){
+         if(this->size() > N){
+            base_t::shrink_to_fit();
+         }
+         else{
+            //Take the dynamic buffer and move the elements back
+            small_vector tmp(this->get_stored_allocator());
+            tmp.swap(*this);
+            this->assign( boost::make_move_iterator(tmp.begin())
+                        , boost::make_move_iterator(tmp.end()));
+         }
+      }
+   }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant if both use dynamically allocated memory, linear otherwise.
+   friend void swap(small_vector& x, small_vector& y)
+   {  x.swap(y);  }
+};
+
+}}
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //   #ifndef  BOOST_CONTAINER_CONTAINER_SMALL_VECTOR_HPP
@@ -13,8 +13,16 @@
 #define BOOST_DETAIL_DYNAMIC_BITSET_HPP
 
 #include <cstddef>
+#include <cstring>
 #include "boost/config.hpp"
+#include "boost/cstdint.hpp"
 #include "boost/detail/workaround.hpp"
+#include "boost/dynamic_bitset/config.hpp"
+#include "boost/pending/lowest_bit.hpp"
+
+#if defined(BOOST_DYNAMIC_BITSET_X86_DISPATCH)
+#include <immintrin.h>
+#endif
 
 
 namespace boost {
@@ -143,6 +151,304 @@ namespace boost {
          return num;
      }
 
+    // ------- single block bit operations --------------
+
+    template <typename Block>
+    inline std::size_t popcount(Block value)
+    {
+#if defined(BOOST_DYNAMIC_BITSET_HAS_BUILTIN_BITOPS)
+        if (sizeof(Block) <= sizeof(unsigned int))
+            return __builtin_popcount(static_cast<unsigned int>(value));
+        else if (sizeof(Block) <= sizeof(unsigned long))
+            return __builtin_popcountl(static_cast<unsigned long>(value));
+        else
+            return __builtin_popcountll(static_cast< ::boost::ulong_long_type>(value));
+#else
+        std::size_t num = 0;
+        while (value) {
+            num += count_table<>::table[value & ((1u<<table_width) - 1)];
+            value >>= table_width;
+        }
+        return num;
+#endif
+    }
+
+    // position of the least significant bit "on"; value must not be zero
+    //
+    template <typename Block>
+    inline std::size_t lowest_bit(Block value)
+    {
+#if defined(BOOST_DYNAMIC_BITSET_HAS_BUILTIN_BITOPS)
+        if (sizeof(Block) <= sizeof(unsigned int))
+            return __builtin_ctz(static_cast<unsigned int>(value));
+        else if (sizeof(Block) <= sizeof(unsigned long))
+            return __builtin_ctzl(static_cast<unsigned long>(value));
+        else
+            return __builtin_ctzll(static_cast< ::boost::ulong_long_type>(value));
+#else
+        return ::boost::lowest_bit(value);
+#endif
+    }
+
+    // ------- bulk block operations --------------
+    //
+    // The bitset operations, and their fused variants which only count
+    // or look for the bits "on" in the result, process the blocks in
+    // chunks of 16 or 32 bytes if the processor supports it, and the
+    // remaining blocks one at a time. The operations are given by
+    // classes with a static member function apply, which is overloaded
+    // for the vector types.
+
+#if defined(BOOST_DYNAMIC_BITSET_X86_DISPATCH) && defined(__SSE2__)
+#   define BOOST_dynamic_bitset_sse2_op(expr)                               \
+        static __m128i apply(__m128i lhs, __m128i rhs) { return expr; }  /**/
+#else
+#   define BOOST_dynamic_bitset_sse2_op(expr)                            /**/
+#endif
+
+#if defined(BOOST_DYNAMIC_BITSET_X86_DISPATCH)
+#   define BOOST_dynamic_bitset_avx2_op(expr)                               \
+        BOOST_DYNAMIC_BITSET_TARGET_AVX2                                    \
+        static __m256i apply(__m256i lhs, __m256i rhs) { return expr; }  /**/
+#else
+#   define BOOST_dynamic_bitset_avx2_op(expr)                            /**/
+#endif
+
+    // the blocks of the left operand, used to count or find
+    // the bits "on" of a single bitset
+    //
+    struct lhs_op
+    {
+        template <typename T>
+        static T apply(T lhs, T) { return lhs; }
+        BOOST_dynamic_bitset_sse2_op((static_cast<void>(rhs), lhs))
+        BOOST_dynamic_bitset_avx2_op((static_cast<void>(rhs), lhs))
+    };
+
+#   define BOOST_dynamic_bitset_bitwise_op(name, expr, sse2, avx2)          \
+    struct name                                                             \
+    {                                                                       \
+        template <typename T>                                               \
+        static T apply(T lhs, T rhs) { return expr; }                       \
+        BOOST_dynamic_bitset_sse2_op(sse2)                                  \
+        BOOST_dynamic_bitset_avx2_op(avx2)                                  \
+    }                                                                    /**/
+
+    BOOST_dynamic_bitset_bitwise_op(and_op, lhs & rhs,
+        _mm_and_si128(lhs, rhs), _mm256_and_si256(lhs, rhs));
+    BOOST_dynamic_bitset_bitwise_op(or_op, lhs | rhs,
+        _mm_or_si128(lhs, rhs), _mm256_or_si256(lhs, rhs));
+    BOOST_dynamic_bitset_bitwise_op(xor_op, lhs ^ rhs,
+        _mm_xor_si128(lhs, rhs), _mm256_xor_si256(lhs, rhs));
+    BOOST_dynamic_bitset_bitwise_op(andnot_op, lhs & ~rhs,
+        _mm_andnot_si128(rhs, lhs), _mm256_andnot_si256(rhs, lhs));
+
+#undef BOOST_dynamic_bitset_bitwise_op
+#undef BOOST_dynamic_bitset_avx2_op
+#undef BOOST_dynamic_bitset_sse2_op
+
+    // the vector loops are only entered for at least this many bytes
+    const std::size_t vector_min_bytes = 32;
+
+#if defined(BOOST_DYNAMIC_BITSET_X86_DISPATCH)
+
+    // the cpuid queries are done once
+    //
+    inline bool cpu_has_avx2()
+    {
+        static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+        return result;
+    }
+
+    inline bool cpu_has_popcnt()
+    {
+        static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("popcnt") != 0);
+        return result;
+    }
+
+    // Each kernel processes a prefix of the byte ranges and returns its
+    // length.
+
+    template <typename Op>
+    BOOST_DYNAMIC_BITSET_TARGET_AVX2
+    std::size_t bitwise_assign_avx2(byte_type * lhs, const byte_type * rhs, std::size_t bytes)
+    {
+        std::size_t i = 0;
+        for (; bytes - i >= 32; i += 32) {
+            const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + i));
+            const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lhs + i), Op::apply(l, r));
+        }
+        return i;
+    }
+
+    // number of bits "on" in each 64 bit lane of v, by looking up the
+    // counts of the nibbles (W. Mula's algorithm)
+    //
+    BOOST_DYNAMIC_BITSET_TARGET_AVX2
+    inline __m256i popcount_avx2(__m256i v)
+    {
+        const __m256i table = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_nibbles = _mm256_set1_epi8(0x0f);
+        const __m256i lo = _mm256_and_si256(v, low_nibbles);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_nibbles);
+        const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(table, lo),
+                                               _mm256_shuffle_epi8(table, hi));
+        return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+    }
+
+    template <typename Op>
+    BOOST_DYNAMIC_BITSET_TARGET_AVX2
+    std::size_t count_avx2(const byte_type * lhs, const byte_type * rhs, std::size_t bytes,
+                           std::size_t & num)
+    {
+        __m256i sums = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for (; bytes - i >= 32; i += 32) {
+            const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + i));
+            const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + i));
+            sums = _mm256_add_epi64(sums, popcount_avx2(Op::apply(l, r)));
+        }
+
+        ::boost::uint64_t lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), sums);
+        num += static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+        return i;
+    }
+
+    template <typename Op>
+    BOOST_DYNAMIC_BITSET_TARGET_AVX2
+    std::size_t find_avx2(const byte_type * lhs, const byte_type * rhs, std::size_t bytes)
+    {
+        std::size_t i = 0;
+        for (; bytes - i >= 32; i += 32) {
+            const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + i));
+            const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + i));
+            const __m256i v = Op::apply(l, r);
+            if (!_mm256_testz_si256(v, v))
+                break;
+        }
+        return i;
+    }
+
+    template <typename Op>
+    BOOST_DYNAMIC_BITSET_TARGET_POPCNT
+    std::size_t count_popcnt(const byte_type * lhs, const byte_type * rhs, std::size_t bytes,
+                             std::size_t & num)
+    {
+        std::size_t i = 0;
+        for (; bytes - i >= 8; i += 8) {
+            ::boost::uint64_t l, r;
+            std::memcpy(&l, lhs + i, sizeof(l));
+            std::memcpy(&r, rhs + i, sizeof(r));
+            num += __builtin_popcountll(Op::apply(l, r));
+        }
+        return i;
+    }
+
+#if defined(__SSE2__)
+    template <typename Op>
+    std::size_t bitwise_assign_sse2(byte_type * lhs, const byte_type * rhs, std::size_t bytes)
+    {
+        std::size_t i = 0;
+        for (; bytes - i >= 16; i += 16) {
+            const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i));
+            const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lhs + i), Op::apply(l, r));
+        }
+        return i;
+    }
+
+    template <typename Op>
+    std::size_t find_sse2(const byte_type * lhs, const byte_type * rhs, std::size_t bytes)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        std::size_t i = 0;
+        for (; bytes - i >= 16; i += 16) {
+            const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i));
+            const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(Op::apply(l, r), zero)) != 0xffff)
+                break;
+        }
+        return i;
+    }
+#endif
+
+#endif // BOOST_DYNAMIC_BITSET_X86_DISPATCH
+
+    // lhs[i] = op(lhs[i], rhs[i]) for i in [0, length)
+    //
+    template <typename Op, typename Block>
+    inline void bitwise_assign(Block * lhs, const Block * rhs, std::size_t length)
+    {
+        std::size_t i = 0;
+#if defined(BOOST_DYNAMIC_BITSET_X86_DISPATCH)
+        const std::size_t bytes = length * sizeof(Block);
+        if (bytes >= vector_min_bytes) {
+            byte_type * l = reinterpret_cast<byte_type *>(lhs);
+            const byte_type * r = reinterpret_cast<const byte_type *>(rhs);
+            if (cpu_has_avx2())
+                i = bitwise_assign_avx2<Op>(l, r, bytes) / sizeof(Block);
+#if defined(__SSE2__)
+            else
+                i = bitwise_assign_sse2<Op>(l, r, bytes) / sizeof(Block);
+#endif
+        }
+#endif
+        for (; i < length; ++i)
+            lhs[i] = Op::apply(lhs[i], rhs[i]);
+    }
+
+    // number of bits "on" in op(lhs[i], rhs[i]) for i in [0, length)
+    //
+    template <typename Op, typename Block>
+    inline std::size_t count_bitwise(const Block * lhs, const Block * rhs, std::size_t length)
+    {
+        std::size_t num = 0;
+        std::size_t i = 0;
+#if defined(BOOST_DYNAMIC_BITSET_X86_DISPATCH)
+        const std::size_t bytes = length * sizeof(Block);
+        if (bytes >= vector_min_bytes) {
+            const byte_type * l = reinterpret_cast<const byte_type *>(lhs);
+            const byte_type * r = reinterpret_cast<const byte_type *>(rhs);
+            if (cpu_has_avx2())
+                i = count_avx2<Op>(l, r, bytes, num) / sizeof(Block);
+            else if (cpu_has_popcnt())
+                i = count_popcnt<Op>(l, r, bytes, num) / sizeof(Block);
+        }
+#endif
+        for (; i < length; ++i)
+            num += popcount(Block(Op::apply(lhs[i], rhs[i])));
+        return num;
+    }
+
+    // index of the first block for which op(lhs[i], rhs[i]) is not zero,
+    // or length if there is none
+    //
+    template <typename Op, typename Block>
+    inline std::size_t find_bitwise(const Block * lhs, const Block * rhs, std::size_t length)
+    {
+        std::size_t i = 0;
+#if defined(BOOST_DYNAMIC_BITSET_X86_DISPATCH)
+        const std::size_t bytes = length * sizeof(Block);
+        if (bytes >= vector_min_bytes) {
+            const byte_type * l = reinterpret_cast<const byte_type *>(lhs);
+            const byte_type * r = reinterpret_cast<const byte_type *>(rhs);
+            if (cpu_has_avx2())
+                i = find_avx2<Op>(l, r, bytes) / sizeof(Block);
+#if defined(__SSE2__)
+            else
+                i = find_sse2<Op>(l, r, bytes) / sizeof(Block);
+#endif
+        }
+#endif
+        while (i < length && Block(Op::apply(lhs[i], rhs[i])) == 0)
+            ++i;
+        return i;
+    }
+
     // -------------------------------------------------------
 
 
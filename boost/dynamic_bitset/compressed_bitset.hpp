@@ -0,0 +1,1328 @@
+// -----------------------------------------------------------
+//
+//        Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// -----------------------------------------------------------
+
+#ifndef BOOST_DYNAMIC_BITSET_COMPRESSED_BITSET_HPP
+#define BOOST_DYNAMIC_BITSET_COMPRESSED_BITSET_HPP
+
+#include <assert.h>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "boost/config.hpp"
+#include "boost/cstdint.hpp"
+#include "boost/dynamic_bitset/config.hpp"
+#include "boost/detail/dynamic_bitset.hpp"
+#include "boost/iterator/iterator_facade.hpp"
+
+
+namespace boost {
+
+  namespace detail {
+  namespace compressed_bitset_impl {
+
+    // The positions are split in chunks of 2^16 bits, the bits "on"
+    // of each chunk are stored in a container, in one of three
+    // representations:
+    //
+    //  - array:  the sorted offsets of the bits "on", if there are
+    //            at most array_max_size of them
+    //  - bitmap: bitmap_words 64 bit words
+    //  - runs:   the sorted maximal intervals [first, last] of bits
+    //            "on", stored as pairs of offsets
+    //
+    // Both the array and the run representation take at most as much
+    // memory as the bitmap.
+    //
+    enum container_kind { array_kind, bitmap_kind, run_kind };
+
+    const boost::uint32_t chunk_size = 0x10000;
+    const std::size_t bitmap_words = chunk_size / 64;
+    const std::size_t array_max_size = 4096;
+    const std::size_t run_max_size = 2048;
+
+    // state of the iteration over the bits "on" of a container
+    struct position
+    {
+        std::size_t index;      // of the value, the run or the word
+        boost::uint64_t word;   // bits of the word not visited yet
+        boost::uint32_t value;
+    };
+
+    template <typename Allocator>
+    class container
+    {
+    public:
+        typedef std::vector<boost::uint16_t,
+            typename Allocator::template rebind<boost::uint16_t>::other> values_type;
+        typedef std::vector<boost::uint64_t,
+            typename Allocator::template rebind<boost::uint64_t>::other> words_type;
+
+        container(boost::uint16_t key, const Allocator & alloc)
+          : m_key(key), m_kind(array_kind), m_cardinality(0),
+            m_values(alloc), m_words(alloc)
+        {}
+
+        // takes the contents of values and words, which must hold
+        // a valid representation of the given kind
+        container(boost::uint16_t key, container_kind kind, boost::uint32_t cardinality,
+                  values_type & values, words_type & words)
+          : m_key(key), m_kind(kind), m_cardinality(cardinality),
+            m_values(values.get_allocator()), m_words(words.get_allocator())
+        {
+            m_values.swap(values);
+            m_words.swap(words);
+        }
+
+        boost::uint16_t key() const { return m_key; }
+        container_kind kind() const { return m_kind; }
+        boost::uint32_t cardinality() const { return m_cardinality; }
+        bool empty() const { return m_cardinality == 0; }
+        const values_type & values() const { return m_values; }
+        const words_type & words() const { return m_words; }
+
+        std::size_t memory_usage() const
+        {
+            return m_values.capacity() * sizeof(boost::uint16_t)
+                + m_words.capacity() * sizeof(boost::uint64_t);
+        }
+
+        void swap(container & other)
+        {
+            std::swap(m_key, other.m_key);
+            std::swap(m_kind, other.m_kind);
+            std::swap(m_cardinality, other.m_cardinality);
+            m_values.swap(other.m_values);
+            m_words.swap(other.m_words);
+        }
+
+        bool test(boost::uint32_t v) const
+        {
+            switch (m_kind) {
+            case array_kind:
+                return std::binary_search(m_values.begin(), m_values.end(), v);
+            case bitmap_kind:
+                return ((m_words[v / 64] >> (v % 64)) & 1) != 0;
+            default: {
+                const std::size_t r = find_run(v);
+                return r < num_runs() && run_first(r) <= v;
+            }
+            }
+        }
+
+        // returns false if the bit was already "on"
+        bool set(boost::uint32_t v)
+        {
+            switch (m_kind) {
+            case array_kind: {
+                const typename values_type::iterator it =
+                    std::lower_bound(m_values.begin(), m_values.end(), v);
+                if (it != m_values.end() && *it == v)
+                    return false;
+                m_values.insert(it, static_cast<boost::uint16_t>(v));
+                if (++m_cardinality > array_max_size)
+                    to_bitmap();
+                return true;
+            }
+            case bitmap_kind: {
+                const boost::uint64_t mask = boost::uint64_t(1) << (v % 64);
+                if (m_words[v / 64] & mask)
+                    return false;
+                m_words[v / 64] |= mask;
+                ++m_cardinality;
+                return true;
+            }
+            default:
+                if (test(v))
+                    return false;
+                add_run(v, v);
+                normalize();
+                return true;
+            }
+        }
+
+        // returns false if the bit was already "off"
+        bool reset(boost::uint32_t v)
+        {
+            switch (m_kind) {
+            case array_kind: {
+                const typename values_type::iterator it =
+                    std::lower_bound(m_values.begin(), m_values.end(), v);
+                if (it == m_values.end() || *it != v)
+                    return false;
+                m_values.erase(it);
+                --m_cardinality;
+                return true;
+            }
+            case bitmap_kind: {
+                const boost::uint64_t mask = boost::uint64_t(1) << (v % 64);
+                if (!(m_words[v / 64] & mask))
+                    return false;
+                m_words[v / 64] &= ~mask;
+                --m_cardinality;
+                normalize();
+                return true;
+            }
+            default:
+                if (!test(v))
+                    return false;
+                remove_run(v, v);
+                normalize();
+                return true;
+            }
+        }
+
+        // sets the bits in [first, last]; the bits of an empty
+        // container are stored as runs
+        void add_range(boost::uint32_t first, boost::uint32_t last)
+        {
+            if (m_cardinality == 0 && m_kind != run_kind) {
+                values_type(m_values.get_allocator()).swap(m_values);
+                words_type(m_words.get_allocator()).swap(m_words);
+                m_kind = run_kind;
+            }
+
+            if (m_kind == run_kind)
+                add_run(first, last);
+            else {
+                to_bitmap();
+                fill_words(first, last, true);
+                recount();
+            }
+            normalize();
+        }
+
+        // resets the bits in [first, last]
+        void remove_range(boost::uint32_t first, boost::uint32_t last)
+        {
+            switch (m_kind) {
+            case array_kind: {
+                const typename values_type::iterator begin =
+                    std::lower_bound(m_values.begin(), m_values.end(), first);
+                const typename values_type::iterator end =
+                    std::upper_bound(begin, m_values.end(), last);
+                m_cardinality -= static_cast<boost::uint32_t>(end - begin);
+                m_values.erase(begin, end);
+                break;
+            }
+            case bitmap_kind:
+                fill_words(first, last, false);
+                recount();
+                break;
+            default:
+                remove_run(first, last);
+                break;
+            }
+            normalize();
+        }
+
+        // the first bit "on" at or after v, or chunk_size if there is none
+        boost::uint32_t find_from(boost::uint32_t v) const
+        {
+            switch (m_kind) {
+            case array_kind: {
+                const typename values_type::const_iterator it =
+                    std::lower_bound(m_values.begin(), m_values.end(), v);
+                return it == m_values.end() ? chunk_size : *it;
+            }
+            case bitmap_kind: {
+                std::size_t i = v / 64;
+                const boost::uint64_t fore = m_words[i] & (~boost::uint64_t(0) << (v % 64));
+                if (fore)
+                    return static_cast<boost::uint32_t>(i * 64 + dynamic_bitset_impl::lowest_bit(fore));
+                ++i;
+                i += dynamic_bitset_impl::find_bitwise<dynamic_bitset_impl::lhs_op>(
+                    &m_words[0] + i, &m_words[0] + i, bitmap_words - i);
+                return i == bitmap_words ? chunk_size
+                    : static_cast<boost::uint32_t>(i * 64 + dynamic_bitset_impl::lowest_bit(m_words[i]));
+            }
+            default: {
+                const std::size_t r = find_run(v);
+                return r == num_runs() ? chunk_size : (std::max)(v, run_first(r));
+            }
+            }
+        }
+
+        // iteration: first and next return false if there
+        // are no more bits "on"
+        bool first(position & pos) const
+        {
+            pos.index = 0;
+            switch (m_kind) {
+            case array_kind:
+                if (m_values.empty())
+                    return false;
+                pos.value = m_values[0];
+                return true;
+            case bitmap_kind:
+                pos.word = m_words[0];
+                return next_bit(pos);
+            default:
+                if (m_values.empty())
+                    return false;
+                pos.value = run_first(0);
+                return true;
+            }
+        }
+
+        bool next(position & pos) const
+        {
+            switch (m_kind) {
+            case array_kind:
+                if (++pos.index == m_values.size())
+                    return false;
+                pos.value = m_values[pos.index];
+                return true;
+            case bitmap_kind:
+                return next_bit(pos);
+            default:
+                if (pos.value < run_last(pos.index)) {
+                    ++pos.value;
+                    return true;
+                }
+                if (++pos.index == num_runs())
+                    return false;
+                pos.value = run_first(pos.index);
+                return true;
+            }
+        }
+
+        bool operator==(const container & other) const
+        {
+            if (m_key != other.m_key || m_cardinality != other.m_cardinality)
+                return false;
+
+            // the representations of a given kind are unique
+            if (m_kind == other.m_kind)
+                return m_values == other.m_values && m_words == other.m_words;
+
+            position p, q;
+            for (bool more = first(p) && other.first(q); more; more = next(p) && other.next(q))
+                if (p.value != q.value)
+                    return false;
+            return true;
+        }
+
+        bool intersects(const container & other) const
+        {
+            if (m_kind == bitmap_kind && other.m_kind == bitmap_kind)
+                return dynamic_bitset_impl::find_bitwise<dynamic_bitset_impl::and_op>(
+                    &m_words[0], &other.m_words[0], bitmap_words) != bitmap_words;
+
+            // look up the bits of an array or the runs in the other container
+            const container & a = m_kind == bitmap_kind ? other : *this;
+            const container & b = m_kind == bitmap_kind ? *this : other;
+            if (a.m_kind == array_kind) {
+                for (std::size_t i = 0; i < a.m_values.size(); ++i)
+                    if (b.test(a.m_values[i]))
+                        return true;
+            }
+            else {
+                for (std::size_t r = 0; r < a.num_runs(); ++r)
+                    if (b.find_from(a.run_first(r)) <= a.run_last(r))
+                        return true;
+            }
+            return false;
+        }
+
+        // The binary operations convert run containers to arrays or
+        // bitmaps; optimize() restores the runs
+        //
+        void and_assign(const container & other)
+        {
+            if (other.m_kind == run_kind) {
+                container tmp(other);
+                tmp.unpack();
+                and_assign(tmp);
+                return;
+            }
+            unpack();
+
+            if (m_kind == array_kind) {
+                values_type values(m_values.get_allocator());
+                if (other.m_kind == array_kind)
+                    std::set_intersection(m_values.begin(), m_values.end(),
+                                          other.m_values.begin(), other.m_values.end(),
+                                          std::back_inserter(values));
+                else
+                    for (std::size_t i = 0; i < m_values.size(); ++i)
+                        if (other.test(m_values[i]))
+                            values.push_back(m_values[i]);
+                assign_array(values);
+            }
+            else if (other.m_kind == array_kind) {
+                values_type values(m_values.get_allocator());
+                for (std::size_t i = 0; i < other.m_values.size(); ++i)
+                    if (test(other.m_values[i]))
+                        values.push_back(other.m_values[i]);
+                assign_array(values);
+            }
+            else
+                assign_words<dynamic_bitset_impl::and_op>(other);
+        }
+
+        void or_assign(const container & other)
+        {
+            if (other.m_kind == run_kind) {
+                container tmp(other);
+                tmp.unpack();
+                or_assign(tmp);
+                return;
+            }
+            unpack();
+
+            if (m_kind == array_kind && other.m_kind == array_kind) {
+                values_type values(m_values.get_allocator());
+                values.reserve(m_values.size() + other.m_values.size());
+                std::set_union(m_values.begin(), m_values.end(),
+                               other.m_values.begin(), other.m_values.end(),
+                               std::back_inserter(values));
+                assign_array(values);
+                return;
+            }
+
+            to_bitmap();
+            if (other.m_kind == array_kind) {
+                for (std::size_t i = 0; i < other.m_values.size(); ++i)
+                    m_words[other.m_values[i] / 64] |= boost::uint64_t(1) << (other.m_values[i] % 64);
+                recount();
+            }
+            else
+                assign_words<dynamic_bitset_impl::or_op>(other);
+        }
+
+        void xor_assign(const container & other)
+        {
+            if (other.m_kind == run_kind) {
+                container tmp(other);
+                tmp.unpack();
+                xor_assign(tmp);
+                return;
+            }
+            unpack();
+
+            if (m_kind == array_kind && other.m_kind == array_kind) {
+                values_type values(m_values.get_allocator());
+                values.reserve(m_values.size() + other.m_values.size());
+                std::set_symmetric_difference(m_values.begin(), m_values.end(),
+                                              other.m_values.begin(), other.m_values.end(),
+                                              std::back_inserter(values));
+                assign_array(values);
+                return;
+            }
+
+            to_bitmap();
+            if (other.m_kind == array_kind) {
+                for (std::size_t i = 0; i < other.m_values.size(); ++i)
+                    m_words[other.m_values[i] / 64] ^= boost::uint64_t(1) << (other.m_values[i] % 64);
+                recount();
+                normalize();
+            }
+            else
+                assign_words<dynamic_bitset_impl::xor_op>(other);
+        }
+
+        void andnot_assign(const container & other)
+        {
+            if (other.m_kind == run_kind) {
+                container tmp(other);
+                tmp.unpack();
+                andnot_assign(tmp);
+                return;
+            }
+            unpack();
+
+            if (m_kind == array_kind) {
+                values_type values(m_values.get_allocator());
+                if (other.m_kind == array_kind)
+                    std::set_difference(m_values.begin(), m_values.end(),
+                                        other.m_values.begin(), other.m_values.end(),
+                                        std::back_inserter(values));
+                else
+                    for (std::size_t i = 0; i < m_values.size(); ++i)
+                        if (!other.test(m_values[i]))
+                            values.push_back(m_values[i]);
+                assign_array(values);
+            }
+            else if (other.m_kind == array_kind) {
+                for (std::size_t i = 0; i < other.m_values.size(); ++i)
+                    m_words[other.m_values[i] / 64] &= ~(boost::uint64_t(1) << (other.m_values[i] % 64));
+                recount();
+                normalize();
+            }
+            else
+                assign_words<dynamic_bitset_impl::andnot_op>(other);
+        }
+
+        // switches to the representation that takes the least memory,
+        // and releases the unused capacity
+        void optimize()
+        {
+            const std::size_t run_bytes = 2 * sizeof(boost::uint16_t) * count_runs();
+            const std::size_t other_bytes = m_cardinality <= array_max_size
+                ? sizeof(boost::uint16_t) * m_cardinality
+                : sizeof(boost::uint64_t) * bitmap_words;
+
+            if (run_bytes < other_bytes)
+                to_runs();
+            else
+                unpack();
+            values_type(m_values).swap(m_values);
+        }
+
+    private:
+        std::size_t num_runs() const { return m_values.size() / 2; }
+        boost::uint32_t run_first(std::size_t r) const { return m_values[2 * r]; }
+        boost::uint32_t run_last(std::size_t r) const { return m_values[2 * r + 1]; }
+
+        // index of the first run that ends at or after v
+        std::size_t find_run(boost::uint32_t v) const
+        {
+            std::size_t lo = 0, hi = num_runs();
+            while (lo < hi) {
+                const std::size_t mid = lo + (hi - lo) / 2;
+                if (run_last(mid) < v)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+
+        // the runs that overlap or touch [first, last] are merged
+        void add_run(boost::uint32_t first, boost::uint32_t last)
+        {
+            const std::size_t i = find_run(first == 0 ? 0 : first - 1);
+            std::size_t j = i;
+            boost::uint32_t merged = 0;
+            for (; j < num_runs() && run_first(j) <= last + 1; ++j)
+                merged += run_last(j) - run_first(j) + 1;
+
+            if (i != j) {
+                first = (std::min)(first, run_first(i));
+                last = (std::max)(last, run_last(j - 1));
+            }
+
+            const boost::uint16_t run[2] = { static_cast<boost::uint16_t>(first),
+                                             static_cast<boost::uint16_t>(last) };
+            m_values.erase(m_values.begin() + 2 * i, m_values.begin() + 2 * j);
+            m_values.insert(m_values.begin() + 2 * i, run, run + 2);
+            m_cardinality += last - first + 1 - merged;
+        }
+
+        // the runs that overlap [first, last] are cut
+        void remove_run(boost::uint32_t first, boost::uint32_t last)
+        {
+            const std::size_t i = find_run(first);
+            std::size_t j = i;
+            boost::uint32_t removed = 0;
+            for (; j < num_runs() && run_first(j) <= last; ++j)
+                removed += run_last(j) - run_first(j) + 1;
+            if (i == j)
+                return;
+
+            boost::uint16_t pieces[4];
+            std::size_t num_pieces = 0;
+            if (run_first(i) < first) {
+                pieces[num_pieces++] = static_cast<boost::uint16_t>(run_first(i));
+                pieces[num_pieces++] = static_cast<boost::uint16_t>(first - 1);
+                removed -= first - run_first(i);
+            }
+            if (run_last(j - 1) > last) {
+                pieces[num_pieces++] = static_cast<boost::uint16_t>(last + 1);
+                pieces[num_pieces++] = static_cast<boost::uint16_t>(run_last(j - 1));
+                removed -= run_last(j - 1) - last;
+            }
+
+            m_values.erase(m_values.begin() + 2 * i, m_values.begin() + 2 * j);
+            m_values.insert(m_values.begin() + 2 * i, pieces, pieces + num_pieces);
+            m_cardinality -= removed;
+        }
+
+        std::size_t count_runs() const
+        {
+            switch (m_kind) {
+            case array_kind: {
+                std::size_t runs = m_values.empty() ? 0 : 1;
+                for (std::size_t i = 1; i < m_values.size(); ++i)
+                    if (m_values[i] != m_values[i - 1] + 1)
+                        ++runs;
+                return runs;
+            }
+            case bitmap_kind: {
+                // count the bits "on" whose predecessor is "off"
+                std::size_t runs = 0;
+                boost::uint64_t carry = 0;
+                for (std::size_t i = 0; i < bitmap_words; ++i) {
+                    const boost::uint64_t w = m_words[i];
+                    runs += dynamic_bitset_impl::popcount(w & ~((w << 1) | carry));
+                    carry = w >> 63;
+                }
+                return runs;
+            }
+            default:
+                return num_runs();
+            }
+        }
+
+        bool next_bit(position & pos) const
+        {
+            while (pos.word == 0) {
+                if (++pos.index == bitmap_words)
+                    return false;
+                pos.word = m_words[pos.index];
+            }
+            pos.value = static_cast<boost::uint32_t>(
+                pos.index * 64 + dynamic_bitset_impl::lowest_bit(pos.word));
+            pos.word &= pos.word - 1;
+            return true;
+        }
+
+        void fill_words(boost::uint32_t first, boost::uint32_t last, bool val)
+        {
+            for (boost::uint32_t i = first / 64; i <= last / 64; ++i) {
+                const boost::uint32_t lo = i == first / 64 ? first % 64 : 0;
+                const boost::uint32_t hi = i == last / 64 ? last % 64 : 63;
+                const boost::uint64_t mask =
+                    (~boost::uint64_t(0) >> (63 - hi)) & (~boost::uint64_t(0) << lo);
+                if (val)
+                    m_words[i] |= mask;
+                else
+                    m_words[i] &= ~mask;
+            }
+        }
+
+        void recount()
+        {
+            m_cardinality = static_cast<boost::uint32_t>(
+                dynamic_bitset_impl::count_bitwise<dynamic_bitset_impl::lhs_op>(
+                    &m_words[0], &m_words[0], bitmap_words));
+        }
+
+        template <typename Op>
+        void assign_words(const container & other)
+        {
+            dynamic_bitset_impl::bitwise_assign<Op>(&m_words[0], &other.m_words[0], bitmap_words);
+            recount();
+            normalize();
+        }
+
+        void assign_array(values_type & values)
+        {
+            m_kind = array_kind;
+            m_cardinality = static_cast<boost::uint32_t>(values.size());
+            m_values.swap(values);
+            words_type(m_words.get_allocator()).swap(m_words);
+            normalize();
+        }
+
+        // keeps the sizes of the arrays and runs within their bounds
+        void normalize()
+        {
+            if (m_kind == array_kind && m_cardinality > array_max_size)
+                to_bitmap();
+            else if (m_kind == bitmap_kind && m_cardinality <= array_max_size)
+                to_array();
+            else if (m_kind == run_kind && num_runs() > run_max_size)
+                unpack();
+        }
+
+        void unpack()
+        {
+            if (m_kind == run_kind) {
+                if (m_cardinality <= array_max_size)
+                    to_array();
+                else
+                    to_bitmap();
+            }
+        }
+
+        void to_bitmap()
+        {
+            if (m_kind == bitmap_kind)
+                return;
+
+            m_words.assign(bitmap_words, 0);
+            if (m_kind == array_kind) {
+                for (std::size_t i = 0; i < m_values.size(); ++i)
+                    m_words[m_values[i] / 64] |= boost::uint64_t(1) << (m_values[i] % 64);
+            }
+            else {
+                for (std::size_t r = 0; r < num_runs(); ++r)
+                    fill_words(run_first(r), run_last(r), true);
+            }
+            values_type(m_values.get_allocator()).swap(m_values);
+            m_kind = bitmap_kind;
+        }
+
+        void to_array()
+        {
+            if (m_kind == array_kind)
+                return;
+
+            values_type values(m_values.get_allocator());
+            values.reserve(m_cardinality);
+            position pos;
+            for (bool more = first(pos); more; more = next(pos))
+                values.push_back(static_cast<boost::uint16_t>(pos.value));
+            m_values.swap(values);
+            words_type(m_words.get_allocator()).swap(m_words);
+            m_kind = array_kind;
+        }
+
+        void to_runs()
+        {
+            if (m_kind == run_kind)
+                return;
+
+            values_type runs(m_values.get_allocator());
+            runs.reserve(2 * count_runs());
+            position pos;
+            for (bool more = first(pos); more; more = next(pos)) {
+                if (!runs.empty() && runs.back() + 1u == pos.value)
+                    runs.back() = static_cast<boost::uint16_t>(pos.value);
+                else {
+                    runs.push_back(static_cast<boost::uint16_t>(pos.value));
+                    runs.push_back(static_cast<boost::uint16_t>(pos.value));
+                }
+            }
+            m_values.swap(runs);
+            words_type(m_words.get_allocator()).swap(m_words);
+            m_kind = run_kind;
+        }
+
+        boost::uint16_t m_key;
+        container_kind m_kind;
+        boost::uint32_t m_cardinality;
+        values_type m_values;
+        words_type m_words;
+    };
+
+    template <typename Container>
+    struct key_less
+    {
+        bool operator()(const Container & c, boost::uint16_t key) const
+        {
+            return c.key() < key;
+        }
+    };
+
+  } // namespace compressed_bitset_impl
+  } // namespace detail
+
+
+// A set of 32 bit positions, stored in the compressed form of
+// "roaring" bitmaps: the bits "on" of each chunk of 2^16 positions
+// are kept as a sorted array, a bitmap or a list of runs.
+//
+template <typename Allocator = std::allocator<boost::uint64_t> >
+class compressed_bitset
+{
+    typedef detail::compressed_bitset_impl::container<Allocator> container_type;
+    typedef std::vector<container_type,
+        typename Allocator::template rebind<container_type>::other> buffer_type;
+    typedef detail::compressed_bitset_impl::key_less<container_type> key_less;
+
+public:
+    typedef Allocator allocator_type;
+    typedef boost::uint64_t size_type;
+
+    BOOST_STATIC_CONSTANT(size_type, npos = static_cast<size_type>(-1));
+
+    // forward iterator over the positions of the bits "on", in
+    // increasing order
+    class const_iterator
+      : public boost::iterator_facade<const_iterator, const size_type,
+                                      boost::forward_traversal_tag, size_type>
+    {
+    public:
+        const_iterator() : m_chunk(0), m_end(0), m_pos() {}
+
+    private:
+        friend class compressed_bitset;
+        friend class boost::iterator_core_access;
+
+        const_iterator(const container_type * chunk, const container_type * end)
+          : m_chunk(chunk), m_end(end), m_pos()
+        {
+            if (m_chunk != m_end)
+                m_chunk->first(m_pos);
+        }
+
+        size_type dereference() const
+        {
+            return (size_type(m_chunk->key()) << 16) | m_pos.value;
+        }
+
+        void increment()
+        {
+            if (!m_chunk->next(m_pos) && ++m_chunk != m_end)
+                m_chunk->first(m_pos);
+        }
+
+        bool equal(const const_iterator & other) const
+        {
+            return m_chunk == other.m_chunk
+                && (m_chunk == m_end || m_pos.value == other.m_pos.value);
+        }
+
+        const container_type * m_chunk;
+        const container_type * m_end;
+        detail::compressed_bitset_impl::position m_pos;
+    };
+    typedef const_iterator iterator;
+
+    explicit compressed_bitset(const Allocator& alloc = Allocator());
+
+    // sets the bits at the positions in [first, last)
+    template <typename InputIterator>
+    compressed_bitset(InputIterator first, InputIterator last,
+                      const Allocator& alloc = Allocator())
+      : m_chunks(alloc)
+    {
+        for (; first != last; ++first)
+            set(*first);
+    }
+
+    void swap(compressed_bitset& b);
+    allocator_type get_allocator() const;
+
+    // bitset operations
+    compressed_bitset& operator&=(const compressed_bitset& b);
+    compressed_bitset& operator|=(const compressed_bitset& b);
+    compressed_bitset& operator^=(const compressed_bitset& b);
+    compressed_bitset& operator-=(const compressed_bitset& b);
+
+    // basic bit operations
+    compressed_bitset& set(size_type n, bool val = true);
+    compressed_bitset& set(size_type pos, size_type len, bool val);
+    compressed_bitset& reset(size_type n);
+    compressed_bitset& reset();
+    compressed_bitset& flip(size_type n);
+    bool test(size_type n) const;
+    bool any() const;
+    bool none() const;
+    size_type count() const;
+
+    bool operator[](size_type pos) const { return test(pos); }
+
+    // number of positions, 2^32
+    size_type size() const;
+
+    bool is_subset_of(const compressed_bitset& a) const;
+    bool intersects(const compressed_bitset& a) const;
+
+    // lookup
+    size_type find_first() const;
+    size_type find_next(size_type pos) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // stores each chunk in the representation that takes the least
+    // memory, and releases the unused capacity
+    void optimize();
+
+    // bytes allocated for the chunks
+    std::size_t memory_usage() const;
+
+    friend bool operator==(const compressed_bitset& a, const compressed_bitset& b)
+    {
+        return a.m_chunks == b.m_chunks;
+    }
+
+    // defined in boost/dynamic_bitset/compressed_bitset_serialization.hpp
+    template <typename Archive>
+    struct serialize_impl;
+
+private:
+    typename buffer_type::iterator m_find(boost::uint16_t key);
+    typename buffer_type::const_iterator m_find(boost::uint16_t key) const;
+    typename buffer_type::iterator m_insert(boost::uint16_t key);
+
+    buffer_type m_chunks; // sorted by key, none of them is empty
+};
+
+
+template <typename Allocator>
+bool operator!=(const compressed_bitset<Allocator>& a,
+                const compressed_bitset<Allocator>& b);
+
+template <typename Allocator>
+compressed_bitset<Allocator>
+operator&(const compressed_bitset<Allocator>& b1,
+          const compressed_bitset<Allocator>& b2);
+
+template <typename Allocator>
+compressed_bitset<Allocator>
+operator|(const compressed_bitset<Allocator>& b1,
+          const compressed_bitset<Allocator>& b2);
+
+template <typename Allocator>
+compressed_bitset<Allocator>
+operator^(const compressed_bitset<Allocator>& b1,
+          const compressed_bitset<Allocator>& b2);
+
+template <typename Allocator>
+compressed_bitset<Allocator>
+operator-(const compressed_bitset<Allocator>& b1,
+          const compressed_bitset<Allocator>& b2);
+
+template <typename Allocator>
+void swap(compressed_bitset<Allocator>& b1,
+          compressed_bitset<Allocator>& b2);
+
+
+//=============================================================================
+// compressed_bitset implementation
+
+
+//-----------------------------------------------------------------------------
+// constructors, etc.
+
+template <typename Allocator>
+compressed_bitset<Allocator>::compressed_bitset(const Allocator& alloc)
+  : m_chunks(alloc)
+{
+}
+
+template <typename Allocator>
+inline void compressed_bitset<Allocator>::swap(compressed_bitset<Allocator>& b)
+{
+    m_chunks.swap(b.m_chunks);
+}
+
+template <typename Allocator>
+inline typename compressed_bitset<Allocator>::allocator_type
+compressed_bitset<Allocator>::get_allocator() const
+{
+    return m_chunks.get_allocator();
+}
+
+//-----------------------------------------------------------------------------
+// bitset operations
+
+// The chunks only in *this are kept by |= and ^=, and dropped by &=.
+// The chunks which become empty are removed.
+//
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::operator&=(const compressed_bitset& rhs)
+{
+    typename buffer_type::const_iterator j = rhs.m_chunks.begin();
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_chunks.size(); ++i) {
+        j = std::lower_bound(j, rhs.m_chunks.end(), m_chunks[i].key(), key_less());
+        if (j == rhs.m_chunks.end())
+            break;
+        if (j->key() != m_chunks[i].key())
+            continue;
+
+        m_chunks[i].and_assign(*j);
+        if (!m_chunks[i].empty())
+            m_chunks[kept++].swap(m_chunks[i]);
+    }
+    m_chunks.erase(m_chunks.begin() + kept, m_chunks.end());
+    return *this;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::operator|=(const compressed_bitset& rhs)
+{
+    buffer_type result(m_chunks.get_allocator());
+    result.reserve(m_chunks.size() + rhs.m_chunks.size());
+
+    typename buffer_type::iterator i = m_chunks.begin();
+    typename buffer_type::const_iterator j = rhs.m_chunks.begin();
+    while (i != m_chunks.end() || j != rhs.m_chunks.end()) {
+        if (j == rhs.m_chunks.end() || (i != m_chunks.end() && i->key() < j->key())) {
+            result.push_back(container_type(i->key(), m_chunks.get_allocator()));
+            result.back().swap(*i++);
+        }
+        else if (i == m_chunks.end() || j->key() < i->key())
+            result.push_back(*j++);
+        else {
+            i->or_assign(*j++);
+            result.push_back(container_type(i->key(), m_chunks.get_allocator()));
+            result.back().swap(*i++);
+        }
+    }
+    m_chunks.swap(result);
+    return *this;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::operator^=(const compressed_bitset& rhs)
+{
+    buffer_type result(m_chunks.get_allocator());
+    result.reserve(m_chunks.size() + rhs.m_chunks.size());
+
+    typename buffer_type::iterator i = m_chunks.begin();
+    typename buffer_type::const_iterator j = rhs.m_chunks.begin();
+    while (i != m_chunks.end() || j != rhs.m_chunks.end()) {
+        if (j == rhs.m_chunks.end() || (i != m_chunks.end() && i->key() < j->key())) {
+            result.push_back(container_type(i->key(), m_chunks.get_allocator()));
+            result.back().swap(*i++);
+        }
+        else if (i == m_chunks.end() || j->key() < i->key())
+            result.push_back(*j++);
+        else {
+            i->xor_assign(*j++);
+            if (!i->empty()) {
+                result.push_back(container_type(i->key(), m_chunks.get_allocator()));
+                result.back().swap(*i);
+            }
+            ++i;
+        }
+    }
+    m_chunks.swap(result);
+    return *this;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::operator-=(const compressed_bitset& rhs)
+{
+    typename buffer_type::const_iterator j = rhs.m_chunks.begin();
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_chunks.size(); ++i) {
+        j = std::lower_bound(j, rhs.m_chunks.end(), m_chunks[i].key(), key_less());
+        if (j != rhs.m_chunks.end() && j->key() == m_chunks[i].key())
+            m_chunks[i].andnot_assign(*j);
+        if (!m_chunks[i].empty())
+            m_chunks[kept++].swap(m_chunks[i]);
+    }
+    m_chunks.erase(m_chunks.begin() + kept, m_chunks.end());
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+// basic bit operations
+
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::set(size_type n, bool val)
+{
+    assert(n < size());
+
+    if (val)
+        m_insert(static_cast<boost::uint16_t>(n >> 16))->set(static_cast<boost::uint32_t>(n & 0xffff));
+    else
+        reset(n);
+
+    return *this;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::set(size_type pos, size_type len, bool val)
+{
+    assert(pos <= size() && len <= size() - pos);
+    if (len == 0)
+        return *this;
+
+    const size_type last = pos + len - 1;
+    for (size_type key = pos >> 16; key <= last >> 16; ++key) {
+        const boost::uint32_t lo = key == pos >> 16 ? static_cast<boost::uint32_t>(pos & 0xffff) : 0;
+        const boost::uint32_t hi = key == last >> 16 ? static_cast<boost::uint32_t>(last & 0xffff) : 0xffff;
+
+        if (val)
+            m_insert(static_cast<boost::uint16_t>(key))->add_range(lo, hi);
+        else {
+            const typename buffer_type::iterator it = m_find(static_cast<boost::uint16_t>(key));
+            if (it != m_chunks.end()) {
+                it->remove_range(lo, hi);
+                if (it->empty())
+                    m_chunks.erase(it);
+            }
+        }
+    }
+    return *this;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::reset(size_type n)
+{
+    assert(n < size());
+
+    const typename buffer_type::iterator it = m_find(static_cast<boost::uint16_t>(n >> 16));
+    if (it != m_chunks.end()) {
+        it->reset(static_cast<boost::uint32_t>(n & 0xffff));
+        if (it->empty())
+            m_chunks.erase(it);
+    }
+    return *this;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::reset()
+{
+    m_chunks.clear();
+    return *this;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>&
+compressed_bitset<Allocator>::flip(size_type n)
+{
+    assert(n < size());
+    return set(n, !test(n));
+}
+
+template <typename Allocator>
+bool compressed_bitset<Allocator>::test(size_type n) const
+{
+    assert(n < size());
+
+    const typename buffer_type::const_iterator it = m_find(static_cast<boost::uint16_t>(n >> 16));
+    return it != m_chunks.end() && it->test(static_cast<boost::uint32_t>(n & 0xffff));
+}
+
+template <typename Allocator>
+inline bool compressed_bitset<Allocator>::any() const
+{
+    return !m_chunks.empty();
+}
+
+template <typename Allocator>
+inline bool compressed_bitset<Allocator>::none() const
+{
+    return m_chunks.empty();
+}
+
+template <typename Allocator>
+typename compressed_bitset<Allocator>::size_type
+compressed_bitset<Allocator>::count() const
+{
+    size_type num = 0;
+    for (std::size_t i = 0; i < m_chunks.size(); ++i)
+        num += m_chunks[i].cardinality();
+    return num;
+}
+
+template <typename Allocator>
+inline typename compressed_bitset<Allocator>::size_type
+compressed_bitset<Allocator>::size() const
+{
+    return size_type(1) << 32;
+}
+
+template <typename Allocator>
+bool compressed_bitset<Allocator>::is_subset_of(const compressed_bitset& a) const
+{
+    typename buffer_type::const_iterator j = a.m_chunks.begin();
+    for (std::size_t i = 0; i < m_chunks.size(); ++i) {
+        j = std::lower_bound(j, a.m_chunks.end(), m_chunks[i].key(), key_less());
+        if (j == a.m_chunks.end() || j->key() != m_chunks[i].key()
+            || j->cardinality() < m_chunks[i].cardinality())
+            return false;
+
+        container_type difference(m_chunks[i]);
+        difference.andnot_assign(*j);
+        if (!difference.empty())
+            return false;
+    }
+    return true;
+}
+
+template <typename Allocator>
+bool compressed_bitset<Allocator>::intersects(const compressed_bitset& a) const
+{
+    typename buffer_type::const_iterator j = a.m_chunks.begin();
+    for (std::size_t i = 0; i < m_chunks.size(); ++i) {
+        j = std::lower_bound(j, a.m_chunks.end(), m_chunks[i].key(), key_less());
+        if (j == a.m_chunks.end())
+            break;
+        if (j->key() == m_chunks[i].key() && m_chunks[i].intersects(*j))
+            return true;
+    }
+    return false;
+}
+
+// --------------------------------
+// lookup
+
+template <typename Allocator>
+typename compressed_bitset<Allocator>::size_type
+compressed_bitset<Allocator>::find_first() const
+{
+    if (m_chunks.empty())
+        return npos;
+
+    const container_type & c = m_chunks.front();
+    return (size_type(c.key()) << 16) | c.find_from(0);
+}
+
+template <typename Allocator>
+typename compressed_bitset<Allocator>::size_type
+compressed_bitset<Allocator>::find_next(size_type pos) const
+{
+    if (pos >= size() - 1)
+        return npos;
+
+    ++pos;
+
+    const boost::uint16_t key = static_cast<boost::uint16_t>(pos >> 16);
+    typename buffer_type::const_iterator it =
+        std::lower_bound(m_chunks.begin(), m_chunks.end(), key, key_less());
+    if (it != m_chunks.end() && it->key() == key) {
+        const boost::uint32_t v = it->find_from(static_cast<boost::uint32_t>(pos & 0xffff));
+        if (v != detail::compressed_bitset_impl::chunk_size)
+            return (size_type(key) << 16) | v;
+        ++it;
+    }
+
+    return it == m_chunks.end() ? npos
+        : (size_type(it->key()) << 16) | it->find_from(0);
+}
+
+template <typename Allocator>
+typename compressed_bitset<Allocator>::const_iterator
+compressed_bitset<Allocator>::begin() const
+{
+    if (m_chunks.empty())
+        return const_iterator();
+    return const_iterator(&m_chunks[0], &m_chunks[0] + m_chunks.size());
+}
+
+template <typename Allocator>
+typename compressed_bitset<Allocator>::const_iterator
+compressed_bitset<Allocator>::end() const
+{
+    if (m_chunks.empty())
+        return const_iterator();
+    const container_type * const end = &m_chunks[0] + m_chunks.size();
+    return const_iterator(end, end);
+}
+
+//-----------------------------------------------------------------------------
+// storage
+
+template <typename Allocator>
+void compressed_bitset<Allocator>::optimize()
+{
+    for (std::size_t i = 0; i < m_chunks.size(); ++i)
+        m_chunks[i].optimize();
+    buffer_type(m_chunks).swap(m_chunks);
+}
+
+template <typename Allocator>
+std::size_t compressed_bitset<Allocator>::memory_usage() const
+{
+    std::size_t bytes = m_chunks.capacity() * sizeof(container_type);
+    for (std::size_t i = 0; i < m_chunks.size(); ++i)
+        bytes += m_chunks[i].memory_usage();
+    return bytes;
+}
+
+template <typename Allocator>
+inline typename compressed_bitset<Allocator>::buffer_type::iterator
+compressed_bitset<Allocator>::m_find(boost::uint16_t key)
+{
+    const typename buffer_type::iterator it =
+        std::lower_bound(m_chunks.begin(), m_chunks.end(), key, key_less());
+    return it != m_chunks.end() && it->key() == key ? it : m_chunks.end();
+}
+
+template <typename Allocator>
+inline typename compressed_bitset<Allocator>::buffer_type::const_iterator
+compressed_bitset<Allocator>::m_find(boost::uint16_t key) const
+{
+    const typename buffer_type::const_iterator it =
+        std::lower_bound(m_chunks.begin(), m_chunks.end(), key, key_less());
+    return it != m_chunks.end() && it->key() == key ? it : m_chunks.end();
+}
+
+// the chunk with the given key, which is created if needed
+//
+template <typename Allocator>
+inline typename compressed_bitset<Allocator>::buffer_type::iterator
+compressed_bitset<Allocator>::m_insert(boost::uint16_t key)
+{
+    // positions are usually set in increasing order
+    if (!m_chunks.empty() && m_chunks.back().key() == key)
+        return m_chunks.end() - 1;
+
+    const typename buffer_type::iterator it =
+        std::lower_bound(m_chunks.begin(), m_chunks.end(), key, key_less());
+    if (it != m_chunks.end() && it->key() == key)
+        return it;
+    return m_chunks.insert(it, container_type(key, m_chunks.get_allocator()));
+}
+
+//-----------------------------------------------------------------------------
+// comparison
+
+template <typename Allocator>
+inline bool operator!=(const compressed_bitset<Allocator>& a,
+                       const compressed_bitset<Allocator>& b)
+{
+    return !(a == b);
+}
+
+//-----------------------------------------------------------------------------
+// bitset operations
+
+template <typename Allocator>
+compressed_bitset<Allocator>
+operator&(const compressed_bitset<Allocator>& x,
+          const compressed_bitset<Allocator>& y)
+{
+    compressed_bitset<Allocator> b(x);
+    return b &= y;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>
+operator|(const compressed_bitset<Allocator>& x,
+          const compressed_bitset<Allocator>& y)
+{
+    compressed_bitset<Allocator> b(x);
+    return b |= y;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>
+operator^(const compressed_bitset<Allocator>& x,
+          const compressed_bitset<Allocator>& y)
+{
+    compressed_bitset<Allocator> b(x);
+    return b ^= y;
+}
+
+template <typename Allocator>
+compressed_bitset<Allocator>
+operator-(const compressed_bitset<Allocator>& x,
+          const compressed_bitset<Allocator>& y)
+{
+    compressed_bitset<Allocator> b(x);
+    return b -= y;
+}
+
+//-----------------------------------------------------------------------------
+// namespace scope swap
+
+template <typename Allocator>
+inline void
+swap(compressed_bitset<Allocator>& left,
+     compressed_bitset<Allocator>& right) // no throw
+{
+    left.swap(right);
+}
+
+} // namespace boost
+
+#endif // include guard
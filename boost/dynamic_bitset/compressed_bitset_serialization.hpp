@@ -0,0 +1,165 @@
+// -----------------------------------------------------------
+//
+//        Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// -----------------------------------------------------------
+
+#ifndef BOOST_COMPRESSED_BITSET_SERIALIZATION_HPP
+#define BOOST_COMPRESSED_BITSET_SERIALIZATION_HPP
+
+#include "boost/archive/archive_exception.hpp"
+#include "boost/dynamic_bitset/compressed_bitset.hpp"
+#include "boost/serialization/collection_size_type.hpp"
+#include "boost/serialization/nvp.hpp"
+#include "boost/serialization/split_free.hpp"
+#include "boost/serialization/throw_exception.hpp"
+#include "boost/serialization/vector.hpp"
+
+
+namespace boost {
+
+// Each chunk is written as its key, the kind of its representation,
+// the number of bits "on" and the arrays of values and words. The
+// chunks read are checked to be a valid representation, since the
+// member functions rely on it.
+//
+template <typename Allocator>
+template <typename Archive>
+struct compressed_bitset<Allocator>::serialize_impl
+{
+    typedef typename container_type::values_type values_type;
+    typedef typename container_type::words_type words_type;
+
+    static bool is_valid(unsigned int kind, boost::uint32_t cardinality,
+                         const values_type & values, const words_type & words)
+    {
+        using namespace detail::compressed_bitset_impl;
+
+        boost::uint32_t count = 0;
+        switch (kind) {
+        case array_kind:
+            if (!words.empty() || values.size() != cardinality)
+                return false;
+            for (std::size_t i = 1; i < values.size(); ++i)
+                if (values[i - 1] >= values[i])
+                    return false;
+            count = static_cast<boost::uint32_t>(values.size());
+            break;
+        case bitmap_kind:
+            if (!values.empty() || words.size() != bitmap_words)
+                return false;
+            for (std::size_t i = 0; i < bitmap_words; ++i)
+                count += static_cast<boost::uint32_t>(
+                    detail::dynamic_bitset_impl::popcount(words[i]));
+            break;
+        case run_kind:
+            // the runs must be sorted and maximal, i.e. separated by
+            // at least one bit "off"
+            if (!words.empty() || values.size() % 2 != 0)
+                return false;
+            for (std::size_t i = 0; i < values.size(); i += 2) {
+                if (values[i] > values[i + 1]
+                    || (i != 0 && values[i - 1] + 1 >= values[i]))
+                    return false;
+                count += values[i + 1] - values[i] + 1u;
+            }
+            break;
+        default:
+            return false;
+        }
+        // empty chunks aren't stored
+        return count != 0 && count == cardinality;
+    }
+
+    static void invalid_archive()
+    {
+        boost::serialization::throw_exception(
+            boost::archive::archive_exception(
+                boost::archive::archive_exception::other_exception,
+                "invalid compressed_bitset"));
+    }
+
+    static void save(Archive & ar, const compressed_bitset & b, const unsigned int /*version*/)
+    {
+        const boost::serialization::collection_size_type count(b.m_chunks.size());
+        ar << boost::serialization::make_nvp("count", count);
+
+        for (std::size_t i = 0; i < b.m_chunks.size(); ++i) {
+            const container_type & c = b.m_chunks[i];
+            const boost::uint16_t key = c.key();
+            const unsigned int kind = c.kind();
+            const boost::uint32_t cardinality = c.cardinality();
+
+            ar << boost::serialization::make_nvp("key", key);
+            ar << boost::serialization::make_nvp("kind", kind);
+            ar << boost::serialization::make_nvp("cardinality", cardinality);
+            ar << boost::serialization::make_nvp("values", c.values());
+            ar << boost::serialization::make_nvp("words", c.words());
+        }
+    }
+
+    static void load(Archive & ar, compressed_bitset & b, const unsigned int /*version*/)
+    {
+        boost::serialization::collection_size_type count;
+        ar >> boost::serialization::make_nvp("count", count);
+
+        buffer_type chunks(b.m_chunks.get_allocator());
+        chunks.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            boost::uint16_t key;
+            unsigned int kind;
+            boost::uint32_t cardinality;
+            values_type values(b.m_chunks.get_allocator());
+            words_type words(b.m_chunks.get_allocator());
+
+            ar >> boost::serialization::make_nvp("key", key);
+            ar >> boost::serialization::make_nvp("kind", kind);
+            ar >> boost::serialization::make_nvp("cardinality", cardinality);
+            ar >> boost::serialization::make_nvp("values", values);
+            ar >> boost::serialization::make_nvp("words", words);
+
+            if ((i != 0 && chunks.back().key() >= key)
+                || !is_valid(kind, cardinality, values, words))
+                invalid_archive();
+
+            container_type c(key, static_cast<detail::compressed_bitset_impl::container_kind>(kind),
+                             cardinality, values, words);
+            chunks.push_back(container_type(key, b.m_chunks.get_allocator()));
+            chunks.back().swap(c);
+        }
+        b.m_chunks.swap(chunks);
+    }
+};
+
+namespace serialization {
+
+template <typename Archive, typename Allocator>
+inline void save(Archive & ar, const boost::compressed_bitset<Allocator> & b,
+                 const unsigned int version)
+{
+    boost::compressed_bitset<Allocator>::template serialize_impl<Archive>::save(ar, b, version);
+}
+
+template <typename Archive, typename Allocator>
+inline void load(Archive & ar, boost::compressed_bitset<Allocator> & b,
+                 const unsigned int version)
+{
+    boost::compressed_bitset<Allocator>::template serialize_impl<Archive>::load(ar, b, version);
+}
+
+template <typename Archive, typename Allocator>
+inline void serialize(Archive & ar, boost::compressed_bitset<Allocator> & b,
+                      const unsigned int version)
+{
+    boost::serialization::split_free(ar, b, version);
+}
+
+} // namespace serialization
+
+} // namespace boost
+
+#endif // include guard
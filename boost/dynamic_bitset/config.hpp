@@ -69,4 +69,25 @@ namespace boost { namespace detail {
 
 #endif
 
+// Bit counting and scanning intrinsics
+//
+#if !defined(BOOST_DYNAMIC_BITSET_NO_INTRINSICS) && defined(__GNUC__) \
+    && (defined(__clang__) || (__GNUC__ * 100 + __GNUC_MINOR__ >= 304))
+#define BOOST_DYNAMIC_BITSET_HAS_BUILTIN_BITOPS
+#endif
+
+// Vectorized bulk operations on x86: SSE2 is used if it is enabled at
+// compile time, AVX2 and POPCNT are selected at run time. The target
+// attribute is needed to compile the AVX2 functions without -mavx2.
+//
+#if !defined(BOOST_DYNAMIC_BITSET_NO_SIMD) \
+    && defined(BOOST_DYNAMIC_BITSET_HAS_BUILTIN_BITOPS) \
+    && (defined(__x86_64__) || defined(__i386__)) && !defined(__INTEL_COMPILER) \
+    && ((defined(__clang__) && (__clang_major__ >= 4)) \
+        || (!defined(__clang__) && (__GNUC__ * 100 + __GNUC_MINOR__ >= 409)))
+#define BOOST_DYNAMIC_BITSET_X86_DISPATCH
+#define BOOST_DYNAMIC_BITSET_TARGET_AVX2 __attribute__((target("avx2")))
+#define BOOST_DYNAMIC_BITSET_TARGET_POPCNT __attribute__((target("popcnt")))
+#endif
+
 #endif // include guard
@@ -292,6 +292,13 @@ public:
     bool is_proper_subset_of(const dynamic_bitset& a) const;
     bool intersects(const dynamic_bitset & a) const;
 
+    // fused bitset operations, which don't create the result
+    size_type and_count(const dynamic_bitset& b) const;
+    size_type or_count(const dynamic_bitset& b) const;
+    size_type xor_count(const dynamic_bitset& b) const;
+    size_type andnot_count(const dynamic_bitset& b) const;
+    bool andnot_any(const dynamic_bitset& b) const;
+
     // lookup
     size_type find_first() const;
     size_type find_next(size_type pos) const;
@@ -337,6 +344,15 @@ private:
 
     size_type m_do_find_from(size_type first_block) const;
 
+    // bulk operations on the blocks of *this and b
+    template <typename Op>
+    void m_bitwise_assign(const dynamic_bitset& b);
+    template <typename Op>
+    size_type m_bitwise_count(const dynamic_bitset& b) const;
+    template <typename Op>
+    size_type m_bitwise_find(const dynamic_bitset& b, size_type first_block,
+                             size_type last_block) const;
+
     block_width_type count_extra_bits() const { return bit_index(size()); }
     static size_type block_index(size_type pos) { return pos / bits_per_block; }
     static block_width_type bit_index(size_type pos) { return static_cast<block_width_type>(pos % bits_per_block); }
@@ -731,8 +747,7 @@ dynamic_bitset<Block, Allocator>&
 dynamic_bitset<Block, Allocator>::operator&=(const dynamic_bitset& rhs)
 {
     assert(size() == rhs.size());
-    for (size_type i = 0; i < num_blocks(); ++i)
-        m_bits[i] &= rhs.m_bits[i];
+    m_bitwise_assign<detail::dynamic_bitset_impl::and_op>(rhs);
     return *this;
 }
 
@@ -741,9 +756,7 @@ dynamic_bitset<Block, Allocator>&
 dynamic_bitset<Block, Allocator>::operator|=(const dynamic_bitset& rhs)
 {
     assert(size() == rhs.size());
-    for (size_type i = 0; i < num_blocks(); ++i)
-        m_bits[i] |= rhs.m_bits[i];
-    //m_zero_unused_bits();
+    m_bitwise_assign<detail::dynamic_bitset_impl::or_op>(rhs);
     return *this;
 }
 
@@ -752,9 +765,7 @@ dynamic_bitset<Block, Allocator>&
 dynamic_bitset<Block, Allocator>::operator^=(const dynamic_bitset& rhs)
 {
     assert(size() == rhs.size());
-    for (size_type i = 0; i < this->num_blocks(); ++i)
-        m_bits[i] ^= rhs.m_bits[i];
-    //m_zero_unused_bits();
+    m_bitwise_assign<detail::dynamic_bitset_impl::xor_op>(rhs);
     return *this;
 }
 
@@ -763,9 +774,7 @@ dynamic_bitset<Block, Allocator>&
 dynamic_bitset<Block, Allocator>::operator-=(const dynamic_bitset& rhs)
 {
     assert(size() == rhs.size());
-    for (size_type i = 0; i < num_blocks(); ++i)
-        m_bits[i] &= ~rhs.m_bits[i];
-    //m_zero_unused_bits();
+    m_bitwise_assign<detail::dynamic_bitset_impl::andnot_op>(rhs);
     return *this;
 }
 
@@ -969,10 +978,8 @@ bool dynamic_bitset<Block, Allocator>::test(size_type pos) const
 template <typename Block, typename Allocator>
 bool dynamic_bitset<Block, Allocator>::any() const
 {
-    for (size_type i = 0; i < num_blocks(); ++i)
-        if (m_bits[i])
-            return true;
-    return false;
+    return m_bitwise_find<detail::dynamic_bitset_impl::lhs_op>(*this, 0, num_blocks())
+        != num_blocks();
 }
 
 template <typename Block, typename Allocator>
@@ -994,6 +1001,12 @@ template <typename Block, typename Allocator>
 typename dynamic_bitset<Block, Allocator>::size_type
 dynamic_bitset<Block, Allocator>::count() const
 {
+#if defined(BOOST_DYNAMIC_BITSET_X86_DISPATCH)
+    // NOTE: Without the vector and popcnt instructions, the
+    //       builtin popcount is slower than the table for
+    //       small blocks
+    return m_bitwise_count<detail::dynamic_bitset_impl::lhs_op>(*this);
+#else
     using detail::dynamic_bitset_impl::table_width;
     using detail::dynamic_bitset_impl::access_by_bytes;
     using detail::dynamic_bitset_impl::access_by_blocks;
@@ -1019,6 +1032,7 @@ dynamic_bitset<Block, Allocator>::count() const
 
     return do_count(m_bits.begin(), num_blocks(), Block(0),
                     static_cast<value_to_type<(bool)mode> *>(0));
+#endif
 }
 
 
@@ -1171,10 +1185,7 @@ bool dynamic_bitset<Block, Allocator>::
 is_subset_of(const dynamic_bitset<Block, Allocator>& a) const
 {
     assert(size() == a.size());
-    for (size_type i = 0; i < num_blocks(); ++i)
-        if (m_bits[i] & ~a.m_bits[i])
-            return false;
-    return true;
+    return !andnot_any(a);
 }
 
 template <typename Block, typename Allocator>
@@ -1203,11 +1214,48 @@ bool dynamic_bitset<Block, Allocator>::intersects(const dynamic_bitset & b) cons
     size_type common_blocks = num_blocks() < b.num_blocks()
                               ? num_blocks() : b.num_blocks();
 
-    for(size_type i = 0; i < common_blocks; ++i) {
-        if(m_bits[i] & b.m_bits[i])
-            return true;
-    }
-    return false;
+    return m_bitwise_find<detail::dynamic_bitset_impl::and_op>(b, 0, common_blocks)
+        != common_blocks;
+}
+
+template <typename Block, typename Allocator>
+typename dynamic_bitset<Block, Allocator>::size_type
+dynamic_bitset<Block, Allocator>::and_count(const dynamic_bitset& b) const
+{
+    assert(size() == b.size());
+    return m_bitwise_count<detail::dynamic_bitset_impl::and_op>(b);
+}
+
+template <typename Block, typename Allocator>
+typename dynamic_bitset<Block, Allocator>::size_type
+dynamic_bitset<Block, Allocator>::or_count(const dynamic_bitset& b) const
+{
+    assert(size() == b.size());
+    return m_bitwise_count<detail::dynamic_bitset_impl::or_op>(b);
+}
+
+template <typename Block, typename Allocator>
+typename dynamic_bitset<Block, Allocator>::size_type
+dynamic_bitset<Block, Allocator>::xor_count(const dynamic_bitset& b) const
+{
+    assert(size() == b.size());
+    return m_bitwise_count<detail::dynamic_bitset_impl::xor_op>(b);
+}
+
+template <typename Block, typename Allocator>
+typename dynamic_bitset<Block, Allocator>::size_type
+dynamic_bitset<Block, Allocator>::andnot_count(const dynamic_bitset& b) const
+{
+    assert(size() == b.size());
+    return m_bitwise_count<detail::dynamic_bitset_impl::andnot_op>(b);
+}
+
+template <typename Block, typename Allocator>
+bool dynamic_bitset<Block, Allocator>::andnot_any(const dynamic_bitset& b) const
+{
+    assert(size() == b.size());
+    return m_bitwise_find<detail::dynamic_bitset_impl::andnot_op>(b, 0, num_blocks())
+        != num_blocks();
 }
 
 // --------------------------------
@@ -1221,16 +1269,15 @@ template <typename Block, typename Allocator>
 typename dynamic_bitset<Block, Allocator>::size_type
 dynamic_bitset<Block, Allocator>::m_do_find_from(size_type first_block) const
 {
-    size_type i = first_block;
-
     // skip null blocks
-    while (i < num_blocks() && m_bits[i] == 0)
-        ++i;
+    const size_type i = first_block < num_blocks()
+        ? m_bitwise_find<detail::dynamic_bitset_impl::lhs_op>(*this, first_block, num_blocks())
+        : num_blocks();
 
     if (i >= num_blocks())
         return npos; // not found
 
-    return i * bits_per_block + boost::lowest_bit(m_bits[i]);
+    return i * bits_per_block + detail::dynamic_bitset_impl::lowest_bit(m_bits[i]);
 
 }
 
@@ -1261,7 +1308,7 @@ dynamic_bitset<Block, Allocator>::find_next(size_type pos) const
     const Block fore = m_bits[blk] & ( ~Block(0) << ind );
 
     return fore?
-        blk * bits_per_block + lowest_bit(fore)
+        blk * bits_per_block + detail::dynamic_bitset_impl::lowest_bit(fore)
         :
         m_do_find_from(blk + 1);
 
@@ -1734,6 +1781,44 @@ inline void dynamic_bitset<Block, Allocator>::m_zero_unused_bits()
 
 }
 
+// The bulk operations forward to the vectorized loops in
+// detail/dynamic_bitset.hpp, with Op one of the operation
+// classes defined there. b must have at least as many
+// blocks as *this.
+//
+template <typename Block, typename Allocator>
+template <typename Op>
+inline void dynamic_bitset<Block, Allocator>::m_bitwise_assign(const dynamic_bitset& b)
+{
+    if (num_blocks() != 0)
+        detail::dynamic_bitset_impl::bitwise_assign<Op>(&m_bits[0], &b.m_bits[0], num_blocks());
+}
+
+template <typename Block, typename Allocator>
+template <typename Op>
+inline typename dynamic_bitset<Block, Allocator>::size_type
+dynamic_bitset<Block, Allocator>::m_bitwise_count(const dynamic_bitset& b) const
+{
+    if (num_blocks() == 0)
+        return 0;
+    return detail::dynamic_bitset_impl::count_bitwise<Op>(&m_bits[0], &b.m_bits[0], num_blocks());
+}
+
+// index of the first block in [first_block, last_block) for which
+// the result of the operation isn't zero, or last_block
+//
+template <typename Block, typename Allocator>
+template <typename Op>
+inline typename dynamic_bitset<Block, Allocator>::size_type
+dynamic_bitset<Block, Allocator>::m_bitwise_find(const dynamic_bitset& b,
+    size_type first_block, size_type last_block) const
+{
+    if (first_block == last_block)
+        return last_block;
+    return first_block + detail::dynamic_bitset_impl::find_bitwise<Op>(
+        &m_bits[first_block], &b.m_bits[first_block], last_block - first_block);
+}
+
 // check class invariants
 template <typename Block, typename Allocator>
 bool dynamic_bitset<Block, Allocator>::m_check_invariants() const
@@ -0,0 +1,159 @@
+/* Copyright (C) 2026 agent <agent@local>.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/flyweight for library home page.
+ */
+
+#ifndef BOOST_FLYWEIGHT_CONCURRENT_FACTORY_HPP
+#define BOOST_FLYWEIGHT_CONCURRENT_FACTORY_HPP
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <boost/flyweight/concurrent_factory_fwd.hpp>
+#include <boost/flyweight/detail/recursive_lw_mutex.hpp>
+#include <boost/flyweight/factory_tag.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/mpl/aux_/lambda_support.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/noncopyable.hpp>
+#include <cstddef>
+#include <functional>
+
+/* Flyweight factory partitioned into a fixed number of hashed containers,
+ * each protected by its own mutex: threads inserting or erasing entries
+ * which belong to different partitions do not contend with each other.
+ * Access to a partition is synchronized by flyweight_core through
+ * mutex(x), so concurrent_factory_class does not rely on the locking policy.
+ * Values whose construction or destruction involves flyweights of the same
+ * type can lock two partitions at once and should not be used with this
+ * factory, as this can lead to deadlocks.
+ */
+
+namespace boost{
+
+namespace flyweights{
+
+template<
+  typename Entry,typename Key,
+  typename Hash,typename Pred,typename Allocator
+>
+class concurrent_factory_class:
+  public factory_marker,public concurrent_factory_marker,noncopyable
+{
+  typedef typename boost::mpl::if_<
+    mpl::is_na<Hash>,
+    hash<Key>,
+    Hash
+  >::type                                           hash_type;
+
+  struct index_list:
+    boost::mpl::vector1<
+      multi_index::hashed_unique<
+        multi_index::identity<Entry>,
+        hash_type,
+        typename boost::mpl::if_<
+          mpl::is_na<Pred>,
+          std::equal_to<Key>,
+          Pred
+        >::type
+      >
+    >
+  {};
+
+  typedef multi_index::multi_index_container<
+    Entry,
+    index_list,
+    typename boost::mpl::if_<
+      mpl::is_na<Allocator>,
+      std::allocator<Entry>,
+      Allocator
+    >::type
+  > container_type;
+
+public:
+  typedef const Entry*                        handle_type;
+  typedef detail::recursive_lightweight_mutex mutex_type;
+  typedef mutex_type::scoped_lock             lock_type;
+
+  /* a prime number, so that partitioning does not correlate with the
+   * layout of hash values (e.g. aligned addresses)
+   */
+
+  BOOST_STATIC_CONSTANT(std::size_t,partition_count=61);
+
+  handle_type insert(const Entry& x)
+  {
+    return &*partition_of(x).cont.insert(x).first;
+  }
+
+  void erase(handle_type h)
+  {
+    container_type& cont=partition_of(*h).cont;
+    cont.erase(cont.iterator_to(*h));
+  }
+
+  static const Entry& entry(handle_type h){return *h;}
+
+  mutex_type& mutex(const Entry& x)
+  {
+    return partition_of(x).mutex;
+  }
+
+private:
+  /* the alignment keeps partitions in distinct cache lines */
+
+  struct BOOST_ALIGNMENT(64) partition
+  {
+    container_type cont;
+    mutex_type     mutex;
+#if defined(BOOST_NO_ALIGNMENT)
+    char           padding[64];
+#endif
+  };
+
+  partition& partition_of(const Entry& x)
+  {
+    return partitions[hasher(static_cast<const Key&>(x))%partition_count];
+  }
+
+  hash_type hasher;
+  partition partitions[partition_count];
+
+public:
+  typedef concurrent_factory_class type;
+  BOOST_MPL_AUX_LAMBDA_SUPPORT(
+    5,concurrent_factory_class,(Entry,Key,Hash,Pred,Allocator))
+};
+
+/* concurrent_factory_class specifier */
+
+template<
+  typename Hash,typename Pred,typename Allocator
+  BOOST_FLYWEIGHT_NOT_A_PLACEHOLDER_EXPRESSION_DEF
+>
+struct concurrent_factory:factory_marker
+{
+  template<typename Entry,typename Key>
+  struct apply:
+    mpl::apply2<
+      concurrent_factory_class<
+        boost::mpl::_1,boost::mpl::_2,Hash,Pred,Allocator
+      >,
+      Entry,Key
+    >
+  {};
+};
+
+} /* namespace flyweights */
+
+} /* namespace boost */
+
+#endif
@@ -0,0 +1,57 @@
+/* Copyright (C) 2026 agent <agent@local>.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/flyweight for library home page.
+ */
+
+#ifndef BOOST_FLYWEIGHT_DEFERRED_REFCOUNTED_HPP
+#define BOOST_FLYWEIGHT_DEFERRED_REFCOUNTED_HPP
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <boost/flyweight/deferred_refcounted_fwd.hpp>
+#include <boost/flyweight/refcounted.hpp>
+#include <boost/flyweight/tracking_tag.hpp>
+
+/* Refcounting tracking policy with deferred erasure: values no longer
+ * referenced are erased in batches rather than one at a time, so releasing
+ * the last reference to a value does not lock the factory, and values
+ * released and reacquired before their batch is processed are not erased
+ * and reinserted. See refcounted.hpp for implementation details.
+ */
+
+namespace boost{
+
+namespace flyweights{
+
+struct deferred_refcounted:tracking_marker
+{
+  struct entry_type
+  {
+    template<typename Value,typename Key>
+    struct apply
+    {
+      typedef detail::refcounted_value<Value,Key> type;
+    };
+  };
+
+  struct handle_type
+  {
+    template<typename Handle,typename TrackingHelper>
+    struct apply
+    {
+      typedef detail::refcounted_handle<Handle,TrackingHelper,true> type;
+    };
+  };
+};
+
+} /* namespace flyweights */
+
+} /* namespace boost */
+
+#endif
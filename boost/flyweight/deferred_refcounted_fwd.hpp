@@ -0,0 +1,26 @@
+/* Copyright (C) 2026 agent <agent@local>.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/flyweight for library home page.
+ */
+
+#ifndef BOOST_FLYWEIGHT_DEFERRED_REFCOUNTED_FWD_HPP
+#define BOOST_FLYWEIGHT_DEFERRED_REFCOUNTED_FWD_HPP
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+namespace boost{
+
+namespace flyweights{
+
+struct deferred_refcounted;
+
+} /* namespace flyweights */
+
+} /* namespace boost */
+
+#endif
@@ -14,10 +14,14 @@
 #endif
 
 #include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <boost/detail/lightweight_mutex.hpp>
 #include <boost/detail/no_exceptions_support.hpp>
 #include <boost/detail/workaround.hpp>
+#include <boost/flyweight/factory_tag.hpp>
 #include <boost/mpl/apply.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
+#include <cstddef>
+#include <vector>
 
 #if BOOST_WORKAROUND(BOOST_MSVC,BOOST_TESTED_AT(1400))
 #pragma warning(push)
@@ -27,6 +31,9 @@
 /* flyweight_core provides the inner implementation of flyweight<> by
  * weaving together a value policy, a flyweight factory, a holder for the
  * factory,a tracking policy and a locking policy.
+ * Access to an entry of the factory is protected by the mutex of the locking
+ * policy, except for concurrent factories, which provide a mutex per entry
+ * (see factory_tag.hpp).
  */
 
 namespace boost{
@@ -65,10 +72,46 @@ public:
   template<typename Checker>
   static void erase(const handle_type& h,Checker chk)
   {
-    typedef typename core::lock_type lock_type;
-    lock_type lock(core::mutex());
+    typedef typename core::entry_lock_type entry_lock_type;
+    entry_lock_type lock(entry(h));
     if(chk(h))core::factory().erase(h);
   }
+
+  /* Erasure is deferred until batch_size handles have been collected, then
+   * chk is invoked on the entry of each collected handle, which is erased
+   * if chk returns true.
+   */
+
+  template<typename EntryChecker>
+  static void deferred_erase(
+    const handle_type& h,EntryChecker chk,std::size_t batch_size)
+  {
+    core::deferred_erase(h,chk,batch_size);
+  }
+};
+
+template<typename Core,bool ConcurrentFactory>
+class flyweight_core_entry_lock
+{
+public:
+  explicit flyweight_core_entry_lock(const typename Core::entry_type&):
+    lock(Core::mutex())
+  {}
+
+private:
+  typename Core::lock_type lock;
+};
+
+template<typename Core>
+class flyweight_core_entry_lock<Core,true>
+{
+public:
+  explicit flyweight_core_entry_lock(const typename Core::entry_type& x):
+    lock(Core::factory().mutex(x))
+  {}
+
+private:
+  typename Core::factory_type::lock_type lock;
 };
 
 template<
@@ -103,6 +146,10 @@ public:
   >::type                                    handle_type;
   typedef typename LockingPolicy::mutex_type mutex_type;
   typedef typename LockingPolicy::lock_type  lock_type;
+  typedef flyweight_core_entry_lock<
+    flyweight_core,
+    is_concurrent_factory<factory_type>::value
+  >                                          entry_lock_type;
 
   static bool init()
   {
@@ -111,6 +158,7 @@ public:
       holder_arg& a=holder_type::get();
       static_factory_ptr=&a.factory;
       static_mutex_ptr=&a.mutex;
+      static_pending_ptr=&a.pending;
       static_initializer=(static_factory_ptr!=0);
       return static_initializer;
     }
@@ -153,11 +201,49 @@ public:
     return *static_mutex_ptr;
   }
 
+  template<typename EntryChecker>
+  static void deferred_erase(
+    const base_handle_type& h,EntryChecker chk,std::size_t batch_size)
+  {
+    std::vector<base_handle_type> batch;
+    bool                          deferred=true;
+    {
+      pending_erasure&                              p=*static_pending_ptr;
+      boost::detail::lightweight_mutex::scoped_lock lock(p.mutex);
+      BOOST_TRY{
+        p.handles.push_back(h);
+      }
+      BOOST_CATCH(...){
+        deferred=false; /* out of memory: erase h along with the batch */
+      }
+      BOOST_CATCH_END
+      if(deferred&&p.handles.size()<batch_size)return;
+      batch.swap(p.handles);
+    }
+    for(std::size_t i=0;i<batch.size();++i)erase_if(batch[i],chk);
+    if(!deferred)erase_if(h,chk);
+  }
+
 private:
+  template<typename EntryChecker>
+  static void erase_if(const base_handle_type& h,EntryChecker chk)
+  {
+    const entry_type& x=entry(h);
+    entry_lock_type   lock(x);
+    if(chk(x))factory().erase(h);
+  }
+
+  struct                              pending_erasure
+  {
+    boost::detail::lightweight_mutex mutex;
+    std::vector<base_handle_type>    handles;
+  };
+
   struct                              holder_arg
   {
-    factory_type factory;
-    mutex_type   mutex;
+    factory_type    factory;
+    mutex_type      mutex;
+    pending_erasure pending;
   };
   typedef typename mpl::apply1<
     HolderSpecifier,
@@ -168,7 +254,7 @@ private:
   {
     init();
     entry_type       e(x);
-    lock_type        lock(mutex());
+    entry_lock_type  lock(e);
     base_handle_type h(factory().insert(e));
     BOOST_TRY{
       ValuePolicy::construct_value(
@@ -186,7 +272,7 @@ private:
   {
     init();
     entry_type       e((rep_type(x)));
-    lock_type        lock(mutex());
+    entry_lock_type  lock(e);
     base_handle_type h(factory().insert(e));
     BOOST_TRY{
       ValuePolicy::copy_value(
@@ -200,9 +286,10 @@ private:
     return static_cast<handle_type>(h);
   }
 
-  static bool          static_initializer;
-  static factory_type* static_factory_ptr;
-  static mutex_type*   static_mutex_ptr;
+  static bool             static_initializer;
+  static factory_type*    static_factory_ptr;
+  static mutex_type*      static_mutex_ptr;
+  static pending_erasure* static_pending_ptr;
 };
 
 template<
@@ -239,6 +326,17 @@ flyweight_core<
   ValuePolicy,Tag,TrackingPolicy,
   FactorySpecifier,LockingPolicy,HolderSpecifier>::static_mutex_ptr=0;
 
+template<
+  typename ValuePolicy,typename Tag,typename TrackingPolicy,
+  typename FactorySpecifier,typename LockingPolicy,typename HolderSpecifier
+>
+typename flyweight_core<
+  ValuePolicy,Tag,TrackingPolicy,
+  FactorySpecifier,LockingPolicy,HolderSpecifier>::pending_erasure*
+flyweight_core<
+  ValuePolicy,Tag,TrackingPolicy,
+  FactorySpecifier,LockingPolicy,HolderSpecifier>::static_pending_ptr=0;
+
 } /* namespace flyweights::detail */
 
 } /* namespace flyweights */
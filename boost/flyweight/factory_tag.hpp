@@ -37,6 +37,19 @@ template<typename T=parameter::void_>
 struct factory:parameter::template_keyword<factory<>,T>
 {};
 
+/* Factory classes derived from concurrent_factory_marker synchronize
+ * access to their entries on their own: instead of the mutex provided by
+ * the locking policy, flyweight_core locks the mutex returned by
+ * mutex(x) for each entry x, which must be of type mutex_type and
+ * lockable by lock_type.
+ */
+
+struct concurrent_factory_marker{};
+
+template<typename T>
+struct is_concurrent_factory:is_base_and_derived<concurrent_factory_marker,T>
+{};
+
 } /* namespace flyweights */
 
 } /* namespace boost */
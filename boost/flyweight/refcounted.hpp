@@ -19,6 +19,8 @@
 #include <boost/detail/workaround.hpp>
 #include <boost/flyweight/refcounted_fwd.hpp>
 #include <boost/flyweight/tracking_tag.hpp>
+#include <boost/mpl/bool.hpp>
+#include <cstddef>
 #include <boost/utility/swap.hpp>
 
 /* Refcounting tracking policy.
@@ -38,6 +40,11 @@
  * value is effectively erasable only when the deleter count goes down to 0
  * (unless there are dangling references due to abnormal program termination,
  * for instance if std::exit is called).
+ * When erasure is deferred (deferred_refcounted policy), handles whose
+ * reference count has dropped to zero are collected and checked for erasure
+ * in batches; the deleter count works exactly as before, as there is a
+ * deleter check per collected handle. In the meantime, the value can be
+ * attached new references without being erased and reinserted.
  */
 
 namespace boost{
@@ -69,7 +76,7 @@ public:
     
 #if !defined(BOOST_NO_MEMBER_TEMPLATE_FRIENDS)
 private:
-  template<typename,typename> friend class refcounted_handle;
+  template<typename,typename,bool> friend class refcounted_handle;
 #endif
 
   long count()const{return ref;}
@@ -85,7 +92,7 @@ private:
   mutable long                        del_ref;
 };
 
-template<typename Handle,typename TrackingHelper>
+template<typename Handle,typename TrackingHelper,bool Deferred=false>
 class refcounted_handle
 {
 public:
@@ -110,7 +117,7 @@ public:
   ~refcounted_handle()
   {
     if(TrackingHelper::entry(*this).release()){
-      TrackingHelper::erase(*this,check_erase);
+      erase(mpl::bool_<Deferred>());
     }
   }
 
@@ -122,6 +129,25 @@ public:
   }
 
 private:
+  BOOST_STATIC_CONSTANT(std::size_t,deferred_erase_batch_size=64);
+
+  struct deferred_check_erase
+  {
+    template<typename Entry>
+    bool operator()(const Entry& x)const{return x.release_deleter();}
+  };
+
+  void erase(mpl::false_)
+  {
+    TrackingHelper::erase(*this,check_erase);
+  }
+
+  void erase(mpl::true_)
+  {
+    TrackingHelper::deferred_erase(
+      *this,deferred_check_erase(),deferred_erase_batch_size);
+  }
+
   static bool check_erase(const refcounted_handle& x)
   {
     return TrackingHelper::entry(x).release_deleter();
@@ -130,10 +156,10 @@ private:
   Handle h;
 };
 
-template<typename Handle,typename TrackingHelper>
+template<typename Handle,typename TrackingHelper,bool Deferred>
 void swap(
-  refcounted_handle<Handle,TrackingHelper>& x,
-  refcounted_handle<Handle,TrackingHelper>& y)
+  refcounted_handle<Handle,TrackingHelper,Deferred>& x,
+  refcounted_handle<Handle,TrackingHelper,Deferred>& y)
 {
   x.swap(y);
 }
@@ -145,10 +171,12 @@ void swap(
 
 } /* namespace flyweights */
 
-template<typename Handle,typename TrackingHelper>
+template<typename Handle,typename TrackingHelper,bool Deferred>
 void swap(
-  ::boost::flyweights::detail::refcounted_handle<Handle,TrackingHelper>& x,
-  ::boost::flyweights::detail::refcounted_handle<Handle,TrackingHelper>& y)
+  ::boost::flyweights::detail::refcounted_handle<
+    Handle,TrackingHelper,Deferred>& x,
+  ::boost::flyweights::detail::refcounted_handle<
+    Handle,TrackingHelper,Deferred>& y)
 {
   ::boost::flyweights::detail::swap(x,y);
 }
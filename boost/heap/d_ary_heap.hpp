@@ -14,8 +14,10 @@
 #include <vector>
 
 #include <boost/assert.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
 
 #include <boost/mem_fn.hpp>
+#include <boost/heap/detail/cache_aligned_allocator.hpp>
 #include <boost/heap/detail/heap_comparison.hpp>
 #include <boost/heap/detail/ordered_adaptor_iterator.hpp>
 #include <boost/heap/detail/stable_heap.hpp>
@@ -50,7 +52,8 @@ typedef parameter::parameters<boost::parameter::required<tag::arity>,
                               boost::parameter::optional<tag::compare>,
                               boost::parameter::optional<tag::stable>,
                               boost::parameter::optional<tag::stability_counter_type>,
-                              boost::parameter::optional<tag::constant_time_size>
+                              boost::parameter::optional<tag::constant_time_size>,
+                              boost::parameter::optional<tag::cache_aligned>
                              > d_ary_heap_signature;
 
 
@@ -66,7 +69,15 @@ class d_ary_heap:
     typedef typename heap_base_maker::type super_t;
     typedef typename super_t::internal_type internal_type;
 
-    typedef typename heap_base_maker::allocator_argument::template rebind<internal_type>::other internal_type_allocator;
+    static const bool is_cache_aligned = extract_cache_aligned<BoundArgs>::value;
+
+    /* the first child of the root is aligned to a cache line boundary, so the children of every node start
+     * at an offset of a multiple of D elements from a cache line boundary */
+    typedef typename heap_base_maker::allocator_argument::template rebind<internal_type>::other base_internal_type_allocator;
+    typedef typename mpl::if_c<is_cache_aligned,
+                               cache_aligned_allocator<base_internal_type_allocator>,
+                               base_internal_type_allocator
+                              >::type internal_type_allocator;
     typedef std::vector<internal_type, internal_type_allocator> container_type;
     typedef typename container_type::const_iterator container_iterator;
 
@@ -202,7 +213,7 @@ public:
 
     allocator_type get_allocator(void) const
     {
-        return q_.get_allocator();
+        return allocator_type(static_cast<base_internal_type_allocator const &>(q_.get_allocator()));
     }
 
     value_type const & top(void) const
@@ -227,6 +238,33 @@ public:
         siftup(q_.size() - 1);
     }
 #endif
+
+    template <typename InputIterator>
+    void push(InputIterator begin, InputIterator end)
+    {
+        const size_type old_size = size();
+        BOOST_TRY {
+            for (; begin != end; ++begin) {
+                q_.push_back(super_t::make_node(*begin));
+                reset_index(size() - 1, size() - 1);
+            }
+        }
+        BOOST_CATCH(...) {
+            // the heap invariant doesn't hold for the appended elements yet, so they are discarded
+            q_.erase(q_.begin() + old_size, q_.end());
+            BOOST_RETHROW;
+        }
+        BOOST_CATCH_END
+
+        // rebuilding the heap is linear in its size, sifting up the new elements is linear in their number
+        // for random input, but logarithmic per element in the worst case
+        if (size() - old_size > old_size)
+            heapify();
+        else
+            for (size_type index = old_size; index != size(); ++index)
+                siftup(index);
+    }
+
     void pop(void)
     {
         BOOST_ASSERT(!empty());
@@ -298,6 +336,15 @@ private:
         }
     }
 
+    void heapify(void)
+    {
+        if (size() < 2)
+            return;
+
+        for (size_type index = parent_index(size() - 1) + 1; index != 0; --index)
+            siftdown(index - 1);
+    }
+
     /* returns new index */
     void siftup(size_type index)
     {
@@ -368,7 +415,8 @@ private:
                                                                   boost::heap::stability_counter_type<typename heap_base_maker::stability_counter_type>,
                                                                   boost::heap::arity<D>,
                                                                   boost::heap::compare<V>,
-                                                                  boost::heap::allocator<W>
+                                                                  boost::heap::allocator<W>,
+                                                                  boost::heap::cache_aligned<is_cache_aligned>
                                                                     >::type,
                            X
                           > other;
@@ -448,7 +496,11 @@ struct select_dary_heap
  * - \c boost::heap::stability_counter_type<>, defaults to \c stability_counter_type<boost::uintmax_t>
  * - \c boost::heap::allocator<>, defaults to \c allocator<std::allocator<T> >
  * - \c boost::heap::mutable_<>, defaults to \c mutable_<false>
+ * - \c boost::heap::cache_aligned<>, defaults to \c cache_aligned<false>
  *
+ * With \c cache_aligned<true>, the storage is aligned so that the children of each node are stored in as few cache
+ * lines as possible. It works best, if the arity is chosen so that the size of D elements is the size of a cache
+ * line (64 bytes), e.g. \c arity<8> for 8 byte values or \c arity<16> for 4 byte values.
  */
 #ifdef BOOST_DOXYGEN_INVOKED
 template<class T, class ...Options>
@@ -459,13 +511,14 @@ template <typename T,
           class A2 = boost::parameter::void_,
           class A3 = boost::parameter::void_,
           class A4 = boost::parameter::void_,
-          class A5 = boost::parameter::void_
+          class A5 = boost::parameter::void_,
+          class A6 = boost::parameter::void_
          >
 #endif
 class d_ary_heap:
-    public detail::select_dary_heap<T, typename detail::d_ary_heap_signature::bind<A0, A1, A2, A3, A4, A5>::type>::type
+    public detail::select_dary_heap<T, typename detail::d_ary_heap_signature::bind<A0, A1, A2, A3, A4, A5, A6>::type>::type
 {
-    typedef typename detail::d_ary_heap_signature::bind<A0, A1, A2, A3, A4, A5>::type bound_args;
+    typedef typename detail::d_ary_heap_signature::bind<A0, A1, A2, A3, A4, A5, A6>::type bound_args;
     typedef typename detail::select_dary_heap<T, bound_args>::type super_t;
 
     template <typename Heap1, typename Heap2>
@@ -599,6 +652,23 @@ public:
     }
 #endif
 
+    /**
+     * \b Effects: Adds the elements of the range [begin, end) to the priority queue.
+     *
+     * \b Complexity: Linear in the size of the priority queue, if more elements are added than it contains.
+     * Otherwise logarithmic per added element (worst case) or linear in the number of added elements (average case).
+     *
+     * \b Note: If copying an element or advancing the iterator throws, the priority queue is left unchanged.
+     *
+     * \b Requirement: data structure must not be configured as mutable
+     * */
+    template <typename InputIterator>
+    void push(InputIterator begin, InputIterator end)
+    {
+        BOOST_STATIC_ASSERT(!is_mutable);
+        super_t::push(begin, end);
+    }
+
     /// \copydoc boost::heap::priority_queue::operator<(HeapType const & rhs) const
     template <typename HeapType>
     bool operator<(HeapType const & rhs) const
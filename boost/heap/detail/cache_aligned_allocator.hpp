@@ -0,0 +1,99 @@
+// boost heap: allocator adaptor for cache-aligned heap storage
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HEAP_DETAIL_CACHE_ALIGNED_ALLOCATOR_HPP
+#define BOOST_HEAP_DETAIL_CACHE_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost  {
+namespace heap   {
+namespace detail {
+
+static const std::size_t cache_line_size = 64;
+
+/* allocator adaptor, that returns arrays whose second element starts at a cache line boundary.
+ *
+ * the memory is obtained as char array from the adapted allocator, which needs to use plain pointers.
+ * the address of the array, that has been allocated by the adapted allocator, is stored in front of the
+ * returned array.
+ * */
+template <typename Alloc>
+class cache_aligned_allocator:
+    public Alloc
+{
+    typedef typename Alloc::template rebind<char>::other byte_allocator;
+
+    BOOST_STATIC_ASSERT((cache_line_size % sizeof(char*) == 0));
+
+public:
+    typedef typename Alloc::value_type value_type;
+    typedef typename Alloc::pointer pointer;
+    typedef typename Alloc::size_type size_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef cache_aligned_allocator<typename Alloc::template rebind<U>::other> other;
+    };
+
+    cache_aligned_allocator(void)
+    {}
+
+    cache_aligned_allocator(Alloc const & alloc):
+        Alloc(alloc)
+    {}
+
+    template <typename Alloc2>
+    cache_aligned_allocator(cache_aligned_allocator<Alloc2> const & rhs):
+        Alloc(static_cast<Alloc2 const &>(rhs))
+    {}
+
+    pointer allocate(size_type n, const void * = 0)
+    {
+        byte_allocator alloc(*this);
+        char * base = alloc.allocate(allocated_bytes(n));
+
+        // the address of the second element is rounded up to the next cache line boundary
+        const boost::uintptr_t first = reinterpret_cast<boost::uintptr_t>(base + sizeof(char*) + sizeof(value_type));
+        const boost::uintptr_t aligned = (first + cache_line_size - 1) & ~boost::uintptr_t(cache_line_size - 1);
+        char * array = base + sizeof(char*) + (aligned - first);
+
+        std::memcpy(array - sizeof(char*), &base, sizeof(char*));
+        return reinterpret_cast<pointer>(array);
+    }
+
+    void deallocate(pointer p, size_type n)
+    {
+        char * base;
+        std::memcpy(&base, reinterpret_cast<char*>(p) - sizeof(char*), sizeof(char*));
+
+        byte_allocator alloc(*this);
+        alloc.deallocate(base, allocated_bytes(n));
+    }
+
+private:
+    static size_type allocated_bytes(size_type n)
+    {
+        return n * sizeof(value_type) + sizeof(char*) + cache_line_size - 1;
+    }
+};
+
+} /* namespace detail */
+} /* namespace heap */
+} /* namespace boost */
+
+#endif /* BOOST_HEAP_DETAIL_CACHE_ALIGNED_ALLOCATOR_HPP */
@@ -69,7 +69,15 @@ struct objects_per_page:
     boost::parameter::template_keyword<tag::objects_per_page, boost::mpl::int_<T> >
 {};
 
+namespace tag { struct cache_aligned; }
+
+template <bool T>
+struct cache_aligned:
+    boost::parameter::template_keyword<tag::cache_aligned, boost::mpl::bool_<T> >
+{};
+
 BOOST_PARAMETER_TEMPLATE_KEYWORD(stability_counter_type)
+BOOST_PARAMETER_TEMPLATE_KEYWORD(key_extractor)
 
 namespace detail {
 
@@ -108,6 +116,19 @@ struct extract_mutable
     static const bool value = mutable_t::value;
 };
 
+template <typename bound_args>
+struct extract_cache_aligned
+{
+    static const bool has_cache_aligned = has_arg<bound_args, tag::cache_aligned>::value;
+
+    typedef typename mpl::if_c<has_cache_aligned,
+                               typename has_arg<bound_args, tag::cache_aligned>::type,
+                               mpl::bool_<false>
+                              >::type cache_aligned_t;
+
+    static const bool value = cache_aligned_t::value;
+};
+
 }
 
 #else
@@ -164,6 +185,21 @@ struct store_parent_pointer{};
  * */
 template <unsigned int T>
 struct arity{};
+
+/** \brief Align the sibling nodes of a D-ary heap to cache lines.
+ *
+ * The storage of the heap is aligned, so that the children of a node share as few cache lines as possible.
+ * Works best if the size of D elements is a multiple of the cache line size (or divides it).
+ * */
+template <bool T>
+struct cache_aligned{};
+
+/** \brief Specifies the function object, that computes the unsigned integer key of a value.
+ *
+ * The function object needs to define \c result_type.
+ * */
+template <typename KeyExtractor>
+struct key_extractor{};
 #endif
 
 } /* namespace heap */
@@ -0,0 +1,610 @@
+// boost heap: radix heap for monotone unsigned integer keys
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HEAP_RADIX_HEAP_HPP
+#define BOOST_HEAP_RADIX_HEAP_HPP
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/type_traits/is_unsigned.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/heap/detail/heap_comparison.hpp>
+#include <boost/heap/detail/stable_heap.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+
+#ifndef BOOST_DOXYGEN_INVOKED
+#ifdef BOOST_HEAP_SANITYCHECKS
+#define BOOST_HEAP_ASSERT BOOST_ASSERT
+#else
+#define BOOST_HEAP_ASSERT(expression)
+#endif
+#endif
+
+namespace boost  {
+namespace heap   {
+namespace detail {
+
+typedef parameter::parameters<boost::parameter::optional<tag::allocator>,
+                              boost::parameter::optional<tag::key_extractor>
+                             > radix_heap_signature;
+
+template <typename T>
+struct radix_heap_identity
+{
+    typedef T result_type;
+
+    result_type operator()(T const & value) const
+    {
+        return value;
+    }
+};
+
+/* the element with the smallest key is the top element */
+template <typename T, typename KeyExtractor>
+struct radix_heap_compare:
+    KeyExtractor
+{
+    radix_heap_compare(KeyExtractor const & key = KeyExtractor()):
+        KeyExtractor(key)
+    {}
+
+    bool operator()(T const & lhs, T const & rhs) const
+    {
+        return KeyExtractor::operator()(lhs) > KeyExtractor::operator()(rhs);
+    }
+
+    KeyExtractor const & key_extractor(void) const
+    {
+        return *this;
+    }
+};
+
+/* number of significant bits */
+template <typename IntType>
+inline std::size_t radix_heap_bit_width(IntType value)
+{
+#ifdef __GNUC__
+    BOOST_STATIC_ASSERT((sizeof(IntType) <= sizeof(unsigned long long)));
+    return value ? sizeof(unsigned long long) * 8 - __builtin_clzll(value) : 0;
+#else
+    std::size_t ret = 0;
+    for (; value; value >>= 1)
+        ++ret;
+    return ret;
+#endif
+}
+
+template <typename T, typename Bucket>
+class radix_heap_iterator:
+    public boost::iterator_facade<radix_heap_iterator<T, Bucket>,
+                                  T const,
+                                  boost::forward_traversal_tag>
+{
+    typedef typename Bucket::const_iterator bucket_iterator;
+
+public:
+    radix_heap_iterator(void):
+        bucket_(0), last_bucket_(0)
+    {}
+
+    radix_heap_iterator(Bucket const * bucket, Bucket const * last_bucket, bucket_iterator it):
+        bucket_(bucket), last_bucket_(last_bucket), it_(it)
+    {
+        skip_empty_buckets();
+    }
+
+private:
+    friend class boost::iterator_core_access;
+
+    void skip_empty_buckets(void)
+    {
+        while (it_ == bucket_->end() && bucket_ != last_bucket_) {
+            ++bucket_;
+            it_ = bucket_->begin();
+        }
+    }
+
+    void increment(void)
+    {
+        ++it_;
+        skip_empty_buckets();
+    }
+
+    bool equal(radix_heap_iterator const & rhs) const
+    {
+        return bucket_ == rhs.bucket_ && (bucket_ == 0 || it_ == rhs.it_);
+    }
+
+    T const & dereference(void) const
+    {
+        return *it_;
+    }
+
+    Bucket const * bucket_;
+    Bucket const * last_bucket_;
+    bucket_iterator it_;
+};
+
+} /* namespace detail */
+
+/**
+ * \class radix_heap
+ * \brief radix heap
+ *
+ * This class implements an immutable priority queue for values with unsigned integer keys, that are
+ * extracted in ascending order. Internally, the values are distributed to one bucket for each bit of the
+ * key type, depending on the highest bit in which their key differs from the key of the last extracted
+ * element. Buckets are std::vectors, which directly store the values.
+ *
+ * The keys must be monotone: the key of a value, that is pushed to a non-empty heap, must not be smaller
+ * than the key of the element, that has been accessed by top() or removed by pop() most recently. This is
+ * the case e.g. for Dijkstra's shortest path algorithm or for timer queues.
+ *
+ * When merging heaps with \c heap_merge, this requirement applies to the keys of the merged heap.
+ *
+ * Each element is moved to a lower bucket at most once per bit of the key type, so that push is constant
+ * and pop is amortized logarithmic in the range of the keys, independent of the number of elements.
+ *
+ * The template parameter T is the type to be managed by the container.
+ * The user can specify additional options and if no options are provided default options are used.
+ *
+ * The container supports the following options:
+ * - \c boost::heap::key_extractor<>, defaults to \c key_extractor<identity>, which requires T to be an unsigned integer type
+ * - \c boost::heap::allocator<>, defaults to \c allocator<std::allocator<T> >
+ *
+ * The \c value_compare function object compares the keys with \c std::greater, so that the element with the
+ * smallest key is the top element of the heap.
+ */
+#ifdef BOOST_DOXYGEN_INVOKED
+template<class T, class ...Options>
+#else
+template <typename T,
+          class A0 = boost::parameter::void_,
+          class A1 = boost::parameter::void_
+         >
+#endif
+class radix_heap
+{
+    typedef typename detail::radix_heap_signature::bind<A0, A1>::type bound_args;
+    typedef typename parameter::binding<bound_args, tag::allocator, std::allocator<T> >::type allocator_argument;
+    typedef typename parameter::binding<bound_args, tag::key_extractor, detail::radix_heap_identity<T> >::type key_extractor_type;
+
+    typedef typename boost::remove_cv<
+                typename boost::remove_reference<typename key_extractor_type::result_type>::type
+            >::type key_type;
+
+    BOOST_STATIC_ASSERT((boost::is_unsigned<key_type>::value));
+
+    typedef typename allocator_argument::template rebind<T>::other bucket_allocator;
+    typedef std::vector<T, bucket_allocator> bucket_type;
+
+    /* bucket 0 contains the elements whose key equals last_, bucket i the elements whose key differs from
+     * last_ in bit i-1, but not in any higher bit */
+    static const std::size_t bucket_count = std::numeric_limits<key_type>::digits + 1;
+
+    template <typename Heap1, typename Heap2>
+    friend struct detail::heap_merge_emulate;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+    struct implementation_defined:
+        detail::extract_allocator_types<allocator_argument>
+    {
+        typedef detail::radix_heap_compare<T, key_extractor_type> value_compare;
+        typedef detail::radix_heap_iterator<T, bucket_type> iterator;
+        typedef iterator const_iterator;
+        typedef allocator_argument allocator_type;
+    };
+#endif
+
+public:
+    typedef T value_type;
+    typedef typename implementation_defined::size_type size_type;
+    typedef typename implementation_defined::difference_type difference_type;
+    typedef typename implementation_defined::value_compare value_compare;
+    typedef typename implementation_defined::allocator_type allocator_type;
+    typedef typename implementation_defined::reference reference;
+    typedef typename implementation_defined::const_reference const_reference;
+    typedef typename implementation_defined::pointer pointer;
+    typedef typename implementation_defined::const_pointer const_pointer;
+    /**
+     * \b Note: The iterator does not traverse the priority queue in order of the priorities.
+     * */
+    typedef typename implementation_defined::iterator iterator;
+    typedef typename implementation_defined::const_iterator const_iterator;
+
+    static const bool constant_time_size = true;
+    static const bool has_ordered_iterators = false;
+    static const bool is_mergable = false;
+    static const bool is_stable = false;
+    static const bool has_reserve = false;
+
+    /**
+     * \b Effects: constructs an empty priority queue.
+     *
+     * \b Complexity: Constant.
+     *
+     * */
+    explicit radix_heap(value_compare const & cmp = value_compare()):
+        cmp_(cmp), last_(0), size_(0)
+    {}
+
+    /**
+     * \b Effects: copy-constructs priority queue from rhs.
+     *
+     * \b Complexity: Linear.
+     *
+     * */
+    radix_heap(radix_heap const & rhs):
+        cmp_(rhs.cmp_), last_(rhs.last_), size_(rhs.size_)
+    {
+        std::copy(rhs.buckets_, rhs.buckets_ + bucket_count, buckets_);
+    }
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * \b Effects: C++11-style move constructor.
+     *
+     * \b Complexity: Linear in the number of bits of the key type.
+     *
+     * \b Note: Only available, if BOOST_NO_CXX11_RVALUE_REFERENCES is not defined
+     * */
+    radix_heap(radix_heap && rhs):
+        cmp_(std::move(rhs.cmp_)), last_(0), size_(0)
+    {
+        swap(rhs);
+    }
+
+    /**
+     * \b Effects: C++11-style move assignment.
+     *
+     * \b Complexity: Linear in the number of bits of the key type.
+     *
+     * \b Note: Only available, if BOOST_NO_CXX11_RVALUE_REFERENCES is not defined
+     * */
+    radix_heap & operator=(radix_heap && rhs)
+    {
+        clear();
+        swap(rhs);
+        return *this;
+    }
+#endif
+
+    /**
+     * \b Effects: Assigns priority queue from rhs.
+     *
+     * \b Complexity: Linear.
+     *
+     * */
+    radix_heap & operator=(radix_heap const & rhs)
+    {
+        cmp_ = rhs.cmp_;
+        last_ = rhs.last_;
+        size_ = rhs.size_;
+        std::copy(rhs.buckets_, rhs.buckets_ + bucket_count, buckets_);
+        return *this;
+    }
+
+    /**
+     * \b Effects: Returns true, if the priority queue contains no elements.
+     *
+     * \b Complexity: Constant.
+     *
+     * */
+    bool empty(void) const
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * \b Effects: Returns the number of elements contained in the priority queue.
+     *
+     * \b Complexity: Constant.
+     *
+     * */
+    size_type size(void) const
+    {
+        return size_;
+    }
+
+    /**
+     * \b Effects: Returns the maximum number of elements the priority queue can contain.
+     *
+     * \b Complexity: Constant.
+     *
+     * */
+    size_type max_size(void) const
+    {
+        return buckets_[0].max_size();
+    }
+
+    /**
+     * \b Effects: Removes all elements from the priority queue.
+     *
+     * \b Complexity: Linear.
+     *
+     * */
+    void clear(void)
+    {
+        for (std::size_t i = 0; i != bucket_count; ++i)
+            buckets_[i].clear();
+        last_ = 0;
+        size_ = 0;
+    }
+
+    /**
+     * \b Effects: Returns allocator.
+     *
+     * \b Complexity: Constant.
+     *
+     * */
+    allocator_type get_allocator(void) const
+    {
+        return buckets_[0].get_allocator();
+    }
+
+    /**
+     * \b Effects: Returns a const_reference to the element with the smallest key.
+     *
+     * \b Complexity: Constant (amortized). Linear (worst case).
+     *
+     * \b Note: May move elements between the internal buckets and invalidate iterators.
+     * */
+    const_reference top(void) const
+    {
+        BOOST_ASSERT(!empty());
+        if (buckets_[0].empty())
+            redistribute();
+        return buckets_[0].back();
+    }
+
+    /**
+     * \b Effects: Adds a new element to the priority queue.
+     *
+     * \b Complexity: Constant (amortized).
+     *
+     * \b Requirement: If the priority queue is not empty, the key of \c v must not be smaller than the key of
+     * the element, that has been accessed by top() or removed by pop() most recently.
+     * */
+    void push(value_type const & v)
+    {
+        buckets_[bucket_index(key(v))].push_back(v);
+        ++size_;
+    }
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES) && !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+    /**
+     * \b Effects: Adds a new element to the priority queue. The element is constructed from \c args and moved
+     * to its bucket.
+     *
+     * \b Complexity: Constant (amortized).
+     *
+     * \b Requirement: If the priority queue is not empty, the key of the element must not be smaller than the
+     * key of the element, that has been accessed by top() or removed by pop() most recently.
+     * */
+    template <class... Args>
+    void emplace(Args&&... args)
+    {
+        value_type v(std::forward<Args>(args)...);
+        buckets_[bucket_index(key(v))].push_back(std::move(v));
+        ++size_;
+    }
+#endif
+
+    /**
+     * \b Effects: Removes the element with the smallest key from the priority queue.
+     *
+     * \b Complexity: Logarithmic in the range of the keys (amortized). Linear (worst case).
+     *
+     * */
+    void pop(void)
+    {
+        BOOST_ASSERT(!empty());
+        if (buckets_[0].empty())
+            redistribute();
+        buckets_[0].pop_back();
+
+        // an empty heap accepts any key
+        if (--size_ == 0)
+            last_ = 0;
+    }
+
+    /**
+     * \b Effects: Swaps two priority queues.
+     *
+     * \b Complexity: Linear in the number of bits of the key type.
+     *
+     * */
+    void swap(radix_heap & rhs)
+    {
+        std::swap(cmp_, rhs.cmp_);
+        std::swap(last_, rhs.last_);
+        std::swap(size_, rhs.size_);
+        for (std::size_t i = 0; i != bucket_count; ++i)
+            buckets_[i].swap(rhs.buckets_[i]);
+    }
+
+    /**
+     * \b Effects: Returns an iterator to the first element contained in the priority queue.
+     *
+     * \b Complexity: Linear in the number of bits of the key type.
+     *
+     * */
+    iterator begin(void) const
+    {
+        return iterator(buckets_, buckets_ + bucket_count - 1, buckets_[0].begin());
+    }
+
+    /**
+     * \b Effects: Returns an iterator to the end of the priority queue.
+     *
+     * \b Complexity: Constant.
+     *
+     * */
+    iterator end(void) const
+    {
+        return iterator(buckets_ + bucket_count - 1, buckets_ + bucket_count - 1, buckets_[bucket_count - 1].end());
+    }
+
+    /**
+     * \b Effect: Returns the value_compare object used by the priority queue
+     *
+     * */
+    value_compare const & value_comp(void) const
+    {
+        return cmp_;
+    }
+
+    /**
+     * \b Returns: Element-wise comparison of heap data structures
+     *
+     * \b Requirement: the \c value_compare object of both heaps must match.
+     *
+     * */
+    template <typename HeapType>
+    bool operator<(HeapType const & rhs) const
+    {
+        return detail::heap_compare(*this, rhs);
+    }
+
+    /**
+     * \b Returns: Element-wise comparison of heap data structures
+     *
+     * \b Requirement: the \c value_compare object of both heaps must match.
+     *
+     * */
+    template <typename HeapType>
+    bool operator>(HeapType const & rhs) const
+    {
+        return detail::heap_compare(rhs, *this);
+    }
+
+    /**
+     * \b Returns: Element-wise comparison of heap data structures
+     *
+     * \b Requirement: the \c value_compare object of both heaps must match.
+     *
+     * */
+    template <typename HeapType>
+    bool operator>=(HeapType const & rhs) const
+    {
+        return !operator<(rhs);
+    }
+
+    /**
+     * \b Returns: Element-wise comparison of heap data structures
+     *
+     * \b Requirement: the \c value_compare object of both heaps must match.
+     *
+     * */
+    template <typename HeapType>
+    bool operator<=(HeapType const & rhs) const
+    {
+        return !operator>(rhs);
+    }
+
+    /** \brief Equivalent comparison
+     * \b Returns: True, if both heap data structures are equivalent.
+     *
+     * \b Requirement: the \c value_compare object of both heaps must match.
+     *
+     * */
+    template <typename HeapType>
+    bool operator==(HeapType const & rhs) const
+    {
+        return detail::heap_equality(*this, rhs);
+    }
+
+    /** \brief Equivalent comparison
+     * \b Returns: True, if both heap data structures are not equivalent.
+     *
+     * \b Requirement: the \c value_compare object of both heaps must match.
+     *
+     * */
+    template <typename HeapType>
+    bool operator!=(HeapType const & rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+private:
+    /* used by heap_merge, radix heaps are not stable */
+    size_type get_stability_count(void) const
+    {
+        return 0;
+    }
+
+    void set_stability_count(size_type)
+    {}
+
+    key_type key(value_type const & v) const
+    {
+        return cmp_.key_extractor()(v);
+    }
+
+    std::size_t bucket_index(key_type k) const
+    {
+        // pushing a key that is smaller than last_ violates the monotonicity requirement
+        BOOST_ASSERT(empty() || !(k < last_));
+        return detail::radix_heap_bit_width(key_type(k ^ last_));
+    }
+
+    /* the smallest key of the first non-empty bucket becomes last_, all elements of this bucket are moved
+     * to lower buckets, since they differ from the new last_ in lower bits only */
+    void redistribute(void) const
+    {
+        BOOST_HEAP_ASSERT(!empty() && buckets_[0].empty());
+
+        std::size_t index = 1;
+        while (buckets_[index].empty())
+            ++index;
+
+        bucket_type & bucket = buckets_[index];
+        typedef typename bucket_type::iterator bucket_iterator;
+
+        key_type min_key = key(bucket.front());
+        for (bucket_iterator it = bucket.begin() + 1; it != bucket.end(); ++it)
+            min_key = (std::min)(min_key, key(*it));
+        last_ = min_key;
+
+        for (bucket_iterator it = bucket.begin(); it != bucket.end(); ++it) {
+            const std::size_t new_index = bucket_index(key(*it));
+            BOOST_HEAP_ASSERT(new_index < index);
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+            buckets_[new_index].push_back(std::move(*it));
+#else
+            buckets_[new_index].push_back(*it);
+#endif
+        }
+        bucket.clear();
+    }
+
+    value_compare cmp_;
+    // top() reorganizes the buckets to find the top element
+    mutable bucket_type buckets_[bucket_count];
+    mutable key_type last_;
+    size_type size_;
+};
+
+} /* namespace heap */
+} /* namespace boost */
+
+#undef BOOST_HEAP_ASSERT
+
+#endif /* BOOST_HEAP_RADIX_HEAP_HPP */
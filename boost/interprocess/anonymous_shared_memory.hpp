@@ -48,6 +48,7 @@ namespace ipcdetail{
          mapped_region region;
          region.m_base = address;
          region.m_size = size;
+         region.m_mode = read_write;
          return region;
       }
    };
@@ -128,7 +128,8 @@ class managed_open_or_create_impl
          , mode
          , addr
          , perm
-         , null_mapped_region_function());
+         , null_mapped_region_function()
+         , default_map_options);
    }
 
    managed_open_or_create_impl(open_only_t,
@@ -143,7 +144,8 @@ class managed_open_or_create_impl
          , mode
          , addr
          , permissions()
-         , null_mapped_region_function());
+         , null_mapped_region_function()
+         , default_map_options);
    }
 
 
@@ -161,7 +163,8 @@ class managed_open_or_create_impl
          , mode
          , addr
          , perm
-         , null_mapped_region_function());
+         , null_mapped_region_function()
+         , default_map_options);
    }
 
    template <class ConstructFunc>
@@ -171,7 +174,8 @@ class managed_open_or_create_impl
                  mode_t mode,
                  const void *addr,
                  const ConstructFunc &construct_func,
-                 const permissions &perm)
+                 const permissions &perm,
+                 map_options_t map_options = default_map_options)
    {
       priv_open_or_create
          (DoCreate
@@ -180,7 +184,8 @@ class managed_open_or_create_impl
          , mode
          , addr
          , perm
-         , construct_func);
+         , construct_func
+         , map_options);
    }
 
    template <class ConstructFunc>
@@ -188,7 +193,8 @@ class managed_open_or_create_impl
                  const device_id_t & id,
                  mode_t mode,
                  const void *addr,
-                 const ConstructFunc &construct_func)
+                 const ConstructFunc &construct_func,
+                 map_options_t map_options = default_map_options)
    {
       priv_open_or_create
          ( DoOpen
@@ -197,7 +203,8 @@ class managed_open_or_create_impl
          , mode
          , addr
          , permissions()
-         , construct_func);
+         , construct_func
+         , map_options);
    }
 
    template <class ConstructFunc>
@@ -207,7 +214,8 @@ class managed_open_or_create_impl
                  mode_t mode,
                  const void *addr,
                  const ConstructFunc &construct_func,
-                 const permissions &perm)
+                 const permissions &perm,
+                 map_options_t map_options = default_map_options)
    {
       priv_open_or_create
          ( DoOpenOrCreate
@@ -216,7 +224,8 @@ class managed_open_or_create_impl
          , mode
          , addr
          , perm
-         , construct_func);
+         , construct_func
+         , map_options);
    }
 
    managed_open_or_create_impl(BOOST_RV_REF(managed_open_or_create_impl) moved)
@@ -252,6 +261,18 @@ class managed_open_or_create_impl
    bool flush()
    {  return m_mapped_region.flush();  }
 
+   bool advise(mapped_region::advice_types advice)
+   {  return m_mapped_region.advise(advice);  }
+
+   bool lock()
+   {  return m_mapped_region.lock();  }
+
+   bool unlock()
+   {  return m_mapped_region.unlock();  }
+
+   bool prefault()
+   {  return m_mapped_region.prefault();  }
+
    const mapped_region &get_mapped_region() const
    {  return m_mapped_region;  }
 
@@ -306,7 +327,8 @@ class managed_open_or_create_impl
        std::size_t size,
        mode_t mode, const void *addr,
        const permissions &perm,
-       ConstructFunc construct_func)
+       ConstructFunc construct_func,
+       map_options_t map_options)
    {
       typedef bool_<FileBased> file_like_t;
       (void)mode;
@@ -396,7 +418,7 @@ class managed_open_or_create_impl
             truncate_device<FileBased>(dev, size, file_like_t());
 
             //If the following throws, we will truncate the file to 1
-            mapped_region        region(dev, read_write, 0, 0, addr);
+            mapped_region        region(dev, read_write, 0, 0, addr, map_options);
             boost::uint32_t *patomic_word = 0;  //avoid gcc warning
             patomic_word = static_cast<boost::uint32_t*>(region.get_address());
             boost::uint32_t previous = atomic_cas32(patomic_word, InitializingSegment, UninitializedSegment);
@@ -445,7 +467,7 @@ class managed_open_or_create_impl
             }
          }
 
-         mapped_region  region(dev, ronly ? read_only : (cow ? copy_on_write : read_write), 0, 0, addr);
+         mapped_region  region(dev, ronly ? read_only : (cow ? copy_on_write : read_write), 0, 0, addr, map_options);
 
          boost::uint32_t *patomic_word = static_cast<boost::uint32_t*>(region.get_address());
          boost::uint32_t value = atomic_read32(patomic_word);
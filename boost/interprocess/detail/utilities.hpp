@@ -131,6 +131,15 @@ struct is_intrusive_index
    static const bool value = false;
 };
 
+//!Trait class to detect if an index can be
+//!searched without taking the lock of the segment
+//!manager. Such indexes must be intrusive.
+template <class Index>
+struct is_lockfree_read_index
+{
+   static const bool value = false;
+};
+
 template <typename T> T*
 addressof(T& v)
 {
@@ -916,6 +916,7 @@ extern "C" __declspec(dllimport) void * __stdcall OpenFileMappingA (unsigned lon
 extern "C" __declspec(dllimport) void * __stdcall CreateFileA (const char *, unsigned long, unsigned long, struct interprocess_security_attributes*, unsigned long, unsigned long, void *);
 extern "C" __declspec(dllimport) void __stdcall GetSystemInfo (struct system_info *);
 extern "C" __declspec(dllimport) int __stdcall FlushViewOfFile (void *, std::size_t);
+extern "C" __declspec(dllimport) int __stdcall VirtualLock (void *, std::size_t);
 extern "C" __declspec(dllimport) int __stdcall VirtualUnlock (void *, std::size_t);
 extern "C" __declspec(dllimport) int __stdcall VirtualProtect (void *, std::size_t, unsigned long, unsigned long *);
 extern "C" __declspec(dllimport) int __stdcall FlushFileBuffers (void *);
@@ -1199,6 +1200,9 @@ inline void get_system_info(system_info *info)
 inline bool flush_view_of_file(void *base_addr, std::size_t numbytes)
 {  return 0 != FlushViewOfFile(base_addr, numbytes); }
 
+inline bool virtual_lock(void *base_addr, std::size_t numbytes)
+{  return 0 != VirtualLock(base_addr, numbytes); }
+
 inline bool virtual_unlock(void *base_addr, std::size_t numbytes)
 {  return 0 != VirtualUnlock(base_addr, numbytes); }
 
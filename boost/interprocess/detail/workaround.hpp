@@ -138,6 +138,14 @@
          //#define BOOST_INTERPROCESS_HAS_KERNEL_BOOTTIME
       #endif
    #endif
+
+   #if defined(__linux__)
+      //Linux futexes work on any memory mapping (process shared or not)
+      #define BOOST_INTERPROCESS_LINUX_FUTEX
+      //Define this to implement interprocess_mutex, interprocess_condition and
+      //interprocess_semaphore with futexes, detecting the death of mutex owners
+      //#define BOOST_INTERPROCESS_FORCE_FUTEX_SYNC
+   #endif
 #endif   //!defined(BOOST_INTERPROCESS_WINDOWS)
 
 #if    !defined(BOOST_NO_CXX11_RVALUE_REFERENCES) && !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
@@ -0,0 +1,876 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_LOCKFREE_READ_INDEX_HPP
+#define BOOST_INTERPROCESS_LOCKFREE_READ_INDEX_HPP
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+
+#include <string>
+#include <utility>
+#include <iterator>
+#include <cstddef>
+#include <boost/interprocess/detail/utilities.hpp>
+#include <boost/interprocess/detail/atomic.hpp>
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+#include <boost/interprocess/detail/segment_manager_helper.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/assert.hpp>
+
+//!\file
+//!Describes an open addressing hash index that can be searched
+//!without taking the lock of the segment manager
+
+namespace boost { namespace interprocess {
+
+/// @cond
+
+namespace ipcdetail {
+
+//Accesses to the words that are read by lock-free searches while a writer
+//holding the lock of the segment manager can modify them.
+#if defined(__GNUC__) && ((__GNUC__ * 100 + __GNUC_MINOR__) >= 407)
+
+template<class T>
+inline T lf_index_load(const volatile T *mem)
+{  return __atomic_load_n(mem, __ATOMIC_RELAXED);  }
+
+template<class T>
+inline T lf_index_load_acquire(const volatile T *mem)
+{  return __atomic_load_n(mem, __ATOMIC_ACQUIRE);  }
+
+template<class T>
+inline void lf_index_store(volatile T *mem, T val)
+{  __atomic_store_n(mem, val, __ATOMIC_RELAXED);  }
+
+template<class T>
+inline void lf_index_store_release(volatile T *mem, T val)
+{  __atomic_store_n(mem, val, __ATOMIC_RELEASE);  }
+
+inline void lf_index_acquire_fence()
+{  __atomic_thread_fence(__ATOMIC_ACQUIRE);  }
+
+inline void lf_index_release_fence()
+{  __atomic_thread_fence(__ATOMIC_RELEASE);  }
+
+inline void lf_index_full_fence()
+{  __atomic_thread_fence(__ATOMIC_SEQ_CST);  }
+
+inline void lf_index_inc(volatile boost::uint32_t *mem)
+{  __atomic_fetch_add(mem, 1u, __ATOMIC_SEQ_CST);  }
+
+inline void lf_index_dec(volatile boost::uint32_t *mem)
+{  __atomic_fetch_sub(mem, 1u, __ATOMIC_SEQ_CST);  }
+
+#else
+
+inline void lf_index_full_fence()
+{
+   volatile boost::uint32_t dummy = 0;
+   atomic_cas32(&dummy, 0, 0);
+}
+
+template<class T>
+inline T lf_index_load(const volatile T *mem)
+{  return *mem;  }
+
+template<class T>
+inline T lf_index_load_acquire(const volatile T *mem)
+{
+   T val = *mem;
+   lf_index_full_fence();
+   return val;
+}
+
+template<class T>
+inline void lf_index_store(volatile T *mem, T val)
+{  *mem = val;  }
+
+template<class T>
+inline void lf_index_store_release(volatile T *mem, T val)
+{
+   lf_index_full_fence();
+   *mem = val;
+}
+
+inline void lf_index_acquire_fence()
+{  lf_index_full_fence();  }
+
+inline void lf_index_release_fence()
+{  lf_index_full_fence();  }
+
+inline void lf_index_inc(volatile boost::uint32_t *mem)
+{  atomic_inc32(mem);  }
+
+inline void lf_index_dec(volatile boost::uint32_t *mem)
+{  atomic_dec32(mem);  }
+
+#endif
+
+//!The index stores the position of the values in its own table. The hook
+//!only links the blocks of erased values whose deallocation is deferred
+template<class SizeType>
+struct lockfree_read_index_hook
+{
+   volatile SizeType m_next_retired;
+};
+
+}  //namespace ipcdetail {
+
+//!Helper class to define typedefs from IndexTraits
+template <class MapConfig>
+struct lockfree_read_index_aux
+{
+   typedef typename
+      MapConfig::segment_manager_base                          segment_manager_base;
+   typedef typename
+      segment_manager_base::void_pointer                       void_pointer;
+   typedef typename segment_manager_base::size_type            size_type;
+   typedef typename boost::intrusive::pointer_traits
+      <void_pointer>::template
+         rebind_pointer<segment_manager_base>::type            segment_manager_base_ptr;
+   typedef typename MapConfig::template intrusive_value_type
+      <ipcdetail::lockfree_read_index_hook<size_type> >::type  value_type;
+   typedef typename MapConfig::
+      intrusive_compare_key_type                               intrusive_compare_key_type;
+   typedef typename MapConfig::char_type                       char_type;
+   typedef ipcdetail::block_header<size_type>                  block_header_t;
+
+   //!A position of the table. "m_value" is the distance from the index to the
+   //!stored value, or one of the special values of lockfree_read_index
+   struct slot_t
+   {
+      volatile size_type m_hash;
+      volatile size_type m_value;
+   };
+
+   //!The table is a single allocation with the header followed by the slots.
+   //!Like the hook of the values, "m_next_retired" is the first member
+   struct table_t
+   {
+      volatile size_type m_next_retired;
+      volatile size_type m_capacity;
+
+      slot_t *slots()
+      {  return reinterpret_cast<slot_t*>(this + 1);  }
+
+      const slot_t *slots() const
+      {  return reinterpret_cast<const slot_t*>(this + 1);  }
+   };
+};
+
+//!Iterator over the values stored in a lockfree_read_index
+template <class Index, class Value>
+class lockfree_read_index_iterator
+{
+   typedef typename Index::slot_t slot_t;
+
+   public:
+   typedef std::forward_iterator_tag   iterator_category;
+   typedef Value                       value_type;
+   typedef std::ptrdiff_t              difference_type;
+   typedef Value *                     pointer;
+   typedef Value &                     reference;
+
+   lockfree_read_index_iterator()
+      :  mp_index(0), mp_slot(0), mp_end(0)
+   {}
+
+   lockfree_read_index_iterator(const Index *index, const slot_t *slot, const slot_t *end)
+      :  mp_index(index), mp_slot(slot), mp_end(end)
+   {  this->priv_skip_free();  }
+
+   //Conversion from iterator to const_iterator
+   template<class OtherValue>
+   lockfree_read_index_iterator(const lockfree_read_index_iterator<Index, OtherValue> &other)
+      :  mp_index(other.mp_index), mp_slot(other.mp_slot), mp_end(other.mp_end)
+   {}
+
+   reference operator*() const
+   {  return *static_cast<Value*>(mp_index->priv_value(mp_slot->m_value));  }
+
+   pointer operator->() const
+   {  return &**this;  }
+
+   lockfree_read_index_iterator &operator++()
+   {
+      ++mp_slot;
+      this->priv_skip_free();
+      return *this;
+   }
+
+   lockfree_read_index_iterator operator++(int)
+   {
+      lockfree_read_index_iterator tmp(*this);
+      ++*this;
+      return tmp;
+   }
+
+   friend bool operator==(const lockfree_read_index_iterator &l, const lockfree_read_index_iterator &r)
+   {  return l.mp_slot == r.mp_slot;  }
+
+   friend bool operator!=(const lockfree_read_index_iterator &l, const lockfree_read_index_iterator &r)
+   {  return l.mp_slot != r.mp_slot;  }
+
+   private:
+   template<class, class> friend class lockfree_read_index_iterator;
+   template<class> friend class lockfree_read_index;
+
+   void priv_skip_free()
+   {
+      while(mp_slot != mp_end && !Index::is_value(mp_slot->m_value)){
+         ++mp_slot;
+      }
+   }
+
+   const Index   *mp_index;
+   const slot_t  *mp_slot;
+   const slot_t  *mp_end;
+};
+
+/// @endcond
+
+//!Index type based on an open addressing hash table whose searches don't
+//!need to take the lock of the segment manager, so that processes looking
+//!for named objects never block each other.
+//!
+//!Insertions and erasures are done, as with the rest of indexes, holding the
+//!lock of the segment manager and they increment a sequence counter before
+//!and after modifying the table. A lock-free search reads the counter, probes
+//!the table and reads the header of the candidate object with atomic loads,
+//!and checks that the counter has not changed. Every position read during the
+//!search is checked against the bounds of the segment, so a search that
+//!overlaps an erasure or a rehash can read stale contents but never memory
+//!outside the segment.
+//!
+//!Searches are also counted while they run, in one of two alternating epochs.
+//!The tables replaced by a rehash and the blocks of erased values are kept in
+//!a list and deallocated by a later modification of the index, once the
+//!searches that were running when they were unlinked have finished, so a
+//!search never reads memory that has been reused.
+//!
+//!A search that finds the sequence counter odd yields and tries again.
+//!Only if the modification is still in progress after LockFreeTries
+//!attempts, or if the found object is still being constructed, the search
+//!fails and the segment manager repeats it holding the lock, so these
+//!searches are serialized with each other and with the writers.
+template <class MapConfig>
+class lockfree_read_index
+{
+   /// @cond
+   //Non-copyable
+   lockfree_read_index(const lockfree_read_index &);
+   lockfree_read_index &operator=(const lockfree_read_index &);
+
+   typedef lockfree_read_index_aux<MapConfig>            index_aux;
+   typedef typename index_aux::segment_manager_base      segment_manager_base;
+   typedef typename index_aux::segment_manager_base_ptr  segment_manager_base_ptr;
+   typedef typename index_aux::char_type                 char_type;
+   typedef typename index_aux::block_header_t            block_header_t;
+   typedef typename index_aux::slot_t                    slot_t;
+   typedef typename index_aux::table_t                   table_t;
+
+   template<class, class> friend class lockfree_read_index_iterator;
+   /// @endcond
+
+   public:
+   typedef typename index_aux::value_type                   value_type;
+   typedef typename index_aux::intrusive_compare_key_type   intrusive_compare_key_type;
+   typedef typename index_aux::size_type                    size_type;
+   typedef lockfree_read_index_iterator
+      <lockfree_read_index, value_type>                     iterator;
+   typedef lockfree_read_index_iterator
+      <lockfree_read_index, const value_type>               const_iterator;
+
+   //!Data obtained by insert_check and used by insert_commit
+   struct insert_commit_data
+   {
+      size_type m_hash;
+      size_type m_slot;
+   };
+
+   //!Number of lock-free attempts made by lockfree_find before
+   //!reporting that the index must be searched holding the lock
+   static const unsigned LockFreeTries = 4u;
+
+   //!Constructor. Takes a pointer to the
+   //!segment manager. Never throws
+   lockfree_read_index(segment_manager_base *segment_mngr)
+      :  m_seq(0), m_epoch(0), m_table(0), m_size(0), m_used(0), mp_segment_mngr(segment_mngr)
+   {
+      m_readers[0] = m_readers[1] = 0;
+      m_retired[0] = m_retired[1] = 0;
+   }
+
+   //!Deallocates the table and the memory whose deallocation
+   //!was deferred. Values are not destroyed. Never throws
+   ~lockfree_read_index()
+   {
+      table_t *t = this->priv_table();
+      if(t){
+         mp_segment_mngr->deallocate(t);
+      }
+      this->priv_free_retired(0u);
+      this->priv_free_retired(1u);
+   }
+
+   //!Returns the number of stored values
+   size_type size() const
+   {  return m_size;  }
+
+   //!Returns true if the index stores no values
+   bool empty() const
+   {  return !m_size;  }
+
+   iterator begin()
+   {  return this->priv_make_iterator<iterator>(0u);  }
+
+   const_iterator begin() const
+   {  return this->priv_make_iterator<const_iterator>(0u);  }
+
+   iterator end()
+   {  return this->priv_make_iterator<iterator>(this->priv_capacity());  }
+
+   const_iterator end() const
+   {  return this->priv_make_iterator<const_iterator>(this->priv_capacity());  }
+
+   //!Preallocates the table to hold "n" values without rehashing.
+   //!Can throw boost::interprocess::bad_alloc
+   void reserve(size_type n)
+   {
+      if(n > this->priv_max_load(this->priv_capacity())){
+         this->priv_rehash(this->priv_suggested_capacity(n));
+      }
+   }
+
+   //!Tries to free unused memory from the table. Never throws
+   void shrink_to_fit()
+   {
+      const size_type capacity = this->priv_capacity();
+      if(!m_size){
+         if(capacity){
+            table_t *t = this->priv_table();
+            this->priv_write_begin();
+            ipcdetail::lf_index_store_release(&m_table, size_type(0u));
+            this->priv_write_end();
+            m_used = 0;
+            this->priv_retire(t);
+         }
+      }
+      else{
+         const size_type suggested = this->priv_suggested_capacity(m_size);
+         if(suggested < capacity){
+            BOOST_TRY{
+               this->priv_rehash(suggested);
+            }
+            BOOST_CATCH(...){}
+            BOOST_CATCH_END
+         }
+      }
+   }
+
+   //!Searches "key". Must be called holding the lock of the segment manager
+   iterator find(const intrusive_compare_key_type &key)
+   {  return this->priv_make_iterator<iterator>(this->priv_find(key, priv_hash(key)));  }
+
+   //!Searches "key". Must be called holding the lock of the segment manager
+   const_iterator find(const intrusive_compare_key_type &key) const
+   {  return this->priv_make_iterator<const_iterator>(this->priv_find(key, priv_hash(key)));  }
+
+   //!Searches "key" without taking any lock. Returns false if a consistent
+   //!result could not be obtained, e.g. because a writer is modifying the
+   //!index or the value is still being constructed: the search must then be
+   //!repeated with find() holding the lock. Otherwise returns true and fills
+   //!"value" with the address of the object (null if "key" is not present)
+   //!and "value_bytes" with the bytes occupied by the object. Never throws
+   bool lockfree_find(const intrusive_compare_key_type &key, void *&value, size_type &value_bytes) const
+   {
+      const size_type hash = priv_hash(key);
+      const reader_guard guard(*this);
+      for(unsigned i = 0; i != LockFreeTries; ++i){
+         const boost::uint32_t seq = ipcdetail::lf_index_load_acquire(&m_seq);
+         if(seq & 1u){
+            //A writer is modifying the index, the modification is short
+            ipcdetail::thread_yield();
+            continue;
+         }
+         value = 0;
+         value_bytes = 0;
+         const bool consistent = this->priv_lockfree_find(key, hash, value, value_bytes);
+         ipcdetail::lf_index_acquire_fence();
+         if(ipcdetail::lf_index_load(&m_seq) == seq){
+            return consistent;
+         }
+      }
+      return false;
+   }
+
+   //!Checks if "key" can be inserted. If the key is already present, returns
+   //!an iterator to it and false. Otherwise, makes room for the new value and
+   //!returns true: the insertion must be completed with insert_commit. Must be
+   //!called holding the lock of the segment manager.
+   //!Can throw boost::interprocess::bad_alloc
+   std::pair<iterator, bool> insert_check
+      (const intrusive_compare_key_type &key, insert_commit_data &commit_data)
+   {
+      this->priv_reclaim();
+      commit_data.m_hash = priv_hash(key);
+      const size_type found = this->priv_find(key, commit_data.m_hash);
+      if(found != this->priv_capacity()){
+         return std::pair<iterator, bool>(this->priv_make_iterator<iterator>(found), false);
+      }
+      this->priv_reserve_one();
+      commit_data.m_slot = this->priv_insertion_slot(commit_data.m_hash);
+      return std::pair<iterator, bool>(this->end(), true);
+   }
+
+   //!Inserts "val" using the data obtained with insert_check. The value is
+   //!found by find() but not by lockfree_find() until publish() is called.
+   //!Must be called holding the lock of the segment manager. Never throws
+   iterator insert_commit(value_type &val, insert_commit_data &commit_data)
+   {
+      slot_t &slot = this->priv_table()->slots()[commit_data.m_slot];
+      if(slot.m_value == EmptySlot){
+         ++m_used;
+      }
+      this->priv_write_begin();
+      ipcdetail::lf_index_store(&slot.m_hash, commit_data.m_hash);
+      ipcdetail::lf_index_store(&slot.m_value, size_type(this->priv_offset(&val) | PendingBit));
+      this->priv_write_end();
+      ++m_size;
+      return this->priv_make_iterator<iterator>(commit_data.m_slot);
+   }
+
+   //!Makes a value inserted with insert_commit visible to lock-free searches.
+   //!Must be called holding the lock of the segment manager, when the object
+   //!has been completely constructed. Never throws
+   void publish(const iterator &it)
+   {
+      slot_t &slot = const_cast<slot_t&>(*it.mp_slot);
+      ipcdetail::lf_index_store_release(&slot.m_value, size_type(slot.m_value & ~PendingBit));
+   }
+
+   //!Erases the value pointed by "it". Must be called holding
+   //!the lock of the segment manager. Never throws
+   void erase(const iterator &it)
+   {
+      table_t *t = this->priv_table();
+      slot_t *slots = t->slots();
+      const size_type mask = t->m_capacity - 1u;
+      size_type pos = static_cast<size_type>(it.mp_slot - slots);
+      this->priv_write_begin();
+      if(slots[(pos + 1u) & mask].m_value == EmptySlot){
+         //No probe sequence continues after this slot: it and the
+         //erased slots that precede it can be marked as empty
+         do{
+            ipcdetail::lf_index_store(&slots[pos].m_value, size_type(EmptySlot));
+            --m_used;
+            pos = (pos - 1u) & mask;
+         } while(slots[pos].m_value == ErasedSlot);
+      }
+      else{
+         ipcdetail::lf_index_store(&slots[pos].m_value, size_type(ErasedSlot));
+      }
+      this->priv_write_end();
+      --m_size;
+   }
+
+   //!Deallocates the memory of a value erased with erase() when no lock-free
+   //!search can be reading it: immediately, or in a later call to a function
+   //!that modifies the index. Must be called holding the lock of the segment
+   //!manager, with the address returned by the allocation. Never throws
+   void retire(void *block)
+   {  this->priv_retire(block);  }
+
+   /// @cond
+   private:
+   //Special values of slot_t::m_value. Values are aligned, so the distance
+   //from the index to a value has the lower bits free to mark it as pending
+   static const size_type EmptySlot    = 0u;
+   static const size_type ErasedSlot   = 1u;
+   static const size_type PendingBit   = 2u;
+   static const size_type MinCapacity  = 16u;
+
+   static bool is_value(size_type v)
+   {  return v != EmptySlot && v != ErasedSlot;  }
+
+   //Keeps the reader counter of the current epoch incremented during a
+   //lock-free search. If the epoch changes before the search is counted,
+   //the search is counted in the new epoch instead
+   class reader_guard
+   {
+      volatile boost::uint32_t *mp_readers;
+
+      public:
+      explicit reader_guard(const lockfree_read_index &index)
+      {
+         for(;;){
+            const boost::uint32_t epoch = ipcdetail::lf_index_load(&index.m_epoch);
+            mp_readers = &index.m_readers[epoch];
+            ipcdetail::lf_index_inc(mp_readers);
+            if(ipcdetail::lf_index_load(&index.m_epoch) == epoch){
+               break;
+            }
+            ipcdetail::lf_index_dec(mp_readers);
+         }
+      }
+
+      ~reader_guard()
+      {  ipcdetail::lf_index_dec(mp_readers);  }
+   };
+
+   static size_type priv_hash(const intrusive_compare_key_type &key)
+   {  return static_cast<size_type>(boost::hash_range(key.mp_str, key.mp_str + key.m_len));  }
+
+   //Maximum number of used (live or erased) slots of a table
+   static size_type priv_max_load(size_type capacity)
+   {  return capacity - capacity/4u;  }
+
+   //Smallest capacity that holds "n" values at half load
+   static size_type priv_suggested_capacity(size_type n)
+   {
+      size_type capacity = MinCapacity;
+      while(capacity/2u < n){
+         capacity *= 2u;
+      }
+      return capacity;
+   }
+
+   size_type priv_offset(const void *ptr) const
+   {
+      const size_type off = static_cast<size_type>
+         (reinterpret_cast<std::size_t>(ptr) - reinterpret_cast<std::size_t>(this));
+      BOOST_ASSERT(!(off & (ErasedSlot | PendingBit)));
+      return off;
+   }
+
+   void *priv_value(size_type v) const
+   {
+      return const_cast<char*>(reinterpret_cast<const char*>(this)) +
+         static_cast<std::size_t>(v & ~PendingBit);
+   }
+
+   table_t *priv_table() const
+   {  return m_table ? static_cast<table_t*>(this->priv_value(m_table)) : 0;  }
+
+   size_type priv_capacity() const
+   {
+      table_t *t = this->priv_table();
+      return t ? size_type(t->m_capacity) : size_type(0u);
+   }
+
+   template<class Iterator>
+   Iterator priv_make_iterator(size_type pos) const
+   {
+      table_t *t = this->priv_table();
+      if(!t){
+         return Iterator(this, 0, 0);
+      }
+      const slot_t *slots = t->slots();
+      return Iterator(this, slots + pos, slots + size_type(t->m_capacity));
+   }
+
+   //Readers that have read an even counter detect the modification
+   void priv_write_begin()
+   {
+      ipcdetail::lf_index_store(&m_seq, boost::uint32_t(m_seq + 1u));
+      ipcdetail::lf_index_release_fence();
+   }
+
+   void priv_write_end()
+   {  ipcdetail::lf_index_store_release(&m_seq, boost::uint32_t(m_seq + 1u));  }
+
+   bool priv_equal(size_type v, const intrusive_compare_key_type &key) const
+   {
+      const value_type &val = *static_cast<const value_type*>(this->priv_value(v));
+      return key.m_len == val.name_length() &&
+             std::char_traits<char_type>::compare(key.mp_str, val.name(), key.m_len) == 0;
+   }
+
+   //Returns the position of "key" or the capacity if not found
+   size_type priv_find(const intrusive_compare_key_type &key, size_type hash) const
+   {
+      table_t *t = this->priv_table();
+      if(!t){
+         return 0u;
+      }
+      const size_type capacity = t->m_capacity;
+      const size_type mask = capacity - 1u;
+      const slot_t *slots = t->slots();
+      for(size_type i = 0, pos = hash & mask; i != capacity; ++i, pos = (pos + 1u) & mask){
+         const size_type v = slots[pos].m_value;
+         if(v == EmptySlot){
+            break;
+         }
+         if(v != ErasedSlot && slots[pos].m_hash == hash && this->priv_equal(v, key)){
+            return pos;
+         }
+      }
+      return capacity;
+   }
+
+   //Returns the first free position of the probe sequence of "hash"
+   size_type priv_insertion_slot(size_type hash) const
+   {
+      table_t *t = this->priv_table();
+      const size_type mask = t->m_capacity - 1u;
+      const slot_t *slots = t->slots();
+      size_type pos = hash & mask;
+      while(is_value(slots[pos].m_value)){
+         pos = (pos + 1u) & mask;
+      }
+      return pos;
+   }
+
+   //Makes sure that a new value can be inserted keeping a free slot
+   void priv_reserve_one()
+   {
+      const size_type capacity = this->priv_capacity();
+      if(m_used < this->priv_max_load(capacity)){
+         return;
+      }
+      BOOST_TRY{
+         this->priv_rehash(this->priv_suggested_capacity(m_size + 1u));
+      }
+      BOOST_CATCH(...){
+         //A full table still works while there is an empty slot
+         if((m_used + 1u) >= capacity){
+            BOOST_RETHROW
+         }
+      }
+      BOOST_CATCH_END
+   }
+
+   //Moves all the values to a new table of "capacity" slots and
+   //purges erased slots. Can throw boost::interprocess::bad_alloc
+   void priv_rehash(size_type capacity)
+   {
+      table_t *new_t = static_cast<table_t*>
+         (mp_segment_mngr->allocate(sizeof(table_t) + capacity*sizeof(slot_t)));
+      ipcdetail::lf_index_store(&new_t->m_capacity, capacity);
+      slot_t *new_slots = new_t->slots();
+      for(size_type i = 0; i != capacity; ++i){
+         ipcdetail::lf_index_store(&new_slots[i].m_hash, size_type(0u));
+         ipcdetail::lf_index_store(&new_slots[i].m_value, size_type(EmptySlot));
+      }
+      const size_type mask = capacity - 1u;
+      table_t *old_t = this->priv_table();
+      if(old_t){
+         const slot_t *old_slots = old_t->slots();
+         for(size_type i = 0, old_capacity = old_t->m_capacity; i != old_capacity; ++i){
+            const size_type v = old_slots[i].m_value;
+            if(is_value(v)){
+               size_type pos = old_slots[i].m_hash & mask;
+               while(new_slots[pos].m_value != EmptySlot){
+                  pos = (pos + 1u) & mask;
+               }
+               ipcdetail::lf_index_store(&new_slots[pos].m_hash, size_type(old_slots[i].m_hash));
+               ipcdetail::lf_index_store(&new_slots[pos].m_value, v);
+            }
+         }
+      }
+      this->priv_write_begin();
+      ipcdetail::lf_index_store_release(&m_table, this->priv_offset(new_t));
+      this->priv_write_end();
+      m_used = m_size;
+      if(old_t){
+         this->priv_retire(old_t);
+      }
+   }
+
+   //Links "block" to the list of deferred deallocations of the current
+   //epoch. Searches that start after the block has been unlinked from the
+   //index can't reach it, so it can be deallocated once the searches
+   //running now have finished
+   void priv_retire(void *block)
+   {
+      ipcdetail::lf_index_store
+         (static_cast<volatile size_type*>(block), size_type(m_retired[m_epoch]));
+      m_retired[m_epoch] = this->priv_offset(block);
+      this->priv_reclaim();
+   }
+
+   //Deallocates the retired memory that no lock-free search can be reading.
+   //Searches are counted in two alternating epochs: when the searches of the
+   //previous epoch have finished, the memory retired during that epoch is
+   //freed and new searches are counted in it again, so that the searches
+   //of the current epoch drain. The memory is never kept for long, even if
+   //searches never stop.
+   void priv_reclaim()
+   {
+      if(!m_retired[0] && !m_retired[1]){
+         return;
+      }
+      const boost::uint32_t cur = m_epoch, prev = cur ^ 1u;
+      //Searches increment the reader counter before loading the table, the
+      //fence orders the modifications of the index before the counter reads
+      ipcdetail::lf_index_full_fence();
+      if(ipcdetail::lf_index_load_acquire(&m_readers[prev])){
+         return;
+      }
+      this->priv_free_retired(prev);
+      if(!ipcdetail::lf_index_load_acquire(&m_readers[cur])){
+         //No search is running
+         this->priv_free_retired(cur);
+      }
+      else{
+         ipcdetail::lf_index_store(&m_epoch, prev);
+      }
+   }
+
+   void priv_free_retired(boost::uint32_t epoch)
+   {
+      while(m_retired[epoch]){
+         void *block = this->priv_value(m_retired[epoch]);
+         m_retired[epoch] = *static_cast<volatile size_type*>(block);
+         mp_segment_mngr->deallocate(block);
+      }
+   }
+
+   //Checks that [this + off, this + off + bytes) is inside the segment
+   bool priv_in_segment(size_type off, std::size_t bytes) const
+   {
+      const std::size_t seg_beg  = reinterpret_cast<std::size_t>(ipcdetail::to_raw_pointer(mp_segment_mngr));
+      const std::size_t seg_size = mp_segment_mngr->get_size();
+      const std::size_t pos = reinterpret_cast<std::size_t>(this) + off - seg_beg;
+      return pos <= seg_size && bytes <= seg_size - pos;
+   }
+
+   //Lock-free probe. Every word is read with an atomic load and
+   //every position is checked against the bounds of the segment.
+   //Returns false if the contents read are not consistent
+   bool priv_lockfree_find
+      (const intrusive_compare_key_type &key, size_type hash, void *&value, size_type &value_bytes) const
+   {
+      const size_type t_off = ipcdetail::lf_index_load_acquire(&m_table);
+      if(!t_off){
+         return true;
+      }
+      if(!this->priv_in_segment(t_off, sizeof(table_t))){
+         return false;
+      }
+      const table_t *t = static_cast<const table_t*>(this->priv_value(t_off));
+      const size_type capacity = ipcdetail::lf_index_load(&t->m_capacity);
+      if(!capacity || (capacity & (capacity - 1u)) ||
+         capacity > mp_segment_mngr->get_size()/sizeof(slot_t) ||
+         !this->priv_in_segment(t_off, sizeof(table_t) + capacity*sizeof(slot_t))){
+         return false;
+      }
+      const size_type mask = capacity - 1u;
+      const slot_t *slots = t->slots();
+      for(size_type i = 0, pos = hash & mask; i != capacity; ++i, pos = (pos + 1u) & mask){
+         const size_type v = ipcdetail::lf_index_load(&slots[pos].m_value);
+         if(v == EmptySlot){
+            return true;
+         }
+         if(v == ErasedSlot || ipcdetail::lf_index_load(&slots[pos].m_hash) != hash){
+            continue;
+         }
+         if(v & PendingBit){
+            //The object could be this one and it is still being constructed
+            return false;
+         }
+         const int cmp = this->priv_lockfree_compare(v, key, value, value_bytes);
+         if(cmp){
+            return cmp > 0;
+         }
+      }
+      return true;
+   }
+
+   //Compares the name of the value "v" with "key". Returns 1 and fills the
+   //value data if they are equal, 0 if they differ and -1 if the header
+   //of the value is not consistent.
+   int priv_lockfree_compare
+      (size_type v, const intrusive_compare_key_type &key, void *&value, size_type &value_bytes) const
+   {
+      //Offset of the header from the value, see intrusive_value_type_impl
+      const size_type hdr_off = v + ipcdetail::get_rounded_size
+         ( size_type(sizeof(value_type))
+         , size_type(::boost::alignment_of<block_header_t>::value));
+      if(!this->priv_in_segment(hdr_off, sizeof(block_header_t))){
+         return -1;
+      }
+      const block_header_t *hdr = static_cast<const block_header_t*>(this->priv_value(hdr_off));
+      const unsigned short num_char = ipcdetail::lf_index_load(&hdr->m_num_char);
+      if(num_char != key.m_len){
+         return 0;
+      }
+      const unsigned char alignment = ipcdetail::lf_index_load(&hdr->m_value_alignment);
+      const unsigned char type_sizeof_char = ipcdetail::lf_index_load(&hdr->m_alloc_type_sizeof_char);
+      if(!alignment || (alignment & (alignment - 1u)) ||
+         (type_sizeof_char & 0x1F) != sizeof(char_type)){
+         return -1;
+      }
+      const block_header_t copy
+         ( ipcdetail::lf_index_load(&hdr->m_value_bytes), alignment
+         , (unsigned char)(type_sizeof_char >> 5u), sizeof(char_type), num_char);
+      const size_type name_off = hdr_off + copy.name_offset();
+      if(copy.name_offset() < sizeof(block_header_t) ||
+         !this->priv_in_segment(name_off, key.m_len*sizeof(char_type))){
+         return -1;
+      }
+      const char_type *name = static_cast<const char_type*>(this->priv_value(name_off));
+      for(std::size_t i = 0; i != key.m_len; ++i){
+         if(ipcdetail::lf_index_load(&name[i]) != key.mp_str[i]){
+            return 0;
+         }
+      }
+      value = this->priv_value(hdr_off + copy.value_offset());
+      value_bytes = copy.value_bytes();
+      return 1;
+   }
+
+   volatile boost::uint32_t   m_seq;
+   //Epoch in which the searches are counted, 0 or 1
+   volatile boost::uint32_t   m_epoch;
+   //Number of running searches counted in each epoch
+   mutable volatile boost::uint32_t m_readers[2];
+   volatile size_type         m_table;
+   size_type                  m_size;
+   size_type                  m_used;
+   //Offset of the last block retired in each epoch,
+   //the blocks are linked by their first word
+   size_type                  m_retired[2];
+   segment_manager_base_ptr   mp_segment_mngr;
+   /// @endcond
+};
+
+/// @cond
+
+//!Trait class to detect if an index is an intrusive
+//!index
+template<class MapConfig>
+struct is_intrusive_index
+   <boost::interprocess::lockfree_read_index<MapConfig> >
+{
+   static const bool value = true;
+};
+
+//!Trait class to detect if an index can be
+//!searched without taking the lock
+template<class MapConfig>
+struct is_lockfree_read_index
+   <boost::interprocess::lockfree_read_index<MapConfig> >
+{
+   static const bool value = true;
+};
+
+/// @endcond
+
+}}   //namespace boost { namespace interprocess {
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_INTERPROCESS_LOCKFREE_READ_INDEX_HPP
@@ -171,6 +171,7 @@ class rbtree_best_fit;
 template<class IndexConfig> class flat_map_index;
 template<class IndexConfig> class iset_index;
 template<class IndexConfig> class iunordered_set_index;
+template<class IndexConfig> class lockfree_read_index;
 template<class IndexConfig> class map_index;
 template<class IndexConfig> class null_index;
 template<class IndexConfig> class unordered_map_index;
@@ -407,6 +408,12 @@ class message_queue_t;
 
 typedef message_queue_t<offset_ptr<void> > message_queue;
 
+template<bool MultiProducerConsumer>
+class lockfree_message_queue_t;
+
+typedef lockfree_message_queue_t<false> spsc_message_queue;
+typedef lockfree_message_queue_t<true>  mpmc_message_queue;
+
 }}  //namespace boost { namespace interprocess {
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,717 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_LOCKFREE_MESSAGE_QUEUE_HPP
+#define BOOST_INTERPROCESS_LOCKFREE_MESSAGE_QUEUE_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+
+#include <boost/interprocess/interprocess_fwd.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/detail/managed_open_or_create_impl.hpp>
+#include <boost/interprocess/detail/atomic.hpp>
+#include <boost/interprocess/detail/utilities.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <boost/interprocess/sync/detail/futex.hpp>
+#include <boost/interprocess/sync/spin/wait.hpp>
+#include <boost/interprocess/creation_tags.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/permissions.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>   //std::size_t
+#include <cstring>   //memcpy
+
+//!\file
+//!Describes lock-free inter-process message queues. Messages are stored in a
+//!bounded ring placed in shared memory and are delivered in FIFO order.
+//!Sending and receiving never take a lock: threads only block (using a futex
+//!where available) when the queue is full or empty.
+
+namespace boost{  namespace interprocess{
+
+/// @cond
+namespace ipcdetail
+{
+   template<bool MultiProducerConsumer>
+   class lf_msg_queue_initialization_func_t;
+}
+/// @endcond
+
+//!A class that allows sending messages between processes without locking.
+//!If "MultiProducerConsumer" is false, at most one thread can send and at most
+//!one thread can receive messages at any time (spsc_message_queue); otherwise any
+//!number of threads and processes can send and receive concurrently (mpmc_message_queue).
+//!Unlike message_queue, messages have no priority and are received in FIFO order.
+template<bool MultiProducerConsumer>
+class lockfree_message_queue_t
+{
+   /// @cond
+   //Blocking modes
+   enum block_t   {  blocking,   timed,   non_blocking   };
+
+   lockfree_message_queue_t();
+   /// @endcond
+
+   public:
+   typedef std::size_t size_type;
+
+   //!Creates a process shared message queue with name "name". For this message queue,
+   //!the maximum number of messages will be "max_num_msg" rounded up to the next
+   //!power of two, and the maximum message size will be "max_msg_size".
+   //!Throws on error and if the queue was previously created.
+   lockfree_message_queue_t(create_only_t create_only,
+                            const char *name,
+                            size_type max_num_msg,
+                            size_type max_msg_size,
+                            const permissions &perm = permissions());
+
+   //!Opens or creates a process shared message queue with name "name".
+   //!If the queue is created, the maximum number of messages will be "max_num_msg"
+   //!rounded up to the next power of two and the maximum message size will be
+   //!"max_msg_size". If queue was previously created the queue will be opened
+   //!and "max_num_msg" and "max_msg_size" parameters are ignored. Throws on error.
+   lockfree_message_queue_t(open_or_create_t open_or_create,
+                            const char *name,
+                            size_type max_num_msg,
+                            size_type max_msg_size,
+                            const permissions &perm = permissions());
+
+   //!Opens a previously created process shared message queue with name "name".
+   //!If the queue was not previously created or there are no free resources,
+   //!throws an error.
+   lockfree_message_queue_t(open_only_t open_only,
+                            const char *name);
+
+   //!Destroys *this and indicates that the calling process is finished using
+   //!the resource. To erase the message queue from the system use remove().
+   ~lockfree_message_queue_t();
+
+   //!Sends a message stored in buffer "buffer" with size "buffer_size".
+   //!If the message queue is full the sender is blocked.
+   //!Throws interprocess_error if "buffer_size" exceeds the maximum message size.
+   void send (const void *buffer, size_type buffer_size);
+
+   //!Sends a message stored in buffer "buffer" with size "buffer_size".
+   //!If the message queue is full the sender is not blocked and returns false,
+   //!otherwise returns true.
+   //!Throws interprocess_error if "buffer_size" exceeds the maximum message size.
+   bool try_send (const void *buffer, size_type buffer_size);
+
+   //!Sends a message stored in buffer "buffer" with size "buffer_size".
+   //!If the message queue is full the sender waits until time "abs_time" is reached.
+   //!Returns true if the message has been successfully sent, false if timeout is reached.
+   //!Throws interprocess_error if "buffer_size" exceeds the maximum message size.
+   bool timed_send (const void *buffer, size_type buffer_size,
+                    const boost::posix_time::ptime& abs_time);
+
+   //!Receives a message from the message queue. The message is stored in buffer
+   //!"buffer", which has size "buffer_size". The received message has size
+   //!"recvd_size". If the message queue is empty the receiver is blocked.
+   //!Throws interprocess_error if "buffer_size" is less than the maximum message size.
+   void receive (void *buffer, size_type buffer_size, size_type &recvd_size);
+
+   //!Receives a message from the message queue. The message is stored in buffer
+   //!"buffer", which has size "buffer_size". The received message has size
+   //!"recvd_size". If the message queue is empty the receiver is not blocked and
+   //!returns false, otherwise returns true.
+   //!Throws interprocess_error if "buffer_size" is less than the maximum message size.
+   bool try_receive (void *buffer, size_type buffer_size, size_type &recvd_size);
+
+   //!Receives a message from the message queue. The message is stored in buffer
+   //!"buffer", which has size "buffer_size". The received message has size
+   //!"recvd_size". If the message queue is empty the receiver waits until time
+   //!"abs_time" is reached. Returns true if a message has been received, false if
+   //!timeout is reached.
+   //!Throws interprocess_error if "buffer_size" is less than the maximum message size.
+   bool timed_receive (void *buffer, size_type buffer_size, size_type &recvd_size,
+                       const boost::posix_time::ptime &abs_time);
+
+   //!Returns the maximum number of messages allowed by the queue. The message
+   //!queue must be opened or created previously. Otherwise, returns 0.
+   //!Never throws
+   size_type get_max_msg() const;
+
+   //!Returns the maximum size of message allowed by the queue. The message
+   //!queue must be opened or created previously. Otherwise, returns 0.
+   //!Never throws
+   size_type get_max_msg_size() const;
+
+   //!Returns the number of messages currently stored. The value might be
+   //!out of date if other threads are concurrently using the queue.
+   //!Never throws
+   size_type get_num_msg() const;
+
+   //!Removes the message queue from the system.
+   //!Returns false on error. Never throws
+   static bool remove(const char *name);
+
+   /// @cond
+   private:
+   typedef boost::posix_time::ptime ptime;
+
+   friend class ipcdetail::lf_msg_queue_initialization_func_t<MultiProducerConsumer>;
+
+   bool do_receive(block_t block,
+                   void *buffer,         size_type buffer_size,
+                   size_type &recvd_size, const ptime &abs_time);
+
+   bool do_send(block_t block,
+                const void *buffer,      size_type buffer_size,
+                const ptime &abs_time);
+
+   //!Returns the needed memory size for the shared message queue.
+   //!Never throws
+   static size_type get_mem_size(size_type max_msg_size, size_type max_num_msg);
+
+   //The header is aligned to a cache line so that the positions updated by
+   //senders and receivers do not share cache lines
+   static const std::size_t CacheLineSize = 64u;
+   typedef ipcdetail::managed_open_or_create_impl
+      <shared_memory_object, CacheLineSize, true, false> open_create_impl_t;
+   open_create_impl_t m_shmem;
+   /// @endcond
+};
+
+//!A lock-free message queue for one sender and one receiver
+typedef lockfree_message_queue_t<false> spsc_message_queue;
+
+//!A lock-free message queue for any number of senders and receivers
+typedef lockfree_message_queue_t<true>  mpmc_message_queue;
+
+/// @cond
+
+namespace ipcdetail {
+
+//Ordered accesses to the 32 bit words shared between senders and receivers.
+//atomic_read32/atomic_write32 are plain volatile accesses, so the data copied
+//to/from a message could be reordered around them.
+#if defined(__GNUC__) && ((__GNUC__ * 100 + __GNUC_MINOR__) >= 407)
+
+inline boost::uint32_t lf_mq_load_acquire(volatile boost::uint32_t *mem)
+{  return __atomic_load_n(mem, __ATOMIC_ACQUIRE);  }
+
+inline void lf_mq_store_release(volatile boost::uint32_t *mem, boost::uint32_t val)
+{  __atomic_store_n(mem, val, __ATOMIC_RELEASE);  }
+
+inline void lf_mq_full_fence()
+{  __atomic_thread_fence(__ATOMIC_SEQ_CST);  }
+
+#else
+
+inline boost::uint32_t lf_mq_load_acquire(volatile boost::uint32_t *mem)
+{  return atomic_cas32(mem, 0, 0);  }
+
+inline void lf_mq_store_release(volatile boost::uint32_t *mem, boost::uint32_t val)
+{
+   boost::uint32_t old;
+   do{
+      old = atomic_read32(mem);
+   } while(atomic_cas32(mem, val, old) != old);
+}
+
+inline void lf_mq_full_fence()
+{
+   volatile boost::uint32_t dummy = 0;
+   atomic_cas32(&dummy, 0, 0);
+}
+
+#endif
+
+//!Header of each slot of the ring. "seq" tells the state of the slot
+//!for the current lap: it equals the position of the next sender that can
+//!fill it, or that position plus one when it holds a message.
+struct lf_msg_hdr_t
+{
+   volatile boost::uint32_t seq;
+   boost::uint32_t          len;
+
+   void * data(){ return this+1; }
+};
+
+//!This header is placed at the beginning of the shared memory and contains
+//!the data to control the queue: a bounded ring of slots where senders and
+//!receivers claim positions (with a CAS in the multi producer/consumer
+//!variant, with a plain store otherwise) and publish their slot through its
+//!sequence number. Blocked threads wait on an event word that is bumped and
+//!woken only when someone has registered as a waiter, so the fast path does
+//!not issue system calls.
+template<bool MultiProducerConsumer>
+class lf_mq_hdr_t
+{
+   public:
+   typedef std::size_t size_type;
+   static const std::size_t CacheLineSize = 64u;
+
+   lf_mq_hdr_t(size_type max_num_msg, size_type max_msg_size)
+      : m_capacity(static_cast<boost::uint32_t>(get_capacity(max_num_msg)))
+      , m_max_msg_size(static_cast<boost::uint32_t>(max_msg_size))
+      , m_slot_size(static_cast<boost::uint32_t>(get_slot_size(max_msg_size)))
+      , m_enqueue_pos(0), m_dequeue_pos(0)
+      , m_recv_event(0), m_recv_waiters(0)
+      , m_send_event(0), m_send_waiters(0)
+   {
+      for(boost::uint32_t i = 0; i != m_capacity; ++i){
+         lf_msg_hdr_t &slot = this->slot_at(i);
+         slot.seq = i;
+         slot.len = 0;
+      }
+   }
+
+   //!Returns the number of slots of the ring: "max_num_msg" rounded
+   //!up to a power of two, so that positions can wrap around freely.
+   static size_type get_capacity(size_type max_num_msg)
+   {
+      size_type capacity = 1u;
+      while(capacity < max_num_msg){
+         capacity <<= 1u;
+      }
+      return capacity;
+   }
+
+   static size_type get_slot_size(size_type max_msg_size)
+   {
+      return sizeof(lf_msg_hdr_t) +
+         ipcdetail::get_rounded_size(max_msg_size, size_type(sizeof(lf_msg_hdr_t)));
+   }
+
+   //!Returns the number of bytes needed to construct a message queue with
+   //!"max_num_size" maximum number of messages and "max_msg_size" maximum
+   //!message size. Never throws.
+   template<class OpenCreateImpl>
+   static size_type get_mem_size(size_type max_msg_size, size_type max_num_msg)
+   {
+      return ct_rounded_size<sizeof(lf_mq_hdr_t), CacheLineSize>::value +
+         get_capacity(max_num_msg)*get_slot_size(max_msg_size) +
+         OpenCreateImpl::ManagedOpenOrCreateUserOffset;
+   }
+
+   bool try_push(const void *buffer, size_type buffer_size)
+   {
+      boost::uint32_t pos = atomic_read32(&m_enqueue_pos);
+      lf_msg_hdr_t *slot;
+      while(1){
+         slot = &this->slot_at(pos);
+         const boost::int32_t dif =
+            static_cast<boost::int32_t>(lf_mq_load_acquire(&slot->seq) - pos);
+         if(dif == 0){
+            //The slot is free for this lap, claim the position
+            if(!MultiProducerConsumer){
+               atomic_write32(&m_enqueue_pos, pos + 1);
+               break;
+            }
+            const boost::uint32_t cur = atomic_cas32(&m_enqueue_pos, pos + 1, pos);
+            if(cur == pos){
+               break;
+            }
+            pos = cur;
+         }
+         else if(dif < 0){
+            //The slot still holds the message of the previous lap
+            return false;
+         }
+         else{
+            //Another sender claimed the position
+            pos = atomic_read32(&m_enqueue_pos);
+         }
+      }
+      slot->len = static_cast<boost::uint32_t>(buffer_size);
+      std::memcpy(slot->data(), buffer, buffer_size);
+      lf_mq_store_release(&slot->seq, pos + 1);
+      return true;
+   }
+
+   bool try_pop(void *buffer, size_type &recvd_size)
+   {
+      boost::uint32_t pos = atomic_read32(&m_dequeue_pos);
+      lf_msg_hdr_t *slot;
+      while(1){
+         slot = &this->slot_at(pos);
+         const boost::int32_t dif =
+            static_cast<boost::int32_t>(lf_mq_load_acquire(&slot->seq) - (pos + 1));
+         if(dif == 0){
+            //The slot holds a message for this lap, claim the position
+            if(!MultiProducerConsumer){
+               atomic_write32(&m_dequeue_pos, pos + 1);
+               break;
+            }
+            const boost::uint32_t cur = atomic_cas32(&m_dequeue_pos, pos + 1, pos);
+            if(cur == pos){
+               break;
+            }
+            pos = cur;
+         }
+         else if(dif < 0){
+            //The slot has not been filled yet
+            return false;
+         }
+         else{
+            //Another receiver claimed the position
+            pos = atomic_read32(&m_dequeue_pos);
+         }
+      }
+      recvd_size = slot->len;
+      std::memcpy(buffer, slot->data(), recvd_size);
+      //Make the slot available to the sender of the next lap
+      lf_mq_store_release(&slot->seq, pos + m_capacity);
+      return true;
+   }
+
+   size_type get_num_msg() const
+   {
+      const boost::uint32_t deq = atomic_read32(const_cast<volatile boost::uint32_t*>(&m_dequeue_pos));
+      const boost::uint32_t enq = atomic_read32(const_cast<volatile boost::uint32_t*>(&m_enqueue_pos));
+      const boost::int32_t  num = static_cast<boost::int32_t>(enq - deq);
+      return num < 0 ? 0u : (static_cast<boost::uint32_t>(num) > m_capacity ? m_capacity : num);
+   }
+
+   //!Retries "op" until it succeeds, blocking on "event" in the meantime. If "timed"
+   //!is true, returns false if "abs_time" is reached before "op" succeeds.
+   template<class Op>
+   static bool wait_and_retry(Op op, volatile boost::uint32_t &event, volatile boost::uint32_t &waiters,
+                              bool timed, const boost::posix_time::ptime &abs_time)
+   {
+      //Spin a bit before blocking, as the other side is usually fast
+      spin_wait swait;
+      while(swait.count() < spin_wait::nop_pause_limit){
+         swait.yield();
+         if(op()){
+            return true;
+         }
+      }
+      while(1){
+         //Read the event before registering as a waiter and retrying, so that
+         //a notification issued after the retry is not lost
+         const boost::uint32_t ev = lf_mq_load_acquire(&event);
+         atomic_inc32(&waiters);
+         bool done = op();
+         if(!done){
+            if(!timed){
+               futex_wait(&event, ev);
+            }
+            else if(!futex_timed_wait(&event, ev, abs_time)){
+               done = op();
+               atomic_dec32(&waiters);
+               return done;
+            }
+         }
+         atomic_dec32(&waiters);
+         if(done){
+            return true;
+         }
+      }
+   }
+
+   //!Wakes a thread blocked on "event", if any has registered in "waiters"
+   static void notify(volatile boost::uint32_t &event, volatile boost::uint32_t &waiters)
+   {
+      //Orders the publication of the slot before the read of the waiter count.
+      //Pairs with the increment of the waiter count in wait_and_retry.
+      lf_mq_full_fence();
+      if(atomic_read32(&waiters)){
+         atomic_inc32(&event);
+         futex_wake(&event, 1);
+      }
+   }
+
+   private:
+   lf_msg_hdr_t &slot_at(boost::uint32_t pos)
+   {
+      char *slots = reinterpret_cast<char*>(this) +
+         ct_rounded_size<sizeof(lf_mq_hdr_t), CacheLineSize>::value;
+      return *reinterpret_cast<lf_msg_hdr_t*>
+         (slots + size_type(pos & (m_capacity - 1))*m_slot_size);
+   }
+
+   public:
+   //Number of slots of the ring (a power of two)
+   const boost::uint32_t       m_capacity;
+   //Maximum size of messages of the queue
+   const boost::uint32_t       m_max_msg_size;
+   //Size of each slot, including its header
+   const boost::uint32_t       m_slot_size;
+   //Senders and receivers update their positions in different cache lines
+   char                        m_pad0[CacheLineSize];
+   volatile boost::uint32_t    m_enqueue_pos;
+   char                        m_pad1[CacheLineSize];
+   volatile boost::uint32_t    m_dequeue_pos;
+   char                        m_pad2[CacheLineSize];
+   //Event and waiter count for receivers blocked on an empty queue
+   volatile boost::uint32_t    m_recv_event;
+   volatile boost::uint32_t    m_recv_waiters;
+   char                        m_pad3[CacheLineSize];
+   //Event and waiter count for senders blocked on a full queue
+   volatile boost::uint32_t    m_send_event;
+   volatile boost::uint32_t    m_send_waiters;
+   char                        m_pad4[CacheLineSize];
+};
+
+template<bool MultiProducerConsumer>
+class lf_mq_push_op
+{
+   public:
+   lf_mq_push_op(lf_mq_hdr_t<MultiProducerConsumer> &hdr, const void *buffer, std::size_t size)
+      : m_hdr(hdr), m_buffer(buffer), m_size(size)
+   {}
+
+   bool operator()() const
+   {  return m_hdr.try_push(m_buffer, m_size);  }
+
+   private:
+   lf_mq_hdr_t<MultiProducerConsumer> &m_hdr;
+   const void *m_buffer;
+   std::size_t m_size;
+};
+
+template<bool MultiProducerConsumer>
+class lf_mq_pop_op
+{
+   public:
+   lf_mq_pop_op(lf_mq_hdr_t<MultiProducerConsumer> &hdr, void *buffer, std::size_t &recvd_size)
+      : m_hdr(hdr), m_buffer(buffer), m_recvd_size(recvd_size)
+   {}
+
+   bool operator()() const
+   {  return m_hdr.try_pop(m_buffer, m_recvd_size);  }
+
+   private:
+   lf_mq_hdr_t<MultiProducerConsumer> &m_hdr;
+   void *m_buffer;
+   std::size_t &m_recvd_size;
+};
+
+//!This is the atomic functor to be executed when creating or opening
+//!shared memory. Never throws
+template<bool MultiProducerConsumer>
+class lf_msg_queue_initialization_func_t
+{
+   public:
+   typedef std::size_t size_type;
+
+   lf_msg_queue_initialization_func_t(size_type maxmsg = 0,
+                                      size_type maxmsgsize = 0)
+      : m_maxmsg (maxmsg), m_maxmsgsize(maxmsgsize) {}
+
+   bool operator()(void *address, size_type, bool created)
+   {
+      if(created){
+         //Construct the message queue header at the beginning
+         BOOST_TRY{
+            new (address) lf_mq_hdr_t<MultiProducerConsumer>(m_maxmsg, m_maxmsgsize);
+         }
+         BOOST_CATCH(...){
+            return false;
+         }
+         BOOST_CATCH_END
+      }
+      return true;
+   }
+
+   std::size_t get_min_size() const
+   {
+      return lockfree_message_queue_t<MultiProducerConsumer>::get_mem_size(m_maxmsgsize, m_maxmsg)
+      - lockfree_message_queue_t<MultiProducerConsumer>::open_create_impl_t::ManagedOpenOrCreateUserOffset;
+   }
+
+   const size_type m_maxmsg;
+   const size_type m_maxmsgsize;
+};
+
+}  //namespace ipcdetail {
+
+template<bool MultiProducerConsumer>
+inline lockfree_message_queue_t<MultiProducerConsumer>::~lockfree_message_queue_t()
+{}
+
+template<bool MultiProducerConsumer>
+inline typename lockfree_message_queue_t<MultiProducerConsumer>::size_type
+   lockfree_message_queue_t<MultiProducerConsumer>::get_mem_size
+      (size_type max_msg_size, size_type max_num_msg)
+{
+   return ipcdetail::lf_mq_hdr_t<MultiProducerConsumer>::template
+      get_mem_size<open_create_impl_t>(max_msg_size, max_num_msg);
+}
+
+template<bool MultiProducerConsumer>
+inline lockfree_message_queue_t<MultiProducerConsumer>::lockfree_message_queue_t
+   (create_only_t, const char *name, size_type max_num_msg, size_type max_msg_size,
+    const permissions &perm)
+      //Create shared memory and execute functor atomically
+   :  m_shmem(create_only,
+              name,
+              get_mem_size(max_msg_size, max_num_msg),
+              read_write,
+              static_cast<void*>(0),
+              //Prepare initialization functor
+              ipcdetail::lf_msg_queue_initialization_func_t<MultiProducerConsumer>(max_num_msg, max_msg_size),
+              perm)
+{}
+
+template<bool MultiProducerConsumer>
+inline lockfree_message_queue_t<MultiProducerConsumer>::lockfree_message_queue_t
+   (open_or_create_t, const char *name, size_type max_num_msg, size_type max_msg_size,
+    const permissions &perm)
+      //Create shared memory and execute functor atomically
+   :  m_shmem(open_or_create,
+              name,
+              get_mem_size(max_msg_size, max_num_msg),
+              read_write,
+              static_cast<void*>(0),
+              //Prepare initialization functor
+              ipcdetail::lf_msg_queue_initialization_func_t<MultiProducerConsumer>(max_num_msg, max_msg_size),
+              perm)
+{}
+
+template<bool MultiProducerConsumer>
+inline lockfree_message_queue_t<MultiProducerConsumer>::lockfree_message_queue_t
+   (open_only_t, const char *name)
+   //Create shared memory and execute functor atomically
+   :  m_shmem(open_only,
+              name,
+              read_write,
+              static_cast<void*>(0),
+              //Prepare initialization functor
+              ipcdetail::lf_msg_queue_initialization_func_t<MultiProducerConsumer>())
+{}
+
+template<bool MultiProducerConsumer>
+inline void lockfree_message_queue_t<MultiProducerConsumer>::send
+   (const void *buffer, size_type buffer_size)
+{  this->do_send(blocking, buffer, buffer_size, ptime()); }
+
+template<bool MultiProducerConsumer>
+inline bool lockfree_message_queue_t<MultiProducerConsumer>::try_send
+   (const void *buffer, size_type buffer_size)
+{  return this->do_send(non_blocking, buffer, buffer_size, ptime()); }
+
+template<bool MultiProducerConsumer>
+inline bool lockfree_message_queue_t<MultiProducerConsumer>::timed_send
+   (const void *buffer, size_type buffer_size, const boost::posix_time::ptime &abs_time)
+{
+   if(abs_time == boost::posix_time::pos_infin){
+      this->send(buffer, buffer_size);
+      return true;
+   }
+   return this->do_send(timed, buffer, buffer_size, abs_time);
+}
+
+template<bool MultiProducerConsumer>
+inline bool lockfree_message_queue_t<MultiProducerConsumer>::do_send
+   (block_t block, const void *buffer, size_type buffer_size, const boost::posix_time::ptime &abs_time)
+{
+   typedef ipcdetail::lf_mq_hdr_t<MultiProducerConsumer> hdr_t;
+   hdr_t *p_hdr = static_cast<hdr_t*>(m_shmem.get_user_address());
+   //Check if buffer is smaller than maximum allowed
+   if (buffer_size > p_hdr->m_max_msg_size) {
+      throw interprocess_exception(size_error);
+   }
+
+   if(!p_hdr->try_push(buffer, buffer_size)){
+      if(block == non_blocking ||
+         !hdr_t::wait_and_retry( ipcdetail::lf_mq_push_op<MultiProducerConsumer>(*p_hdr, buffer, buffer_size)
+                               , p_hdr->m_send_event, p_hdr->m_send_waiters, block == timed, abs_time)){
+         return false;
+      }
+   }
+   //Wake a receiver blocked on an empty queue
+   hdr_t::notify(p_hdr->m_recv_event, p_hdr->m_recv_waiters);
+   return true;
+}
+
+template<bool MultiProducerConsumer>
+inline void lockfree_message_queue_t<MultiProducerConsumer>::receive
+   (void *buffer, size_type buffer_size, size_type &recvd_size)
+{  this->do_receive(blocking, buffer, buffer_size, recvd_size, ptime()); }
+
+template<bool MultiProducerConsumer>
+inline bool lockfree_message_queue_t<MultiProducerConsumer>::try_receive
+   (void *buffer, size_type buffer_size, size_type &recvd_size)
+{  return this->do_receive(non_blocking, buffer, buffer_size, recvd_size, ptime()); }
+
+template<bool MultiProducerConsumer>
+inline bool lockfree_message_queue_t<MultiProducerConsumer>::timed_receive
+   (void *buffer, size_type buffer_size, size_type &recvd_size,
+    const boost::posix_time::ptime &abs_time)
+{
+   if(abs_time == boost::posix_time::pos_infin){
+      this->receive(buffer, buffer_size, recvd_size);
+      return true;
+   }
+   return this->do_receive(timed, buffer, buffer_size, recvd_size, abs_time);
+}
+
+template<bool MultiProducerConsumer>
+inline bool lockfree_message_queue_t<MultiProducerConsumer>::do_receive
+   (block_t block, void *buffer, size_type buffer_size, size_type &recvd_size,
+    const boost::posix_time::ptime &abs_time)
+{
+   typedef ipcdetail::lf_mq_hdr_t<MultiProducerConsumer> hdr_t;
+   hdr_t *p_hdr = static_cast<hdr_t*>(m_shmem.get_user_address());
+   //Check if buffer is big enough for any message
+   if (buffer_size < p_hdr->m_max_msg_size) {
+      throw interprocess_exception(size_error);
+   }
+
+   if(!p_hdr->try_pop(buffer, recvd_size)){
+      if(block == non_blocking ||
+         !hdr_t::wait_and_retry( ipcdetail::lf_mq_pop_op<MultiProducerConsumer>(*p_hdr, buffer, recvd_size)
+                               , p_hdr->m_recv_event, p_hdr->m_recv_waiters, block == timed, abs_time)){
+         return false;
+      }
+   }
+   //Wake a sender blocked on a full queue
+   hdr_t::notify(p_hdr->m_send_event, p_hdr->m_send_waiters);
+   return true;
+}
+
+template<bool MultiProducerConsumer>
+inline typename lockfree_message_queue_t<MultiProducerConsumer>::size_type
+   lockfree_message_queue_t<MultiProducerConsumer>::get_max_msg() const
+{
+   ipcdetail::lf_mq_hdr_t<MultiProducerConsumer> *p_hdr =
+      static_cast<ipcdetail::lf_mq_hdr_t<MultiProducerConsumer>*>(m_shmem.get_user_address());
+   return p_hdr ? p_hdr->m_capacity : 0;
+}
+
+template<bool MultiProducerConsumer>
+inline typename lockfree_message_queue_t<MultiProducerConsumer>::size_type
+   lockfree_message_queue_t<MultiProducerConsumer>::get_max_msg_size() const
+{
+   ipcdetail::lf_mq_hdr_t<MultiProducerConsumer> *p_hdr =
+      static_cast<ipcdetail::lf_mq_hdr_t<MultiProducerConsumer>*>(m_shmem.get_user_address());
+   return p_hdr ? p_hdr->m_max_msg_size : 0;
+}
+
+template<bool MultiProducerConsumer>
+inline typename lockfree_message_queue_t<MultiProducerConsumer>::size_type
+   lockfree_message_queue_t<MultiProducerConsumer>::get_num_msg() const
+{
+   ipcdetail::lf_mq_hdr_t<MultiProducerConsumer> *p_hdr =
+      static_cast<ipcdetail::lf_mq_hdr_t<MultiProducerConsumer>*>(m_shmem.get_user_address());
+   return p_hdr ? p_hdr->get_num_msg() : 0;
+}
+
+template<bool MultiProducerConsumer>
+inline bool lockfree_message_queue_t<MultiProducerConsumer>::remove(const char *name)
+{  return shared_memory_object::remove(name);  }
+
+/// @endcond
+
+}} //namespace boost{  namespace interprocess{
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_INTERPROCESS_LOCKFREE_MESSAGE_QUEUE_HPP
@@ -87,9 +87,10 @@ class basic_managed_mapped_file
    //!Creates mapped file and creates and places the segment manager.
    //!This can throw.
    basic_managed_mapped_file(create_only_t, const char *name,
-                             size_type size, const void *addr = 0, const permissions &perm = permissions())
+                             size_type size, const void *addr = 0, const permissions &perm = permissions(),
+                             map_options_t map_options = default_map_options)
       : m_mfile(create_only, name, size, read_write, addr,
-                create_open_func_t(get_this_pointer(), ipcdetail::DoCreate), perm)
+                create_open_func_t(get_this_pointer(), ipcdetail::DoCreate), perm, map_options)
    {}
 
    //!Creates mapped file and creates and places the segment manager if
@@ -98,39 +99,43 @@ class basic_managed_mapped_file
    //!This can throw.
    basic_managed_mapped_file (open_or_create_t,
                               const char *name, size_type size,
-                              const void *addr = 0, const permissions &perm = permissions())
+                              const void *addr = 0, const permissions &perm = permissions(),
+                              map_options_t map_options = default_map_options)
       : m_mfile(open_or_create, name, size, read_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpenOrCreate), perm)
+                ipcdetail::DoOpenOrCreate), perm, map_options)
    {}
 
    //!Connects to a created mapped file and its segment manager.
    //!This can throw.
    basic_managed_mapped_file (open_only_t, const char* name,
-                              const void *addr = 0)
+                              const void *addr = 0,
+                              map_options_t map_options = default_map_options)
       : m_mfile(open_only, name, read_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Connects to a created mapped file and its segment manager
    //!in copy_on_write mode.
    //!This can throw.
    basic_managed_mapped_file (open_copy_on_write_t, const char* name,
-                              const void *addr = 0)
+                              const void *addr = 0,
+                              map_options_t map_options = default_map_options)
       : m_mfile(open_only, name, copy_on_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Connects to a created mapped file and its segment manager
    //!in read-only mode.
    //!This can throw.
    basic_managed_mapped_file (open_read_only_t, const char* name,
-                              const void *addr = 0)
+                              const void *addr = 0,
+                              map_options_t map_options = default_map_options)
       : m_mfile(open_only, name, read_only, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Moves the ownership of "moved"'s managed memory to *this.
@@ -171,6 +176,26 @@ class basic_managed_mapped_file
    bool flush()
    {  return m_mfile.flush();  }
 
+   //!Advises the OS on the expected use of the whole segment.
+   //!See mapped_region::advise(). Never throws.
+   bool advise(mapped_region::advice_types advice)
+   {  return m_mfile.advise(advice);  }
+
+   //!Locks the pages of the segment in physical memory.
+   //!See mapped_region::lock(). Never throws.
+   bool lock()
+   {  return m_mfile.lock();  }
+
+   //!Unlocks the pages locked with lock().
+   //!Never throws.
+   bool unlock()
+   {  return m_mfile.unlock();  }
+
+   //!Faults in all the pages of the segment.
+   //!See mapped_region::prefault(). Never throws.
+   bool prefault()
+   {  return m_mfile.prefault();  }
+
    //!Tries to resize mapped file so that we have room for
    //!more objects.
    //!
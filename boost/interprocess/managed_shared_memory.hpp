@@ -96,10 +96,11 @@ class basic_managed_shared_memory
    //!Creates shared memory and creates and places the segment manager.
    //!This can throw.
    basic_managed_shared_memory(create_only_t, const char *name,
-                             size_type size, const void *addr = 0, const permissions& perm = permissions())
+                             size_type size, const void *addr = 0, const permissions& perm = permissions(),
+                             map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(create_only, name, size, read_write, addr,
-                create_open_func_t(get_this_pointer(), ipcdetail::DoCreate), perm)
+                create_open_func_t(get_this_pointer(), ipcdetail::DoCreate), perm, map_options)
    {}
 
    //!Creates shared memory and creates and places the segment manager if
@@ -108,43 +109,47 @@ class basic_managed_shared_memory
    //!This can throw.
    basic_managed_shared_memory (open_or_create_t,
                               const char *name, size_type size,
-                              const void *addr = 0, const permissions& perm = permissions())
+                              const void *addr = 0, const permissions& perm = permissions(),
+                              map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(open_or_create, name, size, read_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpenOrCreate), perm)
+                ipcdetail::DoOpenOrCreate), perm, map_options)
    {}
 
    //!Connects to a created shared memory and its segment manager.
    //!in copy_on_write mode.
    //!This can throw.
    basic_managed_shared_memory (open_copy_on_write_t, const char* name,
-                                const void *addr = 0)
+                                const void *addr = 0,
+                                map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(open_only, name, copy_on_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Connects to a created shared memory and its segment manager.
    //!in read-only mode.
    //!This can throw.
    basic_managed_shared_memory (open_read_only_t, const char* name,
-                                const void *addr = 0)
+                                const void *addr = 0,
+                                map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(open_only, name, read_only, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Connects to a created shared memory and its segment manager.
    //!This can throw.
    basic_managed_shared_memory (open_only_t, const char* name,
-                                const void *addr = 0)
+                                const void *addr = 0,
+                                map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(open_only, name, read_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Moves the ownership of "moved"'s managed memory to *this.
@@ -173,6 +178,26 @@ class basic_managed_shared_memory
       base2_t::swap(other);
    }
 
+   //!Advises the OS on the expected use of the whole segment.
+   //!See mapped_region::advise(). Never throws.
+   bool advise(mapped_region::advice_types advice)
+   {  return base2_t::advise(advice);  }
+
+   //!Locks the pages of the segment in physical memory.
+   //!See mapped_region::lock(). Never throws.
+   bool lock()
+   {  return base2_t::lock();  }
+
+   //!Unlocks the pages locked with lock().
+   //!Never throws.
+   bool unlock()
+   {  return base2_t::unlock();  }
+
+   //!Faults in all the pages of the segment.
+   //!See mapped_region::prefault(). Never throws.
+   bool prefault()
+   {  return base2_t::prefault();  }
+
    //!Tries to resize the managed shared memory object so that we have
    //!room for more objects.
    //!
@@ -92,9 +92,10 @@ class basic_managed_windows_shared_memory
    //!This can throw.
    basic_managed_windows_shared_memory
       (create_only_t, const char *name,
-     size_type size, const void *addr = 0, const permissions &perm = permissions())
+     size_type size, const void *addr = 0, const permissions &perm = permissions(),
+     map_options_t map_options = default_map_options)
       : m_wshm(create_only, name, size, read_write, addr,
-                create_open_func_t(get_this_pointer(), ipcdetail::DoCreate), perm)
+                create_open_func_t(get_this_pointer(), ipcdetail::DoCreate), perm, map_options)
    {}
 
    //!Creates shared memory and creates and places the segment manager if
@@ -105,38 +106,42 @@ class basic_managed_windows_shared_memory
       (open_or_create_t,
       const char *name, size_type size,
       const void *addr = 0,
-      const permissions &perm = permissions())
+      const permissions &perm = permissions(),
+      map_options_t map_options = default_map_options)
       : m_wshm(open_or_create, name, size, read_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpenOrCreate), perm)
+                ipcdetail::DoOpenOrCreate), perm, map_options)
    {}
 
    //!Connects to a created shared memory and its segment manager.
    //!This can throw.
    basic_managed_windows_shared_memory
-      (open_only_t, const char* name, const void *addr = 0)
+      (open_only_t, const char* name, const void *addr = 0,
+       map_options_t map_options = default_map_options)
       : m_wshm(open_only, name, read_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Connects to a created shared memory and its segment manager
    //!in copy_on_write mode.
    //!This can throw.
    basic_managed_windows_shared_memory
-      (open_copy_on_write_t, const char* name, const void *addr = 0)
+      (open_copy_on_write_t, const char* name, const void *addr = 0,
+       map_options_t map_options = default_map_options)
       : m_wshm(open_only, name, copy_on_write, addr,
-                create_open_func_t(get_this_pointer(), ipcdetail::DoOpen))
+                create_open_func_t(get_this_pointer(), ipcdetail::DoOpen), map_options)
    {}
 
    //!Connects to a created shared memory and its segment manager
    //!in read-only mode.
    //!This can throw.
    basic_managed_windows_shared_memory
-      (open_read_only_t, const char* name, const void *addr = 0)
+      (open_read_only_t, const char* name, const void *addr = 0,
+       map_options_t map_options = default_map_options)
       : base_t()
       , m_wshm(open_only, name, read_only, addr,
-                create_open_func_t(get_this_pointer(), ipcdetail::DoOpen))
+                create_open_func_t(get_this_pointer(), ipcdetail::DoOpen), map_options)
    {}
 
    //!Moves the ownership of "moved"'s managed memory to *this.
@@ -170,6 +175,26 @@ class basic_managed_windows_shared_memory
       m_wshm.swap(other.m_wshm);
    }
 
+   //!Advises the OS on the expected use of the whole segment.
+   //!See mapped_region::advise(). Never throws.
+   bool advise(mapped_region::advice_types advice)
+   {  return m_wshm.advise(advice);  }
+
+   //!Locks the pages of the segment in physical memory.
+   //!See mapped_region::lock(). Never throws.
+   bool lock()
+   {  return m_wshm.lock();  }
+
+   //!Unlocks the pages locked with lock().
+   //!Never throws.
+   bool unlock()
+   {  return m_wshm.unlock();  }
+
+   //!Faults in all the pages of the segment.
+   //!See mapped_region::prefault(). Never throws.
+   bool prefault()
+   {  return m_wshm.prefault();  }
+
    /// @cond
 
    //!Tries to find a previous named allocation address. Returns a memory
@@ -102,10 +102,11 @@ class basic_managed_xsi_shared_memory
    //!Creates shared memory and creates and places the segment manager.
    //!This can throw.
    basic_managed_xsi_shared_memory(create_only_t, const xsi_key &key,
-                             std::size_t size, const void *addr = 0, const permissions& perm = permissions())
+                             std::size_t size, const void *addr = 0, const permissions& perm = permissions(),
+                             map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(create_only, key, size, read_write, addr,
-                create_open_func_t(get_this_pointer(), ipcdetail::DoCreate), perm)
+                create_open_func_t(get_this_pointer(), ipcdetail::DoCreate), perm, map_options)
    {}
 
    //!Creates shared memory and creates and places the segment manager if
@@ -114,32 +115,35 @@ class basic_managed_xsi_shared_memory
    //!This can throw.
    basic_managed_xsi_shared_memory (open_or_create_t,
                               const xsi_key &key, std::size_t size,
-                              const void *addr = 0, const permissions& perm = permissions())
+                              const void *addr = 0, const permissions& perm = permissions(),
+                              map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(open_or_create, key, size, read_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpenOrCreate), perm)
+                ipcdetail::DoOpenOrCreate), perm, map_options)
    {}
 
    //!Connects to a created shared memory and its segment manager.
    //!in read-only mode.
    //!This can throw.
    basic_managed_xsi_shared_memory (open_read_only_t, const xsi_key &key,
-                                const void *addr = 0)
+                                const void *addr = 0,
+                                map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(open_only, key, read_only, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Connects to a created shared memory and its segment manager.
    //!This can throw.
    basic_managed_xsi_shared_memory (open_only_t, const xsi_key &key,
-                                const void *addr = 0)
+                                const void *addr = 0,
+                                map_options_t map_options = default_map_options)
       : base_t()
       , base2_t(open_only, key, read_write, addr,
                 create_open_func_t(get_this_pointer(),
-                ipcdetail::DoOpen))
+                ipcdetail::DoOpen), map_options)
    {}
 
    //!Moves the ownership of "moved"'s managed memory to *this.
@@ -168,6 +172,26 @@ class basic_managed_xsi_shared_memory
       base2_t::swap(other);
    }
 
+   //!Advises the OS on the expected use of the whole segment.
+   //!See mapped_region::advise(). Never throws.
+   bool advise(mapped_region::advice_types advice)
+   {  return base2_t::advise(advice);  }
+
+   //!Locks the pages of the segment in physical memory.
+   //!See mapped_region::lock(). Never throws.
+   bool lock()
+   {  return base2_t::lock();  }
+
+   //!Unlocks the pages locked with lock().
+   //!Never throws.
+   bool unlock()
+   {  return base2_t::unlock();  }
+
+   //!Faults in all the pages of the segment.
+   //!See mapped_region::prefault(). Never throws.
+   bool prefault()
+   {  return base2_t::prefault();  }
+
    //!Erases a XSI shared memory object identified by shmid
    //!from the system.
    //!Returns false on error. Never throws
@@ -71,6 +71,25 @@ extern "C" int madvise(caddr_t, size_t, int);
 
 namespace ipcdetail{ class interprocess_tester; }
 namespace ipcdetail{ class raw_mapped_region_creator; }
+namespace ipcdetail{ class file_wrapper; }
+
+namespace ipcdetail{
+
+//!Mappings of these classes are backed by a file of the filesystem
+//!instead of by memory.
+template<class MemoryMappable>
+struct is_file_mappable
+{  static const bool value = false;  };
+
+template<>
+struct is_file_mappable<file_mapping>
+{  static const bool value = true;  };
+
+template<>
+struct is_file_mappable<file_wrapper>
+{  static const bool value = true;  };
+
+}  //namespace ipcdetail{
 
 /// @endcond
 
@@ -137,7 +156,7 @@ class mapped_region
    ,  m_mode(read_only)
    ,  m_file_or_mapping_hnd(ipcdetail::invalid_file())
    #else
-   :  m_base(0), m_size(0), m_page_offset(0), m_mode(read_only), m_is_xsi(false)
+   :  m_base(0), m_size(0), m_page_offset(0), m_mode(read_only), m_is_xsi(false), m_is_file(false)
    #endif
    {  this->swap(other);   }
 
@@ -202,7 +221,12 @@ class mapped_region
       advice_willneed,
       //!Specifies that the application expects that it will not access the region in the near future.
       //!The implementation can unload pages within the range to save system resources.
-      advice_dontneed
+      advice_dontneed,
+      //!Specifies that the implementation should back the region with huge pages when possible
+      //!(e.g. transparent huge pages in Linux) to reduce TLB misses.
+      advice_hugepage,
+      //!Specifies that the implementation should not back the region with huge pages.
+      advice_nohugepage
    };
 
    //!Advises the implementation on the expected behavior of the application with respect to the data
@@ -212,6 +236,25 @@ class mapped_region
    //!If the advise type is not known to the implementation, the function returns false. True otherwise.
    bool advise(advice_types advise);
 
+   //!Locks in physical memory the pages of a byte range within the mapped memory, so that
+   //!accessing them never triggers a page fault. If "numbytes" is 0, the range
+   //!extends to the end of the region. The OS might limit the amount of memory a process can lock.
+   //!Never throws. Returns false if operation could not be performed.
+   bool lock(std::size_t mapping_offset = 0, std::size_t numbytes = 0);
+
+   //!Unlocks the pages of a byte range previously locked with lock().
+   //!If "numbytes" is 0, the range extends to the end of the region.
+   //!Never throws. Returns false if operation could not be performed.
+   bool unlock(std::size_t mapping_offset = 0, std::size_t numbytes = 0);
+
+   //!Faults in the pages of a byte range within the mapped memory, so that the first access
+   //!to them doesn't trigger a major page fault. If "numbytes" is 0, the range extends to
+   //!the end of the region. Writable shared memory is populated for writing, pages
+   //!of mapped files are only read in so that they are not dirtied. If the OS has no
+   //!direct support for this operation, pages are read (but never written) one by one.
+   //!Never throws. Returns false if operation could not be performed.
+   bool prefault(std::size_t mapping_offset = 0, std::size_t numbytes = 0);
+
    //!Returns the size of the page. This size is the minimum memory that
    //!will be used by the system when mapping a memory mappable source and
    //!will restrict the address and the offset to map.
@@ -229,6 +272,7 @@ class mapped_region
    static void priv_size_from_mapping_size
       (offset_t mapping_size, offset_t offset, offset_t page_offset, std::size_t &size);
    static offset_t priv_page_offset_addr_fixup(offset_t page_offset, const void *&addr);
+   static void priv_touch_pages(const void *addr, std::size_t numbytes, std::size_t page_size);
 
    template<int dummy>
    struct page_size_holder
@@ -245,6 +289,7 @@ class mapped_region
    file_handle_t     m_file_or_mapping_hnd;
    #else
    bool              m_is_xsi;
+   bool              m_is_file;
    #endif
 
    friend class ipcdetail::interprocess_tester;
@@ -363,6 +408,20 @@ inline offset_t mapped_region::priv_page_offset_addr_fixup(offset_t offset, cons
    return page_offset;
 }
 
+inline void mapped_region::priv_touch_pages(const void *addr, std::size_t numbytes, std::size_t page_size)
+{
+   //Read a byte of every page. Writing would be faster for writable regions
+   //but it would dirty all the pages of mapped files.
+   const volatile char *p   = static_cast<const volatile char*>(addr);
+   const volatile char *end = p + numbytes;
+   for(; p < end; p += page_size){
+      (void)*p;
+   }
+   if(numbytes){
+      (void)end[-1];
+   }
+}
+
 #if defined (BOOST_INTERPROCESS_WINDOWS)
 
 inline mapped_region::mapped_region()
@@ -542,6 +601,38 @@ inline bool mapped_region::advise(advice_types)
    return false;
 }
 
+inline bool mapped_region::lock(std::size_t mapping_offset, std::size_t numbytes)
+{
+   void *addr;
+   if(!this->priv_flush_param_check(mapping_offset, addr, numbytes)){
+      return false;
+   }
+   return winapi::virtual_lock(addr, numbytes);
+}
+
+inline bool mapped_region::unlock(std::size_t mapping_offset, std::size_t numbytes)
+{
+   void *addr;
+   if(!this->priv_flush_param_check(mapping_offset, addr, numbytes)){
+      return false;
+   }
+   return winapi::virtual_unlock(addr, numbytes);
+}
+
+inline bool mapped_region::prefault(std::size_t mapping_offset, std::size_t numbytes)
+{
+   void *addr;
+   if(!this->priv_flush_param_check(mapping_offset, addr, numbytes)){
+      return false;
+   }
+   //The allocation granularity returned by get_page_size()
+   //is bigger than the page size, so ask for the real one.
+   winapi::system_info info;
+   get_system_info(&info);
+   priv_touch_pages(addr, numbytes, std::size_t(info.dwPageSize));
+   return true;
+}
+
 inline void mapped_region::priv_close()
 {
    if(m_base){
@@ -564,7 +655,7 @@ inline void mapped_region::dont_close_on_destruction()
 #else    //#if (defined BOOST_INTERPROCESS_WINDOWS)
 
 inline mapped_region::mapped_region()
-   :  m_base(0), m_size(0), m_page_offset(0), m_mode(read_only), m_is_xsi(false)
+   :  m_base(0), m_size(0), m_page_offset(0), m_mode(read_only), m_is_xsi(false), m_is_file(false)
 {}
 
 template<int dummy>
@@ -580,6 +671,7 @@ inline mapped_region::mapped_region
    , const void *address
    , map_options_t map_options)
    : m_base(0), m_size(0), m_page_offset(0), m_mode(mode), m_is_xsi(false)
+   , m_is_file(ipcdetail::is_file_mappable<MemoryMappable>::value)
 {
    mapping_handle_t map_hnd = mapping.get_mapping_handle();
 
@@ -789,6 +881,19 @@ inline bool mapped_region::advise(advice_types advice)
          mode = mode_madv;
          #endif
       break;
+      //Huge page advices have no POSIX equivalent
+      case advice_hugepage:
+         #if defined(MADV_HUGEPAGE)
+         unix_advice = MADV_HUGEPAGE;
+         mode = mode_madv;
+         #endif
+      break;
+      case advice_nohugepage:
+         #if defined(MADV_NOHUGEPAGE)
+         unix_advice = MADV_NOHUGEPAGE;
+         mode = mode_madv;
+         #endif
+      break;
       default:
       return false;
    }
@@ -811,6 +916,48 @@ inline bool mapped_region::advise(advice_types advice)
    }
 }
 
+inline bool mapped_region::lock(std::size_t mapping_offset, std::size_t numbytes)
+{
+   void *addr;
+   if(!this->priv_flush_param_check(mapping_offset, addr, numbytes)){
+      return false;
+   }
+   return 0 == mlock(addr, numbytes);
+}
+
+inline bool mapped_region::unlock(std::size_t mapping_offset, std::size_t numbytes)
+{
+   void *addr;
+   if(!this->priv_flush_param_check(mapping_offset, addr, numbytes)){
+      return false;
+   }
+   return 0 == munlock(addr, numbytes);
+}
+
+inline bool mapped_region::prefault(std::size_t mapping_offset, std::size_t numbytes)
+{
+   void *addr;
+   if(!this->priv_flush_param_check(mapping_offset, addr, numbytes)){
+      return false;
+   }
+   #if defined(MADV_POPULATE_READ) && defined(MADV_POPULATE_WRITE)
+   //Populate writable shared and anonymous memory for writing so that the
+   //first write doesn't trigger a fault. Files are populated for reading:
+   //populating them for writing would mark every page dirty and the whole
+   //range would be written back. Private mappings are also populated for
+   //reading, as populating them for writing would copy all the pages.
+   const int populate = (m_mode == read_write && !m_is_file) ? MADV_POPULATE_WRITE : MADV_POPULATE_READ;
+   //madvise needs a page aligned address
+   const std::size_t misalignment = reinterpret_cast<std::size_t>(addr) % mapped_region::get_page_size();
+   if(0 == madvise(static_cast<char*>(addr) - misalignment, numbytes + misalignment, populate)){
+      return true;
+   }
+   //The running kernel might not support it, fallback to touching pages
+   #endif
+   priv_touch_pages(addr, numbytes, mapped_region::get_page_size());
+   return true;
+}
+
 inline void mapped_region::priv_close()
 {
    if(m_base != 0){
@@ -854,6 +1001,7 @@ inline void mapped_region::swap(mapped_region &other)
    ipcdetail::do_swap(this->m_file_or_mapping_hnd, other.m_file_or_mapping_hnd);
    #else
    ipcdetail::do_swap(this->m_is_xsi, other.m_is_xsi);
+   ipcdetail::do_swap(this->m_is_file, other.m_is_file);
    #endif
 }
 
@@ -849,17 +849,25 @@ class segment_manager
       typedef IndexType<ipcdetail::index_config<CharT, MemoryAlgorithm> >         index_type;
       typedef typename index_type::iterator           index_it;
 
+      ipcdetail::intrusive_compare_key<CharT> key
+         (name, std::char_traits<CharT>::length(name));
+
+      //Indexes with lock-free reads are searched first without taking the lock
+      void *ret_ptr;
+      if(use_lock && this->priv_lockfree_find
+            (key, index, table, length, ret_ptr, ipcdetail::bool_<is_lockfree_read_index<index_type>::value>())){
+         return ret_ptr;
+      }
+
       //-------------------------------
       scoped_lock<rmutex> guard(priv_get_lock(use_lock));
       //-------------------------------
       //Find name in index
-      ipcdetail::intrusive_compare_key<CharT> key
-         (name, std::char_traits<CharT>::length(name));
       index_it it = index.find(key);
 
       //Initialize return values
-      void *ret_ptr  = 0;
-      length         = 0;
+      ret_ptr  = 0;
+      length   = 0;
 
       //If found, assign values
       if(it != index.end()){
@@ -875,6 +883,37 @@ class segment_manager
       return ret_ptr;
    }
 
+   template <class CharT>
+   bool priv_lockfree_find
+      (const ipcdetail::intrusive_compare_key<CharT> &key,
+       IndexType<ipcdetail::index_config<CharT, MemoryAlgorithm> > &index,
+       ipcdetail::in_place_interface &table,
+       size_type &length,
+       void *&ret_ptr,
+       ipcdetail::true_ is_lockfree_read)
+   {
+      (void)is_lockfree_read;
+      size_type value_bytes;
+      if(!index.lockfree_find(key, ret_ptr, value_bytes)){
+         return false;
+      }
+      length = value_bytes/table.size;
+      return true;
+   }
+
+   template <class CharT>
+   bool priv_lockfree_find
+      (const ipcdetail::intrusive_compare_key<CharT> &,
+       IndexType<ipcdetail::index_config<CharT, MemoryAlgorithm> > &,
+       ipcdetail::in_place_interface &,
+       size_type &,
+       void *&,
+       ipcdetail::false_ is_lockfree_read)
+   {
+      (void)is_lockfree_read;
+      return false;
+   }
+
    template <class CharT>
    void *priv_generic_find
       (const CharT* name,
@@ -986,10 +1025,27 @@ class segment_manager
       //Call destructors and free memory
       std::size_t destroyed;
       table.destroy_n(values, num, destroyed);
-      this->deallocate(memory);
+      this->priv_deallocate_erased
+         (index, memory, ipcdetail::bool_<is_lockfree_read_index<index_type>::value>());
       return true;
    }
 
+   //Lock-free searches can still be reading the header of
+   //an erased value, the index defers the deallocation
+   template<class Index>
+   void priv_deallocate_erased(Index &index, void *memory, ipcdetail::true_ is_lockfree_read)
+   {
+      (void)is_lockfree_read;
+      index.retire(memory);
+   }
+
+   template<class Index>
+   void priv_deallocate_erased(Index &, void *memory, ipcdetail::false_ is_lockfree_read)
+   {
+      (void)is_lockfree_read;
+      this->deallocate(memory);
+   }
+
    template <class CharT>
    bool priv_generic_named_destroy(const CharT *name,
                                    IndexType<ipcdetail::index_config<CharT, MemoryAlgorithm> > &index,
@@ -1190,9 +1246,22 @@ class segment_manager
       //Release rollbacks since construction was successful
       v_eraser.release();
       mem.release();
+      //The object can now be found by lock-free searches
+      this->priv_publish(index, it, ipcdetail::bool_<is_lockfree_read_index<index_type>::value>());
       return ptr;
    }
 
+   template<class Index>
+   void priv_publish(Index &index, const typename Index::iterator &it, ipcdetail::true_ is_lockfree_read)
+   {
+      (void)is_lockfree_read;
+      index.publish(it);
+   }
+
+   template<class Index>
+   void priv_publish(Index &, const typename Index::iterator &, ipcdetail::false_ is_lockfree_read)
+   {  (void)is_lockfree_read;  }
+
    //!Generic named new function for
    //!named functions
    template<class CharT>
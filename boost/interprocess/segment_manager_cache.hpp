@@ -0,0 +1,230 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_SEGMENT_MANAGER_CACHE_HPP
+#define BOOST_INTERPROCESS_SEGMENT_MANAGER_CACHE_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+
+#include <boost/interprocess/interprocess_fwd.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/sync/null_mutex.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+#include <boost/interprocess/detail/utilities.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>   //std::size_t
+#include <new>       //std::nothrow
+
+//!\file
+//!Describes a process-local cache of small blocks placed in front of
+//!the allocation functions of a segment manager.
+
+namespace boost {
+namespace interprocess {
+
+//!segment_manager_cache is a front-end for the raw allocation functions of a
+//!segment manager. It keeps, in process-local memory, lists of free blocks
+//!classified by size. Small blocks are obtained from the memory algorithm in
+//!batches with a single allocate_many() call and returned in batches with a
+//!single deallocate_many() call, so that the lock of the memory algorithm,
+//!shared by all processes using the segment, is taken once per batch instead
+//!of once per allocation.
+//!
+//!Blocks obtained from the cache are ordinary blocks of the segment: they can
+//!be deallocated by any process, either through its own cache or directly
+//!through the segment manager.
+//!
+//!The cache is intended to be owned by a single thread. If "Mutex" is not
+//!null_mutex (e.g. interprocess_mutex), the cache can be shared by all the
+//!threads of a process. The cache itself must not be placed in shared memory.
+//!
+//!Requests bigger than "MaxCachedSize" bytes are forwarded to the segment manager.
+template<class SegmentManager, class Mutex = null_mutex, std::size_t MaxCachedSize = 512>
+class segment_manager_cache
+{
+   /// @cond
+   //Non-copyable
+   segment_manager_cache(const segment_manager_cache &);
+   segment_manager_cache &operator=(const segment_manager_cache &);
+
+   typedef typename SegmentManager::memory_algorithm     memory_algorithm;
+   typedef typename SegmentManager::multiallocation_chain multiallocation_chain;
+   /// @endcond
+
+   public:
+   typedef SegmentManager                       segment_manager;
+   typedef typename SegmentManager::size_type   size_type;
+   typedef Mutex                                mutex_type;
+
+   //!Size classes are multiples of the alignment of the memory algorithm
+   static const size_type Granularity = memory_algorithm::Alignment;
+
+   //!Number of size classes
+   static const size_type NumSizeClasses =
+      ipcdetail::ct_rounded_size<MaxCachedSize, Granularity>::value/Granularity;
+
+   //!Default number of blocks obtained from the segment in each refill
+   static const size_type DefaultBatchSize = 32u;
+
+   /// @cond
+   BOOST_STATIC_ASSERT((NumSizeClasses != 0));
+   /// @endcond
+
+   //!Constructs a cache for the segment managed by "segment_mngr". "batch_size"
+   //!blocks are obtained from the segment when a size class is empty and a size
+   //!class never holds more than 2*"batch_size" blocks. Never throws
+   explicit segment_manager_cache(segment_manager *segment_mngr,
+                                  size_type batch_size = DefaultBatchSize)
+      :  mp_segment_mngr(segment_mngr), m_batch_size(batch_size ? batch_size : 1u)
+   {}
+
+   //!Returns all cached blocks to the segment. Never throws
+   ~segment_manager_cache()
+   {  this->flush();  }
+
+   //!Allocates nbytes bytes. Throws boost::interprocess::bad_alloc
+   //!on failure
+   void * allocate(size_type nbytes)
+   {
+      void *ret = this->allocate(nbytes, std::nothrow);
+      if(!ret)
+         throw bad_alloc();
+      return ret;
+   }
+
+   //!Allocates nbytes bytes. Returns 0 on failure. Never throws
+   void * allocate(size_type nbytes, std::nothrow_t)
+   {
+      if(nbytes > MaxCachedSize){
+         return mp_segment_mngr->allocate(nbytes, std::nothrow);
+      }
+      const size_type size_class = priv_alloc_class(nbytes);
+      {
+         //-----------------------
+         boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+         //-----------------------
+         multiallocation_chain &chain = m_free_blocks[size_class];
+         if(chain.empty()){
+            //Obtain a batch of blocks from the segment taking the lock once
+            mp_segment_mngr->allocate_many
+               (std::nothrow, priv_class_bytes(size_class), m_batch_size, chain);
+         }
+         if(!chain.empty()){
+            return ipcdetail::to_raw_pointer(chain.pop_front());
+         }
+      }
+      //The segment could not provide a whole batch: give back
+      //cached blocks and try a single allocation
+      this->flush();
+      return mp_segment_mngr->allocate(nbytes, std::nothrow);
+   }
+
+   //!Deallocates the bytes pointed by addr, that must have been allocated from
+   //!the same segment (using a cache or not). Never throws
+   void deallocate(void *addr)
+   {
+      if(!addr) return;
+      //The size of a block never changes while it's allocated, so
+      //it can be obtained without locking the memory algorithm
+      const size_type block_size = mp_segment_mngr->size(addr);
+      if(block_size < Granularity || block_size/Granularity > NumSizeClasses){
+         mp_segment_mngr->deallocate(addr);
+         return;
+      }
+      //The block is stored in the biggest class it can hold
+      const size_type size_class = block_size/Granularity - 1u;
+      multiallocation_chain extra;
+      {
+         //-----------------------
+         boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+         //-----------------------
+         multiallocation_chain &chain = m_free_blocks[size_class];
+         chain.push_front(addr);
+         if(chain.size() >= 2u*m_batch_size){
+            //Keep the most recently freed blocks and return
+            //the rest to the segment in a single call
+            typename multiallocation_chain::iterator it(chain.before_begin());
+            for(size_type i = 0; i != m_batch_size; ++i){
+               ++it;
+            }
+            extra.splice_after(extra.before_begin(), chain, it, chain.last(), chain.size() - m_batch_size);
+         }
+      }
+      if(!extra.empty()){
+         mp_segment_mngr->deallocate_many(extra);
+      }
+   }
+
+   //!Returns all cached blocks to the segment. Never throws
+   void flush()
+   {
+      multiallocation_chain chain;
+      {
+         //-----------------------
+         boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+         //-----------------------
+         for(size_type i = 0; i != NumSizeClasses; ++i){
+            chain.splice_after(chain.last(), m_free_blocks[i]);
+         }
+      }
+      if(!chain.empty()){
+         mp_segment_mngr->deallocate_many(chain);
+      }
+   }
+
+   //!Returns the number of free blocks held by the cache. Never throws
+   size_type get_num_cached_blocks() const
+   {
+      //-----------------------
+      boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+      //-----------------------
+      size_type n = 0;
+      for(size_type i = 0; i != NumSizeClasses; ++i){
+         n += m_free_blocks[i].size();
+      }
+      return n;
+   }
+
+   //!Returns the number of blocks obtained from the segment in each refill.
+   //!Never throws
+   size_type get_batch_size() const
+   {  return m_batch_size;  }
+
+   //!Returns the segment manager. Never throws
+   segment_manager* get_segment_manager() const
+   {  return mp_segment_mngr;  }
+
+   /// @cond
+   private:
+   static size_type priv_alloc_class(size_type nbytes)
+   {  return nbytes ? (nbytes - 1u)/Granularity : 0u;  }
+
+   static size_type priv_class_bytes(size_type size_class)
+   {  return (size_class + 1u)*Granularity;  }
+
+   segment_manager         *mp_segment_mngr;
+   const size_type         m_batch_size;
+   mutable mutex_type      m_mutex;
+   multiallocation_chain   m_free_blocks[NumSizeClasses];
+   /// @endcond
+};
+
+}  //namespace interprocess {
+}  //namespace boost {
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_INTERPROCESS_SEGMENT_MANAGER_CACHE_HPP
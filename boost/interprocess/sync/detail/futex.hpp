@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_SYNC_DETAIL_FUTEX_HPP
+#define BOOST_INTERPROCESS_SYNC_DETAIL_FUTEX_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+#include <boost/interprocess/detail/atomic.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <boost/interprocess/sync/spin/wait.hpp>
+#include <boost/cstdint.hpp>
+
+#if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <time.h>
+#  include <climits>
+#endif
+
+//!\file
+//!Describes wait/wake primitives on a 32 bit word that can be placed in
+//!shared memory. Uses futexes in Linux and spinning/yielding elsewhere.
+
+namespace boost {
+namespace interprocess {
+namespace ipcdetail {
+
+#if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+
+//Futexes are used in their process-shared form (no FUTEX_PRIVATE_FLAG)
+//as the word is usually placed in shared memory.
+inline int futex_syscall(volatile boost::uint32_t *addr, int op, boost::uint32_t val, const struct timespec *timeout)
+{  return static_cast<int>(::syscall(SYS_futex, const_cast<boost::uint32_t*>(addr), op, val, timeout, 0, 0)); }
+
+//!Blocks the calling thread while "*addr" holds "expected". Spurious
+//!wakeups are possible, so callers must recheck their condition.
+inline void futex_wait(volatile boost::uint32_t *addr, boost::uint32_t expected)
+{  futex_syscall(addr, FUTEX_WAIT, expected, 0);  }
+
+//!Like futex_wait but returns false if "abs_time" is reached before being woken.
+inline bool futex_timed_wait(volatile boost::uint32_t *addr, boost::uint32_t expected, const boost::posix_time::ptime &abs_time)
+{
+   const boost::posix_time::ptime now = microsec_clock::universal_time();
+   if(now >= abs_time){
+      return false;
+   }
+   //FUTEX_WAIT takes a relative timeout
+   const boost::posix_time::time_duration rel = abs_time - now;
+   struct timespec ts;
+   ts.tv_sec  = static_cast<time_t>(rel.total_seconds());
+   ts.tv_nsec = static_cast<long>(rel.total_microseconds() % 1000000)*1000;
+   futex_syscall(addr, FUTEX_WAIT, expected, &ts);
+   return microsec_clock::universal_time() < abs_time;
+}
+
+//!Wakes up to "count" threads blocked in futex_wait on "addr".
+inline void futex_wake(volatile boost::uint32_t *addr, int count = INT_MAX)
+{  futex_syscall(addr, FUTEX_WAKE, static_cast<boost::uint32_t>(count), 0);  }
+
+#else //#if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+
+inline void futex_wait(volatile boost::uint32_t *addr, boost::uint32_t expected)
+{
+   spin_wait swait;
+   while(atomic_read32(addr) == expected){
+      swait.yield();
+   }
+}
+
+inline bool futex_timed_wait(volatile boost::uint32_t *addr, boost::uint32_t expected, const boost::posix_time::ptime &abs_time)
+{
+   spin_wait swait;
+   while(atomic_read32(addr) == expected){
+      if(microsec_clock::universal_time() >= abs_time){
+         return false;
+      }
+      swait.yield();
+   }
+   return true;
+}
+
+inline void futex_wake(volatile boost::uint32_t *, int = 0)
+{}
+
+#endif   //#if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+
+}  //namespace ipcdetail
+}  //namespace interprocess
+}  //namespace boost
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //BOOST_INTERPROCESS_SYNC_DETAIL_FUTEX_HPP
@@ -0,0 +1,177 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_DETAIL_FUTEX_CONDITION_HPP
+#define BOOST_INTERPROCESS_DETAIL_FUTEX_CONDITION_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+#include <boost/interprocess/detail/atomic.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/sync/detail/futex.hpp>
+#include <boost/cstdint.hpp>
+#include <climits>
+
+//!\file
+//!Describes a process-shared condition variable built on a futex word.
+
+namespace boost {
+namespace interprocess {
+namespace ipcdetail {
+
+//!A condition variable that can be placed in shared memory. Waiters sleep
+//!in the kernel on a sequence number that is incremented by each
+//!notification, so notifying a condition without waiters is a single
+//!atomic increment and a read.
+class futex_condition
+{
+   futex_condition(const futex_condition &);
+   futex_condition &operator=(const futex_condition &);
+   public:
+   futex_condition();
+   ~futex_condition();
+
+   void notify_one();
+   void notify_all();
+
+   template <typename L>
+   bool timed_wait(L& lock, const boost::posix_time::ptime &abs_time)
+   {
+      if (!lock)
+         throw lock_exception();
+      //Handle infinity absolute time here to avoid complications in do_timed_wait
+      if(abs_time == boost::posix_time::pos_infin){
+         this->wait(lock);
+         return true;
+      }
+      return this->do_timed_wait(true, abs_time, *lock.mutex());
+   }
+
+   template <typename L, typename Pr>
+   bool timed_wait(L& lock, const boost::posix_time::ptime &abs_time, Pr pred)
+   {
+      if (!lock)
+         throw lock_exception();
+      //Handle infinity absolute time here to avoid complications in do_timed_wait
+      if(abs_time == boost::posix_time::pos_infin){
+         this->wait(lock, pred);
+         return true;
+      }
+      while (!pred()){
+         if (!this->do_timed_wait(true, abs_time, *lock.mutex()))
+            return pred();
+      }
+      return true;
+   }
+
+   template <typename L>
+   void wait(L& lock)
+   {
+      if (!lock)
+         throw lock_exception();
+      this->do_timed_wait(false, boost::posix_time::ptime(), *lock.mutex());
+   }
+
+   template <typename L, typename Pr>
+   void wait(L& lock, Pr pred)
+   {
+      if (!lock)
+         throw lock_exception();
+
+      while (!pred())
+         this->do_timed_wait(false, boost::posix_time::ptime(), *lock.mutex());
+   }
+
+   private:
+   template<class InterprocessMutex>
+   bool do_timed_wait(bool tout_enabled, const boost::posix_time::ptime &abs_time, InterprocessMutex &mut);
+
+   void notify(int count);
+
+   volatile boost::uint32_t    m_seq;
+   volatile boost::uint32_t    m_num_waiters;
+};
+
+inline futex_condition::futex_condition()
+{
+   //Note that this class is initialized to zero.
+   //So zeroed memory can be interpreted as an initialized
+   //condition variable
+   ipcdetail::atomic_write32(&m_seq, 0u);
+   ipcdetail::atomic_write32(&m_num_waiters, 0u);
+}
+
+inline futex_condition::~futex_condition()
+{
+   //Notify all waiting threads
+   //to allow POSIX semantics on condition destruction
+   this->notify_all();
+}
+
+inline void futex_condition::notify_one()
+{
+   this->notify(1);
+}
+
+inline void futex_condition::notify_all()
+{
+   this->notify(INT_MAX);
+}
+
+inline void futex_condition::notify(int count)
+{
+   //Waiters read the sequence before releasing the external mutex, so
+   //those not sleeping yet will see the change and won't block
+   ipcdetail::atomic_inc32(&m_seq);
+   if(ipcdetail::atomic_read32(&m_num_waiters)){
+      ipcdetail::futex_wake(&m_seq, count);
+   }
+}
+
+template<class InterprocessMutex>
+inline bool futex_condition::do_timed_wait(bool tout_enabled,
+                                     const boost::posix_time::ptime &abs_time,
+                                     InterprocessMutex &mut)
+{
+   if(tout_enabled && microsec_clock::universal_time() >= abs_time){
+      return false;
+   }
+   //The sequence is read and the thread is marked as waiting
+   //while the external mutex is still locked
+   const boost::uint32_t seq = ipcdetail::atomic_read32(&m_seq);
+   ipcdetail::atomic_inc32(&m_num_waiters);
+   mut.unlock();
+
+   bool timed_out = false;
+   if(tout_enabled){
+      timed_out = !ipcdetail::futex_timed_wait(&m_seq, seq, abs_time);
+   }
+   else{
+      ipcdetail::futex_wait(&m_seq, seq);
+   }
+
+   ipcdetail::atomic_dec32(&m_num_waiters);
+   //Lock external again before returning from the method
+   mut.lock();
+   return !timed_out;
+}
+
+}  //namespace ipcdetail
+}  //namespace interprocess
+}  //namespace boost
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //BOOST_INTERPROCESS_DETAIL_FUTEX_CONDITION_HPP
@@ -0,0 +1,258 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_DETAIL_FUTEX_MUTEX_HPP
+#define BOOST_INTERPROCESS_DETAIL_FUTEX_MUTEX_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+#include <boost/interprocess/detail/atomic.hpp>
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/sync/detail/futex.hpp>
+#include <boost/interprocess/sync/spin/wait.hpp>
+#include <boost/cstdint.hpp>
+#include <signal.h>
+#include <errno.h>
+
+//!\file
+//!Describes a process-shared mutex built on a futex word that detects
+//!the death of the owner process.
+
+namespace boost {
+namespace interprocess {
+namespace ipcdetail {
+
+//!A mutex that can be placed in shared memory. The lock word holds the id of
+//!the owner process, so an uncontended lock or unlock is a single atomic
+//!operation and contended lockers sleep in the kernel instead of polling.
+//!
+//!If the owner process dies while holding the mutex, the next locker takes
+//!ownership and previous_owner_dead() returns true, as with POSIX robust
+//!mutexes. The new owner must call consistent() before unlocking it,
+//!otherwise the mutex becomes unusable and any further locking attempt
+//!throws interprocess_exception.
+//!
+//!Owner death is detected per process: all processes must share the
+//!same PID namespace.
+class futex_mutex
+{
+   futex_mutex(const futex_mutex &);
+   futex_mutex &operator=(const futex_mutex &);
+
+   public:
+   futex_mutex();
+   ~futex_mutex();
+
+   void lock();
+   bool try_lock();
+   bool timed_lock(const boost::posix_time::ptime &abs_time);
+   void unlock();
+   void consistent();
+   bool previous_owner_dead();
+
+   private:
+   static const boost::uint32_t WaitersBit = 0x80000000u;
+   //Spins before sleeping if the mutex is locked and there are several cores
+   static const unsigned int SpinCount = 100u;
+   //A sleeping locker wakes up periodically to check if the owner is alive
+   static const unsigned int OwnerCheckPeriodMs = 100u;
+
+   enum { correct_state = 0, fixing_state = 1, broken_state = 2 };
+
+   bool priv_lock(bool tout_enabled, const boost::posix_time::ptime &abs_time);
+   bool priv_check_acquired();
+   bool priv_try_take_from_dead_owner(boost::uint32_t word);
+   void priv_release();
+   static boost::uint32_t priv_self();
+   static bool priv_is_owner_dead(boost::uint32_t word);
+
+   //0 if unlocked, owner process id (plus WaitersBit if there might be
+   //sleeping lockers) otherwise
+   volatile boost::uint32_t m_word;
+   volatile boost::uint32_t m_state;
+};
+
+inline futex_mutex::futex_mutex()
+{
+   //Note that this class is initialized to zero.
+   //So zeroed memory can be interpreted as an initialized mutex
+   ipcdetail::atomic_write32(&m_word, 0u);
+   ipcdetail::atomic_write32(&m_state, correct_state);
+}
+
+inline futex_mutex::~futex_mutex()
+{}
+
+inline boost::uint32_t futex_mutex::priv_self()
+{  return static_cast<boost::uint32_t>(ipcdetail::get_current_process_id());  }
+
+inline bool futex_mutex::priv_is_owner_dead(boost::uint32_t word)
+{
+   const boost::uint32_t owner = word & ~WaitersBit;
+   if(!owner || owner == priv_self()){
+      return false;
+   }
+   return ::kill(static_cast<pid_t>(owner), 0) != 0 && errno == ESRCH;
+}
+
+inline bool futex_mutex::priv_try_take_from_dead_owner(boost::uint32_t word)
+{
+   if(!priv_is_owner_dead(word)){
+      return false;
+   }
+   //Keep the waiters bit so that sleeping lockers are woken on unlock
+   if(ipcdetail::atomic_cas32(&m_word, priv_self() | (word & WaitersBit), word) != word){
+      return false;
+   }
+   ipcdetail::atomic_write32(&m_state, fixing_state);
+   return true;
+}
+
+inline bool futex_mutex::priv_check_acquired()
+{
+   //A previous owner unlocked the mutex without making it consistent
+   if(ipcdetail::atomic_read32(&m_state) == broken_state){
+      this->priv_release();
+      throw interprocess_exception(lock_error, "Broken id");
+   }
+   return true;
+}
+
+inline bool futex_mutex::try_lock()
+{
+   const boost::uint32_t word = ipcdetail::atomic_cas32(&m_word, priv_self(), 0u);
+   if(word == 0u || this->priv_try_take_from_dead_owner(word)){
+      return this->priv_check_acquired();
+   }
+   return false;
+}
+
+inline void futex_mutex::lock()
+{
+   if(ipcdetail::atomic_cas32(&m_word, priv_self(), 0u) == 0u){
+      this->priv_check_acquired();
+      return;
+   }
+   this->priv_lock(false, boost::posix_time::ptime());
+}
+
+inline bool futex_mutex::timed_lock(const boost::posix_time::ptime &abs_time)
+{
+   if(abs_time == boost::posix_time::pos_infin){
+      this->lock();
+      return true;
+   }
+   if(ipcdetail::atomic_cas32(&m_word, priv_self(), 0u) == 0u){
+      return this->priv_check_acquired();
+   }
+   return this->priv_lock(true, abs_time);
+}
+
+inline bool futex_mutex::priv_lock(bool tout_enabled, const boost::posix_time::ptime &abs_time)
+{
+   const boost::uint32_t self = priv_self();
+   //Adaptive spinning: the owner is probably running in
+   //other core and will release the mutex soon
+   if(ipcdetail::num_core_holder<0>::get() > 1u){
+      for(unsigned int i = 0; i != SpinCount; ++i){
+         if(ipcdetail::atomic_read32(&m_word) == 0u &&
+            ipcdetail::atomic_cas32(&m_word, self, 0u) == 0u){
+            return this->priv_check_acquired();
+         }
+         #ifdef BOOST_INTERPROCESS_SMT_PAUSE
+         BOOST_INTERPROCESS_SMT_PAUSE
+         #endif
+      }
+   }
+
+   while(1){
+      boost::uint32_t word = ipcdetail::atomic_read32(&m_word);
+      if(word == 0u){
+         //Other lockers might be sleeping, so conservatively
+         //mark the word so that unlock wakes one of them
+         if(ipcdetail::atomic_cas32(&m_word, self | WaitersBit, 0u) == 0u){
+            return this->priv_check_acquired();
+         }
+         continue;
+      }
+      if(!(word & WaitersBit)){
+         if(ipcdetail::atomic_cas32(&m_word, word | WaitersBit, word) != word){
+            continue;
+         }
+         word |= WaitersBit;
+      }
+      const boost::posix_time::ptime now = microsec_clock::universal_time();
+      if(tout_enabled && now >= abs_time){
+         return false;
+      }
+      boost::posix_time::ptime wake_time = now + boost::posix_time::milliseconds(long(OwnerCheckPeriodMs));
+      if(tout_enabled && abs_time < wake_time){
+         wake_time = abs_time;
+      }
+      if(!ipcdetail::futex_timed_wait(&m_word, word, wake_time) &&
+         this->priv_try_take_from_dead_owner(word)){
+         return this->priv_check_acquired();
+      }
+   }
+}
+
+inline void futex_mutex::priv_release()
+{
+   boost::uint32_t word;
+   do{
+      word = ipcdetail::atomic_read32(&m_word);
+   }
+   while(ipcdetail::atomic_cas32(&m_word, 0u, word) != word);
+   if(word & WaitersBit){
+      ipcdetail::futex_wake(&m_word, 1);
+   }
+}
+
+inline void futex_mutex::unlock()
+{
+   //If in "fixing" state, unlock and mark the mutex as unrecoverable
+   //so next locks will fail and all threads will be noticed
+   //that the data protected by the mutex was not recoverable.
+   if(ipcdetail::atomic_read32(&m_state) == fixing_state){
+      ipcdetail::atomic_write32(&m_state, broken_state);
+   }
+   this->priv_release();
+}
+
+inline void futex_mutex::consistent()
+{
+   //This function supposes the previous owner was dead and
+   //the caller owns the mutex
+   if(ipcdetail::atomic_read32(&m_state) != fixing_state ||
+      (ipcdetail::atomic_read32(&m_word) & ~WaitersBit) != priv_self()){
+      throw interprocess_exception(lock_error, "Broken id");
+   }
+   ipcdetail::atomic_write32(&m_state, correct_state);
+}
+
+inline bool futex_mutex::previous_owner_dead()
+{
+   //Notifies if a owner recovery has been performed in the last lock()
+   return ipcdetail::atomic_read32(&m_state) == fixing_state;
+}
+
+}  //namespace ipcdetail {
+}  //namespace interprocess {
+}  //namespace boost {
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //BOOST_INTERPROCESS_DETAIL_FUTEX_MUTEX_HPP
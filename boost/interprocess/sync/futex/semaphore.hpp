@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_DETAIL_FUTEX_SEMAPHORE_HPP
+#define BOOST_INTERPROCESS_DETAIL_FUTEX_SEMAPHORE_HPP
+
+#if defined(_MSC_VER)
+#  pragma once
+#endif
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+#include <boost/interprocess/detail/atomic.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <boost/interprocess/sync/detail/futex.hpp>
+#include <boost/cstdint.hpp>
+
+//!\file
+//!Describes a process-shared semaphore built on a futex word.
+
+namespace boost {
+namespace interprocess {
+namespace ipcdetail {
+
+//!A semaphore that can be placed in shared memory. The count is the futex
+//!word: waiters sleep in the kernel while it is zero and post() only
+//!enters the kernel if there are sleeping waiters.
+class futex_semaphore
+{
+   futex_semaphore(const futex_semaphore &);
+   futex_semaphore &operator=(const futex_semaphore &);
+
+   public:
+   futex_semaphore(unsigned int initialCount);
+   ~futex_semaphore();
+
+   void post();
+   void wait();
+   bool try_wait();
+   bool timed_wait(const boost::posix_time::ptime &abs_time);
+
+   private:
+   bool priv_wait(bool tout_enabled, const boost::posix_time::ptime &abs_time);
+
+   volatile boost::uint32_t m_count;
+   volatile boost::uint32_t m_num_waiters;
+};
+
+inline futex_semaphore::~futex_semaphore()
+{}
+
+inline futex_semaphore::futex_semaphore(unsigned int initialCount)
+{
+   ipcdetail::atomic_write32(&this->m_count, boost::uint32_t(initialCount));
+   ipcdetail::atomic_write32(&this->m_num_waiters, 0u);
+}
+
+inline void futex_semaphore::post()
+{
+   ipcdetail::atomic_inc32(&m_count);
+   if(ipcdetail::atomic_read32(&m_num_waiters)){
+      ipcdetail::futex_wake(&m_count, 1);
+   }
+}
+
+inline void futex_semaphore::wait()
+{
+   this->priv_wait(false, boost::posix_time::ptime());
+}
+
+inline bool futex_semaphore::try_wait()
+{
+   return ipcdetail::atomic_add_unless32(&m_count, boost::uint32_t(-1), boost::uint32_t(0));
+}
+
+inline bool futex_semaphore::timed_wait(const boost::posix_time::ptime &abs_time)
+{
+   if(abs_time == boost::posix_time::pos_infin){
+      this->wait();
+      return true;
+   }
+   return this->priv_wait(true, abs_time);
+}
+
+inline bool futex_semaphore::priv_wait(bool tout_enabled, const boost::posix_time::ptime &abs_time)
+{
+   while(!this->try_wait()){
+      //The waiter is registered before checking the count again,
+      //so a post() that increments it after the check will wake us
+      ipcdetail::atomic_inc32(&m_num_waiters);
+      bool timed_out = false;
+      if(tout_enabled){
+         timed_out = !ipcdetail::futex_timed_wait(&m_count, 0u, abs_time);
+      }
+      else{
+         ipcdetail::futex_wait(&m_count, 0u);
+      }
+      ipcdetail::atomic_dec32(&m_num_waiters);
+      if(timed_out){
+         //A post might have been done just before the timeout
+         return this->try_wait();
+      }
+   }
+   return true;
+}
+
+}  //namespace ipcdetail {
+}  //namespace interprocess {
+}  //namespace boost {
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //BOOST_INTERPROCESS_DETAIL_FUTEX_SEMAPHORE_HPP
@@ -27,7 +27,10 @@
 #include <boost/interprocess/detail/posix_time_types_wrk.hpp>
 #include <boost/assert.hpp>
 
-#if !defined(BOOST_INTERPROCESS_FORCE_GENERIC_EMULATION) && defined (BOOST_INTERPROCESS_POSIX_PROCESS_SHARED)
+#if !defined(BOOST_INTERPROCESS_FORCE_GENERIC_EMULATION) && defined(BOOST_INTERPROCESS_FORCE_FUTEX_SYNC) && defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+   #include <boost/interprocess/sync/futex/mutex.hpp>
+   #define BOOST_INTERPROCESS_USE_FUTEX
+#elif !defined(BOOST_INTERPROCESS_FORCE_GENERIC_EMULATION) && defined (BOOST_INTERPROCESS_POSIX_PROCESS_SHARED)
    #include <boost/interprocess/sync/posix/mutex.hpp>
    #define BOOST_INTERPROCESS_USE_POSIX
 //Experimental...
@@ -79,6 +82,15 @@ class interprocess_mutex
       friend class ipcdetail::robust_emulation_helpers::mutex_traits<interprocess_mutex>;
       void take_ownership(){ m_mutex.take_ownership(); }
       public:
+   #elif defined(BOOST_INTERPROCESS_USE_FUTEX)
+      #undef BOOST_INTERPROCESS_USE_FUTEX
+      typedef ipcdetail::futex_mutex internal_mutex_type;
+      //!If the owner of the mutex died, marks the state protected by the
+      //!mutex as consistent again. Otherwise, when the recovered mutex is
+      //!unlocked it becomes unusable and further locks throw.
+      void consistent(){ m_mutex.consistent(); }
+      //!Returns true if the last lock took the mutex from a dead owner
+      bool previous_owner_dead(){ return m_mutex.previous_owner_dead(); }
    #elif defined(BOOST_INTERPROCESS_USE_POSIX)
       #undef BOOST_INTERPROCESS_USE_POSIX
       typedef ipcdetail::posix_mutex internal_mutex_type;
@@ -122,6 +122,29 @@ public:
      */
     BOOST_LOG_API void reset_filter();
 
+    /*!
+     * The method returns the current version of the filtering configuration. The version changes every time
+     * the core configuration that may affect filtering results is modified: logging is enabled or disabled,
+     * the global filter is set or reset, sinks are added or removed, global attributes are modified,
+     * an exception is suppressed by the exception handler while filtering, or \c invalidate_filter_caches is called.
+     * Modifying thread-specific attributes does not change the version.
+     *
+     * Log sources may use the version to validate filtering decisions cached between log records.
+     * If the version did not change since the decision was made, the decision is still valid, provided
+     * that filters only depend on attributes that do not change between records and do not depend
+     * on thread-specific attributes.
+     *
+     * \note The method is thread-safe and does not acquire any locks.
+     */
+    BOOST_LOG_API unsigned int get_filter_version() const;
+    /*!
+     * The method changes the filtering configuration version, which invalidates all filtering decisions
+     * cached by log sources. The method should be called when filtering results may change
+     * in a way the core cannot detect, e.g. when a sink filter is changed. Sink frontends call this
+     * method automatically when their filters are modified.
+     */
+    BOOST_LOG_API void invalidate_filter_caches();
+
     /*!
      * The method adds a new sink. The sink is included into logging process immediately after being added and until being removed.
      * No sink can be added more than once at the same time. If the sink is already registered, the call is ignored.
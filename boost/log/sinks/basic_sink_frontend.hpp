@@ -21,6 +21,7 @@
 #include <boost/log/detail/code_conversion.hpp>
 #include <boost/log/detail/attachable_sstream_buf.hpp>
 #include <boost/log/detail/fake_mutex.hpp>
+#include <boost/log/core/core.hpp>
 #include <boost/log/core/record_view.hpp>
 #include <boost/log/sinks/sink.hpp>
 #include <boost/log/sinks/frontend_requirements.hpp>
@@ -89,16 +90,23 @@ public:
     template< typename FunT >
     void set_filter(FunT const& filter)
     {
-        BOOST_LOG_EXPR_IF_MT(boost::log::aux::exclusive_lock_guard< mutex_type > lock(m_Mutex);)
-        m_Filter = filter;
+        {
+            BOOST_LOG_EXPR_IF_MT(boost::log::aux::exclusive_lock_guard< mutex_type > lock(m_Mutex);)
+            m_Filter = filter;
+        }
+        // Filtering decisions cached by loggers are no longer valid
+        core::get()->invalidate_filter_caches();
     }
     /*!
      * The method resets the filter
      */
     void reset_filter()
     {
-        BOOST_LOG_EXPR_IF_MT(boost::log::aux::exclusive_lock_guard< mutex_type > lock(m_Mutex);)
-        m_Filter.reset();
+        {
+            BOOST_LOG_EXPR_IF_MT(boost::log::aux::exclusive_lock_guard< mutex_type > lock(m_Mutex);)
+            m_Filter.reset();
+        }
+        core::get()->invalidate_filter_caches();
     }
 
     /*!
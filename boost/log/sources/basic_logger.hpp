@@ -243,6 +243,17 @@ protected:
         m_Attributes.clear();
     }
 
+    /*!
+     * Lock-free check whether a record with the specified arguments is known to be rejected by filters.
+     * The check is performed by \c open_record before locking the logger. The basic logger does not
+     * cache filtering results, so the check always fails.
+     */
+    template< typename ArgsT >
+    bool is_record_rejected(ArgsT const&) const
+    {
+        return false;
+    }
+
     /*!
      * Unlocked \c open_record
      */
@@ -435,7 +446,7 @@ public:
     record open_record()
     {
         // Perform a quick check first
-        if (this->core()->get_logging_enabled())
+        if (this->core()->get_logging_enabled() && !base_type::is_record_rejected(boost::log::aux::empty_arg_list()))
         {
             typename base_type::open_record_lock lock(base_type::get_threading_model());
             return base_type::open_record_unlocked(boost::log::aux::empty_arg_list());
@@ -453,7 +464,7 @@ public:
     record open_record(ArgsT const& args)
     {
         // Perform a quick check first
-        if (this->core()->get_logging_enabled())
+        if (this->core()->get_logging_enabled() && !base_type::is_record_rejected(args))
         {
             typename base_type::open_record_lock lock(base_type::get_threading_model());
             return base_type::open_record_unlocked(args);
@@ -562,7 +573,7 @@ public:
     record open_record()
     {
         // Perform a quick check first
-        if (this->core()->get_logging_enabled())
+        if (this->core()->get_logging_enabled() && !base_type::is_record_rejected(boost::log::aux::empty_arg_list()))
             return base_type::open_record_unlocked(boost::log::aux::empty_arg_list());
         else
             return record();
@@ -571,7 +582,7 @@ public:
     record open_record(ArgsT const& args)
     {
         // Perform a quick check first
-        if (this->core()->get_logging_enabled())
+        if (this->core()->get_logging_enabled() && !base_type::is_record_rejected(args))
             return base_type::open_record_unlocked(args);
         else
             return record();
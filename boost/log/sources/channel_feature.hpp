@@ -152,8 +152,12 @@ public:
      */
     void channel(channel_type const& ch)
     {
-        BOOST_LOG_EXPR_IF_MT(boost::log::aux::exclusive_lock_guard< threading_model > lock(this->get_threading_model());)
-        m_ChannelAttr.set(ch);
+        {
+            BOOST_LOG_EXPR_IF_MT(boost::log::aux::exclusive_lock_guard< threading_model > lock(this->get_threading_model());)
+            m_ChannelAttr.set(ch);
+        }
+        // Filtering decisions cached for the previous channel are no longer valid
+        this->core()->invalidate_filter_caches();
     }
 
 protected:
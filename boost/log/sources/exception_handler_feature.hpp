@@ -162,6 +162,8 @@ protected:
         catch (...)
         {
             handle_exception();
+            // The record is rejected because of the exception, so this decision must not be cached
+            this->core()->invalidate_filter_caches();
             return record();
         }
     }
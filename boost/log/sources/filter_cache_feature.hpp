@@ -0,0 +1,300 @@
+/*
+ *          Copyright (C) 2026 agent <agent@local>.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   filter_cache_feature.hpp
+ * \author agent
+ * \date   19.10.2026
+ *
+ * The header contains implementation of a filtering decision cache feature.
+ */
+
+#ifndef BOOST_LOG_SOURCES_FILTER_CACHE_FEATURE_HPP_INCLUDED_
+#define BOOST_LOG_SOURCES_FILTER_CACHE_FEATURE_HPP_INCLUDED_
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/move/core.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/locks.hpp>
+#include <boost/log/keywords/channel.hpp>
+#include <boost/log/keywords/severity.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/attribute.hpp>
+#include <boost/log/utility/strictest_lock.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace sources {
+
+/*!
+ * \brief Filter cache feature implementation
+ */
+template< typename BaseT, unsigned int CacheSizeV >
+class basic_filter_cache_logger :
+    public BaseT
+{
+    //! Base type
+    typedef BaseT base_type;
+    typedef basic_filter_cache_logger this_type;
+    BOOST_COPYABLE_AND_MOVABLE_ALT(this_type)
+
+    BOOST_STATIC_ASSERT_MSG(CacheSizeV > 0u, "Boost.Log: The filter cache must have at least one entry");
+
+public:
+    //! Character type
+    typedef typename base_type::char_type char_type;
+    //! Final type
+    typedef typename base_type::final_type final_type;
+    //! Threading model being used
+    typedef typename base_type::threading_model threading_model;
+
+#if defined(BOOST_LOG_DOXYGEN_PASS)
+    //! Lock requirement for the \c open_record_unlocked method
+    typedef typename strictest_lock<
+        typename base_type::open_record_lock,
+        no_lock< threading_model >
+    >::type open_record_lock;
+#endif // defined(BOOST_LOG_DOXYGEN_PASS)
+
+    //! Lock requirement for the \c swap_unlocked method
+    typedef typename strictest_lock<
+        typename base_type::swap_lock,
+#ifndef BOOST_LOG_NO_THREADS
+        boost::log::aux::exclusive_lock_guard< threading_model >
+#else
+        no_lock< threading_model >
+#endif // !defined(BOOST_LOG_NO_THREADS)
+    >::type swap_lock;
+
+private:
+    //! Cache entry type. Zero means no decision is cached, otherwise the entry contains the filtering configuration version plus one at which the record was rejected.
+    typedef boost::atomic< unsigned int > cache_entry;
+
+private:
+    //! Cached filtering decisions, indexed by severity level
+    cache_entry m_FilterCache[CacheSizeV];
+
+public:
+    /*!
+     * Default constructor. The constructed logger has an empty filter cache.
+     */
+    basic_filter_cache_logger() : base_type()
+    {
+        clear_filter_cache();
+    }
+    /*!
+     * Copy constructor. The filter cache is not copied.
+     */
+    basic_filter_cache_logger(basic_filter_cache_logger const& that) :
+        base_type(static_cast< base_type const& >(that))
+    {
+        clear_filter_cache();
+    }
+    /*!
+     * Move constructor. The filter cache is not moved.
+     */
+    basic_filter_cache_logger(BOOST_RV_REF(basic_filter_cache_logger) that) :
+        base_type(boost::move(static_cast< base_type& >(that)))
+    {
+        clear_filter_cache();
+    }
+    /*!
+     * Constructor with named arguments. The arguments are passed to the other features.
+     */
+    template< typename ArgsT >
+    explicit basic_filter_cache_logger(ArgsT const& args) : base_type(args)
+    {
+        clear_filter_cache();
+    }
+
+protected:
+    /*!
+     * Lock-free check whether a record is known to be rejected. Returns \c true if a record with the same
+     * severity level was rejected by filters and the filtering configuration did not change since then.
+     */
+    template< typename ArgsT >
+    bool is_record_rejected(ArgsT const& args) const
+    {
+        return is_record_rejected_with_channel(args, args[keywords::channel | parameter::void_()]);
+    }
+
+    /*!
+     * Unlocked \c open_record
+     */
+    template< typename ArgsT >
+    record open_record_unlocked(ArgsT const& args)
+    {
+        return open_record_with_channel_unlocked(args, args[keywords::channel | parameter::void_()]);
+    }
+
+    /*!
+     * Unlocked \c add_attribute
+     */
+    std::pair< attribute_set::iterator, bool > add_attribute_unlocked(attribute_name const& name, attribute const& attr)
+    {
+        std::pair< attribute_set::iterator, bool > res = base_type::add_attribute_unlocked(name, attr);
+        clear_filter_cache();
+        return res;
+    }
+
+    /*!
+     * Unlocked \c remove_attribute
+     */
+    void remove_attribute_unlocked(attribute_set::iterator it)
+    {
+        base_type::remove_attribute_unlocked(it);
+        clear_filter_cache();
+    }
+
+    /*!
+     * Unlocked \c remove_all_attributes
+     */
+    void remove_all_attributes_unlocked()
+    {
+        base_type::remove_all_attributes_unlocked();
+        clear_filter_cache();
+    }
+
+    /*!
+     * Unlocked \c set_attributes
+     */
+    void set_attributes_unlocked(attribute_set const& attrs)
+    {
+        base_type::set_attributes_unlocked(attrs);
+        clear_filter_cache();
+    }
+
+    //! Unlocked \c swap
+    void swap_unlocked(basic_filter_cache_logger& that)
+    {
+        base_type::swap_unlocked(static_cast< base_type& >(that));
+        clear_filter_cache();
+        that.clear_filter_cache();
+    }
+
+private:
+    //! Discards all cached filtering decisions
+    void clear_filter_cache()
+    {
+        for (unsigned int i = 0; i < CacheSizeV; ++i)
+            m_FilterCache[i].store(0u, boost::memory_order_relaxed);
+    }
+
+    //! The method returns the cache entry index for the severity level of the record
+    template< typename T >
+    static uintmax_t get_filter_cache_index(T const& level)
+    {
+        return static_cast< uintmax_t >(level);
+    }
+    //! The method returns the cache entry index for the record with no severity level specified
+    static uintmax_t get_filter_cache_index(parameter::void_)
+    {
+        // The default severity level of the logger is not known, the record is not cached
+        return static_cast< uintmax_t >(CacheSizeV);
+    }
+
+    //! The \c is_record_rejected implementation for the case when the channel is specified in log statement
+    template< typename ArgsT, typename T >
+    bool is_record_rejected_with_channel(ArgsT const& args, T const&) const
+    {
+        // The record changes the channel, the cached decisions cannot be used
+        return base_type::is_record_rejected(args);
+    }
+    //! The \c is_record_rejected implementation for the case when the channel is not specified in log statement
+    template< typename ArgsT >
+    bool is_record_rejected_with_channel(ArgsT const& args, parameter::void_) const
+    {
+        const uintmax_t index = get_filter_cache_index(args[keywords::severity | parameter::void_()]);
+        if (index < CacheSizeV)
+        {
+            const unsigned int entry = m_FilterCache[index].load(boost::memory_order_relaxed);
+            if (entry != 0u && entry == this->core()->get_filter_version() + 1u)
+                return true;
+        }
+
+        return base_type::is_record_rejected(args);
+    }
+
+    //! The \c open_record implementation for the case when the channel is specified in log statement
+    template< typename ArgsT, typename T >
+    record open_record_with_channel_unlocked(ArgsT const& args, T const&)
+    {
+        // The channel name of the logger is about to change, which may affect filtering
+        clear_filter_cache();
+        return base_type::open_record_unlocked(args);
+    }
+    //! The \c open_record implementation for the case when the channel is not specified in log statement
+    template< typename ArgsT >
+    record open_record_with_channel_unlocked(ArgsT const& args, parameter::void_)
+    {
+        const uintmax_t index = get_filter_cache_index(args[keywords::severity | parameter::void_()]);
+        if (index < CacheSizeV)
+        {
+            // The version has to be obtained before filtering so that a concurrent configuration change is not missed
+            const unsigned int version = this->core()->get_filter_version();
+            record rec = base_type::open_record_unlocked(args);
+            if (!rec)
+                m_FilterCache[index].store(version + 1u, boost::memory_order_relaxed);
+            return boost::move(rec);
+        }
+
+        return base_type::open_record_unlocked(args);
+    }
+};
+
+/*!
+ * \brief Filtering decision cache feature
+ *
+ * The logger with this feature remembers, for every severity level, that log records with that level
+ * were rejected by filters. Subsequent records with the same level are discarded without acquiring
+ * any locks and composing attribute values, until the filtering configuration of the logging core changes
+ * (see the \c core::get_filter_version method). The cache is indexed by severity level value, levels not less than
+ * \c CacheSizeV are not cached. Only the records with the severity level specified in the logging statement
+ * (e.g. with the \c BOOST_LOG_SEV macro) are cached.
+ *
+ * The feature is intended to be combined with the \c severity feature. The feature is opt-in and can only be
+ * used if the filters applied to the records made through the logger depend only on the severity level and
+ * the attributes whose values do not change between records, such as the channel name. Filters that depend
+ * on attributes like timestamps, counters or named scopes must not be used with this feature. Filters must not
+ * depend on thread-specific attributes either: the cache is shared by all threads using the logger, and
+ * modifying thread-specific attributes does not invalidate it.
+ *
+ * Records rejected because an exception was suppressed by an exception handler are not cached.
+ */
+template< unsigned int CacheSizeV = 32u >
+struct filter_cache
+{
+    template< typename BaseT >
+    struct apply
+    {
+        typedef basic_filter_cache_logger<
+            BaseT,
+            CacheSizeV
+        > type;
+    };
+};
+
+} // namespace sources
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_SOURCES_FILTER_CACHE_FEATURE_HPP_INCLUDED_
@@ -15,6 +15,7 @@
 
 #include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
 #include <boost/detail/allocator_utilities.hpp>
+#include <cstddef>
 
 namespace boost{
 
@@ -628,12 +629,43 @@ struct hashed_index_node_trampoline:
   typedef hashed_index_node_impl<impl_allocator_type>   impl_type;
 };
 
-template<typename Super,typename Category>
+/* Hashed indices with hash caching store the hash code of the key of each
+ * element in its node: rehashing then does not invoke the hash function, and
+ * lookups only call the equality predicate on elements whose stored hash
+ * matches that of the key looked for. Without caching, hashed_index_node
+ * inherits from an empty hash storage for which any hash code matches.
+ * As with hashed_index_node_trampoline, Super is used to make the storage
+ * type different for each hashed index of a multi_index_container.
+ */
+
+template<typename Super,bool CacheHash>
+struct hashed_index_node_hash_storage
+{
+  std::size_t stored_hash()const{return hash_;}
+  void        store_hash(std::size_t h){hash_=h;}
+  bool        matches_hash(std::size_t h)const{return hash_==h;}
+
+private:
+  std::size_t hash_;
+};
+
+template<typename Super>
+struct hashed_index_node_hash_storage<Super,false>
+{
+  std::size_t stored_hash()const{return 0;}
+  void        store_hash(std::size_t){}
+  bool        matches_hash(std::size_t)const{return true;}
+};
+
+template<typename Super,typename Category,bool CacheHash=false>
 struct hashed_index_node:
-  Super,hashed_index_node_trampoline<Super>
+  Super,hashed_index_node_trampoline<Super>,
+  hashed_index_node_hash_storage<Super,CacheHash>
 {
 private:
-  typedef hashed_index_node_trampoline<Super> trampoline;
+  typedef hashed_index_node_trampoline<Super>     trampoline;
+  typedef hashed_index_node_hash_storage<
+    Super,CacheHash>                              hash_storage;
 
 public:
   typedef typename trampoline::impl_type          impl_type;
@@ -649,6 +681,13 @@ public:
   impl_base_pointer& prior(){return trampoline::prior();}
   impl_base_pointer  prior()const{return trampoline::prior();}
 
+  std::size_t stored_hash()const{return hash_storage::stored_hash();}
+  void        store_hash(std::size_t h){hash_storage::store_hash(h);}
+  bool        matches_hash(std::size_t h)const
+  {
+    return hash_storage::matches_hash(h);
+  }
+
   impl_pointer impl()
   {
     return static_cast<impl_pointer>(
@@ -26,6 +26,7 @@
 #include <boost/multi_index/detail/vartempl_support.hpp>
 #include <boost/multi_index_container_fwd.hpp>
 #include <boost/tuple/tuple.hpp>
+#include <iterator>
 #include <utility>
 
 #if !defined(BOOST_MULTI_INDEX_DISABLE_SERIALIZATION)
@@ -168,6 +169,12 @@ protected:
 
   void clear_(){}
 
+  void reserve_(std::size_t){}
+
+  void begin_bulk_insert_(){}
+
+  void end_bulk_insert_(){}
+
   void swap_(index_base<Value,IndexSpecifierList,Allocator>&){}
 
   void swap_elements_(index_base<Value,IndexSpecifierList,Allocator>&){}
@@ -255,6 +262,17 @@ protected:
   void final_delete_all_nodes_(){final().delete_all_nodes_();}
   void final_clear_(){final().clear_();}
 
+  template<typename InputIterator>
+  void final_reserve_(InputIterator first,InputIterator last)
+  {
+    final().reserve_(
+      first,last,
+      typename std::iterator_traits<InputIterator>::iterator_category());
+  }
+
+  void final_begin_bulk_insert_(){final().begin_bulk_insert_();}
+  void final_end_bulk_insert_(){final().end_bulk_insert_();}
+
   void final_swap_(final_type& x){final().swap_(x);}
 
   bool final_replace_(
@@ -530,6 +530,63 @@ public:
     }
   }
 
+  /* Bulk loading: nodes inserted in ascending order are linked into a
+   * left vine hanging from the header, i.e. each new node becomes the root
+   * and takes the previous root as its left child. The vine is a (degenerate)
+   * binary search tree allowing for O(1) insertion at the end and
+   * traversal, and build_from_vine turns it into a balanced red-black tree
+   * in linear time, without rotations.
+   */
+
+  static void link_to_vine(pointer x,pointer header)
+  {
+    pointer root=header->parent();
+    x->left()=root;
+    x->right()=pointer(0);
+    x->parent()=header;
+    x->color()=black; /* a red root would be taken by decrement as header */
+    if(root==pointer(0))header->left()=x;
+    else root->parent()=x;
+    header->parent()=x;
+    header->right()=x;
+  }
+
+  static void build_from_vine(pointer header,std::size_t n)
+  {
+    if(n==0)return;
+
+    /* Nodes are laid out so that depths 0..red_depth-1 are complete and
+     * depth red_depth is partially filled, which is a valid coloring if the
+     * latter nodes are red and the rest black.
+     */
+
+    std::size_t red_depth=0;
+    for(std::size_t m=n+1;m>1;m/=2)++red_depth;
+
+    pointer first=header->left();
+    pointer root=build_from_vine(first,n,0,red_depth);
+    header->parent()=root;
+    root->parent()=header;
+  }
+
+  static pointer build_from_vine(
+    pointer& first,std::size_t n,std::size_t depth,std::size_t red_depth)
+  {
+    if(n==0)return pointer(0);
+
+    std::size_t n_left=(n-1)/2;
+    pointer     left=build_from_vine(first,n_left,depth+1,red_depth);
+    pointer     x=first;
+    first=x->parent(); /* next node in the vine */
+    x->left()=left;
+    if(left!=pointer(0))left->parent()=x;
+    pointer     right=build_from_vine(first,n-1-n_left,depth+1,red_depth);
+    x->right()=right;
+    if(right!=pointer(0))right->parent()=x;
+    x->color()=depth==red_depth?red:black;
+    return x;
+  }
+
 #if defined(BOOST_MULTI_INDEX_ENABLE_INVARIANT_CHECKING)
   /* invariant stuff */
 
@@ -78,14 +78,14 @@ namespace detail{
 
 template<
   typename KeyFromValue,typename Hash,typename Pred,
-  typename SuperMeta,typename TagList,typename Category
+  typename SuperMeta,typename TagList,typename Category,bool CacheHash
 >
 class hashed_index:
   BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS SuperMeta::type
 
 #if defined(BOOST_MULTI_INDEX_ENABLE_SAFE_MODE)
   ,public safe_mode::safe_container<
-    hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category> >
+    hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash> >
 #endif
 
 { 
@@ -103,7 +103,7 @@ class hashed_index:
 
 protected:
   typedef hashed_index_node<
-    typename super::node_type,Category>              node_type;
+    typename super::node_type,Category,CacheHash>    node_type;
 
 private:
   typedef typename node_type::node_alg               node_alg;
@@ -196,15 +196,18 @@ public:
    * not supposed to be created on their own. No range ctor either.
    */
 
-  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& operator=(
-    const hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x)
+  hashed_index<
+    KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& operator=(
+    const hashed_index<
+      KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x)
   {
     this->final()=x.final();
     return *this;
   }
 
 #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
-  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& operator=(
+  hashed_index<
+    KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& operator=(
     std::initializer_list<value_type> list)
   {
     this->final()=list;
@@ -290,6 +293,7 @@ public:
   void insert(InputIterator first,InputIterator last)
   {
     BOOST_MULTI_INDEX_HASHED_INDEX_CHECK_INVARIANT;
+    this->final_reserve_(first,last);
     for(;first!=last;++first)this->final_insert_ref_(*first);
   }
 
@@ -314,12 +318,13 @@ public:
   {
     BOOST_MULTI_INDEX_HASHED_INDEX_CHECK_INVARIANT;
 
-    std::size_t       buc=buckets.position(hash_(k));
-    node_impl_pointer x=buckets.at(buc)->next();
+    std::size_t       h=hash_(k);
+    node_impl_pointer x=buckets.at(buckets.position(h))->next();
     if(x!=node_impl_pointer(0)){
       x=x->next();
       do{
-        if(eq_(k,key(node_type::from_impl(x)->value()))){
+        if(node_type::from_impl(x)->matches_hash(h)&&
+           eq_(k,key(node_type::from_impl(x)->value()))){
           node_impl_pointer y=end_of_range(x);
           size_type         s=0;
           do{
@@ -443,7 +448,8 @@ public:
     this->final_clear_();
   }
 
-  void swap(hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x)
+  void swap(hashed_index<
+    KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x)
   {
     BOOST_MULTI_INDEX_HASHED_INDEX_CHECK_INVARIANT;
     BOOST_MULTI_INDEX_HASHED_INDEX_CHECK_INVARIANT_OF(x);
@@ -475,12 +481,13 @@ public:
     const CompatibleKey& k,
     const CompatibleHash& hash,const CompatiblePred& eq)const
   {
-    std::size_t       buc=buckets.position(hash(k));
-    node_impl_pointer x=buckets.at(buc)->next();
+    std::size_t       h=hash(k);
+    node_impl_pointer x=buckets.at(buckets.position(h))->next();
     if(x!=node_impl_pointer(0)){
       x=x->next();
       do{
-        if(eq(k,key(node_type::from_impl(x)->value()))){
+        if(node_type::from_impl(x)->matches_hash(h)&&
+           eq(k,key(node_type::from_impl(x)->value()))){
           return make_iterator(node_type::from_impl(x));
         }
         x=node_alg::next_to_inspect(x);
@@ -502,12 +509,13 @@ public:
     const CompatibleKey& k,
     const CompatibleHash& hash,const CompatiblePred& eq)const
   {
-    std::size_t       buc=buckets.position(hash(k));
-    node_impl_pointer x=buckets.at(buc)->next();
+    std::size_t       h=hash(k);
+    node_impl_pointer x=buckets.at(buckets.position(h))->next();
     if(x!=node_impl_pointer(0)){
       x=x->next();
       do{
-        if(eq(k,key(node_type::from_impl(x)->value()))){
+        if(node_type::from_impl(x)->matches_hash(h)&&
+           eq(k,key(node_type::from_impl(x)->value()))){
           size_type         res=0;
           node_impl_pointer y=end_of_range(x);
           do{
@@ -535,12 +543,13 @@ public:
     const CompatibleKey& k,
     const CompatibleHash& hash,const CompatiblePred& eq)const
   {
-    std::size_t       buc=buckets.position(hash(k));
-    node_impl_pointer x=buckets.at(buc)->next();
+    std::size_t       h=hash(k);
+    node_impl_pointer x=buckets.at(buckets.position(h))->next();
     if(x!=node_impl_pointer(0)){
       x=x->next();
       do{
-        if(eq(k,key(node_type::from_impl(x)->value()))){
+        if(node_type::from_impl(x)->matches_hash(h)&&
+           eq(k,key(node_type::from_impl(x)->value()))){
           return std::pair<iterator,iterator>(
             make_iterator(node_type::from_impl(x)),
             make_iterator(node_type::from_impl(end_of_range(x))));
@@ -649,7 +658,8 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
   }
 
   hashed_index(
-    const hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x):
+    const hashed_index<
+      KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x):
     super(x),
 
 #if defined(BOOST_MULTI_INDEX_ENABLE_SAFE_MODE)
@@ -669,7 +679,8 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
   }
 
   hashed_index(
-    const hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x,
+    const hashed_index<
+      KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x,
     do_not_copy_elements_tag):
     super(x,do_not_copy_elements_tag()),
 
@@ -724,14 +735,16 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
   }
 
   void copy_(
-    const hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x,
+    const hashed_index<
+      KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x,
     const copy_map_type& map)
   {
     copy_(x,map,Category());
   }
 
   void copy_(
-    const hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x,
+    const hashed_index<
+      KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x,
     const copy_map_type& map,hashed_unique_tag)
   {
     if(x.size()!=0){
@@ -743,6 +756,10 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
                           next_cpy=
           static_cast<node_type*>(map.find(static_cast<final_node_type*>(
             node_type::from_impl(next_org))))->impl();
+        if(next_org!=end_org){
+          node_type::from_impl(next_cpy)->store_hash(
+            node_type::from_impl(next_org)->stored_hash());
+        }
         cpy->next()=next_cpy;
         if(node_alg::is_first_of_bucket(next_org)){
           node_impl_base_pointer buc_org=next_org->prior(),
@@ -763,7 +780,8 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
   }
   
   void copy_(
-    const hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x,
+    const hashed_index<
+      KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x,
     const copy_map_type& map,hashed_non_unique_tag)
   {
     if(x.size()!=0){
@@ -775,6 +793,10 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
                           next_cpy=
           static_cast<node_type*>(map.find(static_cast<final_node_type*>(
             node_type::from_impl(next_org))))->impl();
+        if(next_org!=end_org){
+          node_type::from_impl(next_cpy)->store_hash(
+            node_type::from_impl(next_org)->stored_hash());
+        }
         if(org->next()==next_org){
           cpy->next()=next_cpy;
           if(node_alg::is_first_of_bucket(next_org)){
@@ -816,15 +838,15 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
   {
     reserve_for_insert(size()+1);
 
-    std::size_t buc=find_bucket(v);
-    link_info   pos(buckets.at(buc));
-    if(!link_point(v,pos)){
+    std::size_t h=hash_(key(v));
+    link_info   pos(buckets.at(buckets.position(h)));
+    if(!link_point(v,h,pos)){
       return static_cast<final_node_type*>(
         node_type::from_impl(node_impl_type::pointer_from(pos)));
     }
 
     final_node_type* res=super::insert_(v,x,variant);
-    if(res==x)link(static_cast<node_type*>(x),pos);
+    if(res==x)link(static_cast<node_type*>(x),h,pos);
     return res;
   }
 
@@ -834,15 +856,15 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
   {
     reserve_for_insert(size()+1);
 
-    std::size_t buc=find_bucket(v);
-    link_info   pos(buckets.at(buc));
-    if(!link_point(v,pos)){
+    std::size_t h=hash_(key(v));
+    link_info   pos(buckets.at(buckets.position(h)));
+    if(!link_point(v,h,pos)){
       return static_cast<final_node_type*>(
         node_type::from_impl(node_impl_type::pointer_from(pos)));
     }
 
     final_node_type* res=super::insert_(v,position,x,variant);
-    if(res==x)link(static_cast<node_type*>(x),pos);
+    if(res==x)link(static_cast<node_type*>(x),h,pos);
     return res;
   }
 
@@ -901,8 +923,15 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
 #endif
   }
 
+  void reserve_(size_type n)
+  {
+    reserve_for_insert(size()+n);
+    super::reserve_(n);
+  }
+
   void swap_(
-    hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x)
+    hashed_index<
+      KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x)
   {
     std::swap(key,x.key);
     std::swap(hash_,x.hash_);
@@ -919,7 +948,8 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
   }
 
   void swap_elements_(
-    hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x)
+    hashed_index<
+      KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x)
   {
     buckets.swap(x.buckets);
     std::swap(mlf,x.mlf);
@@ -943,10 +973,10 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
     unlink(x,undo);
 
     BOOST_TRY{
-      std::size_t  buc=find_bucket(v);
-      link_info    pos(buckets.at(buc));
-      if(link_point(v,pos)&&super::replace_(v,x,variant)){
-        link(x,pos);
+      std::size_t  h=hash_(key(v));
+      link_info    pos(buckets.at(buckets.position(h)));
+      if(link_point(v,h,pos)&&super::replace_(v,x,variant)){
+        link(x,h,pos);
         return true;
       }
       undo();
@@ -961,11 +991,13 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
 
   bool modify_(node_type* x)
   {
-    std::size_t buc;
+    std::size_t h,buc;
     bool        b; 
     BOOST_TRY{
-      buc=find_bucket(x->value());
-      b=in_place(x->impl(),key(x->value()),buc);
+      h=hash_(key(x->value()));
+      buc=buckets.position(h);
+      x->store_hash(h);
+      b=in_place(x->impl(),key(x->value()),h,buc);
     }
     BOOST_CATCH(...){
       erase_(x);
@@ -976,7 +1008,7 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
       unlink(x);
       BOOST_TRY{
         link_info pos(buckets.at(buc));
-        if(!link_point(x->value(),pos)){
+        if(!link_point(x->value(),h,pos)){
           super::erase_(x);
 
 #if defined(BOOST_MULTI_INDEX_ENABLE_SAFE_MODE)
@@ -984,7 +1016,7 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
 #endif
           return false;
         }
-        link(x,pos);
+        link(x,h,pos);
       }
       BOOST_CATCH(...){
         super::erase_(x);
@@ -1023,9 +1055,11 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
 
   bool modify_rollback_(node_type* x)
   {
-    std::size_t buc=find_bucket(x->value());
-    if(in_place(x->impl(),key(x->value()),buc)){
-      return super::modify_rollback_(x);
+    std::size_t h=hash_(key(x->value())),buc=buckets.position(h);
+    if(in_place(x->impl(),key(x->value()),h,buc)){
+      if(!super::modify_rollback_(x))return false;
+      x->store_hash(h);
+      return true;
     }
 
     unlink_undo undo;
@@ -1033,8 +1067,8 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
 
     BOOST_TRY{
       link_info pos(buckets.at(buc));
-      if(link_point(x->value(),pos)&&super::modify_rollback_(x)){
-        link(x,pos);
+      if(link_point(x->value(),h,pos)&&super::modify_rollback_(x)){
+        link(x,h,pos);
         return true;
       }
       undo();
@@ -1126,18 +1160,20 @@ private:
     link_info_non_unique
   >::type                                link_info;
 
-  bool link_point(value_param_type v,link_info& pos)
+  bool link_point(value_param_type v,std::size_t h,link_info& pos)
   {
-    return link_point(v,pos,Category());
+    return link_point(v,h,pos,Category());
   }
 
   bool link_point(
-    value_param_type v,node_impl_base_pointer& pos,hashed_unique_tag)
+    value_param_type v,std::size_t h,node_impl_base_pointer& pos,
+    hashed_unique_tag)
   {
     if(pos->next()!=node_impl_pointer(0)){
       node_impl_pointer x=pos->next()->next();
       do{
-        if(eq_(key(v),key(node_type::from_impl(x)->value()))){
+        if(node_type::from_impl(x)->matches_hash(h)&&
+           eq_(key(v),key(node_type::from_impl(x)->value()))){
           pos=node_impl_type::base_pointer_from(x);
           return false;
         }
@@ -1148,12 +1184,14 @@ private:
   }
 
   bool link_point(
-    value_param_type v,link_info_non_unique& pos,hashed_non_unique_tag)
+    value_param_type v,std::size_t h,link_info_non_unique& pos,
+    hashed_non_unique_tag)
   {
     if(pos.first->next()!=node_impl_pointer(0)){
       node_impl_pointer x=pos.first->next()->next();
       do{
-        if(eq_(key(v),key(node_type::from_impl(x)->value()))){
+        if(node_type::from_impl(x)->matches_hash(h)&&
+           eq_(key(v),key(node_type::from_impl(x)->value()))){
           pos.first=node_impl_type::base_pointer_from(x);
           pos.last=node_impl_type::base_pointer_from(last_of_range(x));
           return true;
@@ -1185,9 +1223,7 @@ private:
     }
     else{
       return                                  /* range of size 1 or 2 */
-        eq_(
-          key(node_type::from_impl(x)->value()),
-          key(node_type::from_impl(y)->value()))?y:x;
+        equivalent(node_type::from_impl(x),node_type::from_impl(y))?y:x;
     }
   }
 
@@ -1196,8 +1232,21 @@ private:
     return last_of_range(x)->next();
   }
 
-  void link(node_type* x,const link_info& pos)
+  bool equivalent(key_param_type k,std::size_t h,node_impl_pointer y)const
   {
+    return node_type::from_impl(y)->matches_hash(h)&&
+           eq_(k,key(node_type::from_impl(y)->value()));
+  }
+
+  bool equivalent(const node_type* x,const node_type* y)const
+  {
+    return y->matches_hash(x->stored_hash())&&
+           eq_(key(x->value()),key(y->value()));
+  }
+
+  void link(node_type* x,std::size_t h,const link_info& pos)
+  {
+    x->store_hash(h);
     link(x,pos,Category());
   }
 
@@ -1259,19 +1308,27 @@ private:
     bucket_array_type buckets_cpy(get_allocator(),cpy_end,n);
 
     if(size()!=0){
-      auto_space<std::size_t,allocator_type> hashes(get_allocator(),size());
+      /* Hash codes are computed in advance so that an exception thrown by
+       * hash_ leaves the index untouched; cached hash codes need not be.
+       */
+
+      auto_space<std::size_t,allocator_type> hashes(
+        get_allocator(),CacheHash?0:size());
 
       std::size_t       i=0;
       node_impl_pointer x=header()->next();
-      while(x!=end_){
-        hashes.data()[i++]=hash_(key(node_type::from_impl(x)->value()));
-        x=x->next();
+      if(!CacheHash){
+        while(x!=end_){
+          hashes.data()[i++]=hash_(key(node_type::from_impl(x)->value()));
+          x=x->next();
+        }
       }
 
       i=0;
       x=begin_;
       while(x!=end_){
-        std::size_t h=hashes.data()[i++];
+        std::size_t h=CacheHash?
+          node_type::from_impl(x)->stored_hash():hashes.data()[i++];
         node_impl_pointer y=x->next();
         node_alg::link(x,buckets_cpy.at(buckets_cpy.position(h)),cpy_end);
         x=y;
@@ -1295,7 +1352,8 @@ private:
 
     if(size()!=0){
       auto_space<
-        std::size_t,allocator_type> hashes(get_allocator(),size());
+        std::size_t,allocator_type> hashes(
+                                      get_allocator(),CacheHash?0:size());
       auto_space<
         node_impl_pointer,
         allocator_type>             range_lasts(get_allocator(),size());
@@ -1303,7 +1361,9 @@ private:
       std::size_t       i=0;
       node_impl_pointer x=begin_;
       while(x!=end_){
-        hashes.data()[i]=hash_(key(node_type::from_impl(x)->value()));
+        if(!CacheHash){
+          hashes.data()[i]=hash_(key(node_type::from_impl(x)->value()));
+        }
         x=last_of_range(x);
         range_lasts.data()[i++]=x;
         x=x->next();
@@ -1312,7 +1372,8 @@ private:
       i=0;
       x=begin_;
       while(x!=end_){
-        std::size_t       h=hashes.data()[i];
+        std::size_t       h=CacheHash?
+          node_type::from_impl(x)->stored_hash():hashes.data()[i];
         node_impl_pointer last=range_lasts.data()[i++],
                           y=last->next();
         node_alg::link_range(
@@ -1328,13 +1389,14 @@ private:
     calculate_max_load();
   }
 
-  bool in_place(node_impl_pointer x,key_param_type k,std::size_t buc)const
+  bool in_place(
+    node_impl_pointer x,key_param_type k,std::size_t h,std::size_t buc)const
   {
-    return in_place(x,k,buc,Category());
+    return in_place(x,k,h,buc,Category());
   }
 
   bool in_place(
-    node_impl_pointer x,key_param_type k,std::size_t buc,
+    node_impl_pointer x,key_param_type k,std::size_t h,std::size_t buc,
     hashed_unique_tag)const
   {
     bool              found=false;
@@ -1343,7 +1405,7 @@ private:
       y=y->next();
       do{
         if(y==x)found=true;
-        else if(eq_(k,key(node_type::from_impl(y)->value())))return false;
+        else if(equivalent(k,h,y))return false;
         y=y->next();
       }while(!node_alg::is_first_of_bucket(y));
     }
@@ -1351,7 +1413,7 @@ private:
   }
 
   bool in_place(
-    node_impl_pointer x,key_param_type k,std::size_t buc,
+    node_impl_pointer x,key_param_type k,std::size_t h,std::size_t buc,
     hashed_non_unique_tag)const
   {
     bool              found=false;
@@ -1363,11 +1425,11 @@ private:
         if(node_alg::is_first_of_group(y)){ /* group of 3 or more */
           if(y==x){
             /* in place <-> equal to some other member of the group */
-            return eq_(k,key(node_type::from_impl(y->next())->value()));
+            return equivalent(k,h,y->next());
           }
           else{
             node_impl_pointer z=y->next()->prior()->next(); /* end of range */
-            if(eq_(k,key(node_type::from_impl(y)->value()))){
+            if(equivalent(k,h,y)){
               if(found)return false; /* x lies outside */
               do{
                 if(y==x)return true;
@@ -1389,7 +1451,7 @@ private:
             range_size=1;
             found=true;
           }
-          else if(eq_(k,key(node_type::from_impl(y)->value()))){
+          else if(equivalent(k,h,y)){
             if(range_size==0&&found)return false;
             if(range_size==1&&!found)return false;
             if(range_size==2)return false;
@@ -1455,11 +1517,11 @@ private:
 
 template<
   typename KeyFromValue,typename Hash,typename Pred,
-  typename SuperMeta,typename TagList,typename Category
+  typename SuperMeta,typename TagList,typename Category,bool CacheHash
 >
 void swap(
-  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x,
-  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& y)
+  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x,
+  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& y)
 {
   x.swap(y);
 }
@@ -1489,7 +1551,7 @@ struct hashed_unique
   {
     typedef detail::hashed_index<
       key_from_value_type,hash_type,pred_type,
-      SuperMeta,tag_list_type,detail::hashed_unique_tag> type;
+      SuperMeta,tag_list_type,detail::hashed_unique_tag,false> type;
   };
 };
 
@@ -1515,7 +1577,65 @@ struct hashed_non_unique
   {
     typedef detail::hashed_index<
       key_from_value_type,hash_type,pred_type,
-      SuperMeta,tag_list_type,detail::hashed_non_unique_tag> type;
+      SuperMeta,tag_list_type,detail::hashed_non_unique_tag,false> type;
+  };
+};
+
+/* hashed_unique_cached and hashed_non_unique_cached store the hash code
+ * of each element along with it, trading some memory for not having to
+ * invoke the hash function on rehashing and skipping calls to the equality
+ * predicate on lookup for elements with different hash codes.
+ */
+
+template<typename Arg1,typename Arg2,typename Arg3,typename Arg4>
+struct hashed_unique_cached
+{
+  typedef typename detail::hashed_index_args<
+    Arg1,Arg2,Arg3,Arg4>                           index_args;
+  typedef typename index_args::tag_list_type::type tag_list_type;
+  typedef typename index_args::key_from_value_type key_from_value_type;
+  typedef typename index_args::hash_type           hash_type;
+  typedef typename index_args::pred_type           pred_type;
+
+  template<typename Super>
+  struct node_class
+  {
+    typedef detail::hashed_index_node<
+      Super,detail::hashed_unique_tag,true> type;
+  };
+
+  template<typename SuperMeta>
+  struct index_class
+  {
+    typedef detail::hashed_index<
+      key_from_value_type,hash_type,pred_type,
+      SuperMeta,tag_list_type,detail::hashed_unique_tag,true> type;
+  };
+};
+
+template<typename Arg1,typename Arg2,typename Arg3,typename Arg4>
+struct hashed_non_unique_cached
+{
+  typedef typename detail::hashed_index_args<
+    Arg1,Arg2,Arg3,Arg4>                           index_args;
+  typedef typename index_args::tag_list_type::type tag_list_type;
+  typedef typename index_args::key_from_value_type key_from_value_type;
+  typedef typename index_args::hash_type           hash_type;
+  typedef typename index_args::pred_type           pred_type;
+
+  template<typename Super>
+  struct node_class
+  {
+    typedef detail::hashed_index_node<
+      Super,detail::hashed_non_unique_tag,true> type;
+  };
+
+  template<typename SuperMeta>
+  struct index_class
+  {
+    typedef detail::hashed_index<
+      key_from_value_type,hash_type,pred_type,
+      SuperMeta,tag_list_type,detail::hashed_non_unique_tag,true> type;
   };
 };
 
@@ -1527,11 +1647,11 @@ struct hashed_non_unique
 
 template<
   typename KeyFromValue,typename Hash,typename Pred,
-  typename SuperMeta,typename TagList,typename Category
+  typename SuperMeta,typename TagList,typename Category,bool CacheHash
 >
 inline boost::mpl::true_* boost_foreach_is_noncopyable(
   boost::multi_index::detail::hashed_index<
-    KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>*&,
+    KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>*&,
   boost::foreach::tag)
 {
   return 0;
@@ -23,17 +23,17 @@ namespace detail{
 
 template<
   typename KeyFromValue,typename Hash,typename Pred,
-  typename SuperMeta,typename TagList,typename Category
+  typename SuperMeta,typename TagList,typename Category,bool CacheHash
 >
 class hashed_index;
 
 template<
   typename KeyFromValue,typename Hash,typename Pred,
-  typename SuperMeta,typename TagList,typename Category
+  typename SuperMeta,typename TagList,typename Category,bool CacheHash
 >
 void swap(
-  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& x,
-  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category>& y);
+  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& x,
+  hashed_index<KeyFromValue,Hash,Pred,SuperMeta,TagList,Category,CacheHash>& y);
 
 } /* namespace multi_index::detail */
 
@@ -51,6 +51,18 @@ template<
 >
 struct hashed_non_unique;
 
+template<
+  typename Arg1,typename Arg2=mpl::na,
+  typename Arg3=mpl::na,typename Arg4=mpl::na
+>
+struct hashed_unique_cached;
+
+template<
+  typename Arg1,typename Arg2=mpl::na,
+  typename Arg3=mpl::na,typename Arg4=mpl::na
+>
+struct hashed_non_unique_cached;
+
 } /* namespace multi_index */
 
 } /* namespace boost */
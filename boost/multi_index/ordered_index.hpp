@@ -329,12 +329,21 @@ public:
   void insert(InputIterator first,InputIterator last)
   {
     BOOST_MULTI_INDEX_ORD_INDEX_CHECK_INVARIANT;
-    node_type* hint=header(); /* end() */
-    for(;first!=last;++first){
-      hint=this->final_insert_ref_(
-        *first,static_cast<final_node_type*>(hint)).first;
-      node_type::increment(hint);
+    this->final_begin_bulk_insert_();
+    BOOST_TRY{
+      node_type* hint=header(); /* end() */
+      for(;first!=last;++first){
+        hint=this->final_insert_ref_(
+          *first,static_cast<final_node_type*>(hint)).first;
+        node_type::increment(hint);
+      }
+    }
+    BOOST_CATCH(...){
+      this->final_end_bulk_insert_();
+      BOOST_RETHROW;
     }
+    BOOST_CATCH_END
+    this->final_end_bulk_insert_();
   }
 
 #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
@@ -595,7 +604,8 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
   ordered_index(const ctor_args_list& args_list,const allocator_type& al):
     super(args_list.get_tail(),al),
     key(tuples::get<0>(args_list.get_head())),
-    comp_(tuples::get<1>(args_list.get_head()))
+    comp_(tuples::get<1>(args_list.get_head())),
+    bulk_loading(false)
   {
     empty_initialize();
   }
@@ -609,7 +619,8 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
 #endif
 
     key(x.key),
-    comp_(x.comp_)
+    comp_(x.comp_),
+    bulk_loading(false)
   {
     /* Copy ctor just takes the key and compare objects from x. The rest is
      * done in a subsequent call to copy_().
@@ -626,7 +637,8 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
 #endif
 
     key(x.key),
-    comp_(x.comp_)
+    comp_(x.comp_),
+    bulk_loading(false)
   {
     empty_initialize();
   }
@@ -704,15 +716,14 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
     value_param_type v,final_node_type*& x,Variant variant)
   {
     link_info inf;
-    if(!link_point(key(v),inf,Category())){
+    if(!(bulk_loading?
+         bulk_link_point(key(v),header(),inf,Category()):
+         link_point(key(v),inf,Category()))){
       return static_cast<final_node_type*>(node_type::from_impl(inf.pos));
     }
 
     final_node_type* res=super::insert_(v,x,variant);
-    if(res==x){
-      node_impl_type::link(
-        static_cast<node_type*>(x)->impl(),inf.side,inf.pos,header()->impl());
-    }
+    if(res==x)link(static_cast<node_type*>(x),inf);
     return res;
   }
 
@@ -721,15 +732,14 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
     value_param_type v,node_type* position,final_node_type*& x,Variant variant)
   {
     link_info inf;
-    if(!hinted_link_point(key(v),position,inf,Category())){
+    if(!(bulk_loading?
+         bulk_link_point(key(v),position,inf,Category()):
+         hinted_link_point(key(v),position,inf,Category()))){
       return static_cast<final_node_type*>(node_type::from_impl(inf.pos));
     }
 
     final_node_type* res=super::insert_(v,position,x,variant);
-    if(res==x){
-      node_impl_type::link(
-        static_cast<node_type*>(x)->impl(),inf.side,inf.pos,header()->impl());
-    }
+    if(res==x)link(static_cast<node_type*>(x),inf);
     return res;
   }
 
@@ -759,6 +769,18 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
 #endif
   }
 
+  void begin_bulk_insert_()
+  {
+    if(size()==0)bulk_loading=true;
+    super::begin_bulk_insert_();
+  }
+
+  void end_bulk_insert_()
+  {
+    end_bulk_loading();
+    super::end_bulk_insert_();
+  }
+
   void swap_(ordered_index<KeyFromValue,Compare,SuperMeta,TagList,Category>& x)
   {
     std::swap(key,x.key);
@@ -1054,6 +1076,50 @@ private:
     return true;
   }
 
+  void link(node_type* x,const link_info& inf)
+  {
+    if(bulk_loading){
+      node_impl_type::link_to_vine(x->impl(),header()->impl());
+    }
+    else{
+      node_impl_type::link(x->impl(),inf.side,inf.pos,header()->impl());
+    }
+  }
+
+  /* While bulk loading, elements are linked into a vine as long as they come
+   * in ascending order (see ordered_index_node_impl::link_to_vine); an
+   * element out of order makes the index build its tree and resume regular
+   * insertion.
+   */
+
+  bool bulk_link_point(
+    key_param_type k,node_type* position,link_info& inf,ordered_unique_tag)
+  {
+    if(size()==0||comp_(key(rightmost()->value()),k))return true;
+    if(!comp_(k,key(rightmost()->value()))){
+      inf.pos=rightmost()->impl();
+      return false;
+    }
+    end_bulk_loading();
+    return hinted_link_point(k,position,inf,ordered_unique_tag());
+  }
+
+  bool bulk_link_point(
+    key_param_type k,node_type* position,link_info& inf,ordered_non_unique_tag)
+  {
+    if(size()==0||!comp_(k,key(rightmost()->value())))return true;
+    end_bulk_loading();
+    return hinted_link_point(k,position,inf,ordered_non_unique_tag());
+  }
+
+  void end_bulk_loading()
+  {
+    if(bulk_loading){
+      bulk_loading=false;
+      node_impl_type::build_from_vine(header()->impl(),size());
+    }
+  }
+
   bool hinted_link_point(
     key_param_type k,node_type* position,link_info& inf,ordered_unique_tag)
   {
@@ -1347,6 +1413,7 @@ private:
 
   key_from_value key;
   key_compare    comp_;
+  bool           bulk_loading;
 
 #if defined(BOOST_MULTI_INDEX_ENABLE_INVARIANT_CHECKING)&&\
     BOOST_WORKAROUND(__MWERKS__,<=0x3003)
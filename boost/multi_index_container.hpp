@@ -17,6 +17,7 @@
 
 #include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
 #include <algorithm>
+#include <iterator>
 #include <boost/detail/allocator_utilities.hpp>
 #include <boost/detail/no_exceptions_support.hpp>
 #include <boost/detail/workaround.hpp>
@@ -216,14 +217,20 @@ public:
   {
     BOOST_MULTI_INDEX_CHECK_INVARIANT;
     BOOST_TRY{
+      reserve_(
+        first,last,
+        typename std::iterator_traits<InputIterator>::iterator_category());
+      super::begin_bulk_insert_();
       iterator hint=super::end();
       for(;first!=last;++first){
         hint=super::make_iterator(
           insert_ref_(*first,hint.get_node()).first);
         ++hint;
       }
+      super::end_bulk_insert_();
     }
     BOOST_CATCH(...){
+      super::end_bulk_insert_();
       clear_();
       BOOST_RETHROW;
     }
@@ -243,14 +250,18 @@ public:
     BOOST_TRY{
       typedef typename std::initializer_list<Value>::iterator init_iterator;
 
+      reserve_(list.size());
+      super::begin_bulk_insert_();
       iterator hint=super::end();
       for(init_iterator first=list.begin(),last=list.end();
           first!=last;++first){
         hint=super::make_iterator(insert_(*first,hint.get_node()).first);
         ++hint;
       }
+      super::end_bulk_insert_();
     }
     BOOST_CATCH(...){
+      super::end_bulk_insert_();
       clear_();
       BOOST_RETHROW;
     }
@@ -779,6 +790,25 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
     node_count=0;
   }
 
+  /* Indices are given the chance to allocate their internal structures in
+   * advance when the number of elements about to be inserted is known.
+   */
+
+  void reserve_(std::size_t n)
+  {
+    super::reserve_(n);
+  }
+
+  template<typename InputIterator>
+  void reserve_(InputIterator,InputIterator,std::input_iterator_tag){}
+
+  template<typename ForwardIterator>
+  void reserve_(
+    ForwardIterator first,ForwardIterator last,std::forward_iterator_tag)
+  {
+    reserve_(static_cast<std::size_t>(std::distance(first,last)));
+  }
+
   void swap_(multi_index_container<Value,IndexSpecifierList,Allocator>& x)
   {
     if(bfm_allocator::member!=x.bfm_allocator::member){
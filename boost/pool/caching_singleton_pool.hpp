@@ -0,0 +1,422 @@
+// Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#ifndef BOOST_CACHING_SINGLETON_POOL_HPP
+#define BOOST_CACHING_SINGLETON_POOL_HPP
+
+/*!
+  \file
+  \brief The <tt>caching_singleton_pool</tt> class is a <tt>singleton_pool</tt>
+  that keeps a per-thread cache of free chunks.
+
+  \details Header caching_singleton_pool.hpp provides a template class <tt>caching_singleton_pool</tt>,
+  which provides access to a pool as a singleton object. Each thread allocates and deallocates
+  chunks from its own free list, that is refilled from and drained to the shared pool in batches,
+  so that the mutex protecting the shared pool is locked once every <tt>BatchSize</tt> operations
+  instead of once per operation.
+
+  When threading support is enabled, this header requires linking with Boost.Thread
+  (the thread caches are registered in a <tt>boost::thread_specific_ptr</tt>
+  so that they are returned to the shared pool when each thread exits).
+*/
+
+#include <boost/pool/poolfwd.hpp>
+
+// boost::pool
+#include <boost/pool/pool.hpp>
+// boost::details::pool::guard
+#include <boost/pool/detail/guard.hpp>
+
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/static_assert.hpp>
+
+// std::nothrow
+#include <new>
+
+#if !defined(BOOST_HAS_THREADS) || defined(BOOST_NO_MT) || defined(BOOST_POOL_NO_MT)
+#  define BOOST_POOL_NO_THREAD_CACHE
+#else
+// boost::thread_specific_ptr
+#  include <boost/thread/tss.hpp>
+#  if !defined(BOOST_POOL_NO_TLS)
+#    if defined(__GNUC__)
+#      define BOOST_POOL_THREAD_LOCAL __thread
+#    elif defined(BOOST_MSVC)
+#      define BOOST_POOL_THREAD_LOCAL __declspec(thread)
+#    endif
+#  endif
+#endif
+
+namespace boost {
+
+/*!
+  The caching_singleton_pool class is a thread-caching variant of singleton_pool.
+  Chunks are allocated and deallocated from a free list owned by the calling thread,
+  without any synchronization. When the free list of a thread is empty, <b>BatchSize</b> chunks
+  are transferred from the underlying pool to the thread's free list with a single lock of the mutex,
+  and when it holds 2 * <b>BatchSize</b> chunks, <b>BatchSize</b> chunks are returned to the
+  underlying pool. Free lists link chunks as simple_segregated_storage does, so the
+  chunks are the same ones the underlying pool would return.
+
+  Template parameters are those of singleton_pool, plus:
+
+  <b>BatchSize</b> The number of chunks transferred at once between the underlying pool and
+  a thread's free list (defaults to 32). The member typedef <tt>static const value batch_size</tt>
+  exposes the value of this template parameter.
+
+  <b>Notes:</b>
+
+  Only malloc() and free() of single chunks use the thread cache. The rest of
+  functions (ordered and array allocations, is_from(), release_memory(), purge_memory())
+  lock the mutex and operate on the underlying pool.
+
+  Chunks cached by a thread are returned to the underlying pool when the thread exits,
+  or when flush_thread_cache() is called from that thread. Until then, release_memory()
+  considers them in use.
+
+  When threading support is disabled, there is a single cache shared by the whole program.
+
+  \attention
+  As with singleton_pool, the underlying pool <b>is never freed</b>.
+*/
+
+template <typename Tag,
+    unsigned RequestedSize,
+    typename UserAllocator,
+    typename Mutex,
+    unsigned NextSize,
+    unsigned MaxSize,
+    unsigned BatchSize >
+class caching_singleton_pool
+{
+  public:
+    typedef Tag tag; //!< The Tag template parameter uniquely identifies this pool.
+    typedef Mutex mutex; //!< The type of mutex used to synchonise access to the underlying pool.
+    typedef UserAllocator user_allocator; //!< The user-allocator used by this pool, default = <tt>default_user_allocator_new_delete</tt>.
+    typedef typename pool<UserAllocator>::size_type size_type; //!< size_type of user allocator.
+    typedef typename pool<UserAllocator>::difference_type difference_type; //!< difference_type of user allocator.
+
+    BOOST_STATIC_CONSTANT(unsigned, requested_size = RequestedSize); //!< The size of each chunk allocated by this pool.
+    BOOST_STATIC_CONSTANT(unsigned, next_size = NextSize); //!< The number of chunks to allocate on the first allocation.
+    BOOST_STATIC_CONSTANT(unsigned, batch_size = BatchSize); //!< The number of chunks transferred at once to or from a thread cache.
+
+  private:
+    BOOST_STATIC_ASSERT(BatchSize > 0);
+
+    caching_singleton_pool();
+
+    // Free list of a thread
+    struct thread_cache
+    {
+      void * first;
+      size_type count;
+    };
+
+    static void * & nextof(void * const ptr)
+    { return *(static_cast<void **>(ptr)); }
+
+#ifndef BOOST_DOXYGEN
+    struct pool_type: public Mutex, public pool<UserAllocator>
+    {
+      pool_type()
+        : pool<UserAllocator>(RequestedSize, NextSize, MaxSize)
+#ifndef BOOST_POOL_NO_THREAD_CACHE
+        , caches(&caching_singleton_pool::cleanup_cache)
+#endif
+      {}
+
+      // Returns a chunk, growing the pool if needed, and moves up to n - 1
+      // more free chunks to the list cached. The pool is not grown for them.
+      void * malloc_batch(const unsigned n, void * & cached, size_type & count)
+      {
+        void * const ret = (this->malloc)();
+        if (ret == 0)
+          return 0;
+        void * last = 0;
+        void * chunk = this->first;
+        for (count = 0; chunk != 0 && count + 1 < n; ++count)
+        {
+          last = chunk;
+          chunk = nextof(chunk);
+        }
+        if (last != 0)
+        {
+          cached = this->first;
+          nextof(last) = 0;
+          this->first = chunk;
+        }
+        return ret;
+      }
+
+      // Puts the list [head, tail] in the free list
+      void free_batch(void * const head, void * const tail)
+      {
+        nextof(tail) = this->first;
+        this->first = head;
+      }
+
+#ifndef BOOST_POOL_NO_THREAD_CACHE
+      // Owns the cache of each thread
+      boost::thread_specific_ptr<thread_cache> caches;
+#endif
+    }; //  struct pool_type: Mutex
+#endif
+
+  public:
+    static void * malloc BOOST_PREVENT_MACRO_SUBSTITUTION()
+    { //! Equivalent to SingletonPool::p.malloc(); only synchronized when the thread cache is empty.
+      thread_cache * const c = get_cache();
+      if (c == 0)
+      {
+        pool_type & p = get_pool();
+        details::pool::guard<Mutex> g(p);
+        return (p.malloc)();
+      }
+      void * const ret = c->first;
+      if (ret == 0)
+        return refill(*c);
+      c->first = nextof(ret);
+      --c->count;
+      return ret;
+    }
+    static void * ordered_malloc()
+    {  //! Equivalent to SingletonPool::p.ordered_malloc(); synchronized.
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      return p.ordered_malloc();
+    }
+    static void * ordered_malloc(const size_type n)
+    { //! Equivalent to SingletonPool::p.ordered_malloc(n); synchronized.
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      return p.ordered_malloc(n);
+    }
+    static bool is_from(void * const ptr)
+    { //! Equivalent to SingletonPool::p.is_from(chunk); synchronized.
+      //! \returns true if chunk is from SingletonPool::is_from(chunk)
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      return p.is_from(ptr);
+    }
+    static void free BOOST_PREVENT_MACRO_SUBSTITUTION(void * const ptr)
+    { //! Equivalent to SingletonPool::p.free(chunk); only synchronized when the thread cache is full.
+      thread_cache * const c = get_cache();
+      if (c == 0)
+      {
+        pool_type & p = get_pool();
+        details::pool::guard<Mutex> g(p);
+        (p.free)(ptr);
+        return;
+      }
+      nextof(ptr) = c->first;
+      c->first = ptr;
+      if (++c->count >= 2 * static_cast<size_type>(BatchSize))
+        drain(*c, BatchSize);
+    }
+    static void ordered_free(void * const ptr)
+    { //! Equivalent to SingletonPool::p.ordered_free(chunk); synchronized.
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      p.ordered_free(ptr);
+    }
+    static void free BOOST_PREVENT_MACRO_SUBSTITUTION(void * const ptr, const size_type n)
+    { //! Equivalent to SingletonPool::p.free(chunk, n); synchronized.
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      (p.free)(ptr, n);
+    }
+    static void ordered_free(void * const ptr, const size_type n)
+    { //! Equivalent to SingletonPool::p.ordered_free(chunk, n); synchronized.
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      p.ordered_free(ptr, n);
+    }
+    static void flush_thread_cache()
+    { //! Returns all the chunks cached by the calling thread to the underlying pool.
+      thread_cache * const c = get_cache();
+      if (c != 0 && c->count != 0)
+        drain(*c, c->count);
+    }
+    static size_type thread_cache_size()
+    { //! \returns The number of free chunks cached by the calling thread.
+      thread_cache * const c = get_cache();
+      return c == 0 ? 0 : c->count;
+    }
+    static bool release_memory()
+    { //! Calls flush_thread_cache(), then equivalent to SingletonPool::p.release_memory(); synchronized.
+      flush_thread_cache();
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      return p.release_memory();
+    }
+    static bool purge_memory()
+    { //! Empties the cache of the calling thread, then equivalent to SingletonPool::p.purge_memory(); synchronized.
+      //! Other threads must not hold cached chunks, or use them afterwards.
+      thread_cache * const c = get_cache();
+      if (c != 0)
+      {
+        c->first = 0;
+        c->count = 0;
+      }
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      return p.purge_memory();
+    }
+
+  private:
+    // Transfers up to BatchSize chunks from the underlying pool to the empty cache and returns one of them
+    static void * refill(thread_cache & c)
+    {
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      return p.malloc_batch(BatchSize, c.first, c.count);
+    }
+
+    // Returns the first n chunks of the cache to the underlying pool
+    static void drain(thread_cache & c, const size_type n)
+    {
+      void * const head = c.first;
+      void * tail = head;
+      for (size_type i = 1; i < n; ++i)
+        tail = nextof(tail);
+      c.first = nextof(tail);
+      c.count -= n;
+      pool_type & p = get_pool();
+      details::pool::guard<Mutex> g(p);
+      p.free_batch(head, tail);
+    }
+
+#ifdef BOOST_POOL_NO_THREAD_CACHE
+    static thread_cache cache;
+
+    static thread_cache * get_cache()
+    {
+      return &cache;
+    }
+#else
+#ifdef BOOST_POOL_THREAD_LOCAL
+    static BOOST_POOL_THREAD_LOCAL thread_cache * tls_cache;
+#endif
+
+    static thread_cache * get_cache()
+    {
+#ifdef BOOST_POOL_THREAD_LOCAL
+      thread_cache * const c = tls_cache;
+#else
+      thread_cache * const c = get_pool().caches.get();
+#endif
+      return c != 0 ? c : create_cache();
+    }
+
+    static thread_cache * create_cache()
+    {
+      // Returns null if the cache can't be allocated,
+      // so that the underlying pool is used directly.
+      thread_cache * const c = new (std::nothrow) thread_cache;
+      if (c != 0)
+      {
+        c->first = 0;
+        c->count = 0;
+        get_pool().caches.reset(c);
+#ifdef BOOST_POOL_THREAD_LOCAL
+        tls_cache = c;
+#endif
+      }
+      return c;
+    }
+
+    // Called when a thread exits
+    static void cleanup_cache(thread_cache * c)
+    {
+#ifdef BOOST_POOL_THREAD_LOCAL
+      tls_cache = 0;
+#endif
+      if (c->count != 0)
+        drain(*c, c->count);
+      delete c;
+    }
+#endif
+
+    typedef boost::aligned_storage<sizeof(pool_type), boost::alignment_of<pool_type>::value> storage_type;
+    static storage_type storage;
+
+    static pool_type& get_pool()
+    {
+      static bool f = false;
+      if(!f)
+      {
+        // This code *must* be called before main() starts,
+        // and when only one thread is executing.
+        f = true;
+        new (&storage) pool_type;
+      }
+
+      // The following line does nothing else than force the instantiation
+      //  of singleton<T>::create_object, whose constructor is
+      //  called before main() begins.
+      create_object.do_nothing();
+
+      return *static_cast<pool_type*>(static_cast<void*>(&storage));
+    }
+
+    struct object_creator
+    {
+      object_creator()
+      {  // This constructor does nothing more than ensure that instance()
+        //  is called before main() begins, thus creating the static
+        //  T object before multithreading race issues can come up.
+        caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::get_pool();
+      }
+      inline void do_nothing() const
+      {
+      }
+    };
+    static object_creator create_object;
+}; // struct caching_singleton_pool
+
+template <typename Tag,
+    unsigned RequestedSize,
+    typename UserAllocator,
+    typename Mutex,
+    unsigned NextSize,
+    unsigned MaxSize,
+    unsigned BatchSize >
+typename caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::storage_type caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::storage;
+
+template <typename Tag,
+    unsigned RequestedSize,
+    typename UserAllocator,
+    typename Mutex,
+    unsigned NextSize,
+    unsigned MaxSize,
+    unsigned BatchSize >
+typename caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::object_creator caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::create_object;
+
+#ifdef BOOST_POOL_NO_THREAD_CACHE
+template <typename Tag,
+    unsigned RequestedSize,
+    typename UserAllocator,
+    typename Mutex,
+    unsigned NextSize,
+    unsigned MaxSize,
+    unsigned BatchSize >
+typename caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::thread_cache caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::cache;
+#elif defined(BOOST_POOL_THREAD_LOCAL)
+template <typename Tag,
+    unsigned RequestedSize,
+    typename UserAllocator,
+    typename Mutex,
+    unsigned NextSize,
+    unsigned MaxSize,
+    unsigned BatchSize >
+BOOST_POOL_THREAD_LOCAL typename caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::thread_cache * caching_singleton_pool<Tag, RequestedSize, UserAllocator, Mutex, NextSize, MaxSize, BatchSize>::tls_cache = 0;
+#endif
+
+} // namespace boost
+
+#endif
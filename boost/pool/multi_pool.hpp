@@ -0,0 +1,468 @@
+// Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#ifndef BOOST_MULTI_POOL_HPP
+#define BOOST_MULTI_POOL_HPP
+
+/*!
+  \file
+  \brief Provides class \ref multi_pool: an allocator for chunks of different sizes,
+  that routes each request to a pool of chunks of the nearest size class,
+  and \ref multi_pool_allocator: a C++ Standard Library compatible allocator that uses it.
+*/
+
+#include <boost/pool/poolfwd.hpp>
+
+// boost::default_user_allocator_new_delete
+#include <boost/pool/pool.hpp>
+#include <boost/pool/simple_segregated_storage.hpp>
+
+#include <boost/math/common_factor_ct.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/limits.hpp>
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <vector>
+
+namespace boost {
+
+/*! \brief A pool of chunks of different sizes.
+
+  \details
+
+  <b>UserAllocator</b>
+  Defines the method that multi_pool will use to allocate memory from the system.
+  See <a href="boost_pool/pool/pooling.html#boost_pool.pool.pooling.user_allocator">User Allocators</a> for details.
+
+  Requests are rounded up to a size class, and each size class keeps its own blocks of
+  chunks, managed by a simple_segregated_storage. Size classes are multiples of the
+  minimum alignment up to 4 times that alignment, and then there are 4 classes
+  for each power of two (for example 80, 96, 112 and 128), so less than 25% of a chunk is wasted.
+  Requests bigger than the largest size class are forwarded to the UserAllocator.
+
+  Each block counts its allocated chunks. When all the chunks of a block are freed,
+  the block is returned to the UserAllocator, except for one empty block per size class that
+  is kept to avoid allocating and freeing a block repeatedly. release_memory() returns those too.
+
+  Chunks are suitably aligned for any object with fundamental alignment whose size is the requested size.
+
+  multi_pool is not synchronized.
+*/
+template <typename UserAllocator>
+class multi_pool
+{
+  public:
+    typedef UserAllocator user_allocator; //!< User allocator.
+    typedef typename UserAllocator::size_type size_type; //!< An unsigned integral type that can represent the size of the largest object to be allocated.
+    typedef typename UserAllocator::difference_type difference_type; //!< A signed integral type that can represent the difference of any two pointers.
+
+  private:
+    BOOST_STATIC_CONSTANT(size_type, min_align =
+        (::boost::math::static_lcm< ::boost::alignment_of<void *>::value, ::boost::alignment_of<size_type>::value>::value) );
+    BOOST_STATIC_CONSTANT(size_type, max_align =
+        (::boost::math::static_lcm<min_align, ::boost::alignment_of<long double>::value>::value) );
+    BOOST_STATIC_CONSTANT(size_type, min_chunks_per_block = 4);
+
+    // Placed at the beginning of each block, followed by the chunks
+    struct block_header
+    {
+      block_header * prev; // Links blocks with free chunks of a size class
+      block_header * next;
+      simple_segregated_storage<size_type> store;
+      size_type used;
+    };
+
+    struct size_class
+    {
+      size_type chunk_size;
+      size_type chunks_per_block;
+      block_header * partial; // Blocks with allocated and free chunks
+      block_header * spare; // An empty block
+      std::vector<block_header *> blocks; // Ordered by address
+    };
+
+    typedef typename std::vector<block_header *>::iterator block_iterator;
+
+    std::vector<size_class> classes;
+    std::vector<unsigned char> class_of; // Size class of each multiple of min_align
+    size_type max_pooled;
+
+    multi_pool(const multi_pool &);
+    void operator=(const multi_pool &);
+
+    static size_type header_size()
+    {
+      const size_type s = sizeof(block_header);
+      return (s + max_align - 1) / max_align * max_align;
+    }
+
+    static char * chunks_of(block_header * const b)
+    { return reinterpret_cast<char *>(b) + header_size(); }
+
+    static void link(block_header * & list, block_header * const b)
+    {
+      b->prev = 0;
+      b->next = list;
+      if (list != 0)
+        list->prev = b;
+      list = b;
+    }
+
+    static void unlink(block_header * & list, block_header * const b)
+    {
+      if (b->prev != 0)
+        b->prev->next = b->next;
+      else
+        list = b->next;
+      if (b->next != 0)
+        b->next->prev = b->prev;
+    }
+
+    block_header * new_block(size_class & c)
+    {
+      const size_type chunk_area = c.chunk_size * c.chunks_per_block;
+      char * const raw = (UserAllocator::malloc)(header_size() + chunk_area);
+      if (raw == 0)
+        return 0;
+      block_iterator pos = std::upper_bound(c.blocks.begin(), c.blocks.end(),
+          reinterpret_cast<block_header *>(raw), std::less<block_header *>());
+      try
+      {
+        c.blocks.insert(pos, reinterpret_cast<block_header *>(raw));
+      }
+      catch (const std::bad_alloc &)
+      {
+        (UserAllocator::free)(raw);
+        return 0;
+      }
+      block_header * const b = new (raw) block_header;
+      b->used = 0;
+      b->store.add_block(chunks_of(b), chunk_area, c.chunk_size);
+      return b;
+    }
+
+    void delete_block(size_class & c, block_header * const b)
+    {
+      const block_iterator pos = std::lower_bound(c.blocks.begin(), c.blocks.end(), b, std::less<block_header *>());
+      BOOST_ASSERT(pos != c.blocks.end() && *pos == b);
+      c.blocks.erase(pos);
+      b->~block_header();
+      (UserAllocator::free)(reinterpret_cast<char *>(b));
+    }
+
+    // Finds the block that contains chunk
+    static block_header * find_block(size_class & c, void * const chunk)
+    {
+      block_iterator pos = std::upper_bound(c.blocks.begin(), c.blocks.end(),
+          static_cast<block_header *>(chunk), std::less<block_header *>());
+      BOOST_ASSERT(pos != c.blocks.begin());
+      block_header * const b = *--pos;
+      BOOST_ASSERT((std::less<void *>()(chunk, chunks_of(b) + c.chunk_size * c.chunks_per_block)));
+      return b;
+    }
+
+  public:
+    explicit multi_pool(const size_type max_pooled_size = 1024, const size_type block_size = 8192)
+    : max_pooled(0)
+    { //! Constructs a new empty multi_pool.
+      //! \param max_pooled_size The size of the largest requests served by the size classes.
+      //! It is rounded up to the largest size class. Bigger requests are forwarded to the UserAllocator.
+      //! \param block_size The size of the blocks that will be requested from the UserAllocator.
+      //! Blocks hold at least 4 chunks, so the largest size classes use bigger blocks.
+      size_type size = min_align;
+      for (;;)
+      {
+        size_class c;
+        c.chunk_size = size;
+        c.chunks_per_block = (std::max)(
+            static_cast<size_type>(block_size > header_size() ? (block_size - header_size()) / size : 0),
+            static_cast<size_type>(min_chunks_per_block));
+        c.partial = 0;
+        c.spare = 0;
+        classes.push_back(c);
+        max_pooled = size;
+        if (size >= max_pooled_size)
+          break;
+        // Classes are spaced by a quarter of the previous power of two
+        size_type step = 1;
+        while (step * 2 <= size)
+          step *= 2;
+        size += (std::max)(step / 4, static_cast<size_type>(min_align));
+      }
+      BOOST_ASSERT(classes.size() <= (std::numeric_limits<unsigned char>::max)());
+
+      class_of.resize(max_pooled / min_align + 1);
+      unsigned char idx = 0;
+      for (size_type i = 0; i < class_of.size(); ++i)
+      {
+        if (i * min_align > classes[idx].chunk_size)
+          ++idx;
+        class_of[i] = idx;
+      }
+    }
+
+    ~multi_pool()
+    { //! Destructs the multi_pool, freeing all the blocks.
+      purge_memory();
+    }
+
+    void * malloc BOOST_PREVENT_MACRO_SUBSTITUTION(const size_type bytes)
+    { //! Allocates a chunk of at least bytes bytes.
+      //! \returns 0 if out-of-memory.
+      if (bytes > max_pooled)
+        return (UserAllocator::malloc)(bytes);
+      size_class & c = classes[class_of[(bytes + min_align - 1) / min_align]];
+      block_header * b = c.partial;
+      if (b == 0)
+      {
+        if (c.spare != 0)
+        {
+          b = c.spare;
+          c.spare = 0;
+        }
+        else
+        {
+          b = new_block(c);
+          if (b == 0)
+            return 0;
+        }
+        link(c.partial, b);
+      }
+      void * const ret = (b->store.malloc)();
+      ++b->used;
+      if (b->store.empty())
+        unlink(c.partial, b);
+      return ret;
+    }
+
+    void free BOOST_PREVENT_MACRO_SUBSTITUTION(void * const chunk, const size_type bytes)
+    { //! Deallocates a chunk returned by malloc(bytes).
+      //! If it was the last chunk of its block, the block is returned to the UserAllocator,
+      //! unless its size class has no empty block.
+      if (bytes > max_pooled)
+      {
+        (UserAllocator::free)(static_cast<char *>(chunk));
+        return;
+      }
+      size_class & c = classes[class_of[(bytes + min_align - 1) / min_align]];
+      block_header * const b = find_block(c, chunk);
+      const bool was_full = b->store.empty();
+      (b->store.free)(chunk);
+      if (--b->used == 0)
+      {
+        if (!was_full)
+          unlink(c.partial, b);
+        if (c.spare == 0)
+          c.spare = b;
+        else
+          delete_block(c, b);
+      }
+      else if (was_full)
+      {
+        link(c.partial, b);
+      }
+    }
+
+    bool release_memory()
+    { //! Returns the empty blocks kept by the size classes to the UserAllocator.
+      //! \returns true if at least one block was freed.
+      bool ret = false;
+      for (size_type i = 0; i < classes.size(); ++i)
+      {
+        size_class & c = classes[i];
+        if (c.spare != 0)
+        {
+          delete_block(c, c.spare);
+          c.spare = 0;
+          ret = true;
+        }
+      }
+      return ret;
+    }
+
+    bool purge_memory()
+    { //! Returns all the blocks to the UserAllocator, invalidating the chunks allocated
+      //! from the size classes. Chunks bigger than the largest size class must still be freed.
+      //! \returns true if at least one block was freed.
+      bool ret = false;
+      for (size_type i = 0; i < classes.size(); ++i)
+      {
+        size_class & c = classes[i];
+        for (size_type j = 0; j < c.blocks.size(); ++j)
+        {
+          c.blocks[j]->~block_header();
+          (UserAllocator::free)(reinterpret_cast<char *>(c.blocks[j]));
+          ret = true;
+        }
+        c.blocks.clear();
+        c.partial = 0;
+        c.spare = 0;
+      }
+      return ret;
+    }
+
+    size_type max_pooled_size() const
+    { //! \returns The size of the largest size class.
+      return max_pooled;
+    }
+    size_type class_count() const
+    { //! \returns The number of size classes.
+      return classes.size();
+    }
+    size_type class_index(const size_type bytes) const
+    { //! \returns The index of the size class that serves requests of bytes bytes,
+      //! or class_count() if they are forwarded to the UserAllocator.
+      return bytes > max_pooled ? classes.size() : class_of[(bytes + min_align - 1) / min_align];
+    }
+    size_type class_size(const size_type idx) const
+    { //! \returns The size of the chunks of the size class idx.
+      BOOST_ASSERT(idx < classes.size());
+      return classes[idx].chunk_size;
+    }
+    size_type block_count(const size_type idx) const
+    { //! \returns The number of blocks of the size class idx.
+      BOOST_ASSERT(idx < classes.size());
+      return classes[idx].blocks.size();
+    }
+};
+
+/*! \brief A C++ Standard Library conforming allocator that allocates from a multi_pool.
+
+  multi_pool_allocator holds a reference to a multi_pool, so all the copies and
+  rebound copies of an allocator allocate from the same multi_pool, and two allocators
+  compare equal if they use the same multi_pool. It can be used with containers that support
+  stateful allocators, like Boost.Container's and C++11 containers.
+
+  The multi_pool must outlive the allocators and the memory allocated with them. As multi_pool,
+  the allocator is not synchronized.
+*/
+template <typename T, typename UserAllocator>
+class multi_pool_allocator
+{
+  public:
+    typedef T value_type;
+    typedef UserAllocator user_allocator;
+    typedef multi_pool<UserAllocator> pool_type; //!< The type of the multi_pool.
+
+    typedef value_type * pointer;
+    typedef const value_type * const_pointer;
+    typedef value_type & reference;
+    typedef const value_type & const_reference;
+    typedef typename pool_type::size_type size_type;
+    typedef typename pool_type::difference_type difference_type;
+
+    //! \brief Nested class rebind allows for transformation from
+    //! multi_pool_allocator<T> to multi_pool_allocator<U>.
+    template <typename U>
+    struct rebind
+    {
+      typedef multi_pool_allocator<U, UserAllocator> other;
+    };
+
+  private:
+    template <typename U, typename UA> friend class multi_pool_allocator;
+
+    pool_type * p;
+
+  public:
+    // Not explicit, so that a multi_pool can be passed to container constructors
+    multi_pool_allocator(pool_type & mp)
+    : p(&mp)
+    { //! Constructs an allocator that allocates from mp.
+    }
+
+    // Default copy constructor used.
+
+    // Default assignment operator used.
+
+    // Not explicit, mimicking std::allocator [20.4.1]
+    template <typename U>
+    multi_pool_allocator(const multi_pool_allocator<U, UserAllocator> & other)
+    : p(other.p)
+    { }
+
+    // Default destructor used.
+
+    pool_type & pool() const
+    { //! \returns The multi_pool used by this allocator.
+      return *p;
+    }
+
+    static pointer address(reference r)
+    { return &r; }
+    static const_pointer address(const_reference s)
+    { return &s; }
+    static size_type max_size()
+    { return (std::numeric_limits<size_type>::max)() / sizeof(T); }
+    static void construct(const pointer ptr, const value_type & t)
+    { new (ptr) T(t); }
+    static void destroy(const pointer ptr)
+    {
+      ptr->~T();
+      (void) ptr; // Avoid unused variable warning.
+    }
+
+    template <typename U>
+    bool operator==(const multi_pool_allocator<U, UserAllocator> & other) const
+    { return p == other.p; }
+    template <typename U>
+    bool operator!=(const multi_pool_allocator<U, UserAllocator> & other) const
+    { return p != other.p; }
+
+    pointer allocate(const size_type n) const
+    { //! Allocates memory for n objects from the multi_pool.
+      //! \throws std::bad_alloc if out of memory.
+      if (n > max_size())
+        boost::throw_exception(std::bad_alloc());
+      const pointer ret = static_cast<pointer>((p->malloc)(n * sizeof(T)));
+      if (ret == 0)
+        boost::throw_exception(std::bad_alloc());
+      return ret;
+    }
+    pointer allocate(const size_type n, const void * const) const
+    { //! Allocates memory for n objects from the multi_pool.
+      return allocate(n);
+    }
+    void deallocate(const pointer ptr, const size_type n) const
+    { //! Deallocates memory for n objects allocated by allocate(n).
+#ifdef BOOST_NO_PROPER_STL_DEALLOCATE
+      if (ptr == 0 || n == 0)
+        return;
+#endif
+      (p->free)(ptr, n * sizeof(T));
+    }
+};
+
+/*! \brief Specialization of multi_pool_allocator<void>.
+
+Specialization of multi_pool_allocator<void> required to make the allocator standard-conforming.
+*/
+template <typename UserAllocator>
+class multi_pool_allocator<void, UserAllocator>
+{
+  public:
+    typedef void * pointer;
+    typedef const void * const_pointer;
+    typedef void value_type;
+
+    //! \brief Nested class rebind allows for transformation from
+    //! multi_pool_allocator<T> to multi_pool_allocator<U>.
+    template <class U>
+    struct rebind
+    {
+      typedef multi_pool_allocator<U, UserAllocator> other;
+    };
+};
+
+} // namespace boost
+
+#endif
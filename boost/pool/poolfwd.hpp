@@ -40,6 +40,15 @@ struct default_user_allocator_malloc_free;
 template <typename UserAllocator = default_user_allocator_new_delete>
 class pool;
 
+//
+// Location: <boost/pool/multi_pool.hpp>
+//
+template <typename UserAllocator = default_user_allocator_new_delete>
+class multi_pool;
+
+template <typename T, typename UserAllocator = default_user_allocator_new_delete>
+class multi_pool_allocator;
+
 //
 // Location: <boost/pool/object_pool.hpp>
 //
@@ -56,6 +65,17 @@ template <typename Tag, unsigned RequestedSize,
     unsigned MaxSize = 0>
 class singleton_pool;
 
+//
+// Location: <boost/pool/caching_singleton_pool.hpp>
+//
+template <typename Tag, unsigned RequestedSize,
+    typename UserAllocator = default_user_allocator_new_delete,
+    typename Mutex = details::pool::default_mutex,
+    unsigned NextSize = 32,
+    unsigned MaxSize = 0,
+    unsigned BatchSize = 32>
+class caching_singleton_pool;
+
 //
 // Location: <boost/pool/pool_alloc.hpp>
 //
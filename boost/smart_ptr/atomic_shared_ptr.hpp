@@ -0,0 +1,484 @@
+#ifndef BOOST_SMART_PTR_ATOMIC_SHARED_PTR_HPP_INCLUDED
+#define BOOST_SMART_PTR_ATOMIC_SHARED_PTR_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+//
+//  atomic_shared_ptr.hpp
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+//
+//  See http://www.boost.org/libs/smart_ptr/shared_ptr.htm for documentation.
+//
+
+#include <boost/config.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/detail/yield_k.hpp>
+#include <boost/atomic/atomic.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/assert.hpp>
+
+// The split reference count needs a lock-free 64 bit atomic word with
+// enough unused upper bits for the count next to the pointer: 32 bit
+// pointers, or the 47 bit user space addresses of x86-64. Elsewhere,
+// or if BOOST_SP_ATOMIC_SHARED_PTR_NO_SPLIT_COUNT is defined, the
+// spinlock pool used by atomic_load and friends protects the value.
+
+#if !defined( BOOST_SP_ATOMIC_SHARED_PTR_NO_SPLIT_COUNT ) && !( BOOST_ATOMIC_LLONG_LOCK_FREE == 2 && \
+    ( defined( __i386__ ) || defined( _M_IX86 ) || defined( __x86_64__ ) || defined( _M_X64 ) ) )
+# define BOOST_SP_ATOMIC_SHARED_PTR_NO_SPLIT_COUNT
+#endif
+
+#if defined( BOOST_SP_ATOMIC_SHARED_PTR_NO_SPLIT_COUNT )
+# include <boost/smart_ptr/detail/spinlock_pool.hpp>
+#endif
+
+namespace boost
+{
+
+#if !defined( BOOST_SP_ATOMIC_SHARED_PTR_NO_SPLIT_COUNT )
+
+namespace detail
+{
+
+// A snapshot of the stored shared_ptr. Snapshots are immutable and are
+// replaced as a whole by the writers.
+//
+// The lifetime of a snapshot is controlled by a split reference count:
+// the "external" count of readers that are accessing the snapshot is kept
+// in the upper bits of the atomic word that points to it, so that a reader
+// pins the snapshot and reads the pointer with a single fetch_add. When the
+// snapshot is replaced, the writer moves the external count into the
+// "internal" count below; readers that find the snapshot replaced
+// decrement the internal count instead. The snapshot is destroyed when the
+// internal count drops to zero after the transfer.
+
+template<class T> struct sp_atomic_snapshot
+{
+    shared_ptr<T> value_;
+    boost::atomic< long > internal_count_;
+
+    explicit sp_atomic_snapshot( shared_ptr<T> const & v ): value_( v ), internal_count_( 0 )
+    {
+    }
+
+    // Called by the writer that replaced the snapshot, external is the number of pins outstanding at that moment
+    void transfer( long external )
+    {
+        if( internal_count_.fetch_add( external, boost::memory_order_acq_rel ) == -external )
+        {
+            delete this;
+        }
+    }
+
+    // Called by a reader that has pinned the snapshot after it was replaced
+    void release()
+    {
+        if( internal_count_.fetch_sub( 1, boost::memory_order_acq_rel ) == 1 )
+        {
+            delete this;
+        }
+    }
+};
+
+} // namespace detail
+
+//
+//  atomic_shared_ptr
+//
+//  A shared_ptr that can be read and modified concurrently without locks.
+//  Loads never block; they pin the current snapshot with one atomic
+//  increment, copy it, and unpin it.
+//
+//  All the operations are sequentially consistent. The memory_order
+//  arguments are accepted for compatibility with std::atomic, and ignored.
+//
+
+template<class T> class atomic_shared_ptr
+{
+private:
+
+    typedef detail::sp_atomic_snapshot<T> snapshot_type;
+    typedef boost::uint64_t word_type;
+
+    // The pointer to the snapshot occupies the low bits of the word, the external count the high bits
+    BOOST_STATIC_CONSTANT( unsigned, count_shift = sizeof( void* ) == 8? 48: 32 );
+
+    static word_type count_one()
+    {
+        return static_cast< word_type >( 1 ) << count_shift;
+    }
+
+    static snapshot_type * pointer_of( word_type w )
+    {
+        return reinterpret_cast< snapshot_type* >( static_cast< std::size_t >( w & ( count_one() - 1 ) ) );
+    }
+
+    static word_type count_of( word_type w )
+    {
+        return w >> count_shift;
+    }
+
+    // A reader that finds this many pins backs off. The limit leaves room for
+    // the pins of the readers that are backing off, so that the count fits
+    // both in the word and in the long of the internal count
+    static word_type max_pins()
+    {
+        return static_cast< word_type >( 1 ) << ( 62 - count_shift );
+    }
+
+    static word_type make_word( snapshot_type * p )
+    {
+        word_type w = static_cast< word_type >( reinterpret_cast< std::size_t >( p ) );
+        BOOST_ASSERT( ( w >> count_shift ) == 0 );
+        return w;
+    }
+
+    // Every stored value gets a snapshot, even an empty one. Only a default
+    // constructed atomic_shared_ptr holds a null pointer, and it never comes
+    // back once replaced; otherwise a pin taken on one null word could be
+    // dropped against another, whose count would underflow
+    static snapshot_type * make_snapshot( shared_ptr<T> const & v )
+    {
+        return new snapshot_type( v );
+    }
+
+    boost::atomic< word_type > word_;
+
+    atomic_shared_ptr( atomic_shared_ptr const & );
+    atomic_shared_ptr & operator=( atomic_shared_ptr const & );
+
+private:
+
+    // Increments the external count, returns the pinned snapshot
+    snapshot_type * pin() const
+    {
+        boost::atomic< word_type > & word = const_cast< boost::atomic< word_type >& >( word_ );
+
+        for( unsigned k = 0; ; ++k )
+        {
+            word_type w = word.fetch_add( count_one(), boost::memory_order_seq_cst );
+
+            if( count_of( w ) < max_pins() )
+            {
+                return pointer_of( w );
+            }
+
+            unpin( pointer_of( w ) );
+            boost::detail::yield( k );
+        }
+    }
+
+    void unpin( snapshot_type * p ) const
+    {
+        boost::atomic< word_type > & word = const_cast< boost::atomic< word_type >& >( word_ );
+        word_type w = word.load( boost::memory_order_relaxed );
+
+        while( pointer_of( w ) == p )
+        {
+            if( word.compare_exchange_weak( w, w - count_one(), boost::memory_order_release, boost::memory_order_relaxed ) )
+            {
+                return;
+            }
+        }
+
+        // The snapshot was replaced and the writer has moved our pin to the internal count
+        if( p != 0 )
+        {
+            p->release();
+        }
+    }
+
+    // Disposes of a snapshot removed from the atomic word
+    static void retire( word_type w )
+    {
+        snapshot_type * p = pointer_of( w );
+
+        if( p != 0 )
+        {
+            p->transfer( static_cast< long >( count_of( w ) ) );
+        }
+    }
+
+public:
+
+    typedef T element_type;
+    typedef shared_ptr<T> value_type;
+
+    atomic_shared_ptr() BOOST_NOEXCEPT: word_( 0 )
+    {
+    }
+
+    explicit atomic_shared_ptr( shared_ptr<T> const & r ): word_( make_word( make_snapshot( r ) ) )
+    {
+    }
+
+    ~atomic_shared_ptr()
+    {
+        // No concurrent access is possible at this point, so the external count is zero
+        delete pointer_of( word_.load( boost::memory_order_acquire ) );
+    }
+
+    bool is_lock_free() const BOOST_NOEXCEPT
+    {
+        return word_.is_lock_free();
+    }
+
+    shared_ptr<T> load( memory_order /*mo*/ = memory_order_seq_cst ) const
+    {
+        snapshot_type * p = pin();
+
+        shared_ptr<T> r;
+
+        if( p != 0 )
+        {
+            r = p->value_;
+        }
+
+        unpin( p );
+
+        return r;
+    }
+
+    operator shared_ptr<T>() const
+    {
+        return load();
+    }
+
+    void store( shared_ptr<T> r, memory_order /*mo*/ = memory_order_seq_cst )
+    {
+        retire( word_.exchange( make_word( make_snapshot( r ) ), boost::memory_order_seq_cst ) );
+    }
+
+    atomic_shared_ptr & operator=( shared_ptr<T> const & r )
+    {
+        store( r );
+        return *this;
+    }
+
+    shared_ptr<T> exchange( shared_ptr<T> r, memory_order /*mo*/ = memory_order_seq_cst )
+    {
+        snapshot_type * q = make_snapshot( r );
+
+        // Pin the current snapshot so that its value can be returned after it is replaced
+        snapshot_type * p = pin();
+
+        for( ;; )
+        {
+            word_type w = word_.load( boost::memory_order_relaxed );
+
+            while( pointer_of( w ) == p )
+            {
+                if( word_.compare_exchange_weak( w, make_word( q ), boost::memory_order_seq_cst, boost::memory_order_relaxed ) )
+                {
+                    shared_ptr<T> old;
+
+                    if( p != 0 )
+                    {
+                        old = p->value_;
+
+                        // Our own pin is included in the transferred count and is released right away
+                        p->transfer( static_cast< long >( count_of( w ) ) - 1 );
+                    }
+
+                    return old;
+                }
+            }
+
+            // Someone else has replaced the snapshot, start over with the new one
+            unpin( p );
+            p = pin();
+        }
+    }
+
+    bool compare_exchange_strong( shared_ptr<T> & v, shared_ptr<T> w, memory_order /*success*/, memory_order /*failure*/ )
+    {
+        return compare_exchange_strong( v, w );
+    }
+
+    bool compare_exchange_weak( shared_ptr<T> & v, shared_ptr<T> w, memory_order /*success*/, memory_order /*failure*/ )
+    {
+        return compare_exchange_strong( v, w );
+    }
+
+    bool compare_exchange_weak( shared_ptr<T> & v, shared_ptr<T> w, memory_order /*mo*/ = memory_order_seq_cst )
+    {
+        return compare_exchange_strong( v, w );
+    }
+
+    bool compare_exchange_strong( shared_ptr<T> & v, shared_ptr<T> w, memory_order /*mo*/ = memory_order_seq_cst )
+    {
+        snapshot_type * q = 0;
+
+        for( unsigned k = 0; ; ++k )
+        {
+            snapshot_type * p = pin();
+
+            if( p == 0? !v._internal_equiv( shared_ptr<T>() ): !v._internal_equiv( p->value_ ) )
+            {
+                shared_ptr<T> current;
+
+                if( p != 0 )
+                {
+                    current = p->value_;
+                }
+
+                unpin( p );
+
+                delete q;
+                v.swap( current );
+                return false;
+            }
+
+            if( q == 0 )
+            {
+                q = new snapshot_type( w );
+            }
+
+            word_type cw = word_.load( boost::memory_order_relaxed );
+
+            while( pointer_of( cw ) == p )
+            {
+                if( word_.compare_exchange_weak( cw, make_word( q ), boost::memory_order_seq_cst, boost::memory_order_relaxed ) )
+                {
+                    if( p != 0 )
+                    {
+                        p->transfer( static_cast< long >( count_of( cw ) ) - 1 );
+                    }
+
+                    return true;
+                }
+            }
+
+            // The snapshot was replaced while we were comparing, retry with the new one
+            unpin( p );
+            boost::detail::yield( k );
+        }
+    }
+};
+
+#else // !defined( BOOST_SP_ATOMIC_SHARED_PTR_NO_SPLIT_COUNT )
+
+//
+//  atomic_shared_ptr
+//
+//  Lock-based version, for the platforms where the split count can't be
+//  used. The value is protected by a spinlock of the pool, like in
+//  atomic_load( shared_ptr<T> const * ).
+//
+//  All the operations are sequentially consistent. The memory_order
+//  arguments are accepted for compatibility with std::atomic, and ignored.
+//
+
+template<class T> class atomic_shared_ptr
+{
+private:
+
+    typedef boost::detail::spinlock_pool<2> spinlock_pool;
+
+    shared_ptr<T> value_;
+
+    atomic_shared_ptr( atomic_shared_ptr const & );
+    atomic_shared_ptr & operator=( atomic_shared_ptr const & );
+
+public:
+
+    typedef T element_type;
+    typedef shared_ptr<T> value_type;
+
+    atomic_shared_ptr() BOOST_NOEXCEPT
+    {
+    }
+
+    explicit atomic_shared_ptr( shared_ptr<T> const & r ): value_( r )
+    {
+    }
+
+    bool is_lock_free() const BOOST_NOEXCEPT
+    {
+        return false;
+    }
+
+    shared_ptr<T> load( memory_order /*mo*/ = memory_order_seq_cst ) const
+    {
+        spinlock_pool::scoped_lock lock( &value_ );
+        return value_;
+    }
+
+    operator shared_ptr<T>() const
+    {
+        return load();
+    }
+
+    void store( shared_ptr<T> r, memory_order /*mo*/ = memory_order_seq_cst )
+    {
+        spinlock_pool::scoped_lock lock( &value_ );
+        value_.swap( r );
+    }
+
+    atomic_shared_ptr & operator=( shared_ptr<T> const & r )
+    {
+        store( r );
+        return *this;
+    }
+
+    shared_ptr<T> exchange( shared_ptr<T> r, memory_order /*mo*/ = memory_order_seq_cst )
+    {
+        {
+            spinlock_pool::scoped_lock lock( &value_ );
+            value_.swap( r );
+        }
+
+        return r;
+    }
+
+    bool compare_exchange_strong( shared_ptr<T> & v, shared_ptr<T> w, memory_order /*success*/, memory_order /*failure*/ )
+    {
+        return compare_exchange_strong( v, w );
+    }
+
+    bool compare_exchange_weak( shared_ptr<T> & v, shared_ptr<T> w, memory_order /*success*/, memory_order /*failure*/ )
+    {
+        return compare_exchange_strong( v, w );
+    }
+
+    bool compare_exchange_weak( shared_ptr<T> & v, shared_ptr<T> w, memory_order /*mo*/ = memory_order_seq_cst )
+    {
+        return compare_exchange_strong( v, w );
+    }
+
+    bool compare_exchange_strong( shared_ptr<T> & v, shared_ptr<T> w, memory_order /*mo*/ = memory_order_seq_cst )
+    {
+        shared_ptr<T> current;
+
+        {
+            spinlock_pool::scoped_lock lock( &value_ );
+
+            if( value_._internal_equiv( v ) )
+            {
+                value_.swap( w );
+                return true;
+            }
+
+            current = value_;
+        }
+
+        v.swap( current );
+        return false;
+    }
+};
+
+#endif // !defined( BOOST_SP_ATOMIC_SHARED_PTR_NO_SPLIT_COUNT )
+
+} // namespace boost
+
+#endif  // #ifndef BOOST_SMART_PTR_ATOMIC_SHARED_PTR_HPP_INCLUDED
@@ -0,0 +1,176 @@
+#ifndef BOOST_SMART_PTR_DETAIL_LOCAL_COUNTED_BASE_HPP_INCLUDED
+#define BOOST_SMART_PTR_DETAIL_LOCAL_COUNTED_BASE_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+//
+//  detail/local_counted_base.hpp
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+//  local_shared_count is the count used by local_shared_ptr. The local
+//  count is an ordinary integer and is only touched by the owning thread;
+//  the control block also holds one reference to the thread-safe
+//  sp_counted_base of the object, which is released when the last local
+//  owner goes away and is used for conversions to shared_ptr.
+//
+
+#include <boost/config.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+
+class local_counted_base
+{
+private:
+
+    local_counted_base( local_counted_base const & );
+    local_counted_base & operator= ( local_counted_base const & );
+
+    long use_count_;                        // #local owners
+    shared_ptr< void const volatile > pn_;  // the thread-safe owner
+
+public:
+
+    explicit local_counted_base( shared_ptr< void const volatile > const & pn ): use_count_( 1 ), pn_( pn )
+    {
+    }
+
+    void add_ref() BOOST_NOEXCEPT
+    {
+        ++use_count_;
+    }
+
+    void release() BOOST_NOEXCEPT
+    {
+        if( --use_count_ == 0 )
+        {
+            delete this;
+        }
+    }
+
+    long use_count() const BOOST_NOEXCEPT
+    {
+        return use_count_;
+    }
+
+    shared_ptr< void const volatile > const & shared_owner() const BOOST_NOEXCEPT
+    {
+        return pn_;
+    }
+};
+
+class local_shared_count
+{
+private:
+
+    local_counted_base * pi_;
+
+public:
+
+    local_shared_count() BOOST_NOEXCEPT: pi_( 0 )
+    {
+    }
+
+    // Takes over one reference of the thread-safe owner; an empty owner produces an empty count
+    template< class Y > explicit local_shared_count( shared_ptr< Y > const & r ): pi_( 0 )
+    {
+        if( r.use_count() != 0 )
+        {
+            pi_ = new local_counted_base( r );
+        }
+    }
+
+    ~local_shared_count() // nothrow
+    {
+        if( pi_ != 0 ) pi_->release();
+    }
+
+    local_shared_count( local_shared_count const & r ) BOOST_NOEXCEPT: pi_( r.pi_ )
+    {
+        if( pi_ != 0 ) pi_->add_ref();
+    }
+
+#if !defined( BOOST_NO_CXX11_RVALUE_REFERENCES )
+
+    local_shared_count( local_shared_count && r ) BOOST_NOEXCEPT: pi_( r.pi_ )
+    {
+        r.pi_ = 0;
+    }
+
+#endif
+
+    local_shared_count & operator= ( local_shared_count const & r ) BOOST_NOEXCEPT
+    {
+        local_counted_base * tmp = r.pi_;
+
+        if( tmp != pi_ )
+        {
+            if( tmp != 0 ) tmp->add_ref();
+            if( pi_ != 0 ) pi_->release();
+            pi_ = tmp;
+        }
+
+        return *this;
+    }
+
+    void swap( local_shared_count & r ) BOOST_NOEXCEPT
+    {
+        local_counted_base * tmp = r.pi_;
+        r.pi_ = pi_;
+        pi_ = tmp;
+    }
+
+    long use_count() const BOOST_NOEXCEPT
+    {
+        return pi_ != 0? pi_->use_count(): 0;
+    }
+
+    bool unique() const BOOST_NOEXCEPT
+    {
+        return use_count() == 1;
+    }
+
+    bool empty() const BOOST_NOEXCEPT
+    {
+        return pi_ == 0;
+    }
+
+    shared_ptr< void const volatile > shared_owner() const BOOST_NOEXCEPT
+    {
+        return pi_ != 0? pi_->shared_owner(): shared_ptr< void const volatile >();
+    }
+
+    template< class Y > bool owner_before( shared_ptr< Y > const & r ) const BOOST_NOEXCEPT
+    {
+        return pi_ != 0? pi_->shared_owner().owner_before( r ): shared_ptr< void const volatile >().owner_before( r );
+    }
+
+    bool owner_before( local_shared_count const & r ) const BOOST_NOEXCEPT
+    {
+        return r.pi_ != 0? owner_before( r.pi_->shared_owner() ): owner_before( shared_ptr< void const volatile >() );
+    }
+
+    friend inline bool operator==( local_shared_count const & a, local_shared_count const & b ) BOOST_NOEXCEPT
+    {
+        return a.pi_ == b.pi_;
+    }
+};
+
+} // namespace detail
+
+} // namespace boost
+
+#endif  // #ifndef BOOST_SMART_PTR_DETAIL_LOCAL_COUNTED_BASE_HPP_INCLUDED
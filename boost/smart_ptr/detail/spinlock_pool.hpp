@@ -20,33 +20,84 @@
 //  spinlock_pool<1> is reserved for shared_ptr reference counts
 //  spinlock_pool<2> is reserved for shared_ptr atomic access
 //
+//  BOOST_SP_SPINLOCK_POOL_SIZE sets the number of spinlocks in a pool;
+//  it must be a power of two not greater than 256 (default 64)
+//
+//  BOOST_SP_CACHE_LINE_SIZE sets the size each spinlock is padded to,
+//  so that distinct spinlocks never share a cache line (default 64)
+//
 
 #include <boost/config.hpp>
 #include <boost/smart_ptr/detail/spinlock.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
 #include <cstddef>
 
+#ifndef BOOST_SP_SPINLOCK_POOL_SIZE
+# define BOOST_SP_SPINLOCK_POOL_SIZE 64
+#endif
+
+#ifndef BOOST_SP_CACHE_LINE_SIZE
+# define BOOST_SP_CACHE_LINE_SIZE 64
+#endif
+
+#if BOOST_SP_SPINLOCK_POOL_SIZE <= 0 || BOOST_SP_SPINLOCK_POOL_SIZE > 256 || ( BOOST_SP_SPINLOCK_POOL_SIZE & ( BOOST_SP_SPINLOCK_POOL_SIZE - 1 ) ) != 0
+# error BOOST_SP_SPINLOCK_POOL_SIZE must be a power of two not greater than 256
+#endif
+
 namespace boost
 {
 
 namespace detail
 {
 
+template< std::size_t N > struct sp_spinlock_padding
+{
+    char data_[ N ];
+};
+
+template<> struct sp_spinlock_padding< 0 >
+{
+};
+
+// A spinlock occupying a whole number of cache lines
+
+struct BOOST_ALIGNMENT( BOOST_SP_CACHE_LINE_SIZE ) sp_padded_spinlock
+{
+    spinlock sp_;
+    sp_spinlock_padding< ( BOOST_SP_CACHE_LINE_SIZE - sizeof( spinlock ) % BOOST_SP_CACHE_LINE_SIZE ) % BOOST_SP_CACHE_LINE_SIZE > pad_;
+};
+
 template< int I > class spinlock_pool
 {
 private:
 
-    static spinlock pool_[ 41 ];
+    enum { pool_size = BOOST_SP_SPINLOCK_POOL_SIZE };
 
-public:
+    static sp_padded_spinlock pool_[ pool_size ];
 
-    static spinlock & spinlock_for( void const * pv )
+    static std::size_t index_for( void const * pv )
     {
 #if defined(__VMS) && __INITIAL_POINTER_SIZE == 64  
-        std::size_t i = reinterpret_cast< unsigned long long >( pv ) % 41;
+        unsigned long long h = reinterpret_cast< unsigned long long >( pv );
 #else  
-        std::size_t i = reinterpret_cast< std::size_t >( pv ) % 41;
+        std::size_t h = reinterpret_cast< std::size_t >( pv );
 #endif  
-        return pool_[ i ];
+
+        // The low bits are mostly zero due to alignment, and objects allocated
+        // together differ mostly in the middle bits; fold both into the index
+
+        h ^= h >> 4;
+        h ^= h >> 9;
+        h ^= h >> 17;
+
+        return static_cast< std::size_t >( h ) & ( pool_size - 1 );
+    }
+
+public:
+
+    static spinlock & spinlock_for( void const * pv )
+    {
+        return pool_[ index_for( pv ) ].sp_;
     }
 
     class scoped_lock
@@ -72,19 +123,15 @@ public:
     };
 };
 
-template< int I > spinlock spinlock_pool< I >::pool_[ 41 ] =
+#define BOOST_SP_PADDED_SPINLOCK_INIT( z, n, data ) { BOOST_DETAIL_SPINLOCK_INIT }
+
+template< int I > sp_padded_spinlock spinlock_pool< I >::pool_[ spinlock_pool< I >::pool_size ] =
 {
-    BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, 
-    BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, 
-    BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, 
-    BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, 
-    BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, 
-    BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, 
-    BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, 
-    BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, BOOST_DETAIL_SPINLOCK_INIT, 
-    BOOST_DETAIL_SPINLOCK_INIT
+    BOOST_PP_ENUM( BOOST_SP_SPINLOCK_POOL_SIZE, BOOST_SP_PADDED_SPINLOCK_INIT, ~ )
 };
 
+#undef BOOST_SP_PADDED_SPINLOCK_INIT
+
 } // namespace detail
 } // namespace boost
 
@@ -0,0 +1,347 @@
+#ifndef BOOST_SMART_PTR_LOCAL_SHARED_PTR_HPP_INCLUDED
+#define BOOST_SMART_PTR_LOCAL_SHARED_PTR_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+//
+//  local_shared_ptr.hpp
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+//  See http://www.boost.org/libs/smart_ptr/shared_ptr.htm for documentation.
+//
+//  local_shared_ptr is a shared_ptr variant for objects that are owned by
+//  a single thread. Copies and destruction update a plain integer count,
+//  without atomic read-modify-write instructions. A local_shared_ptr is
+//  converted to a shared_ptr when ownership has to escape the thread; the
+//  shared_ptr and all the local_shared_ptr copies share ownership of the
+//  same object.
+//
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/detail/local_counted_base.hpp>
+#include <boost/smart_ptr/detail/sp_convertible.hpp>
+#include <boost/smart_ptr/detail/sp_nullptr_t.hpp>
+#include <algorithm>            // for std::swap
+
+namespace boost
+{
+
+template<class T> class local_shared_ptr
+{
+private:
+
+    // Borland 5.5.1 specific workarounds
+    typedef local_shared_ptr<T> this_type;
+
+public:
+
+    typedef T element_type;
+
+    local_shared_ptr() BOOST_NOEXCEPT : px( 0 ), pn()
+    {
+    }
+
+#if !defined( BOOST_NO_CXX11_NULLPTR )
+
+    local_shared_ptr( boost::detail::sp_nullptr_t ) BOOST_NOEXCEPT : px( 0 ), pn()
+    {
+    }
+
+#endif
+
+    template<class Y>
+    explicit local_shared_ptr( Y * p ): px( p ), pn( shared_ptr<Y>( p ) )
+    {
+    }
+
+    template<class Y, class D> local_shared_ptr( Y * p, D d ): px( p ), pn( shared_ptr<Y>( p, d ) )
+    {
+    }
+
+    template<class Y, class D, class A> local_shared_ptr( Y * p, D d, A a ): px( p ), pn( shared_ptr<Y>( p, d, a ) )
+    {
+    }
+
+    // Shares ownership with a thread-safe shared_ptr; only this conversion touches its atomic count
+
+    template<class Y>
+#if !defined( BOOST_SP_NO_SP_CONVERTIBLE )
+
+    local_shared_ptr( shared_ptr<Y> const & r, typename boost::detail::sp_enable_if_convertible<Y,T>::type = boost::detail::sp_empty() )
+
+#else
+
+    local_shared_ptr( shared_ptr<Y> const & r )
+
+#endif
+    : px( r.get() ), pn( r )
+    {
+    }
+
+    // aliasing
+    template<class Y>
+    local_shared_ptr( local_shared_ptr<Y> const & r, element_type * p ) BOOST_NOEXCEPT : px( p ), pn( r.pn )
+    {
+    }
+
+//  generated copy constructor, destructor are fine...
+
+#if !defined( BOOST_NO_CXX11_RVALUE_REFERENCES )
+
+// ... except in C++0x, move disables the implicit copy
+
+    local_shared_ptr( local_shared_ptr const & r ) BOOST_NOEXCEPT : px( r.px ), pn( r.pn )
+    {
+    }
+
+    local_shared_ptr( local_shared_ptr && r ) BOOST_NOEXCEPT : px( r.px ), pn( static_cast< boost::detail::local_shared_count && >( r.pn ) )
+    {
+        r.px = 0;
+    }
+
+#endif
+
+    template<class Y>
+#if !defined( BOOST_SP_NO_SP_CONVERTIBLE )
+
+    local_shared_ptr( local_shared_ptr<Y> const & r, typename boost::detail::sp_enable_if_convertible<Y,T>::type = boost::detail::sp_empty() )
+
+#else
+
+    local_shared_ptr( local_shared_ptr<Y> const & r )
+
+#endif
+    BOOST_NOEXCEPT : px( r.px ), pn( r.pn )
+    {
+    }
+
+    // assignment
+
+    local_shared_ptr & operator=( local_shared_ptr const & r ) BOOST_NOEXCEPT
+    {
+        this_type( r ).swap( *this );
+        return *this;
+    }
+
+#if !defined( BOOST_NO_CXX11_RVALUE_REFERENCES )
+
+    local_shared_ptr & operator=( local_shared_ptr && r ) BOOST_NOEXCEPT
+    {
+        this_type( static_cast< local_shared_ptr && >( r ) ).swap( *this );
+        return *this;
+    }
+
+#endif
+
+    template<class Y>
+    local_shared_ptr & operator=( local_shared_ptr<Y> const & r ) BOOST_NOEXCEPT
+    {
+        this_type( r ).swap( *this );
+        return *this;
+    }
+
+    template<class Y>
+    local_shared_ptr & operator=( shared_ptr<Y> const & r )
+    {
+        this_type( r ).swap( *this );
+        return *this;
+    }
+
+#if !defined( BOOST_NO_CXX11_NULLPTR )
+
+    local_shared_ptr & operator=( boost::detail::sp_nullptr_t ) BOOST_NOEXCEPT
+    {
+        this_type().swap(*this);
+        return *this;
+    }
+
+#endif
+
+    void reset() BOOST_NOEXCEPT
+    {
+        this_type().swap(*this);
+    }
+
+    template<class Y> void reset( Y * p ) // Y must be complete
+    {
+        BOOST_ASSERT( p == 0 || p != px ); // catch self-reset errors
+        this_type( p ).swap( *this );
+    }
+
+    template<class Y, class D> void reset( Y * p, D d )
+    {
+        this_type( p, d ).swap( *this );
+    }
+
+    template<class Y, class D, class A> void reset( Y * p, D d, A a )
+    {
+        this_type( p, d, a ).swap( *this );
+    }
+
+    template<class Y> void reset( local_shared_ptr<Y> const & r, element_type * p )
+    {
+        this_type( r, p ).swap( *this );
+    }
+
+    // conversion to the thread-safe shared_ptr, the result may be passed to other threads
+
+    template<class Y> operator shared_ptr<Y>() const BOOST_NOEXCEPT
+    {
+        boost::detail::sp_assert_convertible< T, Y >();
+        return shared_ptr<Y>( pn.shared_owner(), px );
+    }
+
+    // never throws (but has a BOOST_ASSERT in it, so not marked with BOOST_NOEXCEPT)
+    T & operator* () const
+    {
+        BOOST_ASSERT( px != 0 );
+        return *px;
+    }
+
+    // never throws (but has a BOOST_ASSERT in it, so not marked with BOOST_NOEXCEPT)
+    T * operator-> () const
+    {
+        BOOST_ASSERT( px != 0 );
+        return px;
+    }
+
+    element_type * get() const BOOST_NOEXCEPT
+    {
+        return px;
+    }
+
+// implicit conversion to "bool"
+#include <boost/smart_ptr/detail/operator_bool.hpp>
+
+    // the number of local_shared_ptr instances sharing ownership in this thread
+    long local_use_count() const BOOST_NOEXCEPT
+    {
+        return pn.use_count();
+    }
+
+    bool unique() const BOOST_NOEXCEPT
+    {
+        return pn.unique();
+    }
+
+    void swap( local_shared_ptr & other ) BOOST_NOEXCEPT
+    {
+        std::swap(px, other.px);
+        pn.swap(other.pn);
+    }
+
+    template<class Y> bool owner_before( local_shared_ptr<Y> const & rhs ) const BOOST_NOEXCEPT
+    {
+        return pn.owner_before( rhs.pn );
+    }
+
+    template<class Y> bool owner_before( shared_ptr<Y> const & rhs ) const BOOST_NOEXCEPT
+    {
+        return pn.owner_before( rhs );
+    }
+
+// Tasteless as this may seem, making all members public allows member templates
+// to work in the absence of member template friends. (Matthew Langston)
+
+#ifndef BOOST_NO_MEMBER_TEMPLATE_FRIENDS
+
+private:
+
+    template<class Y> friend class local_shared_ptr;
+
+#endif
+
+    element_type * px;                          // contained pointer
+    boost::detail::local_shared_count pn;       // local reference counter
+
+};  // local_shared_ptr
+
+template<class T, class U> inline bool operator==(local_shared_ptr<T> const & a, local_shared_ptr<U> const & b) BOOST_NOEXCEPT
+{
+    return a.get() == b.get();
+}
+
+template<class T, class U> inline bool operator!=(local_shared_ptr<T> const & a, local_shared_ptr<U> const & b) BOOST_NOEXCEPT
+{
+    return a.get() != b.get();
+}
+
+#if !defined( BOOST_NO_CXX11_NULLPTR )
+
+template<class T> inline bool operator==( local_shared_ptr<T> const & p, boost::detail::sp_nullptr_t ) BOOST_NOEXCEPT
+{
+    return p.get() == 0;
+}
+
+template<class T> inline bool operator==( boost::detail::sp_nullptr_t, local_shared_ptr<T> const & p ) BOOST_NOEXCEPT
+{
+    return p.get() == 0;
+}
+
+template<class T> inline bool operator!=( local_shared_ptr<T> const & p, boost::detail::sp_nullptr_t ) BOOST_NOEXCEPT
+{
+    return p.get() != 0;
+}
+
+template<class T> inline bool operator!=( boost::detail::sp_nullptr_t, local_shared_ptr<T> const & p ) BOOST_NOEXCEPT
+{
+    return p.get() != 0;
+}
+
+#endif
+
+template<class T, class U> inline bool operator<(local_shared_ptr<T> const & a, local_shared_ptr<U> const & b) BOOST_NOEXCEPT
+{
+    return a.owner_before( b );
+}
+
+template<class T> inline void swap(local_shared_ptr<T> & a, local_shared_ptr<T> & b) BOOST_NOEXCEPT
+{
+    a.swap(b);
+}
+
+template<class T, class U> local_shared_ptr<T> static_pointer_cast( local_shared_ptr<U> const & r ) BOOST_NOEXCEPT
+{
+    (void) static_cast< T* >( static_cast< U* >( 0 ) );
+
+    T * p = static_cast< T* >( r.get() );
+    return local_shared_ptr<T>( r, p );
+}
+
+template<class T, class U> local_shared_ptr<T> const_pointer_cast( local_shared_ptr<U> const & r ) BOOST_NOEXCEPT
+{
+    (void) const_cast< T* >( static_cast< U* >( 0 ) );
+
+    T * p = const_cast< T* >( r.get() );
+    return local_shared_ptr<T>( r, p );
+}
+
+template<class T, class U> local_shared_ptr<T> dynamic_pointer_cast( local_shared_ptr<U> const & r ) BOOST_NOEXCEPT
+{
+    (void) dynamic_cast< T* >( static_cast< U* >( 0 ) );
+
+    T * p = dynamic_cast< T* >( r.get() );
+    return p? local_shared_ptr<T>( r, p ): local_shared_ptr<T>();
+}
+
+// get_pointer() enables boost::mem_fn to recognize local_shared_ptr
+
+template<class T> inline T * get_pointer(local_shared_ptr<T> const & p) BOOST_NOEXCEPT
+{
+    return p.get();
+}
+
+} // namespace boost
+
+#endif  // #ifndef BOOST_SMART_PTR_LOCAL_SHARED_PTR_HPP_INCLUDED
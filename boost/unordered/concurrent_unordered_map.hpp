@@ -0,0 +1,881 @@
+// Copyright (C) 2026 agent <agent@local>.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org/libs/unordered for documentation
+
+#ifndef BOOST_UNORDERED_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
+#define BOOST_UNORDERED_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/detail/foa.hpp>
+#include <boost/unordered/detail/util.hpp>
+#include <boost/atomic.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/move/move.hpp>
+#include <boost/utility/addressof.hpp>
+#include <climits>
+#include <memory>
+#include <functional>
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+#if defined(BOOST_WINDOWS)
+#include <boost/detail/winapi/thread.hpp>
+#else
+#include <sched.h>
+#endif
+
+// The number of shards is 2 to the power of this.
+#if !defined(BOOST_UNORDERED_CONCURRENT_SHARD_BITS)
+#define BOOST_UNORDERED_CONCURRENT_SHARD_BITS 6
+#endif
+
+namespace boost { namespace unordered { namespace detail { namespace foa {
+
+    // The lock of a shard. It's only held for a single table operation,
+    // so a thread waiting for it spins, and yields after a while in case
+    // the thread holding it has been preempted.
+
+    class concurrent_spinlock
+    {
+    public:
+        concurrent_spinlock() : locked_(false) {}
+
+        void lock()
+        {
+            for (unsigned k = 0;
+                locked_.exchange(true, boost::memory_order_acquire); )
+            {
+                while (locked_.load(boost::memory_order_relaxed))
+                    pause(k++);
+            }
+        }
+
+        void unlock()
+        {
+            locked_.store(false, boost::memory_order_release);
+        }
+
+        class scoped_lock
+        {
+        public:
+            explicit scoped_lock(concurrent_spinlock& l) : lock_(l)
+            {
+                lock_.lock();
+            }
+
+            ~scoped_lock() { lock_.unlock(); }
+
+        private:
+            concurrent_spinlock& lock_;
+
+            scoped_lock(scoped_lock const&);
+            scoped_lock& operator=(scoped_lock const&);
+        };
+
+    private:
+        boost::atomic<bool> locked_;
+
+        static void pause(unsigned k)
+        {
+            if (k < 16) {
+#if defined(BOOST_UNORDERED_FOA_SSE2)
+                _mm_pause();
+#endif
+            }
+            else {
+#if defined(BOOST_WINDOWS)
+                boost::detail::winapi::SwitchToThread();
+#else
+                sched_yield();
+#endif
+            }
+        }
+
+        concurrent_spinlock(concurrent_spinlock const&);
+        concurrent_spinlock& operator=(concurrent_spinlock const&);
+    };
+
+    // A shard of a concurrent container: an open addressing table and the
+    // lock which protects it. The alignment pads each shard to whole cache
+    // lines, so that the locks of neighbouring shards don't share one.
+
+    template <typename Table>
+    struct BOOST_ALIGNMENT(64) concurrent_shard
+    {
+        typedef concurrent_spinlock mutex_type;
+        typedef mutex_type::scoped_lock lock_type;
+
+        mutex_type mutex_;
+        Table table_;
+#if defined(BOOST_NO_ALIGNMENT)
+        char padding_[64];
+#endif
+
+        concurrent_shard(typename Table::hasher const& hf,
+                typename Table::key_equal const& eq,
+                typename Table::value_allocator const& a) :
+            mutex_(), table_(0, hf, eq, a)
+        {
+        }
+
+        concurrent_shard(Table const& x,
+                typename Table::value_allocator const& a) :
+            mutex_(), table_(x, a)
+        {
+        }
+
+    private:
+        concurrent_shard(concurrent_shard const&);
+        concurrent_shard& operator=(concurrent_shard const&);
+    };
+
+    // The array of shards. Allocated and constructed together, and only
+    // destroyed by the container's destructor.
+
+    template <typename Table>
+    struct concurrent_shards
+    {
+        typedef concurrent_shard<Table> shard;
+        typedef typename Table::value_allocator value_allocator;
+        typedef typename boost::unordered::detail::rebind_wrap<
+            value_allocator, shard>::type shard_allocator;
+        typedef boost::unordered::detail::allocator_traits<shard_allocator>
+            shard_allocator_traits;
+        typedef typename shard_allocator_traits::pointer shard_pointer;
+
+        shard_allocator alloc_;
+        shard_pointer shards_ptr_;
+        shard* shards_;
+        std::size_t count_;
+
+        concurrent_shards(std::size_t count,
+                typename Table::hasher const& hf,
+                typename Table::key_equal const& eq,
+                value_allocator const& a) :
+            alloc_(a), shards_ptr_(), shards_(), count_(count)
+        {
+            guard g(*this);
+
+            for (; g.constructed_ < count_; ++g.constructed_)
+                new((void*) (shards_ + g.constructed_)) shard(hf, eq, a);
+        }
+
+        // Copies the other shards one at a time, with each one locked.
+        concurrent_shards(concurrent_shards const& x,
+                value_allocator const& a) :
+            alloc_(a), shards_ptr_(), shards_(), count_(x.count_)
+        {
+            guard g(*this);
+
+            for (; g.constructed_ < count_; ++g.constructed_) {
+                shard& s = x[g.constructed_];
+                typename shard::lock_type lock(s.mutex_);
+                new((void*) (shards_ + g.constructed_)) shard(s.table_, a);
+            }
+        }
+
+        ~concurrent_shards()
+        {
+            destroy(count_);
+        }
+
+        shard& operator[](std::size_t i) const
+        {
+            return shards_[i];
+        }
+
+        // Allocates the shards, and destroys them if construction throws.
+        struct guard
+        {
+            concurrent_shards& shards_;
+            std::size_t constructed_;
+
+            explicit guard(concurrent_shards& s) :
+                shards_(s), constructed_(0)
+            {
+                s.shards_ptr_ = shard_allocator_traits::allocate(s.alloc_,
+                    s.count_);
+                s.shards_ = boost::addressof(*s.shards_ptr_);
+            }
+
+            ~guard()
+            {
+                if (constructed_ != shards_.count_)
+                    shards_.destroy(constructed_);
+            }
+
+        private:
+            guard(guard const&);
+            guard& operator=(guard const&);
+        };
+
+        void destroy(std::size_t constructed)
+        {
+            if (!shards_) return;
+
+            for (std::size_t i = 0; i < constructed; ++i)
+                shards_[i].~shard();
+            shard_allocator_traits::deallocate(alloc_, shards_ptr_, count_);
+            shards_ptr_ = shard_pointer();
+            shards_ = 0;
+        }
+
+    private:
+        concurrent_shards(concurrent_shards const&);
+        concurrent_shards& operator=(concurrent_shards const&);
+    };
+}}}}
+
+namespace boost
+{
+namespace unordered
+{
+    // A hash map which can be used from several threads at once. The
+    // elements are split between a fixed number of shards by their hash
+    // value, each shard being an open addressing table protected by its
+    // own mutex, so operations on elements in different shards don't
+    // contend.
+    //
+    // There are no iterators. Elements are accessed by passing a function
+    // object to one of the visitation functions, which is called with the
+    // shard locked. The function object mustn't call back into the
+    // container.
+    //
+    // Construction, destruction, assignment and swap must not run
+    // concurrently with any other operation on the same container. All
+    // other member functions can be called concurrently. Functions which
+    // act on every element (size, visit_all, erase_if, clear, rehash and
+    // reserve) lock one shard at a time, so they don't see a snapshot of
+    // the whole container, and other threads can continue to use the rest
+    // of the container, including rehashing other shards, meanwhile.
+
+    template <class K,
+        class T,
+        class H = boost::hash<K>,
+        class P = std::equal_to<K>,
+        class A = std::allocator<std::pair<const K, T> > >
+    class concurrent_unordered_map
+    {
+#if defined(BOOST_UNORDERED_USE_MOVE)
+        BOOST_COPYABLE_AND_MOVABLE(concurrent_unordered_map)
+#endif
+
+    public:
+
+        typedef K key_type;
+        typedef std::pair<const K, T> value_type;
+        typedef T mapped_type;
+        typedef H hasher;
+        typedef P key_equal;
+        typedef A allocator_type;
+
+        typedef value_type& reference;
+        typedef value_type const& const_reference;
+
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        static const std::size_t shard_bits =
+            BOOST_UNORDERED_CONCURRENT_SHARD_BITS;
+        static const std::size_t shard_count = std::size_t(1) << shard_bits;
+
+    private:
+
+        typedef boost::unordered::detail::foa::map<A, K, T, H, P> types;
+        typedef typename types::table table;
+        typedef typename table::value_allocator value_allocator;
+        typedef boost::unordered::detail::foa::concurrent_shard<table> shard;
+        typedef typename shard::lock_type lock_type;
+
+        typedef typename table::value_allocator_traits
+            value_allocator_traits;
+
+        boost::unordered::detail::foa::concurrent_shards<table> shards_;
+
+    public:
+
+        // constructors
+
+        explicit concurrent_unordered_map(
+                size_type n = 0,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : shards_(shard_count, hf, eql, value_allocator(a))
+        {
+            if (n) rehash(n);
+        }
+
+        explicit concurrent_unordered_map(allocator_type const& a)
+          : shards_(shard_count, hasher(), key_equal(), value_allocator(a))
+        {
+        }
+
+        template <class InputIt>
+        concurrent_unordered_map(InputIt f, InputIt l,
+                size_type n = 0,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : shards_(shard_count, hf, eql, value_allocator(a))
+        {
+            reserve((std::max)(n, boost::unordered::detail::insert_size(f, l)));
+            this->insert(f, l);
+        }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+        concurrent_unordered_map(
+                std::initializer_list<value_type> list,
+                size_type n = 0,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : shards_(shard_count, hf, eql, value_allocator(a))
+        {
+            reserve((std::max)(n, list.size()));
+            this->insert(list.begin(), list.end());
+        }
+#endif
+
+        // copy/move constructors
+        //
+        // The source is copied a shard at a time, so other threads can
+        // modify it while it's being copied, but then the copy won't be a
+        // snapshot.
+
+        concurrent_unordered_map(concurrent_unordered_map const& other)
+          : shards_(other.shards_,
+                value_allocator_traits::select_on_container_copy_construction(
+                    other.shards_[0].table_.value_alloc()))
+        {
+        }
+
+        concurrent_unordered_map(concurrent_unordered_map const& other,
+                allocator_type const& a)
+          : shards_(other.shards_, value_allocator(a))
+        {
+        }
+
+#if defined(BOOST_UNORDERED_USE_MOVE)
+        concurrent_unordered_map(BOOST_RV_REF(concurrent_unordered_map) other)
+          : shards_(shard_count, other.hash_function(), other.key_eq(),
+                other.shards_[0].table_.value_alloc())
+        {
+            swap_shards(other);
+        }
+#elif !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+        concurrent_unordered_map(concurrent_unordered_map&& other)
+          : shards_(shard_count, other.hash_function(), other.key_eq(),
+                other.shards_[0].table_.value_alloc())
+        {
+            swap_shards(other);
+        }
+#endif
+
+        // assignment
+
+#if defined(BOOST_UNORDERED_USE_MOVE)
+        concurrent_unordered_map& operator=(
+                BOOST_COPY_ASSIGN_REF(concurrent_unordered_map) x)
+        {
+            assign(x);
+            return *this;
+        }
+#else
+        concurrent_unordered_map& operator=(
+                concurrent_unordered_map const& x)
+        {
+            assign(x);
+            return *this;
+        }
+#endif
+
+        allocator_type get_allocator() const BOOST_NOEXCEPT
+        {
+            return allocator_type(shards_[0].table_.value_alloc());
+        }
+
+        // size and capacity
+
+        bool empty() const
+        {
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                lock_type lock(shards_[i].mutex_);
+                if (shards_[i].table_.size_) return false;
+            }
+
+            return true;
+        }
+
+        size_type size() const
+        {
+            std::size_t s = 0;
+
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                lock_type lock(shards_[i].mutex_);
+                s += shards_[i].table_.size_;
+            }
+
+            return s;
+        }
+
+        size_type max_size() const BOOST_NOEXCEPT
+        {
+            return shards_[0].table_.max_size();
+        }
+
+        // visitation
+        //
+        // Call 'f' with the element with key 'k', if there is one. Returns
+        // the number of elements visited.
+
+        template <class F>
+        size_type visit(key_type const& k, F f)
+        {
+            std::size_t const mixed = hash(k);
+            shard& s = shard_for(mixed);
+            lock_type lock(s.mutex_);
+
+            std::size_t const pos =
+                s.table_.find_position(mixed, k, s.table_.key_eq());
+            if (pos == s.table_.capacity()) return 0;
+            f(s.table_.slots_[pos]);
+            return 1;
+        }
+
+        template <class F>
+        size_type visit(key_type const& k, F f) const
+        {
+            return cvisit(k, f);
+        }
+
+        template <class F>
+        size_type cvisit(key_type const& k, F f) const
+        {
+            std::size_t const mixed = hash(k);
+            shard& s = shard_for(mixed);
+            lock_type lock(s.mutex_);
+
+            std::size_t const pos =
+                s.table_.find_position(mixed, k, s.table_.key_eq());
+            if (pos == s.table_.capacity()) return 0;
+            f(static_cast<value_type const&>(s.table_.slots_[pos]));
+            return 1;
+        }
+
+        // Call 'f' with every element. Returns the number of elements
+        // visited.
+
+        template <class F>
+        size_type visit_all(F f)
+        {
+            std::size_t n = 0;
+
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                lock_type lock(shards_[i].mutex_);
+                table& t = shards_[i].table_;
+                std::size_t const cap = t.capacity();
+
+                for (std::size_t pos = 0; pos < cap; ++pos) {
+                    if (!boost::unordered::detail::foa::is_occupied(
+                            t.ctrl_[pos])) continue;
+                    f(t.slots_[pos]);
+                    ++n;
+                }
+            }
+
+            return n;
+        }
+
+        template <class F>
+        size_type visit_all(F f) const
+        {
+            return cvisit_all(f);
+        }
+
+        template <class F>
+        size_type cvisit_all(F f) const
+        {
+            std::size_t n = 0;
+
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                lock_type lock(shards_[i].mutex_);
+                table const& t = shards_[i].table_;
+                std::size_t const cap = t.capacity();
+
+                for (std::size_t pos = 0; pos < cap; ++pos) {
+                    if (!boost::unordered::detail::foa::is_occupied(
+                            t.ctrl_[pos])) continue;
+                    f(static_cast<value_type const&>(t.slots_[pos]));
+                    ++n;
+                }
+            }
+
+            return n;
+        }
+
+        // insertion
+        //
+        // These return true if an element was inserted, false if there was
+        // already an element with an equivalent key.
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        template <class... Args>
+        bool emplace(BOOST_FWD_REF(Args)... args)
+        {
+            value_type v(boost::forward<Args>(args)...);
+            return insert_impl(v.first, boost::move(v));
+        }
+#endif
+
+        bool insert(value_type const& x)
+        {
+            return insert_impl(x.first, x);
+        }
+
+        bool insert(BOOST_RV_REF(value_type) x)
+        {
+            return insert_impl(x.first, boost::move(x));
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                insert_impl(types::extractor::extract(*first), *first);
+        }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+        void insert(std::initializer_list<value_type> list)
+        {
+            this->insert(list.begin(), list.end());
+        }
+#endif
+
+        // Inserts 'k' with a value initialized mapped value.
+        bool try_emplace(key_type const& k)
+        {
+            return try_emplace_or_visit_impl(k, value_initialized(),
+                null_visitor());
+        }
+
+        template <class M>
+        bool try_emplace(key_type const& k, BOOST_FWD_REF(M) obj)
+        {
+            return try_emplace_or_visit_impl(k, boost::forward<M>(obj),
+                null_visitor());
+        }
+
+        template <class M>
+        bool insert_or_assign(key_type const& k, BOOST_FWD_REF(M) obj)
+        {
+            std::size_t const mixed = hash(k);
+            shard& s = shard_for(mixed);
+            lock_type lock(s.mutex_);
+
+            std::size_t const pos =
+                s.table_.find_position(mixed, k, s.table_.key_eq());
+            if (pos != s.table_.capacity()) {
+                s.table_.slots_[pos].second = boost::forward<M>(obj);
+                return false;
+            }
+
+            s.table_.insert_new(mixed,
+                value_type(k, boost::forward<M>(obj)));
+            return true;
+        }
+
+        // Insert an element, or if there's already an element with an
+        // equivalent key, call 'f' with it. Unlike a separate insert and
+        // visit, this is a single atomic operation.
+
+        template <class F>
+        bool insert_or_visit(value_type const& x, F f)
+        {
+            return insert_or_visit_impl(x.first, x, f);
+        }
+
+        template <class F>
+        bool insert_or_visit(BOOST_RV_REF(value_type) x, F f)
+        {
+            return insert_or_visit_impl(x.first, boost::move(x), f);
+        }
+
+        template <class F>
+        bool try_emplace_or_visit(key_type const& k, F f)
+        {
+            return try_emplace_or_visit_impl(k, value_initialized(), f);
+        }
+
+        template <class M, class F>
+        bool try_emplace_or_visit(key_type const& k, BOOST_FWD_REF(M) obj,
+                F f)
+        {
+            return try_emplace_or_visit_impl(k, boost::forward<M>(obj), f);
+        }
+
+        // erasure
+
+        size_type erase(key_type const& k)
+        {
+            return erase_if(k, always_true());
+        }
+
+        // Erase the element with key 'k' if 'f' returns true for it.
+        template <class F>
+        size_type erase_if(key_type const& k, F f)
+        {
+            std::size_t const mixed = hash(k);
+            shard& s = shard_for(mixed);
+            lock_type lock(s.mutex_);
+
+            std::size_t const pos =
+                s.table_.find_position(mixed, k, s.table_.key_eq());
+            if (pos == s.table_.capacity() ||
+                    !f(static_cast<value_type const&>(s.table_.slots_[pos])))
+                return 0;
+            s.table_.erase_position(pos);
+            return 1;
+        }
+
+        // Erase every element that 'f' returns true for. Returns the number
+        // of elements erased.
+        template <class F>
+        size_type erase_if(F f)
+        {
+            std::size_t n = 0;
+
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                lock_type lock(shards_[i].mutex_);
+                table& t = shards_[i].table_;
+                std::size_t const cap = t.capacity();
+
+                for (std::size_t pos = 0; pos < cap; ++pos) {
+                    if (!boost::unordered::detail::foa::is_occupied(
+                            t.ctrl_[pos])) continue;
+                    if (!f(static_cast<value_type const&>(t.slots_[pos])))
+                        continue;
+                    t.erase_position(pos);
+                    ++n;
+                }
+            }
+
+            return n;
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                lock_type lock(shards_[i].mutex_);
+                shards_[i].table_.clear();
+            }
+        }
+
+        void swap(concurrent_unordered_map& other)
+        {
+            swap_shards(other);
+        }
+
+        // observers
+
+        hasher hash_function() const
+        {
+            return shards_[0].table_.hash_function();
+        }
+
+        key_equal key_eq() const
+        {
+            return shards_[0].table_.key_eq();
+        }
+
+        // lookup
+
+        size_type count(key_type const& k) const
+        {
+            return cvisit(k, null_visitor());
+        }
+
+        bool contains(key_type const& k) const
+        {
+            return count(k) != 0;
+        }
+
+        // hash policy
+        //
+        // The shards are rehashed one at a time, so only the shard being
+        // rehashed is unavailable to other threads.
+
+        float max_load_factor() const BOOST_NOEXCEPT
+        {
+            return 0.875f;
+        }
+
+        void rehash(size_type n)
+        {
+            std::size_t const per_shard = slots_per_shard(n);
+
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                lock_type lock(shards_[i].mutex_);
+                shards_[i].table_.rehash(per_shard);
+            }
+        }
+
+        void reserve(size_type n)
+        {
+            std::size_t const per_shard = slots_per_shard(n);
+
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                lock_type lock(shards_[i].mutex_);
+                shards_[i].table_.reserve(per_shard);
+            }
+        }
+
+    private:
+
+        struct null_visitor
+        {
+            template <class V> void operator()(V const&) const {}
+        };
+
+        // Passed to try_emplace_or_visit_impl for a value initialized
+        // mapped value, which is only constructed if it's inserted.
+        struct value_initialized {};
+
+        static value_type make_value(key_type const& k, value_initialized)
+        {
+            return value_type(k, mapped_type());
+        }
+
+        template <class M>
+        static value_type make_value(key_type const& k, BOOST_FWD_REF(M) obj)
+        {
+            return value_type(k, boost::forward<M>(obj));
+        }
+
+        struct always_true
+        {
+            template <class V> bool operator()(V const&) const
+            {
+                return true;
+            }
+        };
+
+        // The hash is only calculated once. The top bits choose the shard,
+        // the table in the shard uses the bottom bits.
+
+        std::size_t hash(key_type const& k) const
+        {
+            return table::hash(k, shards_[0].table_.hash_function());
+        }
+
+        shard& shard_for(std::size_t mixed) const
+        {
+            return shards_[mixed >>
+                (sizeof(std::size_t) * CHAR_BIT - shard_bits)];
+        }
+
+        // The elements aren't evenly distributed between the shards, so
+        // allow some extra space in each.
+        static std::size_t slots_per_shard(std::size_t n)
+        {
+            std::size_t const per_shard = n / shard_count;
+            return per_shard ? per_shard + per_shard / 8 + 1 : 0;
+        }
+
+        template <class Arg>
+        bool insert_impl(key_type const& k, BOOST_FWD_REF(Arg) x)
+        {
+            return insert_or_visit_impl(k, boost::forward<Arg>(x),
+                null_visitor());
+        }
+
+        template <class Arg, class F>
+        bool insert_or_visit_impl(key_type const& k, BOOST_FWD_REF(Arg) x,
+                F f)
+        {
+            std::size_t const mixed = hash(k);
+            shard& s = shard_for(mixed);
+            lock_type lock(s.mutex_);
+
+            std::size_t const pos =
+                s.table_.find_position(mixed, k, s.table_.key_eq());
+            if (pos != s.table_.capacity()) {
+                f(s.table_.slots_[pos]);
+                return false;
+            }
+
+            s.table_.insert_new(mixed, boost::forward<Arg>(x));
+            return true;
+        }
+
+        template <class M, class F>
+        bool try_emplace_or_visit_impl(key_type const& k,
+                BOOST_FWD_REF(M) obj, F f)
+        {
+            std::size_t const mixed = hash(k);
+            shard& s = shard_for(mixed);
+            lock_type lock(s.mutex_);
+
+            std::size_t const pos =
+                s.table_.find_position(mixed, k, s.table_.key_eq());
+            if (pos != s.table_.capacity()) {
+                f(s.table_.slots_[pos]);
+                return false;
+            }
+
+            s.table_.insert_new(mixed, make_value(k, boost::forward<M>(obj)));
+            return true;
+        }
+
+        // Locks the two shards in address order, so that two threads
+        // assigning or swapping the same pair of containers can't deadlock.
+
+        void assign(concurrent_unordered_map const& other)
+        {
+            if (this == boost::addressof(other)) return;
+
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                shard& a = shards_[i];
+                shard& b = other.shards_[i];
+                lock_type lock1(&a < &b ? a.mutex_ : b.mutex_);
+                lock_type lock2(&a < &b ? b.mutex_ : a.mutex_);
+                a.table_.assign(b.table_);
+            }
+        }
+
+        void swap_shards(concurrent_unordered_map& other)
+        {
+            if (this == boost::addressof(other)) return;
+
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                shard& a = shards_[i];
+                shard& b = other.shards_[i];
+                lock_type lock1(&a < &b ? a.mutex_ : b.mutex_);
+                lock_type lock2(&a < &b ? b.mutex_ : a.mutex_);
+                a.table_.swap(b.table_);
+            }
+        }
+    }; // class template concurrent_unordered_map
+
+    template <class K, class T, class H, class P, class A>
+    inline void swap(concurrent_unordered_map<K,T,H,P,A>& m1,
+            concurrent_unordered_map<K,T,H,P,A>& m2)
+    {
+        m1.swap(m2);
+    }
+
+} // namespace unordered
+
+using boost::unordered::concurrent_unordered_map;
+
+} // namespace boost
+
+#endif // BOOST_UNORDERED_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
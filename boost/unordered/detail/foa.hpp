@@ -0,0 +1,1105 @@
+// Copyright (C) 2026 agent <agent@local>.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Open addressing hash table used by unordered_flat_map and
+// unordered_flat_set.
+//
+// Elements are stored inline in a single array of slots, which is divided
+// into groups of 16. Each slot has a control byte, stored in a separate
+// array: the top bit is set for empty and deleted slots, for occupied
+// slots the low 7 bits hold a reduced hash value. A lookup computes the
+// group from the hash value, compares the 16 control bytes of the group
+// with the reduced hash in one go (using SSE2 where available) and only
+// compares the keys of the slots that match. If the group contains an
+// empty slot the search stops, otherwise the next group in a quadratic
+// probing sequence is tried.
+
+#ifndef BOOST_UNORDERED_DETAIL_FOA_HPP_INCLUDED
+#define BOOST_UNORDERED_DETAIL_FOA_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/detail/util.hpp>
+#include <boost/unordered/detail/allocate.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/swap.hpp>
+#include <boost/assert.hpp>
+#include <boost/limits.hpp>
+#include <boost/iterator.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#if !defined(BOOST_UNORDERED_DISABLE_SSE2)
+#   if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define BOOST_UNORDERED_FOA_SSE2
+#   endif
+#endif
+
+#if defined(BOOST_UNORDERED_FOA_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BOOST_MSVC)
+#include <intrin.h>
+#endif
+
+namespace boost { namespace unordered { namespace detail { namespace foa {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Control bytes
+    //
+    // The sentinel follows the last slot so that iteration stops there, it
+    // has the top bit cleared like an occupied slot but is never part of a
+    // group, so it's never matched by a lookup.
+
+    static const std::size_t group_size = 16;
+    static const unsigned char ctrl_empty = 0x80;
+    static const unsigned char ctrl_deleted = 0xFE;
+    static const unsigned char ctrl_sentinel = 0x7F;
+
+    inline bool is_occupied(unsigned char c)
+    {
+        return !(c & 0x80);
+    }
+
+    inline unsigned int count_trailing_zeros(unsigned int mask)
+    {
+        BOOST_ASSERT(mask);
+#if defined(__GNUC__)
+        return static_cast<unsigned int>(__builtin_ctz(mask));
+#elif defined(BOOST_MSVC)
+        unsigned long r;
+        _BitScanForward(&r, mask);
+        return static_cast<unsigned int>(r);
+#else
+        unsigned int n = 0;
+        while (!(mask & 1u)) { mask >>= 1; ++n; }
+        return n;
+#endif
+    }
+
+    // Returns a bit mask with the bits set for the bytes in the group
+    // equal to 'c'.
+
+#if defined(BOOST_UNORDERED_FOA_SSE2)
+
+    inline unsigned int match_group(unsigned char const* g, unsigned char c)
+    {
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<__m128i const*>(g));
+        return static_cast<unsigned int>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(c)))));
+    }
+
+    // Empty or deleted slots
+    inline unsigned int match_available(unsigned char const* g)
+    {
+        return static_cast<unsigned int>(_mm_movemask_epi8(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(g))));
+    }
+
+#else
+
+    inline unsigned int match_group(unsigned char const* g, unsigned char c)
+    {
+        unsigned int mask = 0;
+        for (std::size_t i = 0; i < group_size; ++i)
+            if (g[i] == c) mask |= 1u << i;
+        return mask;
+    }
+
+    inline unsigned int match_available(unsigned char const* g)
+    {
+        unsigned int mask = 0;
+        for (std::size_t i = 0; i < group_size; ++i)
+            if (!is_occupied(g[i])) mask |= 1u << i;
+        return mask;
+    }
+
+#endif
+
+    inline unsigned int match_empty(unsigned char const* g)
+    {
+        return match_group(g, ctrl_empty);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Hash mixing
+    //
+    // Many hash functions (including boost::hash for integers) don't
+    // distribute their bits well, so the hash value is mixed before the
+    // group and the reduced hash are taken from it.
+
+    template <std::size_t Size> struct hash_mixer;
+
+    template <> struct hash_mixer<4>
+    {
+        static std::size_t mix(std::size_t h)
+        {
+            boost::uint32_t x = static_cast<boost::uint32_t>(h);
+            x ^= x >> 16;
+            x *= 0x85ebca6bu;
+            x ^= x >> 13;
+            x *= 0xc2b2ae35u;
+            x ^= x >> 16;
+            return static_cast<std::size_t>(x);
+        }
+    };
+
+    template <> struct hash_mixer<8>
+    {
+        static std::size_t mix(std::size_t h)
+        {
+            boost::uint64_t x = static_cast<boost::uint64_t>(h);
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdull;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53ull;
+            x ^= x >> 33;
+            return static_cast<std::size_t>(x);
+        }
+    };
+
+    inline std::size_t mix_hash(std::size_t h)
+    {
+        return hash_mixer<sizeof(std::size_t)>::mix(h);
+    }
+
+    inline unsigned char reduced_hash(std::size_t mixed)
+    {
+        return static_cast<unsigned char>(mixed & 0x7F);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Slot construction
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+    template <typename Alloc, typename T, typename Arg>
+    inline void construct_slot(Alloc& alloc, T* address, BOOST_FWD_REF(Arg) x)
+    {
+        boost::unordered::detail::func::call_construct(alloc, address,
+            boost::forward<Arg>(x));
+    }
+
+#else
+
+    template <typename Alloc, typename T, typename Arg>
+    inline void construct_slot(Alloc&, T* address, BOOST_FWD_REF(Arg) x)
+    {
+        new((void*) address) T(boost::forward<Arg>(x));
+    }
+
+#endif
+
+    template <typename Alloc, typename T>
+    inline void destroy_slot(Alloc& alloc, T* address)
+    {
+        boost::unordered::detail::func::destroy_value_impl(alloc, address);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Iterators
+    //
+    // all no throw
+
+    template <typename Value, typename Reference, typename Pointer>
+    struct iterator
+        : public boost::iterator<
+            std::forward_iterator_tag,
+            Value,
+            std::ptrdiff_t,
+            Pointer,
+            Reference>
+    {
+        unsigned char const* ctrl_;
+        Value* slot_;
+
+        iterator() BOOST_NOEXCEPT : ctrl_(), slot_() {}
+
+        iterator(unsigned char const* c, Value* s) BOOST_NOEXCEPT
+            : ctrl_(c), slot_(s) {}
+
+        // Conversion from mutable to const iterator.
+        template <typename Reference2, typename Pointer2>
+        iterator(iterator<Value, Reference2, Pointer2> const& x)
+                BOOST_NOEXCEPT
+            : ctrl_(x.ctrl_), slot_(x.slot_) {}
+
+        Reference operator*() const {
+            return *slot_;
+        }
+
+        Pointer operator->() const {
+            return slot_;
+        }
+
+        iterator& operator++() {
+            do {
+                ++ctrl_;
+                ++slot_;
+            } while (!is_occupied(*ctrl_));
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        template <typename Reference2, typename Pointer2>
+        bool operator==(iterator<Value, Reference2, Pointer2> const& x)
+            const BOOST_NOEXCEPT
+        {
+            return ctrl_ == x.ctrl_;
+        }
+
+        template <typename Reference2, typename Pointer2>
+        bool operator!=(iterator<Value, Reference2, Pointer2> const& x)
+            const BOOST_NOEXCEPT
+        {
+            return ctrl_ != x.ctrl_;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // table
+    //
+    // Types provides:
+    //
+    //     value_type, key_type, hasher, key_equal, value_allocator
+    //     extractor - extractor::extract(value) returns the key
+    //     value_reference, value_pointer - for the mutable iterator
+
+    template <typename Types>
+    struct table
+    {
+    private:
+        table(table const&);
+        table& operator=(table const&);
+
+    public:
+        typedef typename Types::key_type key_type;
+        typedef typename Types::value_type value_type;
+        typedef typename Types::hasher hasher;
+        typedef typename Types::key_equal key_equal;
+        typedef typename Types::value_allocator value_allocator;
+        typedef typename Types::extractor extractor;
+
+        typedef boost::unordered::detail::allocator_traits<value_allocator>
+            value_allocator_traits;
+        typedef typename value_allocator_traits::pointer value_pointer;
+        typedef typename boost::unordered::detail::rebind_wrap<
+            value_allocator, unsigned char>::type ctrl_allocator;
+        typedef boost::unordered::detail::allocator_traits<ctrl_allocator>
+            ctrl_allocator_traits;
+        typedef typename ctrl_allocator_traits::pointer ctrl_pointer;
+
+        typedef boost::unordered::detail::foa::iterator<value_type,
+            typename Types::value_reference,
+            typename Types::value_pointer> iterator;
+        typedef boost::unordered::detail::foa::iterator<value_type,
+            value_type const&, value_type const*> c_iterator;
+        typedef std::pair<iterator, bool> emplace_return;
+
+        typedef boost::unordered::detail::compressed<hasher, key_equal>
+            functions;
+
+        // Maximum load factor is 7/8, i.e. 14 elements per group.
+        static std::size_t max_load_for_groups(std::size_t groups)
+        {
+            return groups * (group_size - group_size / 8);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Members
+
+        functions functions_;
+        value_allocator alloc_;
+        value_pointer slots_ptr_;
+        ctrl_pointer ctrl_ptr_;
+        value_type* slots_;
+        unsigned char* ctrl_;
+        std::size_t groups_;
+        std::size_t size_;
+        std::size_t available_;  // Empty slots that can still be filled
+                                 // before a rehash.
+
+        ////////////////////////////////////////////////////////////////////////
+        // Data access
+
+        hasher const& hash_function() const {
+            return functions_.first();
+        }
+
+        key_equal const& key_eq() const {
+            return functions_.second();
+        }
+
+        value_allocator const& value_alloc() const {
+            return alloc_;
+        }
+
+        value_allocator& value_alloc() {
+            return alloc_;
+        }
+
+        std::size_t capacity() const {
+            return groups_ * group_size;
+        }
+
+        std::size_t max_load() const {
+            return max_load_for_groups(groups_);
+        }
+
+        std::size_t max_size() const
+        {
+            return max_load_for_groups(
+                ((std::numeric_limits<std::size_t>::max)() /
+                    (sizeof(value_type) + 1) / group_size) >> 1);
+        }
+
+        static unsigned char const* empty_ctrl()
+        {
+            static unsigned char const sentinel = ctrl_sentinel;
+            return &sentinel;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Iterators
+
+        iterator make_iterator(std::size_t pos) const
+        {
+            return iterator(ctrl_ + pos, slots_ + pos);
+        }
+
+        // Like make_iterator, but also valid for a table without storage:
+        // find_position returns capacity() == 0 there, and there are no
+        // slots to point to.
+        iterator iterator_at(std::size_t pos) const
+        {
+            return groups_ ? make_iterator(pos) : end();
+        }
+
+        iterator begin() const
+        {
+            if (!size_) return end();
+            iterator it(make_iterator(0));
+            if (!is_occupied(ctrl_[0])) ++it;
+            return it;
+        }
+
+        iterator end() const
+        {
+            return groups_ ? make_iterator(capacity()) :
+                iterator(empty_ctrl(), 0);
+        }
+
+        std::size_t position(c_iterator it) const
+        {
+            return static_cast<std::size_t>(it.ctrl_ - ctrl_);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Constructors
+
+        table(std::size_t num_slots,
+                hasher const& hf,
+                key_equal const& eq,
+                value_allocator const& a) :
+            functions_(hf, eq),
+            alloc_(a),
+            slots_ptr_(),
+            ctrl_ptr_(),
+            slots_(),
+            ctrl_(),
+            groups_(0),
+            size_(0),
+            available_(0)
+        {
+            if (num_slots) rehash(num_slots);
+        }
+
+        table(table const& x, value_allocator const& a) :
+            functions_(x.functions_),
+            alloc_(a),
+            slots_ptr_(),
+            ctrl_ptr_(),
+            slots_(),
+            ctrl_(),
+            groups_(0),
+            size_(0),
+            available_(0)
+        {
+            copy_elements(x);
+        }
+
+        table(table& x, boost::unordered::detail::move_tag m) :
+            functions_(x.functions_, m),
+            alloc_(x.alloc_),
+            slots_ptr_(x.slots_ptr_),
+            ctrl_ptr_(x.ctrl_ptr_),
+            slots_(x.slots_),
+            ctrl_(x.ctrl_),
+            groups_(x.groups_),
+            size_(x.size_),
+            available_(x.available_)
+        {
+            x.release_storage();
+        }
+
+        table(table& x, value_allocator const& a,
+                boost::unordered::detail::move_tag m) :
+            functions_(x.functions_, m),
+            alloc_(a),
+            slots_ptr_(),
+            ctrl_ptr_(),
+            slots_(),
+            ctrl_(),
+            groups_(0),
+            size_(0),
+            available_(0)
+        {
+            if (alloc_ == x.alloc_) {
+                steal_storage(x);
+            }
+            else if (x.size_) {
+                move_elements(x);
+            }
+        }
+
+        ~table()
+        {
+            delete_storage();
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Storage management
+
+        // Allocates the slots and control bytes for a new table, the
+        // storage is released in the destructor unless 'release' is called.
+        struct storage
+        {
+            struct ctrl_deallocator
+            {
+                ctrl_allocator& alloc_;
+                ctrl_pointer ptr_;
+                std::size_t size_;
+
+                ~ctrl_deallocator()
+                {
+                    if (ptr_)
+                        ctrl_allocator_traits::deallocate(alloc_, ptr_, size_);
+                }
+            };
+
+            value_allocator& alloc_;
+            value_pointer slots_ptr_;
+            ctrl_pointer ctrl_ptr_;
+            value_type* slots_;
+            unsigned char* ctrl_;
+            std::size_t groups_;
+
+            storage(value_allocator& a, std::size_t groups) :
+                alloc_(a), slots_ptr_(), ctrl_ptr_(), slots_(), ctrl_(),
+                groups_(groups)
+            {
+                std::size_t const cap = groups * group_size;
+                ctrl_allocator ca(alloc_);
+                ctrl_ptr_ = ctrl_allocator_traits::allocate(ca, cap + 1);
+                ctrl_ = boost::addressof(*ctrl_ptr_);
+                std::memset(ctrl_, ctrl_empty, cap);
+                ctrl_[cap] = ctrl_sentinel;
+
+                // The destructor isn't called if the constructor throws,
+                // so the control bytes are released by 'guard' if the
+                // slots can't be allocated.
+                ctrl_deallocator guard = { ca, ctrl_ptr_, cap + 1 };
+                slots_ptr_ = value_allocator_traits::allocate(alloc_, cap);
+                slots_ = boost::addressof(*slots_ptr_);
+                guard.ptr_ = ctrl_pointer();
+            }
+
+            ~storage()
+            {
+                if (!groups_) return;
+                std::size_t const cap = groups_ * group_size;
+
+                for (std::size_t i = 0; i < cap; ++i) {
+                    if (is_occupied(ctrl_[i]))
+                        destroy_slot(alloc_, slots_ + i);
+                }
+
+                if (slots_ptr_)
+                    value_allocator_traits::deallocate(alloc_, slots_ptr_, cap);
+
+                ctrl_allocator ca(alloc_);
+                ctrl_allocator_traits::deallocate(ca, ctrl_ptr_, cap + 1);
+            }
+
+            void release() { groups_ = 0; }
+
+        private:
+            storage(storage const&);
+            storage& operator=(storage const&);
+        };
+
+        void adopt_storage(storage& s, std::size_t size)
+        {
+            slots_ptr_ = s.slots_ptr_;
+            ctrl_ptr_ = s.ctrl_ptr_;
+            slots_ = s.slots_;
+            ctrl_ = s.ctrl_;
+            groups_ = s.groups_;
+            size_ = size;
+            available_ = max_load() - size;
+            s.release();
+        }
+
+        void release_storage()
+        {
+            slots_ptr_ = value_pointer();
+            ctrl_ptr_ = ctrl_pointer();
+            slots_ = 0;
+            ctrl_ = 0;
+            groups_ = 0;
+            size_ = 0;
+            available_ = 0;
+        }
+
+        void destroy_elements()
+        {
+            if (!size_) return;
+
+            std::size_t const cap = capacity();
+            for (std::size_t i = 0; i < cap; ++i) {
+                if (is_occupied(ctrl_[i]))
+                    destroy_slot(alloc_, slots_ + i);
+            }
+        }
+
+        void delete_storage()
+        {
+            if (!groups_) return;
+
+            destroy_elements();
+            std::size_t const cap = capacity();
+            value_allocator_traits::deallocate(alloc_, slots_ptr_, cap);
+            ctrl_allocator ca(alloc_);
+            ctrl_allocator_traits::deallocate(ca, ctrl_ptr_, cap + 1);
+            release_storage();
+        }
+
+        void steal_storage(table& x)
+        {
+            BOOST_ASSERT(!groups_);
+            slots_ptr_ = x.slots_ptr_;
+            ctrl_ptr_ = x.ctrl_ptr_;
+            slots_ = x.slots_;
+            ctrl_ = x.ctrl_;
+            groups_ = x.groups_;
+            size_ = x.size_;
+            available_ = x.available_;
+            x.release_storage();
+        }
+
+        static std::size_t min_groups_for_size(std::size_t size)
+        {
+            std::size_t groups = 1;
+            while (max_load_for_groups(groups) < size) groups <<= 1;
+            return groups;
+        }
+
+        static std::size_t min_groups_for_slots(std::size_t num_slots)
+        {
+            std::size_t groups = 1;
+            while (groups * group_size < num_slots) groups <<= 1;
+            return groups;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Hashing and probing
+
+        template <typename Key>
+        std::size_t hash(Key const& k) const
+        {
+            return mix_hash(hash_function()(k));
+        }
+
+        template <typename Key, typename Hash>
+        static std::size_t hash(Key const& k, Hash const& hf)
+        {
+            return mix_hash(hf(k));
+        }
+
+        std::size_t first_group(std::size_t mixed) const
+        {
+            return (mixed >> 7) & (groups_ - 1);
+        }
+
+        template <typename Key, typename Pred>
+        std::size_t find_position(std::size_t mixed, Key const& k,
+                Pred const& eq) const
+        {
+            if (!size_) return capacity();
+
+            std::size_t const mask = groups_ - 1;
+            unsigned char const h = reduced_hash(mixed);
+            std::size_t g = first_group(mixed);
+
+            for (std::size_t i = 0; ; ) {
+                unsigned char const* group = ctrl_ + g * group_size;
+
+                for (unsigned int m = match_group(group, h); m; m &= m - 1) {
+                    std::size_t const pos =
+                        g * group_size + count_trailing_zeros(m);
+                    if (eq(k, extractor::extract(slots_[pos]))) return pos;
+                }
+
+                if (match_empty(group) || i == mask) return capacity();
+
+                // Triangular numbers visit every group when the number of
+                // groups is a power of 2.
+                g = (g + ++i) & mask;
+            }
+        }
+
+        template <typename Key>
+        std::size_t find_position(Key const& k) const
+        {
+            return find_position(hash(k), k, key_eq());
+        }
+
+        // Finds the first empty or deleted slot in the probing sequence.
+        static std::size_t find_insert_position(unsigned char const* ctrl,
+                std::size_t groups, std::size_t mixed)
+        {
+            std::size_t const mask = groups - 1;
+            std::size_t g = (mixed >> 7) & mask;
+
+            for (std::size_t i = 0; ; ) {
+                unsigned int m = match_available(ctrl + g * group_size);
+                if (m) return g * group_size + count_trailing_zeros(m);
+                BOOST_ASSERT(i < mask);
+                g = (g + ++i) & mask;
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Rehashing
+        //
+        // Elements are moved into the new storage, if that throws the
+        // elements which have been moved are destroyed along with the new
+        // storage. So only basic exception safety, unless the element's
+        // move constructor doesn't throw.
+
+        void rebuild(std::size_t groups)
+        {
+            BOOST_ASSERT(max_load_for_groups(groups) >= size_);
+
+            storage s(alloc_, groups);
+            std::size_t const cap = capacity();
+
+            for (std::size_t i = 0; i < cap; ++i) {
+                if (!is_occupied(ctrl_[i])) continue;
+
+                std::size_t const mixed = hash(extractor::extract(slots_[i]));
+                std::size_t const pos =
+                    find_insert_position(s.ctrl_, groups, mixed);
+                construct_slot(alloc_, s.slots_ + pos,
+                    boost::move(slots_[i]));
+                s.ctrl_[pos] = reduced_hash(mixed);
+            }
+
+            std::size_t const size = size_;
+            delete_storage();
+            adopt_storage(s, size);
+        }
+
+        void rehash(std::size_t num_slots)
+        {
+            if (!num_slots && !size_) {
+                delete_storage();
+                return;
+            }
+
+            std::size_t groups = (std::max)(
+                min_groups_for_slots(num_slots), min_groups_for_size(size_));
+
+            // Rebuild the table if the size changes or if there are
+            // deleted slots.
+            if (groups != groups_ || available_ != max_load() - size_)
+                rebuild(groups);
+        }
+
+        void reserve(std::size_t n)
+        {
+            if (n > max_load())
+                rebuild(min_groups_for_size(n));
+        }
+
+        // Called when there are no more empty slots available. If more than
+        // half of the table is deleted slots, it's rebuilt at the same
+        // size, otherwise it grows.
+        void reserve_for_insert()
+        {
+            if (!groups_) {
+                rebuild(1);
+            }
+            else if (size_ < max_load() / 2) {
+                rebuild(groups_);
+            }
+            else {
+                rebuild(groups_ * 2);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Insert
+        //
+        // Strong exception safety unless a rehash is required.
+
+        template <typename Arg>
+        emplace_return insert_unique(key_type const& k, BOOST_FWD_REF(Arg) x)
+        {
+            std::size_t const mixed = hash(k);
+            std::size_t const pos = find_position(mixed, k, key_eq());
+            if (pos != capacity()) return emplace_return(make_iterator(pos),
+                false);
+
+            return emplace_return(
+                insert_new(mixed, boost::forward<Arg>(x)), true);
+        }
+
+        template <typename Arg>
+        iterator insert_new(std::size_t mixed, BOOST_FWD_REF(Arg) x)
+        {
+            if (!available_) reserve_for_insert();
+
+            std::size_t const pos =
+                find_insert_position(ctrl_, groups_, mixed);
+            construct_slot(alloc_, slots_ + pos, boost::forward<Arg>(x));
+
+            if (ctrl_[pos] == ctrl_empty) --available_;
+            ctrl_[pos] = reduced_hash(mixed);
+            ++size_;
+            return make_iterator(pos);
+        }
+
+        template <class InputIt>
+        void insert_range(InputIt i, InputIt j)
+        {
+            for (; i != j; ++i)
+                insert_unique(extractor::extract(*i), *i);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Erase
+        //
+        // no throw
+
+        void erase_position(std::size_t pos)
+        {
+            BOOST_ASSERT(is_occupied(ctrl_[pos]));
+            destroy_slot(alloc_, slots_ + pos);
+
+            // If there is an empty slot in the group, the group has never
+            // been full, so no lookup has probed past it and the slot can
+            // be marked as empty. Otherwise it has to be a tombstone.
+            unsigned char const* group =
+                ctrl_ + (pos / group_size) * group_size;
+            if (match_empty(group)) {
+                ctrl_[pos] = ctrl_empty;
+                ++available_;
+            }
+            else {
+                ctrl_[pos] = ctrl_deleted;
+            }
+            --size_;
+        }
+
+        iterator erase(c_iterator it)
+        {
+            iterator next(make_iterator(position(it)));
+            ++next;
+            erase_position(position(it));
+            return next;
+        }
+
+        iterator erase_range(c_iterator first, c_iterator last)
+        {
+            while (first != last) first = erase(first);
+            return groups_ ? make_iterator(position(last)) : end();
+        }
+
+        std::size_t erase_key(key_type const& k)
+        {
+            std::size_t const pos = find_position(k);
+            if (pos == capacity()) return 0;
+            erase_position(pos);
+            return 1;
+        }
+
+        void clear()
+        {
+            if (!groups_) return;
+
+            destroy_elements();
+            std::size_t const cap = capacity();
+            std::memset(ctrl_, ctrl_empty, cap);
+            size_ = 0;
+            available_ = max_load();
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Copy and move
+
+        // Copies the elements into the same positions, so that no hashing
+        // is required. Deleted slots have to be copied as well, as the
+        // elements might have been placed in later groups when they were
+        // occupied.
+        void copy_elements(table const& x)
+        {
+            BOOST_ASSERT(!groups_);
+            if (!x.size_) return;
+
+            storage s(alloc_, x.groups_);
+            std::size_t const cap = x.capacity();
+
+            for (std::size_t i = 0; i < cap; ++i) {
+                if (x.ctrl_[i] == ctrl_empty) continue;
+                if (is_occupied(x.ctrl_[i]))
+                    construct_slot(alloc_, s.slots_ + i, x.slots_[i]);
+                s.ctrl_[i] = x.ctrl_[i];
+            }
+
+            adopt_storage(s, x.size_);
+            available_ = x.available_;
+        }
+
+        void move_elements(table& x)
+        {
+            BOOST_ASSERT(!size_);
+            reserve(x.size_);
+
+            std::size_t const cap = x.capacity();
+            for (std::size_t i = 0; i < cap; ++i) {
+                if (!is_occupied(x.ctrl_[i])) continue;
+                insert_new(hash(extractor::extract(x.slots_[i])),
+                    boost::move(x.slots_[i]));
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Assignment
+
+        void assign(table const& x)
+        {
+            if (this != boost::addressof(x))
+            {
+                assign(x,
+                    boost::unordered::detail::integral_constant<bool,
+                        value_allocator_traits::
+                        propagate_on_container_copy_assignment::value>());
+            }
+        }
+
+        void assign(table const& x, false_type)
+        {
+            functions_.assign(x.functions_);
+            clear();
+
+            if (!x.size_) return;
+
+            if (x.groups_ == groups_) {
+                // Same layout, copy into the same positions.
+                std::size_t const cap = x.capacity();
+                for (std::size_t i = 0; i < cap; ++i) {
+                    if (x.ctrl_[i] == ctrl_empty) continue;
+                    if (is_occupied(x.ctrl_[i])) {
+                        construct_slot(alloc_, slots_ + i, x.slots_[i]);
+                        ++size_;
+                    }
+                    ctrl_[i] = x.ctrl_[i];
+                    --available_;
+                }
+            }
+            else {
+                delete_storage();
+                copy_elements(x);
+            }
+        }
+
+        void assign(table const& x, true_type)
+        {
+            if (alloc_ != x.alloc_) {
+                delete_storage();
+                alloc_ = x.alloc_;
+            }
+
+            assign(x, false_type());
+        }
+
+        void move_assign(table& x)
+        {
+            if (this != boost::addressof(x))
+            {
+                move_assign(x,
+                    boost::unordered::detail::integral_constant<bool,
+                        value_allocator_traits::
+                        propagate_on_container_move_assignment::value>());
+            }
+        }
+
+        void move_assign(table& x, true_type)
+        {
+            delete_storage();
+            alloc_ = boost::move(x.alloc_);
+            functions_.move_assign(x.functions_);
+            steal_storage(x);
+        }
+
+        void move_assign(table& x, false_type)
+        {
+            functions_.move_assign(x.functions_);
+
+            if (alloc_ == x.alloc_) {
+                delete_storage();
+                steal_storage(x);
+            }
+            else {
+                clear();
+                move_elements(x);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Swap
+
+        void swap_allocators(table& other, false_type)
+        {
+            boost::unordered::detail::func::ignore_unused_variable_warning(other);
+
+            // According to 23.2.1.8, if propagate_on_container_swap is
+            // false the behaviour is undefined unless the allocators
+            // are equal.
+            BOOST_ASSERT(alloc_ == other.alloc_);
+        }
+
+        void swap_allocators(table& other, true_type)
+        {
+            boost::swap(alloc_, other.alloc_);
+        }
+
+        void swap(table& x)
+        {
+            swap_allocators(x,
+                boost::unordered::detail::integral_constant<bool,
+                    value_allocator_traits::
+                    propagate_on_container_swap::value>());
+
+            functions_.swap(x.functions_);
+            boost::swap(slots_ptr_, x.slots_ptr_);
+            boost::swap(ctrl_ptr_, x.ctrl_ptr_);
+            std::swap(slots_, x.slots_);
+            std::swap(ctrl_, x.ctrl_);
+            std::swap(groups_, x.groups_);
+            std::swap(size_, x.size_);
+            std::swap(available_, x.available_);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Equality
+
+        bool equals(table const& other) const
+        {
+            if (size_ != other.size_) return false;
+
+            for (iterator i = begin(), e = end(); i != e; ++i)
+            {
+                std::size_t const pos =
+                    other.find_position(extractor::extract(*i));
+                if (pos == other.capacity()) return false;
+                if (!extractor::compare_mapped(*i, other.slots_[pos]))
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Type policies
+
+    template <typename A, typename T, typename H, typename P>
+    struct set
+    {
+        typedef T key_type;
+        typedef T value_type;
+        typedef H hasher;
+        typedef P key_equal;
+        typedef typename boost::unordered::detail::rebind_wrap<A, T>::type
+            value_allocator;
+        typedef value_type const& value_reference;
+        typedef value_type const* value_pointer;
+
+        struct extractor
+        {
+            static key_type const& extract(value_type const& v)
+            {
+                return v;
+            }
+
+            static bool compare_mapped(value_type const&, value_type const&)
+            {
+                return true;
+            }
+        };
+
+        typedef boost::unordered::detail::foa::table<set> table;
+    };
+
+    template <typename A, typename K, typename M, typename H, typename P>
+    struct map
+    {
+        typedef K key_type;
+        typedef std::pair<K const, M> value_type;
+        typedef H hasher;
+        typedef P key_equal;
+        typedef typename boost::unordered::detail::rebind_wrap<
+            A, value_type>::type value_allocator;
+        typedef value_type& value_reference;
+        typedef value_type* value_pointer;
+
+        struct extractor
+        {
+            static key_type const& extract(value_type const& v)
+            {
+                return v.first;
+            }
+
+            template <class Second>
+            static key_type const& extract(std::pair<K, Second> const& v)
+            {
+                return v.first;
+            }
+
+            static bool compare_mapped(value_type const& x,
+                    value_type const& y)
+            {
+                return x.second == y.second;
+            }
+        };
+
+        typedef boost::unordered::detail::foa::table<map> table;
+    };
+}}}}
+
+#endif
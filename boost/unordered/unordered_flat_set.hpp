@@ -0,0 +1,455 @@
+
+// Copyright (C) 2026 agent <agent@local>.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org/libs/unordered for documentation
+
+#ifndef BOOST_UNORDERED_UNORDERED_FLAT_SET_HPP_INCLUDED
+#define BOOST_UNORDERED_UNORDERED_FLAT_SET_HPP_INCLUDED
+
+#include <boost/config.hpp>
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#pragma once
+#endif
+
+#include <boost/unordered/detail/foa.hpp>
+#include <boost/unordered/detail/util.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/move/move.hpp>
+#include <memory>
+#include <functional>
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost
+{
+namespace unordered
+{
+    // An unordered associative container with unique keys which stores its
+    // elements inline in an open addressing table. It provides the interface
+    // of unordered_set apart from the bucket interface, but references and
+    // iterators are invalidated by rehashing, which can happen on any
+    // insertion. Erasing only invalidates the erased elements.
+
+    template <class T,
+        class H = boost::hash<T>,
+        class P = std::equal_to<T>,
+        class A = std::allocator<T> >
+    class unordered_flat_set
+    {
+#if defined(BOOST_UNORDERED_USE_MOVE)
+        BOOST_COPYABLE_AND_MOVABLE(unordered_flat_set)
+#endif
+
+    public:
+
+        typedef T key_type;
+        typedef T value_type;
+        typedef H hasher;
+        typedef P key_equal;
+        typedef A allocator_type;
+
+    private:
+
+        typedef boost::unordered::detail::foa::set<A, T, H, P> types;
+        typedef typename types::table table;
+        typedef typename table::value_allocator_traits allocator_traits;
+
+    public:
+
+        typedef typename allocator_traits::pointer pointer;
+        typedef typename allocator_traits::const_pointer const_pointer;
+
+        typedef value_type& reference;
+        typedef value_type const& const_reference;
+
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        typedef typename table::c_iterator const_iterator;
+        typedef typename table::c_iterator iterator;
+
+    private:
+
+        table table_;
+
+    public:
+
+        // constructors
+
+        explicit unordered_flat_set(
+                size_type n = 0,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : table_(n, hf, eql, a)
+        {
+        }
+
+        explicit unordered_flat_set(allocator_type const& a)
+          : table_(0, hasher(), key_equal(), a)
+        {
+        }
+
+        template <class InputIt>
+        unordered_flat_set(InputIt f, InputIt l,
+                size_type n = 0,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : table_(
+                (std::max)(n, boost::unordered::detail::insert_size(f, l)),
+                hf, eql, a)
+        {
+            table_.insert_range(f, l);
+        }
+
+        // copy/move constructors
+
+        unordered_flat_set(unordered_flat_set const& other)
+          : table_(other.table_,
+                allocator_traits::select_on_container_copy_construction(
+                    other.table_.value_alloc()))
+        {
+        }
+
+        unordered_flat_set(unordered_flat_set const& other,
+                allocator_type const& a)
+          : table_(other.table_, a)
+        {
+        }
+
+#if defined(BOOST_UNORDERED_USE_MOVE)
+        unordered_flat_set(BOOST_RV_REF(unordered_flat_set) other)
+            : table_(other.table_, boost::unordered::detail::move_tag())
+        {
+        }
+#elif !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+        unordered_flat_set(unordered_flat_set&& other)
+            : table_(other.table_, boost::unordered::detail::move_tag())
+        {
+        }
+#endif
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+        unordered_flat_set(unordered_flat_set&& other,
+                allocator_type const& a)
+          : table_(other.table_, a, boost::unordered::detail::move_tag())
+        {
+        }
+#endif
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+        unordered_flat_set(
+                std::initializer_list<value_type> list,
+                size_type n = 0,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : table_((std::max)(n, list.size()), hf, eql, a)
+        {
+            table_.insert_range(list.begin(), list.end());
+        }
+#endif
+
+        // Assign
+
+#if defined(BOOST_UNORDERED_USE_MOVE)
+        unordered_flat_set& operator=(
+                BOOST_COPY_ASSIGN_REF(unordered_flat_set) x)
+        {
+            table_.assign(x.table_);
+            return *this;
+        }
+
+        unordered_flat_set& operator=(BOOST_RV_REF(unordered_flat_set) x)
+        {
+            table_.move_assign(x.table_);
+            return *this;
+        }
+#else
+        unordered_flat_set& operator=(unordered_flat_set const& x)
+        {
+            table_.assign(x.table_);
+            return *this;
+        }
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+        unordered_flat_set& operator=(unordered_flat_set&& x)
+        {
+            table_.move_assign(x.table_);
+            return *this;
+        }
+#endif
+#endif
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+        unordered_flat_set& operator=(std::initializer_list<value_type> list)
+        {
+            table_.clear();
+            table_.insert_range(list.begin(), list.end());
+            return *this;
+        }
+#endif
+
+        allocator_type get_allocator() const BOOST_NOEXCEPT
+        {
+            return table_.value_alloc();
+        }
+
+        // size and capacity
+
+        bool empty() const BOOST_NOEXCEPT
+        {
+            return table_.size_ == 0;
+        }
+
+        size_type size() const BOOST_NOEXCEPT
+        {
+            return table_.size_;
+        }
+
+        size_type max_size() const BOOST_NOEXCEPT
+        {
+            return table_.max_size();
+        }
+
+        // iterators
+
+        iterator begin() BOOST_NOEXCEPT
+        {
+            return table_.begin();
+        }
+
+        const_iterator begin() const BOOST_NOEXCEPT
+        {
+            return table_.begin();
+        }
+
+        iterator end() BOOST_NOEXCEPT
+        {
+            return table_.end();
+        }
+
+        const_iterator end() const BOOST_NOEXCEPT
+        {
+            return table_.end();
+        }
+
+        const_iterator cbegin() const BOOST_NOEXCEPT
+        {
+            return table_.begin();
+        }
+
+        const_iterator cend() const BOOST_NOEXCEPT
+        {
+            return table_.end();
+        }
+
+        // emplace
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        template <class... Args>
+        std::pair<iterator, bool> emplace(BOOST_FWD_REF(Args)... args)
+        {
+            value_type v(boost::forward<Args>(args)...);
+            return table_.insert_unique(v, boost::move(v));
+        }
+
+        template <class... Args>
+        iterator emplace_hint(const_iterator, BOOST_FWD_REF(Args)... args)
+        {
+            return this->emplace(boost::forward<Args>(args)...).first;
+        }
+#endif
+
+        std::pair<iterator, bool> insert(value_type const& x)
+        {
+            return table_.insert_unique(x, x);
+        }
+
+        std::pair<iterator, bool> insert(BOOST_RV_REF(value_type) x)
+        {
+            return table_.insert_unique(x, boost::move(x));
+        }
+
+        iterator insert(const_iterator, value_type const& x)
+        {
+            return this->insert(x).first;
+        }
+
+        iterator insert(const_iterator, BOOST_RV_REF(value_type) x)
+        {
+            return this->insert(boost::move(x)).first;
+        }
+
+        template <class InputIt> void insert(InputIt first, InputIt last)
+        {
+            table_.insert_range(first, last);
+        }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+        void insert(std::initializer_list<value_type> list)
+        {
+            table_.insert_range(list.begin(), list.end());
+        }
+#endif
+
+        iterator erase(const_iterator position)
+        {
+            return table_.erase(position);
+        }
+
+        size_type erase(const key_type& k)
+        {
+            return table_.erase_key(k);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            return table_.erase_range(first, last);
+        }
+
+        void clear()
+        {
+            table_.clear();
+        }
+
+        void swap(unordered_flat_set& other)
+        {
+            table_.swap(other.table_);
+        }
+
+        // observers
+
+        hasher hash_function() const
+        {
+            return table_.hash_function();
+        }
+
+        key_equal key_eq() const
+        {
+            return table_.key_eq();
+        }
+
+        // lookup
+
+        iterator find(const key_type& k)
+        {
+            return table_.iterator_at(table_.find_position(k));
+        }
+
+        const_iterator find(const key_type& k) const
+        {
+            return table_.iterator_at(table_.find_position(k));
+        }
+
+        template <class CompatibleKey, class CompatibleHash,
+            class CompatiblePredicate>
+        iterator find(
+                CompatibleKey const& k,
+                CompatibleHash const& hash,
+                CompatiblePredicate const& eq)
+        {
+            return table_.iterator_at(table_.find_position(
+                table::hash(k, hash), k, eq));
+        }
+
+        template <class CompatibleKey, class CompatibleHash,
+            class CompatiblePredicate>
+        const_iterator find(
+                CompatibleKey const& k,
+                CompatibleHash const& hash,
+                CompatiblePredicate const& eq) const
+        {
+            return table_.iterator_at(table_.find_position(
+                table::hash(k, hash), k, eq));
+        }
+
+        size_type count(const key_type& k) const
+        {
+            return table_.find_position(k) != table_.capacity() ? 1 : 0;
+        }
+
+        std::pair<iterator, iterator> equal_range(const key_type& k)
+        {
+            iterator first = this->find(k);
+            iterator last = first;
+            if (last != this->end()) ++last;
+            return std::make_pair(first, last);
+        }
+
+        std::pair<const_iterator, const_iterator>
+            equal_range(const key_type& k) const
+        {
+            const_iterator first = this->find(k);
+            const_iterator last = first;
+            if (last != this->end()) ++last;
+            return std::make_pair(first, last);
+        }
+
+        // capacity
+        //
+        // There are no buckets, bucket_count returns the number of slots.
+
+        size_type bucket_count() const BOOST_NOEXCEPT
+        {
+            return table_.capacity();
+        }
+
+        float load_factor() const BOOST_NOEXCEPT
+        {
+            return table_.groups_ ? static_cast<float>(table_.size_) /
+                static_cast<float>(table_.capacity()) : 0.0f;
+        }
+
+        float max_load_factor() const BOOST_NOEXCEPT
+        {
+            return 0.875f;
+        }
+
+        void max_load_factor(float) BOOST_NOEXCEPT
+        {
+        }
+
+        void rehash(size_type n)
+        {
+            table_.rehash(n);
+        }
+
+        void reserve(size_type n)
+        {
+            table_.reserve(n);
+        }
+
+        friend bool operator==(unordered_flat_set const& m1,
+                unordered_flat_set const& m2)
+        {
+            return m1.table_.equals(m2.table_);
+        }
+
+        friend bool operator!=(unordered_flat_set const& m1,
+                unordered_flat_set const& m2)
+        {
+            return !m1.table_.equals(m2.table_);
+        }
+
+    }; // class template unordered_flat_set
+
+    template <class T, class H, class P, class A>
+    inline void swap(
+            unordered_flat_set<T,H,P,A> &m1,
+            unordered_flat_set<T,H,P,A> &m2)
+    {
+        m1.swap(m2);
+    }
+} // namespace unordered
+
+using boost::unordered::unordered_flat_set;
+
+} // namespace boost
+
+#endif // BOOST_UNORDERED_UNORDERED_FLAT_SET_HPP_INCLUDED
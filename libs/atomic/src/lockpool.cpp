@@ -8,6 +8,15 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+// The number of locks in the pool. Must be a power of two.
+#ifndef BOOST_ATOMIC_LOCK_POOL_SIZE
+#define BOOST_ATOMIC_LOCK_POOL_SIZE 64
+#endif
+
+#if BOOST_ATOMIC_LOCK_POOL_SIZE <= 0 || (BOOST_ATOMIC_LOCK_POOL_SIZE & (BOOST_ATOMIC_LOCK_POOL_SIZE - 1)) != 0
+#error BOOST_ATOMIC_LOCK_POOL_SIZE must be a power of two
+#endif
+
 namespace boost {
 namespace atomics {
 namespace detail {
@@ -28,17 +37,62 @@ struct padding< 0 >
 {
 };
 
-struct BOOST_ALIGNMENT(BOOST_ATOMIC_CACHE_LINE_SIZE) padded_lock
+#ifdef BOOST_ATOMIC_FLAG_LOCK_FREE
+
+// Sequence counter value. A distinct type is used so that the atomic counter
+// does not share template instantiations with the user's code, which may use
+// a different atomic implementation (e.g. with BOOST_ATOMIC_FORCE_FALLBACK).
+struct sequence_value
+{
+    unsigned int value;
+};
+
+typedef atomic< sequence_value > sequence_type;
+
+struct lock_state
+{
+    lockpool::lock_type lock;
+    // Sequence counter, odd while an object protected by the lock is being modified
+    sequence_type sequence;
+};
+
+#else
+
+struct lock_state
 {
     lockpool::lock_type lock;
+};
+
+#endif
+
+struct BOOST_ALIGNMENT(BOOST_ATOMIC_CACHE_LINE_SIZE) padded_lock
+{
+    lock_state state;
     // The additional padding is needed to avoid false sharing between locks
-    enum { padding_size = (sizeof(lockpool::lock_type) <= BOOST_ATOMIC_CACHE_LINE_SIZE ?
-        (BOOST_ATOMIC_CACHE_LINE_SIZE - sizeof(lockpool::lock_type)) :
-        (BOOST_ATOMIC_CACHE_LINE_SIZE - sizeof(lockpool::lock_type) % BOOST_ATOMIC_CACHE_LINE_SIZE)) };
+    enum { padding_size = (sizeof(lock_state) <= BOOST_ATOMIC_CACHE_LINE_SIZE ?
+        (BOOST_ATOMIC_CACHE_LINE_SIZE - sizeof(lock_state)) :
+        (BOOST_ATOMIC_CACHE_LINE_SIZE - sizeof(lock_state) % BOOST_ATOMIC_CACHE_LINE_SIZE)) };
     padding< padding_size > pad;
 };
 
-static padded_lock lock_pool_[41];
+static padded_lock lock_pool_[BOOST_ATOMIC_LOCK_POOL_SIZE];
+
+#ifdef BOOST_ATOMIC_FLAG_LOCK_FREE
+
+inline sequence_type& get_sequence(lockpool::lock_type& lock)
+{
+    // The lock is the first member of the state
+    return reinterpret_cast< lock_state* >(&lock)->sequence;
+}
+
+inline void increment_sequence(sequence_type& sequence, memory_order order)
+{
+    sequence_value seq = sequence.load(memory_order_relaxed);
+    ++seq.value;
+    sequence.store(seq, order);
+}
+
+#endif
 
 } // namespace
 
@@ -46,10 +100,53 @@ static padded_lock lock_pool_[41];
 // NOTE: This function must NOT be inline. Otherwise MSVC 9 will sometimes generate broken code for modulus operation which result in crashes.
 BOOST_ATOMIC_DECL lockpool::lock_type& lockpool::get_lock_for(const volatile void* addr)
 {
-    std::size_t index = reinterpret_cast<std::size_t>(addr) % (sizeof(lock_pool_) / sizeof(*lock_pool_));
-    return lock_pool_[index].lock;
+    std::size_t h = reinterpret_cast<std::size_t>(addr);
+    // The low bits are zero because of the alignment, and atomics allocated
+    // close to each other differ mostly in the middle bits. Fold the bits
+    // together so that neighbouring objects use different locks.
+    h ^= h >> 4;
+    h ^= h >> 9;
+    h ^= h >> 17;
+    return lock_pool_[h & (BOOST_ATOMIC_LOCK_POOL_SIZE - 1)].state.lock;
+}
+
+#ifdef BOOST_ATOMIC_FLAG_LOCK_FREE
+
+BOOST_ATOMIC_DECL void lockpool::begin_write(lock_type& lock)
+{
+    // Called with the lock acquired, so there are no concurrent writers
+    increment_sequence(get_sequence(lock), memory_order_relaxed);
+    // Make sure the odd counter is visible before any modifications of the object
+    atomic_thread_fence(memory_order_release);
 }
 
+BOOST_ATOMIC_DECL void lockpool::end_write(lock_type& lock)
+{
+    increment_sequence(get_sequence(lock), memory_order_release);
+}
+
+BOOST_ATOMIC_DECL unsigned int lockpool::read_begin(lock_type& lock)
+{
+    sequence_type& sequence = get_sequence(lock);
+    unsigned int seq;
+    while (((seq = sequence.load(memory_order_acquire).value) & 1u) != 0u)
+    {
+#if defined(BOOST_ATOMIC_X86_PAUSE)
+        BOOST_ATOMIC_X86_PAUSE();
+#endif
+    }
+    return seq;
+}
+
+BOOST_ATOMIC_DECL bool lockpool::read_validate(lock_type& lock, unsigned int seq)
+{
+    // Make sure the object is read before the counter is checked
+    atomic_thread_fence(memory_order_acquire);
+    return get_sequence(lock).load(memory_order_relaxed).value == seq;
+}
+
+#endif // BOOST_ATOMIC_FLAG_LOCK_FREE
+
 }
 }
 }
@@ -0,0 +1,125 @@
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// Let readers race writers on atomic variables that are not lock-free
+// and verify that no load observes a partially written value. The loads
+// of such variables do not take the lock of the pool, they repeat the
+// read if a modification overlapped.
+//
+// Several variables are used, so that some of them share a lock of the
+// pool; the test is also built with a small BOOST_ATOMIC_LOCK_POOL_SIZE
+// to make sure of this.
+
+#include <cstddef>
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread.hpp>
+#include <boost/test/minimal.hpp>
+
+namespace {
+
+// Too large to be lock-free. All the words of a value are equal,
+// a value with different words was torn.
+struct test_value
+{
+    boost::uint32_t words[7];
+};
+
+test_value make_value(boost::uint32_t n)
+{
+    test_value v;
+    for (std::size_t i = 0; i < sizeof(v.words) / sizeof(*v.words); ++i)
+        v.words[i] = n;
+    return v;
+}
+
+bool is_torn(test_value const& v)
+{
+    for (std::size_t i = 1; i < sizeof(v.words) / sizeof(*v.words); ++i)
+    {
+        if (v.words[i] != v.words[0])
+            return true;
+    }
+    return false;
+}
+
+const std::size_t variable_count = 8;
+const boost::uint32_t iteration_count = 100000;
+
+struct shared_state
+{
+    boost::atomic<test_value> variables[variable_count];
+    boost::atomic<unsigned int> running_writers;
+    boost::atomic<unsigned int> torn_loads;
+};
+
+void writer(shared_state& state, boost::uint32_t seed)
+{
+    for (boost::uint32_t n = 0; n < iteration_count; ++n)
+    {
+        boost::atomic<test_value>& var = state.variables[(n + seed) % variable_count];
+        switch (n % 3)
+        {
+        case 0:
+            var.store(make_value(n + seed));
+            break;
+
+        case 1:
+            if (is_torn(var.exchange(make_value(n + seed))))
+                ++state.torn_loads;
+            break;
+
+        default:
+            {
+                test_value expected = var.load();
+                var.compare_exchange_strong(expected, make_value(n + seed));
+                if (is_torn(expected))
+                    ++state.torn_loads;
+            }
+            break;
+        }
+
+        if (n % 64 == 0)
+            boost::this_thread::yield();
+    }
+    --state.running_writers;
+}
+
+void reader(shared_state& state)
+{
+    for (std::size_t n = 0; state.running_writers.load() != 0; ++n)
+    {
+        if (is_torn(state.variables[n % variable_count].load()))
+            ++state.torn_loads;
+    }
+}
+
+} // namespace
+
+int test_main(int, char *[])
+{
+    shared_state state;
+    for (std::size_t i = 0; i < variable_count; ++i)
+        state.variables[i].store(make_value(0));
+    state.running_writers.store(2);
+    state.torn_loads.store(0);
+
+    BOOST_REQUIRE(!state.variables[0].is_lock_free());
+
+    boost::thread_group threads;
+    threads.create_thread(boost::bind(&writer, boost::ref(state), 0u));
+    threads.create_thread(boost::bind(&writer, boost::ref(state), 1000000u));
+    threads.create_thread(boost::bind(&reader, boost::ref(state)));
+    threads.create_thread(boost::bind(&reader, boost::ref(state)));
+    threads.join_all();
+
+    BOOST_CHECK(state.torn_loads.load() == 0u);
+
+    return 0;
+}
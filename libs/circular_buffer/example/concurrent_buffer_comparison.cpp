@@ -0,0 +1,196 @@
+// Comparison of the throughput of the concurrent circular buffers with the bounded buffer based on a mutex.
+
+// Copyright (C) 2026 agent <agent@local>
+
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_CB_DISABLE_DEBUG
+
+#include <boost/circular_buffer.hpp>
+#include <boost/circular_buffer/concurrent.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/call_traits.hpp>
+#include <boost/bind.hpp>
+#include <string>
+#include <iostream>
+
+const unsigned long QUEUE_SIZE     = 1000L;
+const unsigned long TOTAL_ELEMENTS = QUEUE_SIZE * 1000L;
+const unsigned long BATCH_SIZE     = 64L;
+
+// The bounded buffer of the Bounded Buffer Example.
+template <class T>
+class bounded_buffer {
+public:
+
+    typedef boost::circular_buffer<T> container_type;
+    typedef typename container_type::size_type size_type;
+    typedef typename container_type::value_type value_type;
+    typedef typename boost::call_traits<value_type>::param_type param_type;
+
+    explicit bounded_buffer(size_type capacity) : m_unread(0), m_container(capacity) {}
+
+    void push_front(param_type item) {
+        boost::unique_lock<boost::mutex> lock(m_mutex);
+        m_not_full.wait(lock, boost::bind(&bounded_buffer<value_type>::is_not_full, this));
+        m_container.push_front(item);
+        ++m_unread;
+        lock.unlock();
+        m_not_empty.notify_one();
+    }
+
+    void pop_back(value_type* pItem) {
+        boost::unique_lock<boost::mutex> lock(m_mutex);
+        m_not_empty.wait(lock, boost::bind(&bounded_buffer<value_type>::is_not_empty, this));
+        *pItem = m_container[--m_unread];
+        lock.unlock();
+        m_not_full.notify_one();
+    }
+
+private:
+    bounded_buffer(const bounded_buffer&);              // Disabled copy constructor
+    bounded_buffer& operator = (const bounded_buffer&); // Disabled assign operator
+
+    bool is_not_empty() const { return m_unread > 0; }
+    bool is_not_full() const { return m_unread < m_container.capacity(); }
+
+    size_type m_unread;
+    container_type m_container;
+    boost::mutex m_mutex;
+    boost::condition_variable m_not_empty;
+    boost::condition_variable m_not_full;
+};
+
+// Producers and consumers of the bounded buffer.
+template <class T>
+void bounded_buffer_producer(bounded_buffer<T>* buffer, unsigned long n) {
+    for (unsigned long i = 0L; i < n; ++i)
+        buffer->push_front(T());
+}
+
+template <class T>
+void bounded_buffer_consumer(bounded_buffer<T>* buffer, unsigned long n) {
+    T item;
+    for (unsigned long i = 0L; i < n; ++i)
+        buffer->pop_back(&item);
+}
+
+// Producer and consumers of the circular_buffer_spsc.
+template <class T>
+void spsc_producer(boost::circular_buffer_spsc<T>* buffer, unsigned long n) {
+    for (unsigned long i = 0L; i < n; ++i)
+        buffer->push_back(T());
+}
+
+template <class T>
+void spsc_consumer(boost::circular_buffer_spsc<T>* buffer, unsigned long n) {
+    T item;
+    for (unsigned long i = 0L; i < n; ++i)
+        buffer->pop_front(item);
+}
+
+template <class T>
+void spsc_batch_consumer(boost::circular_buffer_spsc<T>* buffer, unsigned long n) {
+    typedef typename boost::circular_buffer_spsc<T>::array_range array_range;
+    T item;
+    for (unsigned long i = 0L; i < n;) {
+        // Process the elements in place
+        const array_range one = buffer->array_one();
+        const array_range two = buffer->array_two();
+        if (one.second == 0) {
+            boost::this_thread::yield();
+            continue;
+        }
+        for (std::size_t j = 0; j < one.second; ++j)
+            item = one.first[j];
+        for (std::size_t j = 0; j < two.second; ++j)
+            item = two.first[j];
+        buffer->erase_begin(one.second + two.second);
+        i += one.second + two.second;
+    }
+}
+
+// Producers and consumers of the circular_buffer_mpmc.
+template <class T>
+void mpmc_producer(boost::circular_buffer_mpmc<T>* buffer, unsigned long n) {
+    for (unsigned long i = 0L; i < n; ++i)
+        buffer->push_back(T());
+}
+
+template <class T>
+void mpmc_consumer(boost::circular_buffer_mpmc<T>* buffer, unsigned long n) {
+    T item;
+    for (unsigned long i = 0L; i < n; ++i)
+        buffer->pop_front(item);
+}
+
+template <class T>
+void mpmc_batch_consumer(boost::circular_buffer_mpmc<T>* buffer, unsigned long n) {
+    typedef typename boost::circular_buffer_mpmc<T>::array_range array_range;
+    typedef typename boost::circular_buffer_mpmc<T>::batch batch;
+    T item;
+    for (unsigned long i = 0L; i < n;) {
+        // Claim the elements and process them in place
+        batch b = buffer->acquire_front(n - i < BATCH_SIZE ? n - i : BATCH_SIZE);
+        const array_range one = b.array_one();
+        const array_range two = b.array_two();
+        for (std::size_t j = 0; j < one.second; ++j)
+            item = one.first[j];
+        for (std::size_t j = 0; j < two.second; ++j)
+            item = two.first[j];
+        i += b.size();
+        buffer->release(b);
+    }
+}
+
+// Runs "threads" producers and "threads" consumers and prints the throughput.
+template <class Buffer, class Producer, class Consumer>
+void fifo_test(const char* name, Buffer* buffer, Producer producer, Consumer consumer, unsigned long threads) {
+
+    boost::timer::cpu_timer timer;
+    boost::thread_group group;
+    for (unsigned long i = 0L; i < threads; ++i) {
+        group.create_thread(boost::bind(consumer, buffer, TOTAL_ELEMENTS / threads));
+        group.create_thread(boost::bind(producer, buffer, TOTAL_ELEMENTS / threads));
+    }
+    group.join_all();
+    timer.stop();
+
+    const double seconds = timer.elapsed().wall / 1e9;
+    std::cout << name << " " << threads << "x" << threads << ": " << seconds << " s, "
+              << TOTAL_ELEMENTS / seconds / 1e6 << " M elements/s" << std::endl;
+}
+
+template <class T>
+void compare(const char* type_name) {
+
+    std::cout << type_name << std::endl;
+
+    bounded_buffer<T> bb(QUEUE_SIZE);
+    fifo_test("  bounded_buffer              ", &bb, &bounded_buffer_producer<T>, &bounded_buffer_consumer<T>, 1);
+
+    boost::circular_buffer_spsc<T> spsc(QUEUE_SIZE);
+    fifo_test("  circular_buffer_spsc        ", &spsc, &spsc_producer<T>, &spsc_consumer<T>, 1);
+    fifo_test("  circular_buffer_spsc batch  ", &spsc, &spsc_producer<T>, &spsc_batch_consumer<T>, 1);
+
+    boost::circular_buffer_mpmc<T> mpmc(QUEUE_SIZE);
+    fifo_test("  circular_buffer_mpmc        ", &mpmc, &mpmc_producer<T>, &mpmc_consumer<T>, 1);
+    fifo_test("  circular_buffer_mpmc batch  ", &mpmc, &mpmc_producer<T>, &mpmc_batch_consumer<T>, 1);
+
+    fifo_test("  bounded_buffer              ", &bb, &bounded_buffer_producer<T>, &bounded_buffer_consumer<T>, 4);
+    fifo_test("  circular_buffer_mpmc        ", &mpmc, &mpmc_producer<T>, &mpmc_consumer<T>, 4);
+    fifo_test("  circular_buffer_mpmc batch  ", &mpmc, &mpmc_producer<T>, &mpmc_batch_consumer<T>, 4);
+}
+
+int main(int /*argc*/, char* /*argv*/[]) {
+
+    compare<int>("int");
+    compare<std::string>("std::string");
+
+    return 0;
+}
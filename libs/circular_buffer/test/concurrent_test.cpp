@@ -0,0 +1,315 @@
+// Test of the concurrent circular buffers.
+
+// Copyright (C) 2026 agent <agent@local>
+
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test.hpp"
+#include <boost/circular_buffer/concurrent.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+
+// Integer counting its instances, the copy constructor of which can throw while its move constructor does not
+// (as required by circular_buffer_mpmc).
+class NothrowMovableInteger {
+    BOOST_COPYABLE_AND_MOVABLE(NothrowMovableInteger)
+    int m_value;
+    static int ms_exception_trigger;
+    static int ms_count;
+public:
+    explicit NothrowMovableInteger(int i = 0) : m_value(i) { ++ms_count; }
+    NothrowMovableInteger(const NothrowMovableInteger& src) : m_value(src.m_value) {
+        if (ms_exception_trigger > 0 && --ms_exception_trigger == 0) {
+#if !defined(BOOST_NO_EXCEPTIONS)
+            throw std::exception();
+#endif
+        }
+        ++ms_count;
+    }
+    NothrowMovableInteger(BOOST_RV_REF(NothrowMovableInteger) src) BOOST_NOEXCEPT : m_value(src.m_value) { ++ms_count; }
+    ~NothrowMovableInteger() { --ms_count; }
+    NothrowMovableInteger& operator = (BOOST_COPY_ASSIGN_REF(NothrowMovableInteger) src) {
+        m_value = src.m_value;
+        return *this;
+    }
+    NothrowMovableInteger& operator = (BOOST_RV_REF(NothrowMovableInteger) src) BOOST_NOEXCEPT {
+        m_value = src.m_value;
+        return *this;
+    }
+    operator int () const { return m_value; }
+    static void set_exception_trigger(int n) { ms_exception_trigger = n; }
+    static int count() { return ms_count; }
+};
+
+namespace boost {
+    // For compilers without noexcept
+    template <> struct has_nothrow_move<NothrowMovableInteger> : true_type {};
+}
+
+int MyInteger::ms_exception_trigger = 0;
+int InstanceCounter::ms_count = 0;
+int NothrowMovableInteger::ms_exception_trigger = 0;
+int NothrowMovableInteger::ms_count = 0;
+
+const int TOTAL_ELEMENTS = 200000;
+
+// Sums the elements of two array ranges.
+template <class ArrayRange>
+int sum_arrays(const ArrayRange& one, const ArrayRange& two, int* last) {
+    int sum = 0;
+    for (typename ArrayRange::second_type i = 0; i < one.second; ++i) {
+        BOOST_CHECK(one.first[i] == *last + 1);
+        *last = one.first[i];
+        sum += one.first[i];
+    }
+    for (typename ArrayRange::second_type i = 0; i < two.second; ++i) {
+        BOOST_CHECK(two.first[i] == *last + 1);
+        *last = two.first[i];
+        sum += two.first[i];
+    }
+    return sum;
+}
+
+void spsc_basic_test() {
+
+    circular_buffer_spsc<int> cb(5);
+
+    BOOST_CHECK(cb.capacity() == 5);
+    BOOST_CHECK(cb.empty());
+    BOOST_CHECK(cb.array_one().second == 0);
+    BOOST_CHECK(cb.array_two().second == 0);
+
+    int item = 0;
+    BOOST_CHECK(!cb.try_pop_front(item));
+    for (int i = 1; i <= 5; ++i)
+        BOOST_CHECK(cb.try_push_back(i));
+    BOOST_CHECK(!cb.try_push_back(6));
+    BOOST_CHECK(cb.full());
+    BOOST_CHECK(cb.size() == 5);
+
+    BOOST_CHECK(cb.try_pop_front(item));
+    BOOST_CHECK(item == 1);
+    cb.erase_begin(2);
+    BOOST_CHECK(cb.size() == 2);
+
+    // Wrap around the end of the internal buffer
+    cb.push_back(6);
+    cb.push_back(7);
+    cb.push_back(8);
+    BOOST_CHECK(cb.full());
+    circular_buffer_spsc<int>::array_range one = cb.array_one();
+    circular_buffer_spsc<int>::array_range two = cb.array_two();
+    BOOST_CHECK(one.second + two.second == 5);
+    BOOST_CHECK(two.second > 0);
+    int last = 3;
+    BOOST_CHECK(sum_arrays(one, two, &last) == 4 + 5 + 6 + 7 + 8);
+    cb.erase_begin(one.second + two.second);
+    BOOST_CHECK(cb.empty());
+}
+
+void spsc_destruction_test() {
+
+    {
+        circular_buffer_spsc<InstanceCounter> cb(10);
+        for (int i = 0; i < 15; ++i) {
+            cb.try_push_back(InstanceCounter());
+            if (i % 3 == 0)
+                cb.erase_begin(1);
+        }
+        BOOST_CHECK(InstanceCounter::count() == (int)cb.size());
+    }
+    BOOST_CHECK(InstanceCounter::count() == 0);
+
+#if !defined(BOOST_NO_EXCEPTIONS)
+    circular_buffer_spsc<MyInteger> cb(3);
+    cb.push_back(1);
+    MyInteger item(2);
+    MyInteger::set_exception_trigger(1);
+    BOOST_CHECK_THROW(cb.try_push_back(item), std::exception);
+    BOOST_CHECK(cb.size() == 1);
+    BOOST_CHECK(cb.array_one().first[0] == 1);
+#endif
+}
+
+void spsc_producer(circular_buffer_spsc<int>* cb) {
+    for (int i = 1; i <= TOTAL_ELEMENTS; ++i)
+        cb->push_back(i);
+}
+
+void spsc_thread_test() {
+
+    circular_buffer_spsc<int> cb(100);
+    boost::thread producer(boost::bind(&spsc_producer, &cb));
+
+    // Consume in batches
+    int last = 0;
+    while (last < TOTAL_ELEMENTS) {
+        circular_buffer_spsc<int>::array_range one = cb.array_one();
+        circular_buffer_spsc<int>::array_range two = cb.array_two();
+        if (one.second == 0) {
+            boost::this_thread::yield();
+            continue;
+        }
+        sum_arrays(one, two, &last);
+        cb.erase_begin(one.second + two.second);
+    }
+    producer.join();
+    BOOST_CHECK(last == TOTAL_ELEMENTS);
+    BOOST_CHECK(cb.empty());
+}
+
+void mpmc_basic_test() {
+
+    circular_buffer_mpmc<int> cb(5);
+
+    BOOST_CHECK(cb.capacity() == 5);
+    BOOST_CHECK(cb.empty());
+    BOOST_CHECK(cb.try_acquire_front(3).empty());
+
+    int item = 0;
+    BOOST_CHECK(!cb.try_pop_front(item));
+    for (int i = 1; i <= 5; ++i)
+        BOOST_CHECK(cb.try_push_back(i));
+    BOOST_CHECK(!cb.try_push_back(6));
+    BOOST_CHECK(cb.full());
+
+    BOOST_CHECK(cb.try_pop_front(item));
+    BOOST_CHECK(item == 1);
+    circular_buffer_mpmc<int>::batch b1 = cb.try_acquire_front(2);
+    BOOST_CHECK(b1.size() == 2);
+    BOOST_CHECK(b1.array_one().first[0] == 2);
+
+    // Slots claimed by a consumer are free only after the batch is released
+    BOOST_CHECK(cb.try_push_back(6));
+    BOOST_CHECK(!cb.try_push_back(7));
+    cb.release(b1);
+    BOOST_CHECK(b1.empty());
+    cb.push_back(7);
+    cb.push_back(8);
+    BOOST_CHECK(cb.full());
+
+    // Wrap around the end of the internal buffer
+    circular_buffer_mpmc<int>::batch b2 = cb.try_acquire_front(10);
+    BOOST_CHECK(b2.size() == 5);
+    BOOST_CHECK(b2.array_two().second > 0);
+    int last = 3;
+    BOOST_CHECK(sum_arrays(b2.array_one(), b2.array_two(), &last) == 4 + 5 + 6 + 7 + 8);
+    BOOST_CHECK(cb.try_acquire_front(1).empty());
+    cb.release(b2);
+    BOOST_CHECK(cb.empty());
+}
+
+void mpmc_destruction_test() {
+
+    {
+        circular_buffer_mpmc<NothrowMovableInteger> cb(10);
+        for (int i = 0; i < 15; ++i) {
+            cb.try_push_back(NothrowMovableInteger(i));
+            if (i % 3 == 0) {
+                circular_buffer_mpmc<NothrowMovableInteger>::batch b = cb.try_acquire_front(1);
+                cb.release(b);
+            }
+        }
+        BOOST_CHECK(NothrowMovableInteger::count() == (int)cb.size());
+    }
+    BOOST_CHECK(NothrowMovableInteger::count() == 0);
+
+#if !defined(BOOST_NO_EXCEPTIONS)
+    // The copy is made before claiming a slot, so the buffer is not changed when it throws
+    circular_buffer_mpmc<NothrowMovableInteger> cb(3);
+    cb.push_back(NothrowMovableInteger(1));
+    const NothrowMovableInteger two(2);
+    NothrowMovableInteger::set_exception_trigger(1);
+    BOOST_CHECK_THROW(cb.try_push_back(two), std::exception);
+    NothrowMovableInteger::set_exception_trigger(1);
+    BOOST_CHECK_THROW(cb.push_back(two), std::exception);
+    BOOST_CHECK(cb.size() == 1);
+    BOOST_CHECK(cb.try_push_back(two));
+    cb.push_back(two);
+    BOOST_CHECK(cb.full());
+    NothrowMovableInteger item;
+    BOOST_CHECK(cb.try_pop_front(item));
+    BOOST_CHECK(item == 1);
+    BOOST_CHECK(cb.try_pop_front(item));
+    BOOST_CHECK(item == 2);
+    BOOST_CHECK(cb.try_pop_front(item));
+    BOOST_CHECK(item == 2);
+    BOOST_CHECK(cb.empty());
+#endif
+}
+
+const int MPMC_THREADS = 4;
+
+void mpmc_producer(circular_buffer_mpmc<int>* cb) {
+    for (int i = 1; i <= TOTAL_ELEMENTS / MPMC_THREADS; ++i)
+        cb->push_back(i);
+}
+
+void mpmc_consumer(circular_buffer_mpmc<int>* cb, int batch_size, long long* sum) {
+    const int n = TOTAL_ELEMENTS / MPMC_THREADS;
+    for (int consumed = 0; consumed < n;) {
+        const int max_count = n - consumed < batch_size ? n - consumed : batch_size;
+        circular_buffer_mpmc<int>::batch b = cb->acquire_front(max_count);
+        circular_buffer_mpmc<int>::array_range one = b.array_one();
+        circular_buffer_mpmc<int>::array_range two = b.array_two();
+        for (size_t i = 0; i < one.second; ++i)
+            *sum += one.first[i];
+        for (size_t i = 0; i < two.second; ++i)
+            *sum += two.first[i];
+        consumed += (int)b.size();
+        cb->release(b);
+    }
+}
+
+void mpmc_thread_test() {
+
+    // Consumers claim single elements or batches
+    for (int batch_size = 1; batch_size <= 16; batch_size *= 16) {
+        circular_buffer_mpmc<int> cb(64);
+        long long sums[MPMC_THREADS] = {};
+        boost::thread_group threads;
+        for (int i = 0; i < MPMC_THREADS; ++i) {
+            threads.create_thread(boost::bind(&mpmc_producer, &cb));
+            threads.create_thread(boost::bind(&mpmc_consumer, &cb, batch_size, &sums[i]));
+        }
+        threads.join_all();
+        long long total = 0;
+        for (int i = 0; i < MPMC_THREADS; ++i)
+            total += sums[i];
+        const long long n = TOTAL_ELEMENTS / MPMC_THREADS;
+        BOOST_CHECK(total == MPMC_THREADS * n * (n + 1) / 2);
+        BOOST_CHECK(cb.empty());
+    }
+}
+
+void mpmc_sleep_test() {
+
+    // Threads sleep while the buffer is full or empty
+    circular_buffer_mpmc<int> cb(2);
+    long long sum = 0;
+    boost::thread consumer(boost::bind(&mpmc_consumer, &cb, 1, &sum));
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    mpmc_producer(&cb);
+    consumer.join();
+    const long long n = TOTAL_ELEMENTS / MPMC_THREADS;
+    BOOST_CHECK(sum == n * (n + 1) / 2);
+    BOOST_CHECK(cb.empty());
+}
+
+// test main
+test_suite* init_unit_test_suite(int /*argc*/, char* /*argv*/[]) {
+
+    test_suite* tests = BOOST_TEST_SUITE("Unit tests for the concurrent circular buffers.");
+
+    tests->add(BOOST_TEST_CASE(&spsc_basic_test));
+    tests->add(BOOST_TEST_CASE(&spsc_destruction_test));
+    tests->add(BOOST_TEST_CASE(&spsc_thread_test));
+    tests->add(BOOST_TEST_CASE(&mpmc_basic_test));
+    tests->add(BOOST_TEST_CASE(&mpmc_destruction_test));
+    tests->add(BOOST_TEST_CASE(&mpmc_thread_test));
+    tests->add(BOOST_TEST_CASE(&mpmc_sleep_test));
+
+    return tests;
+}
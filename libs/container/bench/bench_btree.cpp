@@ -0,0 +1,276 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "boost/container/map.hpp"
+#include "boost/container/flat_map.hpp"
+#include "boost/container/btree_map.hpp"
+#include <map>
+#include <vector>
+#include <iostream>
+#include <boost/timer/timer.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t N = 200000;
+static const std::size_t Iterations = 20;
+#else
+static const std::size_t N = 20000;
+static const std::size_t Iterations = 2;
+#endif
+
+void compare_times(cpu_times time_numerator, cpu_times time_denominator){
+   std::cout << "----------------------------------------------" << '\n';
+   std::cout << " wall        = " << ((double)time_numerator.wall/(double)time_denominator.wall) << std::endl;
+   std::cout << "----------------------------------------------" << '\n' << std::endl;
+}
+
+std::vector<int> random_unique_range;
+std::vector<int> sorted_unique_range;
+std::vector<std::pair<int, int> > sorted_unique_pairs;
+
+void fill_ranges()
+{
+   sorted_unique_range.resize(N);
+   for(std::size_t i = 0; i != N; ++i){
+      sorted_unique_range[i] = static_cast<int>(i);
+   }
+   random_unique_range = sorted_unique_range;
+   std::srand(0);
+   std::random_shuffle(random_unique_range.begin(), random_unique_range.end());
+   sorted_unique_pairs.resize(N);
+   for(std::size_t i = 0; i != N; ++i){
+      sorted_unique_pairs[i] = std::pair<int, int>(static_cast<int>(i), static_cast<int>(i));
+   }
+}
+
+template<typename T>
+cpu_times insert_time()
+{
+   cpu_timer sorted_timer, random_timer, erase_timer;
+   sorted_timer.stop(); random_timer.stop(); erase_timer.stop();
+
+   cpu_timer total_time;
+   total_time.resume();
+
+   for(std::size_t i = 0; i != Iterations; ++i){
+      {
+         sorted_timer.resume();
+         T t;
+         for(std::size_t j = 0; j != N; ++j){
+            t.insert(t.end(), typename T::value_type(sorted_unique_range[j], 0));
+         }
+         sorted_timer.stop();
+      }
+      {
+         random_timer.resume();
+         T t;
+         for(std::size_t j = 0; j != N; ++j){
+            t.insert(typename T::value_type(random_unique_range[j], 0));
+         }
+         random_timer.stop();
+         erase_timer.resume();
+         for(std::size_t j = 0; j != N; ++j){
+            t.erase(random_unique_range[j]);
+         }
+         erase_timer.stop();
+      }
+   }
+   total_time.stop();
+
+   std::cout << " Insert sorted_unique_range (hint end) " << boost::timer::format(sorted_timer.elapsed(), boost::timer::default_places, "%ws wall\n");
+   std::cout << " Insert random_unique_range            " << boost::timer::format(random_timer.elapsed(), boost::timer::default_places, "%ws wall\n");
+   std::cout << " Erase random_unique_range             " << boost::timer::format(erase_timer.elapsed(), boost::timer::default_places, "%ws wall\n");
+   std::cout << " Total time =                          " << boost::timer::format(total_time.elapsed(), boost::timer::default_places, "%ws wall\n") << std::endl;
+   return total_time.elapsed();
+}
+
+template<typename T>
+cpu_times search_time()
+{
+   cpu_timer find_timer, lower_timer;
+   find_timer.stop(); lower_timer.stop();
+
+   T t(sorted_unique_pairs.begin(), sorted_unique_pairs.end());
+
+   cpu_timer total_time;
+   total_time.resume();
+
+   for(std::size_t i = 0; i != Iterations; ++i){
+      //Find
+      {
+         std::size_t found = 0;
+         find_timer.resume();
+         for(std::size_t j = 0; j != N; ++j){
+            found += static_cast<std::size_t>(t.end() != t.find(random_unique_range[j]));
+         }
+         find_timer.stop();
+         if(found != t.size()){
+            std::cout << "ERROR! all elements not found" << std::endl;
+         }
+      }
+      //Lower
+      {
+         std::size_t found = 0;
+         lower_timer.resume();
+         for(std::size_t j = 0; j != N; ++j){
+            found += static_cast<std::size_t>(t.end() != t.lower_bound(random_unique_range[j]));
+         }
+         lower_timer.stop();
+         if(found != t.size()){
+            std::cout << "ERROR! all elements not found" << std::endl;
+         }
+      }
+   }
+   total_time.stop();
+
+   std::cout << " Find         " << boost::timer::format(find_timer.elapsed(), boost::timer::default_places, "%ws wall\n");
+   std::cout << " Lower Bound  " << boost::timer::format(lower_timer.elapsed(), boost::timer::default_places, "%ws wall\n");
+   std::cout << " Total time = " << boost::timer::format(total_time.elapsed(), boost::timer::default_places, "%ws wall\n") << std::endl;
+   return total_time.elapsed();
+}
+
+template<typename T>
+cpu_times scan_time()
+{
+   cpu_timer forward_timer, range_timer;
+   forward_timer.stop(); range_timer.stop();
+
+   T t(sorted_unique_pairs.begin(), sorted_unique_pairs.end());
+   const std::size_t RangeSize = 100;
+
+   cpu_timer total_time;
+   total_time.resume();
+
+   for(std::size_t i = 0; i != Iterations; ++i){
+      //Full forward traversal
+      {
+         std::size_t sum = 0;
+         forward_timer.resume();
+         for(typename T::const_iterator it = t.begin(), itend = t.end(); it != itend; ++it){
+            sum += static_cast<std::size_t>(it->first);
+         }
+         forward_timer.stop();
+         if(sum != (N*(N-1))/2){
+            std::cout << "ERROR! wrong sum" << std::endl;
+         }
+      }
+      //Short range scans starting at random keys
+      {
+         std::size_t visited = 0;
+         range_timer.resume();
+         for(std::size_t j = 0; j != N/RangeSize; ++j){
+            typename T::const_iterator it = t.lower_bound(random_unique_range[j]);
+            for(std::size_t k = 0; k != RangeSize && it != t.end(); ++k, ++it){
+               visited += static_cast<std::size_t>(it->second >= 0);
+            }
+         }
+         range_timer.stop();
+         if(!visited){
+            std::cout << "ERROR! no elements visited" << std::endl;
+         }
+      }
+   }
+   total_time.stop();
+
+   std::cout << " Forward traversal " << boost::timer::format(forward_timer.elapsed(), boost::timer::default_places, "%ws wall\n");
+   std::cout << " Range scans       " << boost::timer::format(range_timer.elapsed(), boost::timer::default_places, "%ws wall\n");
+   std::cout << " Total time =      " << boost::timer::format(total_time.elapsed(), boost::timer::default_places, "%ws wall\n") << std::endl;
+   return total_time.elapsed();
+}
+
+template<class BoostClass, class StdClass>
+void launch_tests(const char *BoostContName, const char *StdContName)
+{
+   try {
+      fill_ranges();
+      {
+         std::cout << "Insert benchmark:" << BoostContName << std::endl;
+         cpu_times boost_time = insert_time< BoostClass >();
+
+         std::cout << "Insert benchmark:" << StdContName << std::endl;
+         cpu_times std_time = insert_time< StdClass >();
+
+         std::cout << "Total time (" << BoostContName << "/" << StdContName << "):\n";
+         compare_times(boost_time, std_time);
+      }
+      {
+         std::cout << "Search benchmark:" << BoostContName << std::endl;
+         cpu_times boost_time = search_time< BoostClass >();
+
+         std::cout << "Search benchmark:" << StdContName << std::endl;
+         cpu_times std_time = search_time< StdClass >();
+
+         std::cout << "Total time (" << BoostContName << "/" << StdContName << "):\n";
+         compare_times(boost_time, std_time);
+      }
+      {
+         std::cout << "Scan benchmark:" << BoostContName << std::endl;
+         cpu_times boost_time = scan_time< BoostClass >();
+
+         std::cout << "Scan benchmark:" << StdContName << std::endl;
+         cpu_times std_time = scan_time< StdClass >();
+
+         std::cout << "Total time (" << BoostContName << "/" << StdContName << "):\n";
+         compare_times(boost_time, std_time);
+      }
+   }catch(std::exception &e){
+      std::cout << e.what();
+   }
+}
+
+template<class BoostClass>
+void launch_search_scan_tests(const char *BoostContName, const char *FlatContName)
+{
+   try {
+      fill_ranges();
+      {
+         std::cout << "Search benchmark:" << BoostContName << std::endl;
+         cpu_times boost_time = search_time< BoostClass >();
+
+         std::cout << "Search benchmark:" << FlatContName << std::endl;
+         cpu_times flat_time = search_time< boost::container::flat_map<int, int> >();
+
+         std::cout << "Total time (" << BoostContName << "/" << FlatContName << "):\n";
+         compare_times(boost_time, flat_time);
+      }
+      {
+         std::cout << "Scan benchmark:" << BoostContName << std::endl;
+         cpu_times boost_time = scan_time< BoostClass >();
+
+         std::cout << "Scan benchmark:" << FlatContName << std::endl;
+         cpu_times flat_time = scan_time< boost::container::flat_map<int, int> >();
+
+         std::cout << "Total time (" << BoostContName << "/" << FlatContName << "):\n";
+         compare_times(boost_time, flat_time);
+      }
+   }catch(std::exception &e){
+      std::cout << e.what();
+   }
+}
+
+int main()
+{
+   //btree_map vs std::map
+   launch_tests< boost::container::btree_map<int, int> , std::map<int, int> >
+      ("boost::container::btree_map<int, int>", "std::map<int, int>");
+   //btree_map vs map
+   launch_tests< boost::container::btree_map<int, int> , boost::container::map<int, int> >
+      ("boost::container::btree_map<int, int>", "boost::container::map<int, int>");
+   //btree_map vs flat_map (flat_map random insertion is quadratic, so only lookups and scans)
+   launch_search_scan_tests< boost::container::btree_map<int, int> >
+      ("boost::container::btree_map<int, int>", "boost::container::flat_map<int, int>");
+   return 0;
+}
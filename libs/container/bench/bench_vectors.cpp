@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//  Compares vector, small_vector, devector and deque when pushing elements
+//  at both ends and when creating many short sequences.
+
+#include "boost/container/vector.hpp"
+#include "boost/container/small_vector.hpp"
+#include "boost/container/devector.hpp"
+#include "boost/container/deque.hpp"
+#include <iostream>
+#include <boost/timer/timer.hpp>
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t NElements  = 1000000;
+static const std::size_t NSequences = 1000000;
+#else
+static const std::size_t NElements  = 10000;
+static const std::size_t NSequences = 10000;
+#endif
+
+//Number of elements of each short sequence
+static const std::size_t ShortLength = 8;
+
+template<class Container>
+void push_back_test(const char *name)
+{
+   cpu_timer timer;
+   {
+      Container c;
+      for(std::size_t i = 0; i != NElements; ++i){
+         c.push_back(int(i));
+      }
+      if(c.size() != NElements)
+         std::cout << "error" << std::endl;
+   }
+   timer.stop();
+   std::cout << "  " << name << " push_back: " << boost::timer::format(timer.elapsed(), 6);
+}
+
+template<class Container>
+void push_front_test(const char *name)
+{
+   cpu_timer timer;
+   {
+      Container c;
+      for(std::size_t i = 0; i != NElements; ++i){
+         c.push_front(int(i));
+      }
+      if(c.size() != NElements)
+         std::cout << "error" << std::endl;
+   }
+   timer.stop();
+   std::cout << "  " << name << " push_front: " << boost::timer::format(timer.elapsed(), 6);
+}
+
+template<class Container>
+void fifo_test(const char *name)
+{
+   cpu_timer timer;
+   {
+      Container c;
+      for(std::size_t i = 0; i != NElements; ++i){
+         c.push_back(int(i));
+         if(i % 2){
+            c.pop_front();
+         }
+      }
+      if(c.size() != NElements/2)
+         std::cout << "error" << std::endl;
+   }
+   timer.stop();
+   std::cout << "  " << name << " fifo: " << boost::timer::format(timer.elapsed(), 6);
+}
+
+template<class Container>
+void short_sequences_test(const char *name)
+{
+   cpu_timer timer;
+   std::size_t total = 0;
+   for(std::size_t i = 0; i != NSequences; ++i){
+      Container c;
+      for(std::size_t j = 0; j != ShortLength; ++j){
+         c.push_back(int(j));
+      }
+      total += c.size();
+   }
+   timer.stop();
+   if(total != NSequences*ShortLength)
+      std::cout << "error" << std::endl;
+   std::cout << "  " << name << " short sequences: " << boost::timer::format(timer.elapsed(), 6);
+}
+
+int main()
+{
+   using namespace boost::container;
+
+   std::cout << "Elements = " << NElements << ", sequences = " << NSequences << "\n\n";
+
+   push_back_test< vector<int> >("vector");
+   push_back_test< small_vector<int, ShortLength> >("small_vector");
+   push_back_test< devector<int> >("devector");
+   push_back_test< deque<int> >("deque");
+   std::cout << std::endl;
+
+   push_front_test< devector<int> >("devector");
+   push_front_test< deque<int> >("deque");
+   std::cout << std::endl;
+
+   fifo_test< devector<int> >("devector");
+   fifo_test< deque<int> >("deque");
+   std::cout << std::endl;
+
+   short_sequences_test< vector<int> >("vector");
+   short_sequences_test< small_vector<int, ShortLength> >("small_vector");
+   short_sequences_test< devector<int> >("devector");
+   short_sequences_test< deque<int> >("deque");
+
+   return 0;
+}
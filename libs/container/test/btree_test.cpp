@@ -0,0 +1,637 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/detail/config_begin.hpp>
+#include <set>
+#include <map>
+#include <vector>
+#include <cstdlib>
+#include <boost/container/btree_set.hpp>
+#include <boost/container/btree_map.hpp>
+#include "print_container.hpp"
+#include "dummy_test_allocator.hpp"
+#include "movable_int.hpp"
+#include "set_test.hpp"
+#include "map_test.hpp"
+#include "propagate_allocator_test.hpp"
+#include "emplace_test.hpp"
+#include <boost/container/detail/btree.hpp>
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+
+//btree_map
+template class btree_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class btree_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+//btree_multimap
+template class btree_multimap
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class btree_multimap
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+//btree_set
+template class btree_set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   >;
+
+template class btree_set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   >;
+
+//btree_multiset
+template class btree_multiset
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   >;
+
+template class btree_multiset
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   >;
+
+namespace container_detail {
+
+template class btree_iterator
+   < btree_node<void*, test::movable_and_copyable_int, 256u>*
+   , test::movable_and_copyable_int
+   , false>;
+
+template class btree_iterator
+   < btree_node<void*, test::movable_and_copyable_int, 256u>*
+   , test::movable_and_copyable_int
+   , true>;
+
+}  //namespace container_detail {
+
+}} //boost::container
+
+
+//Alias allocator type
+typedef std::allocator<int> allocator_t;
+typedef std::allocator<test::movable_int>
+   movable_allocator_t;
+typedef std::allocator<std::pair<int, int> >
+   pair_allocator_t;
+typedef std::allocator<std::pair<test::movable_int, test::movable_int> >
+   movable_pair_allocator_t;
+typedef std::allocator<test::movable_and_copyable_int >
+   move_copy_allocator_t;
+typedef std::allocator<std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   move_copy_pair_allocator_t;
+typedef std::allocator<test::copyable_int >
+   copy_allocator_t;
+typedef std::allocator<std::pair<test::copyable_int, test::copyable_int> >
+   copy_pair_allocator_t;
+
+//Nodes of this size store the minimum number of elements (three), so that
+//the tests build trees with many levels and exercise splits and merges.
+static const std::size_t SmallNode = 1u;
+
+//Alias set types
+typedef std::set<int>                                                   MyStdSet;
+typedef std::multiset<int>                                              MyStdMultiSet;
+typedef std::map<int, int>                                              MyStdMap;
+typedef std::multimap<int, int>                                         MyStdMultiMap;
+
+typedef btree_set<int, std::less<int>, allocator_t>                MyBoostSet;
+typedef btree_multiset<int, std::less<int>, allocator_t>           MyBoostMultiSet;
+typedef btree_map<int, int, std::less<int>, pair_allocator_t>      MyBoostMap;
+typedef btree_multimap<int, int, std::less<int>, pair_allocator_t> MyBoostMultiMap;
+
+typedef btree_set<int, std::less<int>, allocator_t, SmallNode>                MySmallBoostSet;
+typedef btree_multiset<int, std::less<int>, allocator_t, SmallNode>           MySmallBoostMultiSet;
+typedef btree_map<int, int, std::less<int>, pair_allocator_t, SmallNode>      MySmallBoostMap;
+typedef btree_multimap<int, int, std::less<int>, pair_allocator_t, SmallNode> MySmallBoostMultiMap;
+
+typedef btree_set<test::movable_int, std::less<test::movable_int>
+                 ,movable_allocator_t>                            MyMovableBoostSet;
+typedef btree_multiset<test::movable_int,std::less<test::movable_int>
+                      ,movable_allocator_t>                       MyMovableBoostMultiSet;
+typedef btree_map<test::movable_int, test::movable_int
+                 ,std::less<test::movable_int>
+                 ,movable_pair_allocator_t>                       MyMovableBoostMap;
+typedef btree_multimap<test::movable_int, test::movable_int
+                 ,std::less<test::movable_int>
+                 ,movable_pair_allocator_t>                       MyMovableBoostMultiMap;
+
+typedef btree_set<test::movable_and_copyable_int, std::less<test::movable_and_copyable_int>
+                 ,move_copy_allocator_t, SmallNode>                 MyMoveCopyBoostSet;
+typedef btree_multiset<test::movable_and_copyable_int,std::less<test::movable_and_copyable_int>
+                      ,move_copy_allocator_t, SmallNode>            MyMoveCopyBoostMultiSet;
+typedef btree_map<test::movable_and_copyable_int, test::movable_and_copyable_int
+                 ,std::less<test::movable_and_copyable_int>
+                 ,move_copy_pair_allocator_t, SmallNode>            MyMoveCopyBoostMap;
+typedef btree_multimap<test::movable_and_copyable_int, test::movable_and_copyable_int
+                 ,std::less<test::movable_and_copyable_int>
+                 ,move_copy_pair_allocator_t, SmallNode>            MyMoveCopyBoostMultiMap;
+
+typedef btree_set<test::copyable_int, std::less<test::copyable_int>
+                 ,copy_allocator_t>                             MyCopyBoostSet;
+typedef btree_multiset<test::copyable_int,std::less<test::copyable_int>
+                      ,copy_allocator_t>                        MyCopyBoostMultiSet;
+typedef btree_map<test::copyable_int, test::copyable_int
+                 ,std::less<test::copyable_int>
+                 ,copy_pair_allocator_t>                        MyCopyBoostMap;
+typedef btree_multimap<test::copyable_int, test::copyable_int
+                 ,std::less<test::copyable_int>
+                 ,copy_pair_allocator_t>                        MyCopyBoostMultiMap;
+
+
+//Test recursive structures
+class recursive_btree_set
+{
+   public:
+   recursive_btree_set(const recursive_btree_set &c)
+      : id_(c.id_), btree_set_(c.btree_set_)
+   {}
+
+   recursive_btree_set & operator =(const recursive_btree_set &c)
+   {
+      id_ = c.id_;
+      btree_set_= c.btree_set_;
+      return *this;
+   }
+   int id_;
+   btree_set<recursive_btree_set> btree_set_;
+   friend bool operator< (const recursive_btree_set &a, const recursive_btree_set &b)
+   {  return a.id_ < b.id_;   }
+};
+
+class recursive_btree_map
+{
+   public:
+   recursive_btree_map(const recursive_btree_map &c)
+      : id_(c.id_), map_(c.map_)
+   {}
+
+   recursive_btree_map & operator =(const recursive_btree_map &c)
+   {
+      id_ = c.id_;
+      map_= c.map_;
+      return *this;
+   }
+
+   int id_;
+   btree_map<recursive_btree_map, recursive_btree_map> map_;
+
+   friend bool operator< (const recursive_btree_map &a, const recursive_btree_map &b)
+   {  return a.id_ < b.id_;   }
+};
+
+template<class C>
+void test_move()
+{
+   //Now test move semantics
+   C original;
+   C move_ctor(boost::move(original));
+   C move_assign;
+   move_assign = boost::move(move_ctor);
+   move_assign.swap(original);
+}
+
+template<class T, class A>
+class btree_propagate_test_wrapper
+   : public container_detail::btree<T, T, container_detail::identity<T>, std::less<T>, A, 256u>
+{
+   BOOST_COPYABLE_AND_MOVABLE(btree_propagate_test_wrapper)
+   typedef container_detail::btree<T, T, container_detail::identity<T>, std::less<T>, A, 256u> Base;
+   public:
+   btree_propagate_test_wrapper()
+      : Base()
+   {}
+
+   btree_propagate_test_wrapper(const btree_propagate_test_wrapper &x)
+      : Base(x)
+   {}
+
+   btree_propagate_test_wrapper(BOOST_RV_REF(btree_propagate_test_wrapper) x)
+      : Base(boost::move(static_cast<Base&>(x)))
+   {}
+
+   btree_propagate_test_wrapper &operator=(BOOST_COPY_ASSIGN_REF(btree_propagate_test_wrapper) x)
+   {  this->Base::operator=(x);  return *this; }
+
+   btree_propagate_test_wrapper &operator=(BOOST_RV_REF(btree_propagate_test_wrapper) x)
+   {  this->Base::operator=(boost::move(static_cast<Base&>(x)));  return *this; }
+
+   void swap(btree_propagate_test_wrapper &x)
+   {  this->Base::swap(x);  }
+};
+
+namespace boost{
+namespace container {
+namespace test{
+
+template<class T>
+bool btree_equal_value(const T &a, const T &b)
+{  return a == b;  }
+
+template<class K, class T>
+bool btree_equal_value(const std::pair<K, T> &a, const std::pair<const K, T> &b)
+{  return a.first == b.first && a.second == b.second;  }
+
+template<class BoostContainer, class StdContainer>
+bool check_btree_traversal(const BoostContainer &b, const StdContainer &s)
+{
+   if(!CheckEqualContainers(&s, &b))
+      return false;
+   //Backwards traversal
+   typename BoostContainer::const_reverse_iterator rit = b.rbegin();
+   for(typename StdContainer::const_reverse_iterator sit = s.rbegin(); sit != s.rend(); ++sit, ++rit){
+      if(rit == b.rend() || !btree_equal_value(*rit, *sit))
+         return false;
+   }
+   return rit == b.rend();
+}
+
+bool btree_ordered_insertion_test()
+{
+   using namespace boost::container;
+   const std::size_t NumElements = 1000;
+
+   //Ordered insertion multiset
+   {
+      std::multiset<int> int_mset;
+      for(std::size_t i = 0; i != NumElements; ++i){
+         int_mset.insert(static_cast<int>(i/2));
+      }
+      //Construction insertion
+      btree_multiset<int> bmset(ordered_range, int_mset.begin(), int_mset.end());
+      if(!check_btree_traversal(bmset, int_mset))
+         return false;
+      //Appended elements fill the nodes
+      if(bmset.size()/bmset.node_capacity() > 2u*NumElements/bmset.node_capacity())
+         return false;
+      //Insertion when empty
+      bmset.clear();
+      bmset.insert(ordered_range, int_mset.begin(), int_mset.end());
+      if(!check_btree_traversal(bmset, int_mset))
+         return false;
+      //Re-insertion
+      bmset.insert(ordered_range, int_mset.begin(), int_mset.end());
+      std::multiset<int> int_mset2(int_mset);
+      int_mset2.insert(int_mset.begin(), int_mset.end());
+      if(!check_btree_traversal(bmset, int_mset2))
+         return false;
+   }
+   //Ordered insertion map
+   {
+      std::map<int, int> int_map;
+      for(std::size_t i = 0; i != NumElements; ++i){
+         int_map.insert(std::map<int, int>::value_type(static_cast<int>(i), static_cast<int>(i)));
+      }
+      //Construction insertion
+      btree_map<int, int, std::less<int>, pair_allocator_t, SmallNode> bmap(ordered_unique_range, int_map.begin(), int_map.end());
+      if(!check_btree_traversal(bmap, int_map))
+         return false;
+      //Insertion when empty
+      bmap.clear();
+      bmap.insert(ordered_unique_range, int_map.begin(), int_map.end());
+      if(!check_btree_traversal(bmap, int_map))
+         return false;
+      //Re-insertion
+      bmap.insert(ordered_unique_range, int_map.begin(), int_map.end());
+      if(!check_btree_traversal(bmap, int_map))
+         return false;
+      //Reverse insertion
+      bmap.clear();
+      for(std::map<int, int>::reverse_iterator it = int_map.rbegin(); it != int_map.rend(); ++it){
+         bmap.insert(bmap.begin(), std::pair<int, int>(it->first, it->second));
+      }
+      if(!check_btree_traversal(bmap, int_map))
+         return false;
+   }
+   return true;
+}
+
+//Random insertions and erasures compared against the standard containers
+template<class BoostSet, class BoostMultiSet, class BoostMap, class BoostMultiMap>
+bool btree_random_test()
+{
+   const int NumOperations = 20000;
+   const int MaxKey = 2000;
+   std::srand(0);
+
+   std::set<int> sset;
+   std::multiset<int> smset;
+   std::map<int, int> smap;
+   std::multimap<int, int> smmap;
+   BoostSet bset;
+   BoostMultiSet bmset;
+   BoostMap bmap;
+   BoostMultiMap bmmap;
+
+   for(int i = 0; i != NumOperations; ++i){
+      const int k = std::rand() % MaxKey;
+      switch(std::rand() % 6){
+         case 0:
+         case 1:
+         case 2:
+            if(sset.insert(k).second != bset.insert(k).second)
+               return false;
+            smset.insert(k);
+            bmset.insert(bmset.upper_bound(k), k);
+            smap.insert(std::pair<int, int>(k, i));
+            bmap[k] = smap[k];
+            smmap.insert(std::pair<int, int>(k, i));
+            bmmap.insert(std::pair<int, int>(k, i));
+         break;
+         case 3:
+            if(sset.erase(k) != bset.erase(k))
+               return false;
+            if(smset.erase(k) != bmset.erase(k))
+               return false;
+            smap.erase(k);
+            bmap.erase(k);
+         break;
+         case 4:
+         {
+            //Erasure returns the next element
+            typename BoostMultiSet::iterator it = bmset.lower_bound(k);
+            std::multiset<int>::iterator sit = smset.lower_bound(k);
+            if(sit != smset.end()){
+               std::multiset<int>::iterator snext = sit;
+               ++snext;
+               sit = snext;
+               smset.erase(smset.lower_bound(k));
+               it = bmset.erase(it);
+               if((sit == smset.end()) != (it == bmset.end()))
+                  return false;
+               if(sit != smset.end() && *it != *sit)
+                  return false;
+            }
+            std::multimap<int, int>::iterator mit = smmap.find(k);
+            if(mit != smmap.end()){
+               smmap.erase(mit);
+               bmmap.erase(bmmap.find(k));
+            }
+         }
+         break;
+         default:
+         {
+            //Range erasure
+            std::set<int>::iterator first = sset.lower_bound(k), last = sset.upper_bound(k + 20);
+            typename BoostSet::iterator bfirst = bset.lower_bound(k), blast = bset.upper_bound(k + 20);
+            sset.erase(first, last);
+            typename BoostSet::iterator bnext = bset.erase(bfirst, blast);
+            if(bnext != bset.upper_bound(k + 20))
+               return false;
+         }
+         break;
+      }
+      if(bset.size() != sset.size() || bmset.size() != smset.size() ||
+         bmap.size() != smap.size() || bmmap.size() != smmap.size())
+         return false;
+   }
+   if(!check_btree_traversal(bset, sset) || !check_btree_traversal(bmset, smset) ||
+      !check_btree_traversal(bmap, smap) || !CheckEqualContainers(&smmap, &bmmap))
+      return false;
+   //Keys are looked up in all levels
+   for(int k = -1; k <= MaxKey; ++k){
+      if(bset.count(k) != sset.count(k) || bmset.count(k) != smset.count(k))
+         return false;
+      if(std::distance(bmset.lower_bound(k), bmset.upper_bound(k)) !=
+         std::distance(smset.lower_bound(k), smset.upper_bound(k)))
+         return false;
+      if((bmap.find(k) == bmap.end()) != (smap.find(k) == smap.end()))
+         return false;
+   }
+   //Copies have the same shape
+   BoostMultiSet bmset_copy(bmset);
+   if(bmset_copy != bmset || bmset_copy.height() != bmset.height())
+      return false;
+   //Empty all the containers erasing one by one
+   const std::size_t multiset_size = smset.size();
+   while(!bmset.empty()){
+      bmset.erase(bmset.begin());
+      smset.erase(smset.begin());
+      if(!smset.empty() && *bmset.begin() != *smset.begin())
+         return false;
+   }
+   while(!bmap.empty()){
+      typename BoostMap::iterator last = bmap.end();
+      --last;
+      bmap.erase(last);
+   }
+   return bmset.begin() == bmset.end() && bmap.height() == 0u && bmset_copy.size() == multiset_size;
+}
+
+}}}
+
+int main()
+{
+   using namespace boost::container::test;
+
+   //Allocator argument container
+   {
+      btree_set<int> set_((std::allocator<int>()));
+      btree_multiset<int> multiset_((std::allocator<int>()));
+      btree_map<int, int> map_((std::allocator<std::pair<int, int> >()));
+      btree_multimap<int, int> multimap_((std::allocator<std::pair<int, int> >()));
+   }
+   //Now test move semantics
+   {
+      test_move<btree_set<recursive_btree_set> >();
+      test_move<btree_map<recursive_btree_map, recursive_btree_map> >();
+   }
+
+   if(!btree_ordered_insertion_test()){
+      return 1;
+   }
+
+   if(!btree_random_test<MyBoostSet, MyBoostMultiSet, MyBoostMap, MyBoostMultiMap>()){
+      std::cout << "Error in btree_random_test<MyBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if(!btree_random_test<MySmallBoostSet, MySmallBoostMultiSet, MySmallBoostMap, MySmallBoostMultiMap>()){
+      std::cout << "Error in btree_random_test<MySmallBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != set_test<
+                  MyBoostSet
+                  ,MyStdSet
+                  ,MyBoostMultiSet
+                  ,MyStdMultiSet>()){
+      std::cout << "Error in set_test<MyBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != set_test_copyable<
+                  MySmallBoostSet
+                  ,MyStdSet
+                  ,MySmallBoostMultiSet
+                  ,MyStdMultiSet>()){
+      std::cout << "Error in set_test<MySmallBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != set_test<
+                  MyMovableBoostSet
+                  ,MyStdSet
+                  ,MyMovableBoostMultiSet
+                  ,MyStdMultiSet>()){
+      std::cout << "Error in set_test<MyMovableBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != set_test<
+                  MyMoveCopyBoostSet
+                  ,MyStdSet
+                  ,MyMoveCopyBoostMultiSet
+                  ,MyStdMultiSet>()){
+      std::cout << "Error in set_test<MyMoveCopyBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != set_test_copyable<
+                  MyMoveCopyBoostSet
+                  ,MyStdSet
+                  ,MyMoveCopyBoostMultiSet
+                  ,MyStdMultiSet>()){
+      std::cout << "Error in set_test<MyMoveCopyBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != set_test<
+                  MyCopyBoostSet
+                  ,MyStdSet
+                  ,MyCopyBoostMultiSet
+                  ,MyStdMultiSet>()){
+      std::cout << "Error in set_test<MyCopyBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != set_test_copyable<
+                  MyCopyBoostSet
+                  ,MyStdSet
+                  ,MyCopyBoostMultiSet
+                  ,MyStdMultiSet>()){
+      std::cout << "Error in set_test<MyCopyBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != map_test<
+                  MyBoostMap
+                  ,MyStdMap
+                  ,MyBoostMultiMap
+                  ,MyStdMultiMap>()){
+      std::cout << "Error in map_test<MyBoostMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != map_test_copyable<
+                  MySmallBoostMap
+                  ,MyStdMap
+                  ,MySmallBoostMultiMap
+                  ,MyStdMultiMap>()){
+      std::cout << "Error in map_test<MySmallBoostMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != map_test<
+                  MyMovableBoostMap
+                  ,MyStdMap
+                  ,MyMovableBoostMultiMap
+                  ,MyStdMultiMap>()){
+      std::cout << "Error in map_test<MyMovableBoostMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != map_test<
+                  MyMoveCopyBoostMap
+                  ,MyStdMap
+                  ,MyMoveCopyBoostMultiMap
+                  ,MyStdMultiMap>()){
+      std::cout << "Error in map_test<MyMoveCopyBoostMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != map_test_copyable<
+                  MyMoveCopyBoostMap
+                  ,MyStdMap
+                  ,MyMoveCopyBoostMultiMap
+                  ,MyStdMultiMap>()){
+      std::cout << "Error in map_test<MyMoveCopyBoostMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != map_test<
+                  MyCopyBoostMap
+                  ,MyStdMap
+                  ,MyCopyBoostMultiMap
+                  ,MyStdMultiMap>()){
+      std::cout << "Error in map_test<MyCopyBoostMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != map_test_copyable<
+                  MyCopyBoostMap
+                  ,MyStdMap
+                  ,MyCopyBoostMultiMap
+                  ,MyStdMultiMap>()){
+      std::cout << "Error in map_test<MyCopyBoostMap>" << std::endl;
+      return 1;
+   }
+
+   const test::EmplaceOptions SetOptions = (test::EmplaceOptions)(test::EMPLACE_HINT | test::EMPLACE_ASSOC);
+   const test::EmplaceOptions MapOptions = (test::EmplaceOptions)(test::EMPLACE_HINT_PAIR | test::EMPLACE_ASSOC_PAIR);
+
+   if(!boost::container::test::test_emplace<btree_map<test::EmplaceInt, test::EmplaceInt>, MapOptions>())
+      return 1;
+   if(!boost::container::test::test_emplace<btree_multimap<test::EmplaceInt, test::EmplaceInt>, MapOptions>())
+      return 1;
+   if(!boost::container::test::test_emplace<btree_set<test::EmplaceInt>, SetOptions>())
+      return 1;
+   if(!boost::container::test::test_emplace<btree_multiset<test::EmplaceInt>, SetOptions>())
+      return 1;
+   if(!boost::container::test::test_propagate_allocator<btree_propagate_test_wrapper>())
+      return 1;
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
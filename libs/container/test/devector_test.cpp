@@ -0,0 +1,155 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <iostream>
+#include <functional>
+
+#include <boost/container/devector.hpp>
+#include <boost/move/utility.hpp>
+#include "check_equal_containers.hpp"
+#include "movable_int.hpp"
+#include "dummy_test_allocator.hpp"
+#include "propagate_allocator_test.hpp"
+#include "vector_test.hpp"
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class boost::container::devector<test::movable_and_copyable_int,
+   test::simple_allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::devector<test::movable_and_copyable_int,
+   test::dummy_test_allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::devector<test::movable_and_copyable_int,
+   std::allocator<test::movable_and_copyable_int> >;
+
+}}
+
+template<class IntType>
+bool devector_front_test()
+{
+   typedef devector<IntType> MyBoostDevector;
+   typedef std::deque<int>   MyStdDeque;
+   MyBoostDevector boostdevector;
+   MyStdDeque stddeque;
+
+   //Insertions at the front
+   for(int i = 0; i != 100; ++i){
+      IntType move_me(i);
+      boostdevector.push_front(boost::move(move_me));
+      stddeque.push_front(i);
+   }
+   if(!test::CheckEqualContainers(&boostdevector, &stddeque))
+      return false;
+
+   for(int i = 0; i != 10; ++i){
+      boostdevector.emplace_front(-i);
+      stddeque.push_front(-i);
+      boostdevector.emplace(boostdevector.begin() + 3, i);
+      stddeque.insert(stddeque.begin() + 3, i);
+   }
+   if(!test::CheckEqualContainers(&boostdevector, &stddeque))
+      return false;
+
+   //Erasures near the front move the preceding elements
+   boostdevector.erase(boostdevector.begin() + 2, boostdevector.begin() + 7);
+   stddeque.erase(stddeque.begin() + 2, stddeque.begin() + 7);
+   for(int i = 0; i != 10; ++i){
+      boostdevector.pop_front();
+      stddeque.pop_front();
+   }
+   if(!test::CheckEqualContainers(&boostdevector, &stddeque))
+      return false;
+
+   //Used as a FIFO queue the capacity must not grow without bound
+   boostdevector.clear();
+   stddeque.clear();
+   for(int i = 0; i != 10000; ++i){
+      IntType move_me(i);
+      boostdevector.push_back(boost::move(move_me));
+      stddeque.push_back(i);
+      if(i % 3){
+         boostdevector.pop_front();
+         stddeque.pop_front();
+      }
+   }
+   if(!test::CheckEqualContainers(&boostdevector, &stddeque))
+      return false;
+   const std::size_t cap = boostdevector.capacity();
+   for(int i = 0; i != 100000; ++i){
+      IntType move_me(i);
+      boostdevector.push_back(boost::move(move_me));
+      boostdevector.pop_front();
+   }
+   if(boostdevector.capacity() != cap || boostdevector.size() != stddeque.size())
+      return false;
+
+   //Reserve free capacity at the front
+   boostdevector.reserve_front(boostdevector.size() + 100);
+   if(boostdevector.front_free_capacity() < 100)
+      return false;
+   const typename MyBoostDevector::size_type old_cap = boostdevector.capacity();
+   for(int i = 0; i != 100; ++i){
+      IntType move_me(i);
+      boostdevector.push_front(boost::move(move_me));
+   }
+   if(boostdevector.capacity() != old_cap)
+      return false;
+   boostdevector.shrink_to_fit();
+   if(boostdevector.capacity() != boostdevector.size())
+      return false;
+   return true;
+}
+
+int main()
+{
+   typedef devector<int> MyVector;
+   typedef devector<test::movable_int> MyMoveVector;
+   typedef devector<test::movable_and_copyable_int> MyCopyMoveVector;
+   typedef devector<test::copyable_int> MyCopyVector;
+
+   if(test::vector_test<MyVector>())
+      return 1;
+   if(test::vector_test<MyMoveVector>())
+      return 1;
+   if(test::vector_test<MyCopyMoveVector>())
+      return 1;
+   if(test::vector_test<MyCopyVector>())
+      return 1;
+   if(!devector_front_test<int>())
+      return 1;
+   if(!devector_front_test<test::movable_int>())
+      return 1;
+   if(!test::default_init_test< devector<int, test::default_init_allocator<int> > >()){
+      std::cerr << "Default init test failed" << std::endl;
+      return 1;
+   }
+
+   const test::EmplaceOptions Options = (test::EmplaceOptions)
+      (test::EMPLACE_BACK | test::EMPLACE_FRONT | test::EMPLACE_BEFORE);
+   if(!boost::container::test::test_emplace< devector<test::EmplaceInt>, Options>()){
+      return 1;
+   }
+
+   if(!boost::container::test::test_propagate_allocator<devector>()){
+      return 1;
+   }
+
+   return 0;
+}
+#include <boost/container/detail/config_end.hpp>
@@ -10,6 +10,7 @@
 
 #include <boost/container/detail/config_begin.hpp>
 #include <set>
+#include <map>
 #include <boost/container/flat_set.hpp>
 #include <boost/container/flat_map.hpp>
 #include "print_container.hpp"
@@ -469,6 +470,126 @@ bool flat_tree_ordered_insertion_test()
    return true;
 }
 
+bool flat_tree_bulk_insertion_test()
+{
+   using namespace boost::container;
+   const int NumElements = 1000;
+
+   //Unordered range insertion merges with the existing elements
+   {
+      std::set<int> int_set;
+      std::multiset<int> int_mset;
+      std::map<int, int> int_map;
+      std::multimap<int, int> int_mmap;
+      flat_set<int> fset;
+      flat_multiset<int> fmset;
+      flat_map<int, int> fmap;
+      flat_multimap<int, int> fmmap;
+
+      for(int round = 0; round != 5; ++round){
+         std::vector<int> values;
+         std::vector<std::pair<int, int> > pairs;
+         for(int i = 0; i != NumElements; ++i){
+            values.push_back((i * 7919 + round * 31) % (NumElements * 2));
+            pairs.push_back(std::pair<int, int>(values.back(), i + round * NumElements));
+         }
+         int_set.insert(values.begin(), values.end());
+         fset.insert(values.begin(), values.end());
+         int_mset.insert(values.begin(), values.end());
+         fmset.insert(values.begin(), values.end());
+         int_map.insert(pairs.begin(), pairs.end());
+         fmap.insert(pairs.begin(), pairs.end());
+         int_mmap.insert(pairs.begin(), pairs.end());
+         fmmap.insert(pairs.begin(), pairs.end());
+
+         if(!CheckEqualContainers(&int_set, &fset))
+            return false;
+         if(!CheckEqualContainers(&int_mset, &fmset))
+            return false;
+         if(!CheckEqualContainers(&int_map, &fmap))
+            return false;
+         if(!CheckEqualContainers(&int_mmap, &fmmap))
+            return false;
+      }
+
+      //Equivalent elements keep their insertion order
+      std::multimap<int, int>::const_iterator it = int_mmap.begin();
+      for(flat_multimap<int, int>::const_iterator fit = fmmap.begin(); fit != fmmap.end(); ++fit, ++it){
+         if(fit->second != it->second)
+            return false;
+      }
+   }
+
+   //Movable but not copyable elements
+   {
+      std::set<int> int_set;
+      flat_set<test::movable_int> fset;
+      for(int round = 0; round != 3; ++round){
+         test::movable_int values[NumElements/10];
+         for(int i = 0; i != NumElements/10; ++i){
+            const int v = (i * 37 + round * 11) % (NumElements/4);
+            values[i] = test::movable_int(v);
+            int_set.insert(v);
+         }
+         fset.insert(boost::make_move_iterator(&values[0]), boost::make_move_iterator(values + NumElements/10));
+         if(!CheckEqualContainers(&int_set, &fset))
+            return false;
+      }
+   }
+
+   //Adopting and extracting sequences
+   {
+      std::set<int> int_set;
+      flat_set<int>::sequence_type seq;
+      for(int i = 0; i != NumElements; ++i){
+         const int v = (i * 7919) % (NumElements / 2);
+         seq.push_back(v);
+         int_set.insert(v);
+      }
+      flat_set<int> fset;
+      fset.insert(-1);
+      fset.adopt_sequence(boost::move(seq));
+      if(!CheckEqualContainers(&int_set, &fset))
+         return false;
+
+      flat_set<int>::sequence_type extracted(fset.extract_sequence());
+      if(!fset.empty() || extracted.size() != int_set.size())
+         return false;
+      fset.adopt_sequence(ordered_unique_range, boost::move(extracted));
+      if(!CheckEqualContainers(&int_set, &fset))
+         return false;
+
+      std::multimap<int, int> int_mmap;
+      flat_multimap<int, int>::sequence_type mseq;
+      for(int i = 0; i != NumElements; ++i){
+         const int v = (i * 7919) % (NumElements / 2);
+         mseq.push_back(std::pair<int, int>(v, i));
+         int_mmap.insert(std::pair<int, int>(v, i));
+      }
+      flat_multimap<int, int> fmmap;
+      fmmap.adopt_sequence(boost::move(mseq));
+      if(!CheckEqualContainers(&int_mmap, &fmmap))
+         return false;
+      std::multimap<int, int>::const_iterator it = int_mmap.begin();
+      for(flat_multimap<int, int>::const_iterator fit = fmmap.begin(); fit != fmmap.end(); ++fit, ++it){
+         if(fit->second != it->second)
+            return false;
+      }
+
+      flat_multimap<int, int>::sequence_type mextracted(fmmap.extract_sequence());
+      flat_map<int, int> fmap;
+      fmap.adopt_sequence(boost::move(mextracted));
+      if(fmap.size() != int_set.size())
+         return false;
+      for(flat_map<int, int>::const_iterator fit = fmap.begin(); fit != fmap.end(); ++fit){
+         if(fit->second != int_mmap.find(fit->first)->second)
+            return false;
+      }
+   }
+
+   return true;
+}
+
 }}}
 
 int main()
@@ -494,6 +615,10 @@ int main()
       return 1;
    }
 
+   if(!flat_tree_bulk_insertion_test()){
+      return 1;
+   }
+
    if (0 != set_test<
                   MyBoostSet
                   ,MyStdSet
@@ -10,6 +10,7 @@
 
 #include <boost/container/detail/config_begin.hpp>
 #include <boost/container/list.hpp>
+#include <boost/container/allocator.hpp>
 #include "dummy_test_allocator.hpp"
 #include <memory>
 #include "movable_int.hpp"
@@ -32,6 +33,9 @@ template class boost::container::list<test::movable_and_copyable_int,
 template class boost::container::list<test::movable_and_copyable_int,
    std::allocator<test::movable_and_copyable_int> >;
 
+template class boost::container::list<test::movable_and_copyable_int,
+   allocator<test::movable_and_copyable_int> >;
+
 namespace container_detail {
 
 template class iterator
@@ -48,6 +52,9 @@ typedef list<int> MyList;
 typedef list<test::movable_int> MyMoveList;
 typedef list<test::movable_and_copyable_int> MyCopyMoveList;
 typedef list<test::copyable_int> MyCopyList;
+typedef list<int, allocator<int> > MyBurstList;
+typedef list<test::movable_and_copyable_int
+            , allocator<test::movable_and_copyable_int> > MyBurstCopyMoveList;
 
 class recursive_list
 {
@@ -90,6 +97,12 @@ int main ()
    if(test::list_test<MyCopyList, true>())
       return 1;
 
+   if(test::list_test<MyBurstList, true>())
+      return 1;
+
+   if(test::list_test<MyBurstCopyMoveList, true>())
+      return 1;
+
    const test::EmplaceOptions Options = (test::EmplaceOptions)(test::EMPLACE_BACK | test::EMPLACE_FRONT | test::EMPLACE_BEFORE);
 
    if(!boost::container::test::test_emplace<list<test::EmplaceInt>, Options>())
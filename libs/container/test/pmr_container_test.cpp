@@ -0,0 +1,194 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/pmr/vector.hpp>
+#include <boost/container/pmr/stable_vector.hpp>
+#include <boost/container/pmr/small_vector.hpp>
+#include <boost/container/pmr/devector.hpp>
+#include <boost/container/pmr/deque.hpp>
+#include <boost/container/pmr/list.hpp>
+#include <boost/container/pmr/slist.hpp>
+#include <boost/container/pmr/set.hpp>
+#include <boost/container/pmr/map.hpp>
+#include <boost/container/pmr/flat_set.hpp>
+#include <boost/container/pmr/flat_map.hpp>
+#include <boost/container/pmr/string.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/pmr/unsynchronized_pool_resource.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/static_assert.hpp>
+#include <cstdio>
+#include <iostream>
+#include "vector_test.hpp"
+
+using namespace boost::container;
+
+//Aliases and metafunctions name the same types
+#if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
+BOOST_STATIC_ASSERT((boost::is_same<pmr::vector<int>, pmr::vector_of<int>::type>::value));
+BOOST_STATIC_ASSERT((boost::is_same<pmr::small_vector<int, 4>, pmr::small_vector_of<int, 4>::type>::value));
+BOOST_STATIC_ASSERT((boost::is_same<pmr::map<int, int>, pmr::map_of<int, int>::type>::value));
+BOOST_STATIC_ASSERT((boost::is_same<pmr::flat_multimap<int, int>, pmr::flat_multimap_of<int, int>::type>::value));
+BOOST_STATIC_ASSERT((boost::is_same<pmr::basic_string<char>, pmr::string>::value));
+#endif
+
+BOOST_STATIC_ASSERT((boost::is_same<pmr::map_of<int, int>::type::allocator_type
+                    , pmr::polymorphic_allocator<std::pair<const int, int> > >::value));
+BOOST_STATIC_ASSERT((boost::is_same<pmr::flat_map_of<int, int>::type::allocator_type
+                    , pmr::polymorphic_allocator<std::pair<int, int> > >::value));
+BOOST_STATIC_ASSERT((boost::is_same<pmr::wstring::allocator_type
+                    , pmr::polymorphic_allocator<wchar_t> >::value));
+
+//A memory resource that counts live allocations
+class counting_resource : public pmr::memory_resource
+{
+   public:
+   counting_resource()
+      : allocations(0)
+   {}
+
+   std::size_t allocations;
+
+   protected:
+   virtual void* do_allocate(std::size_t bytes, std::size_t alignment)
+   {
+      void *p = pmr::new_delete_resource()->allocate(bytes, alignment);
+      ++allocations;
+      return p;
+   }
+
+   virtual void do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+   {
+      --allocations;
+      pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+   }
+
+   virtual bool do_is_equal(const pmr::memory_resource& other) const BOOST_CONTAINER_NOEXCEPT
+   {  return this == &other;  }
+};
+
+bool test_polymorphic_allocator()
+{
+   counting_resource cr;
+   pmr::polymorphic_allocator<int> a(&cr);
+   if(a.resource() != &cr)
+      return false;
+   //Default constructed allocators use the default resource
+   pmr::polymorphic_allocator<int> d;
+   if(d.resource() != pmr::get_default_resource() || a == d)
+      return false;
+   //Rebinding keeps the resource
+   pmr::polymorphic_allocator<double> b(a);
+   if(b.resource() != &cr || !(a == b))
+      return false;
+   //Copy construction of containers does not propagate the resource
+   if(a.select_on_container_copy_construction().resource() != pmr::get_default_resource())
+      return false;
+   int *p = a.allocate(10u);
+   if(cr.allocations != 1u)
+      return false;
+   a.deallocate(p, 10u);
+   return cr.allocations == 0u;
+}
+
+//Checks that the resource is propagated to all nested containers
+bool test_nested_propagation()
+{
+   counting_resource cr;
+   {
+      typedef pmr::vector_of<pmr::string>::type string_vector_t;
+      typedef pmr::map_of<pmr::string, string_vector_t>::type map_t;
+      map_t m(&cr);
+      for(int i = 0; i != 50; ++i){
+         char key[64];
+         std::sprintf(key, "this is a long key that needs dynamic memory %d", i);
+         string_vector_t &v = m[pmr::string(key, &cr)];
+         v.push_back(pmr::string(key, &cr));
+         v.emplace_back(static_cast<const char*>(key));
+      }
+      for(map_t::iterator it = m.begin(); it != m.end(); ++it){
+         if(it->first.get_allocator().resource() != &cr ||
+            it->second.get_allocator().resource() != &cr ||
+            it->second[0].get_allocator().resource() != &cr ||
+            it->second[1].get_allocator().resource() != &cr)
+            return false;
+      }
+
+      pmr::list_of<pmr::deque_of<int>::type>::type l(&cr);
+      l.emplace_back();
+      l.back().push_back(1);
+      if(l.back().get_allocator().resource() != &cr)
+         return false;
+
+      pmr::flat_map_of<int, pmr::string>::type fm(&cr);
+      fm[1] = "a";
+      if(fm[1].get_allocator().resource() != &cr)
+         return false;
+   }
+   return cr.allocations == 0u;
+}
+
+//Request-scoped data is freed in one shot by the resource
+bool test_release_in_one_shot()
+{
+   counting_resource cr;
+   pmr::monotonic_buffer_resource mr(&cr);
+   pmr::unsynchronized_pool_resource pr(&cr);
+   for(int i = 0; i != 2; ++i){
+      pmr::memory_resource &r = i ? static_cast<pmr::memory_resource&>(mr) : pr;
+      pmr::stable_vector_of<int>::type *sv =
+         new pmr::stable_vector_of<int>::type(pmr::polymorphic_allocator<int>(&r));
+      pmr::set_of<int>::type *s = new pmr::set_of<int>::type(pmr::polymorphic_allocator<int>(&r));
+      pmr::slist_of<int>::type *sl = new pmr::slist_of<int>::type(pmr::polymorphic_allocator<int>(&r));
+      pmr::devector_of<int>::type *dv = new pmr::devector_of<int>::type(pmr::polymorphic_allocator<int>(&r));
+      pmr::flat_set_of<int>::type *fs = new pmr::flat_set_of<int>::type(pmr::polymorphic_allocator<int>(&r));
+      for(int j = 0; j != 1000; ++j){
+         sv->push_back(j);
+         s->insert(j);
+         sl->push_front(j);
+         dv->push_front(j);
+         fs->insert(j);
+      }
+      if(!cr.allocations)
+         return false;
+      //Leak containers' memory on purpose, the resource frees it
+      ::operator delete(sv);
+      ::operator delete(s);
+      ::operator delete(sl);
+      ::operator delete(dv);
+      ::operator delete(fs);
+   }
+   mr.release();
+   pr.release();
+   return cr.allocations == 0u;
+}
+
+int main()
+{
+   if(test::vector_test< pmr::vector_of<int>::type >())
+      return 1;
+   if(test::vector_test< pmr::small_vector_of<int, 10>::type >())
+      return 1;
+   if(!test_polymorphic_allocator()){
+      std::cerr << "polymorphic_allocator test failed" << std::endl;
+      return 1;
+   }
+   if(!test_nested_propagation()){
+      std::cerr << "Nested propagation test failed" << std::endl;
+      return 1;
+   }
+   if(!test_release_in_one_shot()){
+      std::cerr << "Release in one shot test failed" << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
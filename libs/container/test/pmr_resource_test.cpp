@@ -0,0 +1,247 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/pmr/unsynchronized_pool_resource.hpp>
+#include <boost/container/pmr/synchronized_pool_resource.hpp>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+using namespace boost::container::pmr;
+
+//A memory resource that counts live allocations and bytes
+class counting_resource : public memory_resource
+{
+   public:
+   counting_resource()
+      : allocations(0), bytes(0)
+   {}
+
+   std::size_t allocations;
+   std::size_t bytes;
+
+   protected:
+   virtual void* do_allocate(std::size_t b, std::size_t alignment)
+   {
+      void *p = new_delete_resource()->allocate(b, alignment);
+      ++allocations;
+      bytes += b;
+      return p;
+   }
+
+   virtual void do_deallocate(void* p, std::size_t b, std::size_t alignment)
+   {
+      --allocations;
+      bytes -= b;
+      new_delete_resource()->deallocate(p, b, alignment);
+   }
+
+   virtual bool do_is_equal(const memory_resource& other) const BOOST_CONTAINER_NOEXCEPT
+   {  return this == &other;  }
+};
+
+bool is_aligned(void *p, std::size_t alignment)
+{  return (reinterpret_cast<std::size_t>(p) & (alignment - 1u)) == 0;  }
+
+bool test_global_resources()
+{
+   memory_resource *nd = new_delete_resource();
+   if(nd != new_delete_resource() || !(*nd == *new_delete_resource()))
+      return false;
+   memory_resource *nl = null_memory_resource();
+   if(*nd == *nl)
+      return false;
+
+   //new_delete_resource must honor extended alignments
+   for(std::size_t a = 1u; a <= 4096u; a *= 2u){
+      void *p = nd->allocate(33u, a);
+      if(!is_aligned(p, a))
+         return false;
+      std::memset(p, 0, 33u);
+      nd->deallocate(p, 33u, a);
+   }
+
+   //null_memory_resource always throws
+   bool thrown = false;
+   try{
+      nl->allocate(1u);
+   }
+   catch(std::bad_alloc&){
+      thrown = true;
+   }
+   if(!thrown)
+      return false;
+
+   //Default resource
+   if(get_default_resource() != nd)
+      return false;
+   if(set_default_resource(nl) != nd || get_default_resource() != nl)
+      return false;
+   //Null resets to new_delete_resource()
+   if(set_default_resource(0) != nl || get_default_resource() != nd)
+      return false;
+   return true;
+}
+
+bool test_monotonic_buffer_resource()
+{
+   counting_resource upstream;
+   {
+      //Initial buffer is used before upstream
+      char buffer[256];
+      monotonic_buffer_resource mr(buffer, sizeof(buffer), &upstream);
+      if(mr.upstream_resource() != &upstream)
+         return false;
+      void *p = mr.allocate(64u, 1u);
+      if(p != static_cast<void*>(buffer) || upstream.allocations != 0)
+         return false;
+      void *q = mr.allocate(16u, 16u);
+      if(!is_aligned(q, 16u) || q < static_cast<void*>(buffer + 64) || upstream.allocations != 0)
+         return false;
+      //deallocate is a no-op
+      mr.deallocate(q, 16u, 16u);
+      if(mr.allocate(1u, 1u) == q)
+         return false;
+      //Exhaust the buffer
+      mr.allocate(256u, 1u);
+      if(upstream.allocations != 1u)
+         return false;
+      //Growth is geometric
+      const std::size_t next = mr.next_buffer_size();
+      for(std::size_t i = 0; i != 100u; ++i){
+         mr.allocate(100u);
+      }
+      if(mr.next_buffer_size() <= next)
+         return false;
+      //Extended alignments
+      if(!is_aligned(mr.allocate(10u, 1024u), 1024u))
+         return false;
+      //release frees everything and reuses the initial buffer
+      mr.release();
+      if(upstream.allocations != 0u || mr.allocate(1u, 1u) != static_cast<void*>(buffer))
+         return false;
+      mr.allocate(1000u);
+   }
+   //The destructor releases memory
+   if(upstream.allocations != 0u)
+      return false;
+
+   {
+      monotonic_buffer_resource mr(1000u, &upstream);
+      if(mr.next_buffer_size() < 1000u)
+         return false;
+      mr.allocate(1u);
+      mr.allocate(500u);
+      if(upstream.allocations != 1u)
+         return false;
+   }
+   if(upstream.allocations != 0u)
+      return false;
+
+   //is_equal
+   monotonic_buffer_resource a, b;
+   return a == a && a != b && a.upstream_resource() == get_default_resource();
+}
+
+template<class PoolResource>
+bool test_pool_resource()
+{
+   counting_resource upstream;
+   {
+      pool_options opts;
+      opts.max_blocks_per_chunk = 32u;
+      opts.largest_required_pool_block = 1000u;
+      PoolResource mr(opts, &upstream);
+      if(mr.upstream_resource() != &upstream)
+         return false;
+      //Options are rounded
+      const pool_options o = mr.options();
+      if(o.max_blocks_per_chunk != 32u || o.largest_required_pool_block != 1024u)
+         return false;
+      if(mr.pool_index(1025u) != mr.pool_count())
+         return false;
+      for(std::size_t i = 0; i != mr.pool_count(); ++i){
+         if(mr.pool_index(mr.pool_block(i)) != i || mr.pool_cached_blocks(i) != 0u)
+            return false;
+         if(i && mr.pool_index(mr.pool_block(i-1u)+1u) != i)
+            return false;
+      }
+
+      //Blocks are cached and reused
+      const std::size_t idx = mr.pool_index(100u);
+      void *p = mr.allocate(100u);
+      const std::size_t cached = mr.pool_cached_blocks(idx);
+      mr.deallocate(p, 100u);
+      if(mr.pool_cached_blocks(idx) != cached + 1u || mr.allocate(100u) != p)
+         return false;
+
+      //Chunks grow geometrically up to max_blocks_per_chunk
+      const std::size_t allocations = upstream.allocations;
+      for(std::size_t i = 0; i != 1000u; ++i){
+         std::memset(mr.allocate(100u), 0, 100u);
+      }
+      if(mr.pool_next_blocks_per_chunk(idx) != 32u || upstream.allocations - allocations > 1000u/16u)
+         return false;
+
+      //Oversized and overaligned blocks are served by upstream
+      const std::size_t before = upstream.allocations;
+      void *big = mr.allocate(5000u);
+      void *aligned = mr.allocate(64u, 4096u);
+      if(upstream.allocations != before + 2u || !is_aligned(aligned, 4096u))
+         return false;
+      std::memset(big, 0, 5000u);
+      mr.deallocate(big, 5000u);
+      if(upstream.allocations != before + 1u)
+         return false;
+      mr.allocate(10000u, 64u);
+
+      //release frees everything
+      mr.release();
+      if(upstream.allocations != 0u || mr.pool_cached_blocks(idx) != 0u)
+         return false;
+      mr.allocate(10u);
+      mr.allocate(10000u);
+   }
+   //The destructor releases memory
+   if(upstream.allocations != 0u)
+      return false;
+
+   //Default options
+   PoolResource a, b;
+   const pool_options o = a.options();
+   if(!o.max_blocks_per_chunk || !o.largest_required_pool_block)
+      return false;
+   return a == a && a != b && a.upstream_resource() == get_default_resource();
+}
+
+int main()
+{
+   if(!test_global_resources()){
+      std::cerr << "Global resources test failed" << std::endl;
+      return 1;
+   }
+   if(!test_monotonic_buffer_resource()){
+      std::cerr << "monotonic_buffer_resource test failed" << std::endl;
+      return 1;
+   }
+   if(!test_pool_resource<unsynchronized_pool_resource>()){
+      std::cerr << "unsynchronized_pool_resource test failed" << std::endl;
+      return 1;
+   }
+   if(!test_pool_resource<synchronized_pool_resource>()){
+      std::cerr << "synchronized_pool_resource test failed" << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
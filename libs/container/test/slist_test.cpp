@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////
 #include <boost/container/detail/config_begin.hpp>
 #include <boost/container/slist.hpp>
+#include <boost/container/allocator.hpp>
 #include <memory>
 #include "dummy_test_allocator.hpp"
 #include "movable_int.hpp"
@@ -31,12 +32,18 @@ template class boost::container::slist<test::movable_and_copyable_int,
 template class boost::container::slist<test::movable_and_copyable_int,
    std::allocator<test::movable_and_copyable_int> >;
 
+template class boost::container::slist<test::movable_and_copyable_int,
+   allocator<test::movable_and_copyable_int> >;
+
 }}
 
 typedef slist<int> MyList;
 typedef slist<test::movable_int> MyMoveList;
 typedef slist<test::movable_and_copyable_int> MyCopyMoveList;
 typedef slist<test::copyable_int> MyCopyList;
+typedef slist<int, allocator<int> > MyBurstList;
+typedef slist<test::movable_and_copyable_int
+             , allocator<test::movable_and_copyable_int> > MyBurstCopyMoveList;
 
 class recursive_slist
 {
@@ -83,6 +90,12 @@ int main ()
    if(test::list_test<MyCopyList, false>())
       return 1;
 
+   if(test::list_test<MyBurstList, false>())
+      return 1;
+
+   if(test::list_test<MyBurstCopyMoveList, false>())
+      return 1;
+
    const test::EmplaceOptions Options = (test::EmplaceOptions)
       (test::EMPLACE_FRONT | test::EMPLACE_AFTER | test::EMPLACE_BEFORE  | test::EMPLACE_AFTER);
 
@@ -0,0 +1,154 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <iostream>
+#include <functional>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/move/utility.hpp>
+#include "check_equal_containers.hpp"
+#include "movable_int.hpp"
+#include "dummy_test_allocator.hpp"
+#include "vector_test.hpp"
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class boost::container::small_vector<test::movable_and_copyable_int, 10,
+   test::simple_allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::small_vector<test::movable_and_copyable_int, 10,
+   std::allocator<test::movable_and_copyable_int> >;
+
+}}
+
+template<class SmallVector>
+bool is_internal(const SmallVector &v)
+{
+   const char *const obj_begin = reinterpret_cast<const char*>(&v);
+   const char *const obj_end   = obj_begin + sizeof(v);
+   const char *const data      = reinterpret_cast<const char*>(v.data());
+   return obj_begin <= data && data < obj_end;
+}
+
+bool small_vector_internal_storage_test()
+{
+   typedef small_vector<int, 10> sv_t;
+   std::vector<int> stdvector;
+
+   //Up to N elements no memory is allocated
+   sv_t v;
+   if(v.capacity() != 10 || !is_internal(v))
+      return false;
+   for(int i = 0; i != 10; ++i){
+      v.push_back(i);
+      stdvector.push_back(i);
+   }
+   if(!is_internal(v) || !test::CheckEqualContainers(&v, &stdvector))
+      return false;
+
+   //Spill to dynamic memory
+   v.push_back(10);
+   stdvector.push_back(10);
+   if(is_internal(v) || v.capacity() <= 10 || !test::CheckEqualContainers(&v, &stdvector))
+      return false;
+
+   //Copies of small vectors are internal again
+   v.erase(v.begin(), v.begin() + 5);
+   stdvector.erase(stdvector.begin(), stdvector.begin() + 5);
+   sv_t c(v);
+   if(!is_internal(c) || !test::CheckEqualContainers(&c, &stdvector))
+      return false;
+
+   //shrink_to_fit goes back to the internal buffer
+   v.shrink_to_fit();
+   if(!is_internal(v) || v.capacity() != 10 || !test::CheckEqualContainers(&v, &stdvector))
+      return false;
+
+   //Moving an internal vector moves the elements
+   sv_t m(boost::move(v));
+   if(!is_internal(m) || !v.empty() || !is_internal(v) || !test::CheckEqualContainers(&m, &stdvector))
+      return false;
+
+   //Moving a dynamic vector transfers the buffer
+   sv_t big(20, 3);
+   const int *const big_data = big.data();
+   sv_t moved(boost::move(big));
+   if(moved.data() != big_data || !big.empty() || !is_internal(big) || moved.size() != 20)
+      return false;
+
+   //Swap internal and dynamic vectors
+   m.swap(moved);
+   if(is_internal(m) || m.data() != big_data || m.size() != 20 ||
+      !is_internal(moved) || !test::CheckEqualContainers(&moved, &stdvector))
+      return false;
+   m.swap(moved);
+   if(!is_internal(m) || !test::CheckEqualContainers(&m, &stdvector) || moved.data() != big_data)
+      return false;
+
+   //Assignment
+   moved = m;
+   if(!test::CheckEqualContainers(&moved, &stdvector))
+      return false;
+   m = boost::move(moved);
+   if(!test::CheckEqualContainers(&m, &stdvector))
+      return false;
+
+   //Containers of small vectors
+   vector< small_vector<int, 2> > vv;
+   for(int i = 0; i != 100; ++i){
+      vv.push_back(small_vector<int, 2>(std::size_t(i % 5), i));
+   }
+   for(int i = 0; i != 100; ++i){
+      if(vv[i].size() != std::size_t(i % 5) || (i % 5 && vv[i].back() != i))
+         return false;
+   }
+   return true;
+}
+
+int main()
+{
+   typedef small_vector<int, 5> MyVector;
+   typedef small_vector<test::movable_int, 5> MyMoveVector;
+   typedef small_vector<test::movable_and_copyable_int, 5> MyCopyMoveVector;
+   typedef small_vector<test::copyable_int, 5> MyCopyVector;
+
+   if(test::vector_test<MyVector>())
+      return 1;
+   if(test::vector_test<MyMoveVector>())
+      return 1;
+   if(test::vector_test<MyCopyMoveVector>())
+      return 1;
+   if(test::vector_test<MyCopyVector>())
+      return 1;
+   if(!test::default_init_test< small_vector<int, 10, test::default_init_allocator<int> > >()){
+      std::cerr << "Default init test failed" << std::endl;
+      return 1;
+   }
+
+   const test::EmplaceOptions Options = (test::EmplaceOptions)(test::EMPLACE_BACK | test::EMPLACE_BEFORE);
+   if(!boost::container::test::test_emplace< small_vector<test::EmplaceInt, 5>, Options>()){
+      return 1;
+   }
+
+   if(!small_vector_internal_storage_test()){
+      std::cerr << "Internal storage test failed" << std::endl;
+      return 1;
+   }
+
+   return 0;
+}
+#include <boost/container/detail/config_end.hpp>
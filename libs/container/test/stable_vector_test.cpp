@@ -16,6 +16,7 @@
 #include <functional>
 
 #include <boost/container/stable_vector.hpp>
+#include <boost/container/allocator.hpp>
 #include "check_equal_containers.hpp"
 #include "movable_int.hpp"
 #include "expand_bwd_test_allocator.hpp"
@@ -39,6 +40,9 @@ template class stable_vector<test::movable_and_copyable_int,
 template class stable_vector<test::movable_and_copyable_int,
    std::allocator<test::movable_and_copyable_int> >;
 
+template class stable_vector<test::movable_and_copyable_int,
+   allocator<test::movable_and_copyable_int> >;
+
 namespace stable_vector_detail{
 
 template class iterator<int*, false>;
@@ -132,6 +136,9 @@ int main()
    if(test::vector_test<MyCopyVector>())
       return 1;
 
+   if(test::vector_test<stable_vector<int, allocator<int> > >())
+      return 1;
+
    if(!test::default_init_test< stable_vector<int, test::default_init_allocator<int> > >()){
       std::cerr << "Default init test failed" << std::endl;
       return 1;
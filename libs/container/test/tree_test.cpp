@@ -9,8 +9,11 @@
 //////////////////////////////////////////////////////////////////////////////
 #include <boost/container/detail/config_begin.hpp>
 #include <set>
+#include <vector>
+#include <new>
 #include <boost/container/set.hpp>
 #include <boost/container/map.hpp>
+#include <boost/container/allocator.hpp>
 #include "print_container.hpp"
 #include "movable_int.hpp"
 #include "dummy_test_allocator.hpp"
@@ -51,6 +54,14 @@ typedef map<test::copyable_int
 typedef multimap<test::copyable_int
                 ,test::copyable_int>                     MyCopyBoostMultiMap;
 
+//Alias types using a burst allocator
+typedef set<int, std::less<int>, allocator<int> >              MyBurstBoostSet;
+typedef multiset<int, std::less<int>, allocator<int> >         MyBurstBoostMultiSet;
+typedef map<int, int, std::less<int>
+           , allocator<std::pair<const int, int> > >           MyBurstBoostMap;
+typedef multimap<int, int, std::less<int>
+           , allocator<std::pair<const int, int> > >           MyBurstBoostMultiMap;
+
 namespace boost {
 namespace container {
 
@@ -125,6 +136,12 @@ template class set
    , std::allocator<test::movable_and_copyable_int>
    >;
 
+template class set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , allocator<test::movable_and_copyable_int>
+   >;
+
 //multiset
 template class multiset
    < test::movable_and_copyable_int
@@ -238,6 +255,74 @@ class tree_propagate_test_wrapper
    {  this->Base::swap(x);  }
 };
 
+//A value whose construction throws after a number of copies
+struct throwing_int
+{
+   static int copies_left;
+   int value;
+
+   throwing_int(int v = 0)
+      :  value(v)
+   {}
+
+   throwing_int(const throwing_int &other)
+      :  value(other.value)
+   {
+      if(copies_left-- == 0)
+         throw std::bad_alloc();
+   }
+
+   friend bool operator<(const throwing_int &a, const throwing_int &b)
+   {  return a.value < b.value;  }
+};
+
+int throwing_int::copies_left = -1;
+
+//Range insertion of nodes allocated in bursts, with repeated
+//values and with exceptions thrown in the middle
+bool test_burst_range_insertion()
+{
+   std::vector<throwing_int> values;
+   for(int i = 0; i != 1000; ++i){
+      values.push_back(throwing_int(i % 300));
+   }
+   typedef set<throwing_int, std::less<throwing_int>, allocator<throwing_int> >       set_t;
+   typedef multiset<throwing_int, std::less<throwing_int>, allocator<throwing_int> >  multiset_t;
+   {
+      set_t s(values.begin(), values.end());
+      multiset_t ms(values.begin(), values.end());
+      if(s.size() != 300 || ms.size() != 1000){
+         return false;
+      }
+      s.insert(values.begin(), values.end());
+      ms.insert(values.begin(), values.end());
+      if(s.size() != 300 || ms.size() != 2000){
+         return false;
+      }
+   }
+   for(int i = 0; i != 3; ++i){
+      set_t s;
+      multiset_t ms;
+      throwing_int::copies_left = 500;
+      try{
+         s.insert(values.begin(), values.end());
+         return false;
+      }
+      catch(std::bad_alloc &){}
+      throwing_int::copies_left = 500;
+      try{
+         ms.insert(values.begin(), values.end());
+         return false;
+      }
+      catch(std::bad_alloc &){}
+      throwing_int::copies_left = -1;
+      if(s.size() != 300 || ms.size() != 500){
+         return false;
+      }
+   }
+   return true;
+}
+
 int main ()
 {
    //Recursive container instantiation
@@ -326,6 +411,24 @@ int main ()
       return 1;
    }
 
+   if(0 != test::set_test_copyable<MyBurstBoostSet
+                        ,MyStdSet
+                        ,MyBurstBoostMultiSet
+                        ,MyStdMultiSet>()){
+      return 1;
+   }
+
+   if(0 != test::map_test_copyable<MyBurstBoostMap
+                        ,MyStdMap
+                        ,MyBurstBoostMultiMap
+                        ,MyStdMultiMap>()){
+      return 1;
+   }
+
+   if(!test_burst_range_insertion()){
+      return 1;
+   }
+
    if (0 != test::map_test<MyMovableBoostMap
                   ,MyStdMap
                   ,MyMovableBoostMultiMap
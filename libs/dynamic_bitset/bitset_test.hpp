@@ -783,6 +783,36 @@ struct bitset_test {
     BOOST_CHECK(b.intersects(a) == have_intersection);
   }
 
+  static void fused_operations(const Bitset& a, const Bitset& b)
+  {
+    BOOST_CHECK(a.size() == b.size()); // PRE
+
+    std::size_t and_count = 0, or_count = 0, xor_count = 0, andnot_count = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+      if (a[i] && b[i])
+        ++and_count;
+      if (a[i] || b[i])
+        ++or_count;
+      if (a[i] != b[i])
+        ++xor_count;
+      if (a[i] && !b[i])
+        ++andnot_count;
+    }
+
+    BOOST_CHECK(a.and_count(b) == and_count);
+    BOOST_CHECK(a.or_count(b) == or_count);
+    BOOST_CHECK(a.xor_count(b) == xor_count);
+    BOOST_CHECK(a.andnot_count(b) == andnot_count);
+    BOOST_CHECK(a.andnot_any(b) == (andnot_count != 0));
+
+    // same as the operation followed by count() or any()
+    BOOST_CHECK(a.and_count(b) == (a & b).count());
+    BOOST_CHECK(a.or_count(b) == (a | b).count());
+    BOOST_CHECK(a.xor_count(b) == (a ^ b).count());
+    BOOST_CHECK(a.andnot_count(b) == (a - b).count());
+    BOOST_CHECK(a.andnot_any(b) == (a - b).any());
+  }
+
   static void find_first(const Bitset& b)
   {
       // find first non-null bit, if any
@@ -0,0 +1,412 @@
+// -----------------------------------------------------------
+//              Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// -----------------------------------------------------------
+
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+#include "boost/archive/text_iarchive.hpp"
+#include "boost/archive/text_oarchive.hpp"
+#include "boost/archive/xml_iarchive.hpp"
+#include "boost/archive/xml_oarchive.hpp"
+#include "boost/dynamic_bitset/dynamic_bitset.hpp"
+#include "boost/dynamic_bitset/compressed_bitset.hpp"
+#include "boost/dynamic_bitset/compressed_bitset_serialization.hpp"
+#include "boost/test/minimal.hpp"
+
+typedef boost::compressed_bitset<> compressed_type;
+typedef boost::dynamic_bitset<> reference_type;
+
+// the random bitsets span 16 chunks
+const std::size_t test_size = 16 * 0x10000;
+
+// Fills the chunks of c and r with bits "on" at random positions,
+// dense bits, ranges or nothing, so that every representation of
+// the chunks occurs.
+//
+void make_random(compressed_type & c, reference_type & r)
+{
+  r.resize(test_size);
+  for (std::size_t chunk = 0; chunk < test_size; chunk += 0x10000) {
+    switch (std::rand() % 5) {
+    case 0: // sparse
+      for (int i = 0; i < 300; ++i) {
+        const std::size_t pos = chunk + std::rand() % 0x10000;
+        c.set(pos);
+        r.set(pos);
+      }
+      break;
+    case 1: // dense
+      for (std::size_t pos = chunk; pos < chunk + 0x10000; ++pos)
+        if (std::rand() % 3 == 0) {
+          c.set(pos);
+          r.set(pos);
+        }
+      break;
+    case 2: // ranges
+      for (int i = 0; i < 20; ++i) {
+        const std::size_t pos = chunk + std::rand() % 0x10000;
+        const std::size_t len = std::rand() % 3000;
+        const std::size_t last = (std::min)(pos + len, chunk + 0x10000);
+        c.set(pos, last - pos, true);
+        for (std::size_t i = pos; i < last; ++i)
+          r.set(i);
+      }
+      break;
+    case 3: // all bits "on"
+      c.set(chunk, 0x10000, true);
+      for (std::size_t pos = chunk; pos < chunk + 0x10000; ++pos)
+        r.set(pos);
+      break;
+    default: // empty
+      break;
+    }
+  }
+}
+
+void check_equal(const compressed_type & c, const reference_type & r)
+{
+  BOOST_CHECK(c.count() == r.count());
+  BOOST_CHECK(c.any() == r.any());
+
+  // iteration, find_first and find_next
+  std::size_t pos = r.find_first();
+  compressed_type::size_type next = c.find_first();
+  compressed_type::const_iterator it = c.begin();
+  for (; it != c.end(); ++it) {
+    BOOST_REQUIRE(pos != reference_type::npos);
+    BOOST_REQUIRE(*it == pos);
+    BOOST_REQUIRE(next == pos);
+    pos = r.find_next(pos);
+    next = c.find_next(next);
+  }
+  BOOST_CHECK(pos == reference_type::npos);
+  BOOST_CHECK(next == compressed_type::npos);
+
+  for (int i = 0; i < 1000; ++i) {
+    const std::size_t n = std::rand() % test_size;
+    BOOST_CHECK(c.test(n) == r.test(n));
+  }
+}
+
+void test_basic_operations()
+{
+  compressed_type c;
+  BOOST_CHECK(c.none());
+  BOOST_CHECK(c.count() == 0);
+  BOOST_CHECK(c.find_first() == compressed_type::npos);
+  BOOST_CHECK(c.begin() == c.end());
+  BOOST_CHECK(c.size() == compressed_type::size_type(1) << 32);
+
+  c.set(5).set(70000).set(3);
+  BOOST_CHECK(c.count() == 3);
+  BOOST_CHECK(c.test(3) && c.test(5) && c.test(70000));
+  BOOST_CHECK(!c.test(4) && !c[69999]);
+  BOOST_CHECK(c.find_first() == 3);
+  BOOST_CHECK(c.find_next(3) == 5);
+  BOOST_CHECK(c.find_next(5) == 70000);
+  BOOST_CHECK(c.find_next(70000) == compressed_type::npos);
+
+  c.reset(5);
+  c.flip(3);
+  c.flip(4);
+  BOOST_CHECK(c.count() == 2);
+  BOOST_CHECK(c.find_first() == 4);
+
+  // the last positions
+  const compressed_type::size_type last = c.size() - 1;
+  c.set(last);
+  c.set(last - 1);
+  BOOST_CHECK(c.test(last));
+  BOOST_CHECK(c.find_next(70000) == last - 1);
+  BOOST_CHECK(c.find_next(last - 1) == last);
+  BOOST_CHECK(c.find_next(last) == compressed_type::npos);
+  BOOST_CHECK(c.find_next(compressed_type::npos) == compressed_type::npos);
+  std::vector<compressed_type::size_type> positions(c.begin(), c.end());
+  BOOST_CHECK(positions.size() == 4);
+  BOOST_CHECK(positions[3] == last);
+  BOOST_CHECK(compressed_type(positions.begin(), positions.end()) == c);
+
+  c.set(0, c.size(), false);
+  BOOST_CHECK(c.none());
+
+  // the whole range
+  c.set(0, c.size(), true);
+  BOOST_CHECK(c.count() == c.size());
+  BOOST_CHECK(c.find_next(123456) == 123457);
+  c.reset();
+  BOOST_CHECK(c.none());
+}
+
+void test_representations()
+{
+  // the array of a chunk is turned into a bitmap and back
+  compressed_type c;
+  for (std::size_t i = 0; i < 10000; ++i)
+    c.set(i * 3);
+  BOOST_CHECK(c.count() == 10000);
+  const std::size_t bitmap_usage = c.memory_usage();
+  for (std::size_t i = 0; i < 10000; ++i)
+    if (i % 4)
+      c.reset(i * 3);
+  BOOST_CHECK(c.count() == 2500);
+  BOOST_CHECK(c.test(12) && !c.test(3));
+  c.optimize();
+  BOOST_CHECK(c.memory_usage() < bitmap_usage);
+
+  // ranges are stored as runs
+  compressed_type r;
+  r.set(100, 50000, true);
+  r.set(60000, 10000, true);
+  BOOST_CHECK(r.count() == 60000);
+  BOOST_CHECK(r.memory_usage() < 1000);
+  r.set(100, 60000, true); // merged with both runs
+  BOOST_CHECK(r.count() == 69900);
+  r.reset(200);
+  r.set(1000, 10, false);
+  r.flip(69999);
+  r.flip(70000);
+  BOOST_CHECK(r.count() == 69900 - 1 - 10);
+  BOOST_CHECK(!r.test(200) && r.test(201) && !r.test(1005) && r.test(1010));
+  BOOST_CHECK(!r.test(69999) && r.test(70000) && !r.test(70001));
+  BOOST_CHECK(r.find_next(999) == 1010);
+
+  // many runs are turned into a bitmap, and back by optimize
+  compressed_type many;
+  for (std::size_t i = 0; i < 0x10000; i += 16)
+    many.set(i, 8, true);
+  BOOST_CHECK(many.count() == 0x10000 / 2);
+  const std::size_t many_usage = many.memory_usage();
+  many.optimize();
+  BOOST_CHECK(many.memory_usage() <= many_usage);
+  BOOST_CHECK(many.count() == 0x10000 / 2);
+  compressed_type dense(many);
+  dense.set(0, 0x10000, true);
+  dense.optimize();
+  BOOST_CHECK(dense.memory_usage() < many_usage);
+
+  // equal bitsets with different representations
+  compressed_type a, b;
+  for (std::size_t i = 10; i < 20; ++i)
+    a.set(i);
+  b.set(10, 10, true);
+  BOOST_CHECK(a == b);
+  a.optimize();
+  b.set(0, 0x10000, true);
+  b.set(20, 0x10000 - 20, false);
+  b.set(0, 10, false);
+  BOOST_CHECK(a == b);
+  b.set(30);
+  BOOST_CHECK(a != b);
+}
+
+void test_bitset_operations()
+{
+  for (int i = 0; i < 24; ++i) {
+    compressed_type a, b;
+    reference_type ra, rb;
+    make_random(a, ra);
+    make_random(b, rb);
+    if (i % 2) {
+      a.optimize();
+      b.optimize();
+    }
+    check_equal(a, ra);
+    check_equal(b, rb);
+
+    check_equal(a & b, ra & rb);
+    check_equal(a | b, ra | rb);
+    check_equal(a ^ b, ra ^ rb);
+    check_equal(a - b, ra - rb);
+    check_equal(b - a, rb - ra);
+
+    BOOST_CHECK(a.intersects(b) == ra.intersects(rb));
+    BOOST_CHECK(a.is_subset_of(b) == ra.is_subset_of(rb));
+    BOOST_CHECK((a & b).is_subset_of(a));
+    BOOST_CHECK(a.is_subset_of(a | b));
+    BOOST_CHECK(!(a - b).intersects(b));
+    BOOST_CHECK((a ^ b) == ((a | b) - (a & b)));
+    BOOST_CHECK(((a ^ b) ^ b) == a);
+  }
+}
+
+template <typename OArchive, typename IArchive>
+void test_serialization()
+{
+  compressed_type a;
+  reference_type r;
+  make_random(a, r);
+  a.set(a.size() - 1);
+  a.optimize();
+
+  std::stringstream stream;
+  {
+    OArchive oa(stream);
+    oa << boost::serialization::make_nvp("bitset", a);
+  }
+  compressed_type b;
+  b.set(12345);
+  {
+    IArchive ia(stream);
+    ia >> boost::serialization::make_nvp("bitset", b);
+  }
+  BOOST_CHECK(a == b);
+  BOOST_CHECK(b.count() == r.count() + 1);
+}
+
+// Writes chunks in the format of compressed_bitset, without checking
+// them, to make up malformed archives.
+//
+struct raw_chunk
+{
+  boost::uint16_t key;
+  unsigned int kind;
+  boost::uint32_t cardinality;
+  std::vector<boost::uint16_t> values;
+  std::vector<boost::uint64_t> words;
+};
+
+struct raw_bitset
+{
+  std::vector<raw_chunk> chunks;
+
+  template <typename Archive>
+  void serialize(Archive & ar, const unsigned int /*version*/)
+  {
+    const boost::serialization::collection_size_type count(chunks.size());
+    ar << boost::serialization::make_nvp("count", count);
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+      ar << boost::serialization::make_nvp("key", chunks[i].key);
+      ar << boost::serialization::make_nvp("kind", chunks[i].kind);
+      ar << boost::serialization::make_nvp("cardinality", chunks[i].cardinality);
+      ar << boost::serialization::make_nvp("values", chunks[i].values);
+      ar << boost::serialization::make_nvp("words", chunks[i].words);
+    }
+  }
+};
+
+raw_chunk make_chunk(boost::uint16_t key, unsigned int kind, boost::uint32_t cardinality)
+{
+  raw_chunk c;
+  c.key = key;
+  c.kind = kind;
+  c.cardinality = cardinality;
+  return c;
+}
+
+// returns true if loading raw throws archive_exception
+bool is_rejected(const raw_bitset & raw)
+{
+  std::stringstream stream;
+  {
+    boost::archive::text_oarchive oa(stream);
+    oa << raw;
+  }
+  compressed_type b;
+  b.set(12345);
+  try {
+    boost::archive::text_iarchive ia(stream);
+    ia >> b;
+  }
+  catch (const boost::archive::archive_exception &) {
+    // b is left unchanged
+    BOOST_CHECK(b.count() == 1 && b.test(12345));
+    return true;
+  }
+  return false;
+}
+
+void test_malformed_archive()
+{
+  raw_bitset raw;
+  raw_chunk array = make_chunk(0, 0, 3);
+  array.values.push_back(1);
+  array.values.push_back(5);
+  array.values.push_back(9);
+  raw_chunk bitmap = make_chunk(2, 1, 2);
+  bitmap.words.resize(1024);
+  bitmap.words[7] = 0x11;
+  raw_chunk runs = make_chunk(4, 2, 13);
+  runs.values.push_back(10);
+  runs.values.push_back(19);
+  runs.values.push_back(30);
+  runs.values.push_back(32);
+
+  // the valid archive is loaded
+  raw.chunks.push_back(array);
+  raw.chunks.push_back(bitmap);
+  raw.chunks.push_back(runs);
+  BOOST_CHECK(!is_rejected(raw));
+
+  raw_bitset bad(raw);
+  bad.chunks[0].kind = 3;
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[1].words.pop_back();
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[0].words.push_back(1);
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  std::swap(bad.chunks[0].values[0], bad.chunks[0].values[1]);
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[0].values[1] = 1;
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[0].values.pop_back();
+  bad.chunks[0].cardinality = 3;
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[2].values.pop_back();
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[2].values[1] = 29; // adjacent runs
+  bad.chunks[2].cardinality = 23;
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[1].cardinality = 3;
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[2].cardinality = 12;
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[1].key = 0;
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  std::swap(bad.chunks[1], bad.chunks[2]);
+  BOOST_CHECK(is_rejected(bad));
+
+  bad = raw;
+  bad.chunks[0] = make_chunk(0, 0, 0); // empty chunk
+  BOOST_CHECK(is_rejected(bad));
+}
+
+int
+test_main(int, char*[])
+{
+  test_basic_operations();
+  test_representations();
+  test_bitset_operations();
+  test_serialization<boost::archive::text_oarchive, boost::archive::text_iarchive>();
+  test_serialization<boost::archive::xml_oarchive, boost::archive::xml_iarchive>();
+  test_malformed_archive();
+
+  return 0;
+}
@@ -228,6 +228,47 @@ void run_test_cases( BOOST_EXPLICIT_TEMPLATE_TYPE(Block) )
     a[14] = b[14] = 1;
     Tests::intersects(a, b);
   }
+  {
+    // long bitsets, whose blocks are processed in vector registers
+    bitset_type a(long_string), b(long_string);
+    Tests::intersects(a, b);
+    a.flip();
+    Tests::intersects(a, b);
+    a.resize(3 * long_string.size(), true);
+    Tests::intersects(a, b);
+  }
+  //=====================================================================
+  // Test fused operations
+  {
+    bitset_type a, b; // empty
+    Tests::fused_operations(a, b);
+  }
+  {
+    bitset_type a(1, 1ul), b(1, 0ul);
+    Tests::fused_operations(a, b);
+    Tests::fused_operations(b, a);
+  }
+  {
+    bitset_type a(long_string);
+    bitset_type b(long_string.size(), 0ul);
+    Tests::fused_operations(a, b);
+    Tests::fused_operations(b, a);
+    Tests::fused_operations(a, a);
+  }
+  {
+    bitset_type a(long_string), b(long_string);
+    b >>= 5;
+    b.flip(long_string.size() - 1);
+    Tests::fused_operations(a, b);
+    Tests::fused_operations(b, a);
+  }
+  {
+    // a single difference in the last block
+    bitset_type a(long_string), b(long_string);
+    a.flip(a.size() - 1);
+    Tests::fused_operations(a, b);
+    Tests::fused_operations(b, a);
+  }
   //=====================================================================
   // Test find_first
   {
@@ -256,6 +297,15 @@ void run_test_cases( BOOST_EXPLICIT_TEMPLATE_TYPE(Block) )
       b.set(b.size() - 1);
       Tests::find_first(b);
   }
+  {
+      // each bit on in a long bitset
+      bitset_type b(40 * bitset_type::bits_per_block, 0ul);
+      for (typename bitset_type::size_type i = 0; i < b.size(); i += 7) {
+          b.set(i);
+          Tests::find_first(b);
+          b.reset(i);
+      }
+  }
   //=====================================================================
   // Test find_next
   {
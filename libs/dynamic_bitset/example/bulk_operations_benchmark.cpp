@@ -0,0 +1,165 @@
+// -----------------------------------------------------------
+//
+//           Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// -----------------------------------------------------------
+
+//  boost::dynamic_bitset bulk operations benchmark
+//
+//  Times the bitset operations, count(), the fused operations
+//  and the lookup functions on bitsets of different sizes. The
+//  fused operations are compared with the equivalent expressions,
+//  which create a temporary bitset.
+//
+//  To compare with the loops that process one block at a time,
+//  build with BOOST_DYNAMIC_BITSET_NO_SIMD defined, or with
+//  BOOST_DYNAMIC_BITSET_NO_INTRINSICS defined to also disable the
+//  use of the popcount and ctz builtins.
+//
+// -----------------------------------------------------------------------//
+
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <typeinfo>
+
+#include "boost/cstdlib.hpp"
+#include "boost/timer.hpp"
+#include "boost/dynamic_bitset.hpp"
+
+
+namespace {
+
+    // Prints the time per call, in nanoseconds, of running f
+    // on a and b. The results are summed up in dummy, to keep
+    // the optimizer from removing the calls.
+    //
+    template <typename Bitset, typename Function>
+    void run(const char * name, Function f, Bitset & a, const Bitset & b,
+             unsigned long iterations, typename Bitset::size_type & dummy)
+    {
+        boost::timer time;
+        for (unsigned long i = 0; i < iterations; ++i)
+            dummy += f(a, b);
+
+        const double elapsed = time.elapsed();
+        std::cout << "  " << std::setw(22) << std::left << name << std::right
+                  << std::setw(10) << elapsed / iterations * 1e9 << " ns\n";
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type and_assign(Bitset & a, const Bitset & b)
+    {
+        a &= b;
+        return a.num_blocks();
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type or_assign(Bitset & a, const Bitset & b)
+    {
+        a |= b;
+        return a.num_blocks();
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type count(Bitset & a, const Bitset &)
+    {
+        return a.count();
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type and_count(Bitset & a, const Bitset & b)
+    {
+        return a.and_count(b);
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type and_then_count(Bitset & a, const Bitset & b)
+    {
+        return (a & b).count();
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type andnot_any(Bitset & a, const Bitset & b)
+    {
+        return a.andnot_any(b);
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type andnot_then_any(Bitset & a, const Bitset & b)
+    {
+        return (a - b).any();
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type is_subset_of(Bitset & a, const Bitset & b)
+    {
+        return a.is_subset_of(b);
+    }
+
+    template <typename Bitset>
+    typename Bitset::size_type find_all(Bitset &, const Bitset & b)
+    {
+        typename Bitset::size_type sum = 0;
+        for (typename Bitset::size_type i = b.find_first(); i != Bitset::npos; i = b.find_next(i))
+            sum += i;
+        return sum;
+    }
+
+}
+
+
+template <typename T>
+void benchmark(typename boost::dynamic_bitset<T>::size_type size, T* = 0)
+{
+    typedef boost::dynamic_bitset<T> bitset_type;
+    typedef typename bitset_type::size_type size_type;
+
+    // about 2^28 bits are processed by each test
+    const unsigned long iterations = static_cast<unsigned long>((1ul << 28) / size) + 1;
+
+    bitset_type dense(size), sparse(size);
+    for (size_type i = 0; i < size; ++i) {
+        dense[i] = std::rand() % 2 != 0;
+        sparse[i] = std::rand() % 1024 == 0;
+    }
+
+    // b is a superset of a, so that no test returns early
+    bitset_type a(sparse), b(dense | sparse);
+    size_type dummy = 0;
+
+    std::cout << "\ndynamic_bitset<" << typeid(T).name() << ">, "
+              << size << " bits [" << iterations << " iterations]\n";
+
+    run("operator&=", &and_assign<bitset_type>, a, b, iterations, dummy);
+    run("operator|=", &or_assign<bitset_type>, a, sparse, iterations, dummy);
+    run("count", &count<bitset_type>, b, b, iterations, dummy);
+    run("and_count", &and_count<bitset_type>, a, b, iterations, dummy);
+    run("(a & b).count()", &and_then_count<bitset_type>, a, b, iterations, dummy);
+    run("andnot_any", &andnot_any<bitset_type>, a, b, iterations, dummy);
+    run("(a - b).any()", &andnot_then_any<bitset_type>, a, b, iterations, dummy);
+    run("is_subset_of", &is_subset_of<bitset_type>, a, b, iterations, dummy);
+    run("find_first/find_next", &find_all<bitset_type>, a, sparse,
+        iterations / 16 + 1, dummy);
+
+    std::cout << "  (dummy: " << dummy << ")\n";
+}
+
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(1);
+
+    const unsigned long sizes[] = { 256, 4096, 65536, 1048576 };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        benchmark<unsigned char>(sizes[i]);
+        benchmark<unsigned long>(sizes[i]);
+    }
+
+    return boost::exit_success;
+}
@@ -0,0 +1,110 @@
+/* Boost.Flyweight example of performance of concurrent interning.
+ *
+ * Copyright (C) 2026 agent <agent@local>.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/flyweight for library home page.
+ */
+
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/flyweight/concurrent_factory.hpp>
+#include <boost/flyweight/deferred_refcounted.hpp>
+#include <boost/flyweight/flyweight.hpp>
+#include <boost/flyweight/hashed_factory.hpp>
+#include <boost/flyweight/refcounted.hpp>
+#include <boost/flyweight/simple_locking.hpp>
+#include <boost/flyweight/static_holder.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace boost::flyweights;
+
+/* A number of threads intern strings drawn from a common pool; part of the
+ * strings are kept alive for the whole run (hot values) while the rest are
+ * created and dropped inside the loop, so that the factory is continuously
+ * inserted into and erased from. Elapsed wall time is reported for
+ * increasing numbers of threads and different flyweight configurations.
+ */
+
+const int num_hot_values=1000;
+const int num_cold_values=100000;
+const int num_iterations=400000;
+
+std::vector<std::string> values;
+
+void build_values()
+{
+  for(int i=0;i<num_hot_values+num_cold_values;++i){
+    std::ostringstream oss;
+    oss<<"interned string #"<<i;
+    values.push_back(oss.str());
+  }
+}
+
+template<typename Flyweight>
+void intern(int seed,std::size_t* res)
+{
+  std::size_t len=0;
+  unsigned    n=static_cast<unsigned>(seed)*2654435761U;
+  for(int i=0;i<num_iterations;++i){
+    n=n*1103515245U+12345U;
+    Flyweight fw(values[(n>>8)%values.size()]);
+    len+=fw.get().size();
+  }
+  *res=len;
+}
+
+template<typename Flyweight>
+double measure(int num_threads)
+{
+  /* keep hot values alive during the measurement */
+
+  std::vector<Flyweight> hot;
+  for(int i=0;i<num_hot_values;++i)hot.push_back(Flyweight(values[i]));
+
+  std::vector<std::size_t> res(num_threads);
+  boost::thread_group      threads;
+  boost::posix_time::ptime start=
+    boost::posix_time::microsec_clock::universal_time();
+  for(int i=0;i<num_threads;++i){
+    threads.create_thread(boost::bind(intern<Flyweight>,i,&res[i]));
+  }
+  threads.join_all();
+  return (boost::posix_time::microsec_clock::universal_time()-start).
+    total_microseconds()/1.0E6;
+}
+
+template<typename Flyweight>
+void test(const char* name)
+{
+  std::cout<<name<<"\n";
+  for(int num_threads=1;num_threads<=8;num_threads*=2){
+    std::cout<<"  "<<num_threads<<" thread(s): "
+             <<measure<Flyweight>(num_threads)<<" s\n";
+  }
+}
+
+int main()
+{
+  build_values();
+
+  test<flyweight<std::string,hashed_factory<>,simple_locking,tag<int> > >(
+    "hashed_factory, simple_locking, refcounted");
+  test<flyweight<
+    std::string,hashed_factory<>,simple_locking,deferred_refcounted,tag<int>
+  > >(
+    "hashed_factory, simple_locking, deferred_refcounted");
+  test<flyweight<std::string,concurrent_factory<>,tag<int> > >(
+    "concurrent_factory, refcounted");
+  test<flyweight<std::string,concurrent_factory<>,deferred_refcounted> >(
+    "concurrent_factory, deferred_refcounted");
+
+  return 0;
+}
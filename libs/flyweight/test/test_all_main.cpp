@@ -12,7 +12,9 @@
 #include <boost/detail/lightweight_test.hpp>
 #include "test_assoc_cont_factory.hpp"
 #include "test_basic.hpp"
+#include "test_concurrent_factory.hpp"
 #include "test_custom_factory.hpp"
+#include "test_deferred_refcounted.hpp"
 #include "test_intermod_holder.hpp"
 #include "test_init.hpp"
 #include "test_multictor.hpp"
@@ -24,7 +26,9 @@ int main()
 {
   test_assoc_container_factory();
   test_basic();
+  test_concurrent_factory();
   test_custom_factory();
+  test_deferred_refcounted();
   test_init();
   test_intermodule_holder();
   test_multictor();
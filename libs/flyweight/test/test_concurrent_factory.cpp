@@ -0,0 +1,129 @@
+/* Boost.Flyweight test of concurrent_factory.
+ *
+ * Copyright (C) 2026 agent <agent@local>.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/flyweight for library home page.
+ */
+
+#include "test_concurrent_factory.hpp"
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <boost/bind.hpp>
+#include <boost/flyweight/concurrent_factory.hpp>
+#include <boost/flyweight/deferred_refcounted.hpp>
+#include <boost/flyweight/flyweight.hpp>
+#include <boost/flyweight/no_locking.hpp>
+#include <boost/flyweight/refcounted.hpp>
+#include <boost/flyweight/simple_locking.hpp>
+#include <boost/flyweight/static_holder.hpp>
+#include <boost/thread/thread.hpp>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "test_basic_template.hpp"
+
+using namespace boost::flyweights;
+
+struct concurrent_factory_flyweight_specifier1
+{
+  template<typename T>
+  struct apply
+  {
+    typedef flyweight<T,concurrent_factory<> > type;
+  };
+};
+
+struct concurrent_factory_flyweight_specifier2
+{
+  template<typename T>
+  struct apply
+  {
+    typedef flyweight<
+      T,
+      concurrent_factory_class<
+        boost::mpl::_1,boost::mpl::_2,
+        boost::hash<boost::mpl::_2>,
+        std::equal_to<boost::mpl::_2>,
+        std::allocator<boost::mpl::_1>
+      >,
+      no_locking,
+      tag<char>
+    > type;
+  };
+};
+
+struct concurrent_factory_flyweight_specifier3
+{
+  template<typename T>
+  struct apply
+  {
+    typedef flyweight<
+      T,
+      concurrent_factory<>,
+      deferred_refcounted,
+      static_holder_class<boost::mpl::_1>
+    > type;
+  };
+};
+
+static std::string mt_value(int n)
+{
+  std::ostringstream oss;
+  oss<<"value "<<n;
+  return oss.str();
+}
+
+template<typename Flyweight>
+static void mt_intern(
+  const std::vector<Flyweight>* reference,int seed,bool* res)
+{
+  const int n=static_cast<int>(reference->size());
+  for(int i=0;i<20000;++i){
+    int       k=(i*7+seed)%n;
+    Flyweight fw(mt_value(k));
+    if(&fw.get()!=&(*reference)[k].get()){
+      *res=false;
+      return;
+    }
+    Flyweight transient(mt_value(n+(i+seed)%n)); /* inserted and erased */
+    if(transient.get()!=mt_value(n+(i+seed)%n)){
+      *res=false;
+      return;
+    }
+  }
+}
+
+template<typename Flyweight>
+static void test_mt_intern()
+{
+  std::vector<Flyweight> reference;
+  for(int i=0;i<100;++i)reference.push_back(Flyweight(mt_value(i)));
+
+  const int           num_threads=8;
+  bool                res[num_threads];
+  boost::thread_group threads;
+  for(int i=0;i<num_threads;++i){
+    res[i]=true;
+    threads.create_thread(
+      boost::bind(mt_intern<Flyweight>,&reference,i,&res[i]));
+  }
+  threads.join_all();
+  for(int i=0;i<num_threads;++i)BOOST_TEST(res[i]);
+}
+
+void test_concurrent_factory()
+{
+  test_basic_template<concurrent_factory_flyweight_specifier1>();
+  test_basic_template<concurrent_factory_flyweight_specifier2>();
+  test_basic_template<concurrent_factory_flyweight_specifier3>();
+
+  test_mt_intern<
+    flyweight<std::string,concurrent_factory<>,tag<int> > >();
+  test_mt_intern<
+    flyweight<std::string,concurrent_factory<>,deferred_refcounted,tag<int> >
+  >();
+}
@@ -0,0 +1,86 @@
+/* Boost.Flyweight test of deferred_refcounted.
+ *
+ * Copyright (C) 2026 agent <agent@local>.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/flyweight for library home page.
+ */
+
+#include "test_deferred_refcounted.hpp"
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <boost/flyweight/deferred_refcounted.hpp>
+#include <boost/flyweight/flyweight.hpp>
+#include <boost/flyweight/hashed_factory.hpp>
+#include <boost/flyweight/simple_locking.hpp>
+#include <boost/flyweight/static_holder.hpp>
+#include <cstddef>
+#include "test_basic_template.hpp"
+
+using namespace boost::flyweights;
+
+struct deferred_refcounted_flyweight_specifier
+{
+  template<typename T>
+  struct apply
+  {
+    typedef flyweight<T,deferred_refcounted> type;
+  };
+};
+
+/* instrumented value type: keeps track of the number of live copies */
+
+struct counted
+{
+  counted(int n_=0):n(n_){++count;}
+  counted(const counted& x):n(x.n){++count;}
+  ~counted(){--count;}
+
+  bool operator==(const counted& x)const{return n==x.n;}
+
+  int                n;
+  static std::size_t count;
+};
+
+std::size_t counted::count=0;
+
+std::size_t hash_value(const counted& x)
+{
+  return static_cast<std::size_t>(x.n);
+}
+
+void test_deferred_refcounted()
+{
+  test_basic_template<deferred_refcounted_flyweight_specifier>();
+
+  typedef flyweight<counted,deferred_refcounted,tag<int> > counted_flyweight;
+
+  std::size_t base=counted::count;
+  {
+    counted_flyweight fw((counted(0)));
+    BOOST_TEST(counted::count==base+1);
+  }
+  BOOST_TEST(counted::count==base+1); /* erasure is deferred */
+  {
+    counted_flyweight fw((counted(0))); /* reacquired */
+    BOOST_TEST(counted::count==base+1);
+  }
+  for(int i=1;i<1000;++i){
+    counted_flyweight fw((counted(i)));
+    BOOST_TEST(fw.get().n==i);
+  }
+  BOOST_TEST(counted::count<base+100); /* erased in batches */
+
+  counted_flyweight fw0((counted(0)));
+  {
+    counted_flyweight fw1((counted(0)));
+  }
+  for(int i=1;i<1000;++i){
+    counted_flyweight fw((counted(i)));
+  }
+  BOOST_TEST(fw0.get().n==0); /* still referenced, hence not erased */
+  counted_flyweight fw2((counted(0)));
+  BOOST_TEST(&fw0.get()==&fw2.get());
+}
@@ -14,6 +14,8 @@
 #endif
 
 #include <algorithm>
+#include <stdexcept>
+#include <vector>
 
 #include <boost/heap/d_ary_heap.hpp>
 
@@ -133,3 +135,140 @@ BOOST_AUTO_TEST_CASE( d_ary_heap_leak_test )
     typedef boost::heap::d_ary_heap<boost::shared_ptr<int>, boost::heap::arity<2> > pri_queue;
     run_leak_check_test<pri_queue>();
 }
+
+template <int D, bool stable>
+void run_d_ary_heap_cache_aligned_test(void)
+{
+    typedef boost::heap::d_ary_heap<int, boost::heap::arity<D>,
+                                         boost::heap::stable<stable>,
+                                         boost::heap::cache_aligned<true> > pri_queue;
+
+    BOOST_CONCEPT_ASSERT((boost::heap::PriorityQueue<pri_queue>));
+
+    run_concept_check<pri_queue>();
+    run_common_heap_tests<pri_queue>();
+    run_iterator_heap_tests<pri_queue>();
+    run_copyable_heap_tests<pri_queue>();
+    run_moveable_heap_tests<pri_queue>();
+    run_reserve_heap_tests<pri_queue>();
+    run_merge_tests<pri_queue>();
+
+    run_ordered_iterator_tests<pri_queue>();
+
+    typedef boost::heap::d_ary_heap<int, boost::heap::mutable_<true>,
+                                         boost::heap::arity<D>,
+                                         boost::heap::stable<stable>,
+                                         boost::heap::cache_aligned<true> > mutable_pri_queue;
+
+    BOOST_CONCEPT_ASSERT((boost::heap::MutablePriorityQueue<mutable_pri_queue>));
+
+    run_common_heap_tests<mutable_pri_queue>();
+    run_mutable_heap_tests<mutable_pri_queue>();
+}
+
+BOOST_AUTO_TEST_CASE( d_ary_heap_cache_aligned_test )
+{
+    run_d_ary_heap_cache_aligned_test<2, false>();
+    run_d_ary_heap_cache_aligned_test<4, false>();
+    run_d_ary_heap_cache_aligned_test<16, false>();
+    run_d_ary_heap_cache_aligned_test<4, true>();
+
+    // the children of the root start at a cache line boundary
+    boost::heap::d_ary_heap<int, boost::heap::arity<16>, boost::heap::cache_aligned<true> > q;
+    for (int i = 0; i != test_size; ++i) {
+        q.push(i);
+        BOOST_REQUIRE_EQUAL(reinterpret_cast<std::size_t>(&q.top() + 1) % 64, 0u);
+    }
+}
+
+template <int D, bool stable>
+void run_d_ary_heap_bulk_push_test(void)
+{
+    typedef boost::heap::d_ary_heap<int, boost::heap::arity<D>,
+                                         boost::heap::stable<stable> > pri_queue;
+
+    for (int i = 0; i != test_size; ++i) {
+        for (int j = 0; j != test_size; ++j) {
+            test_data data = make_test_data(i + j);
+            test_data shuffled (data);
+            std::random_shuffle(shuffled.begin(), shuffled.end());
+
+            pri_queue q;
+            fill_q(q, test_data(shuffled.begin(), shuffled.begin() + i));
+            q.push(shuffled.begin() + i, shuffled.end());
+
+            check_q(q, data);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( d_ary_heap_bulk_push_test )
+{
+    run_d_ary_heap_bulk_push_test<2, false>();
+    run_d_ary_heap_bulk_push_test<3, false>();
+    run_d_ary_heap_bulk_push_test<4, true>();
+}
+
+// copies of a throwing_int throw once copies_left reaches zero
+struct throwing_int
+{
+    static int copies_left;
+
+    explicit throwing_int(int v):
+        value(v)
+    {}
+
+    throwing_int(throwing_int const & rhs):
+        value(rhs.value)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("copy");
+    }
+
+    throwing_int & operator=(throwing_int const & rhs)
+    {
+        value = rhs.value;
+        return *this;
+    }
+
+    bool operator<(throwing_int const & rhs) const
+    {
+        return value < rhs.value;
+    }
+
+    int value;
+};
+
+int throwing_int::copies_left = -1;
+
+BOOST_AUTO_TEST_CASE( d_ary_heap_bulk_push_exception_test )
+{
+    typedef boost::heap::d_ary_heap<throwing_int, boost::heap::arity<4> > pri_queue;
+
+    for (int fail_at = 0; fail_at != 32; ++fail_at) {
+        std::vector<throwing_int> values;
+        for (int i = 0; i != 64; ++i)
+            values.push_back(throwing_int((i * 37) % 64));
+
+        pri_queue q;
+        q.reserve(128);
+        q.push(values.begin(), values.begin() + 16);
+
+        throwing_int::copies_left = fail_at;
+        BOOST_REQUIRE_THROW(q.push(values.begin() + 16, values.end()), std::runtime_error);
+        throwing_int::copies_left = -1;
+
+        // the heap holds the elements it held before the call, in order
+        std::vector<int> expected;
+        for (int i = 0; i != 16; ++i)
+            expected.push_back(values[i].value);
+        std::sort(expected.begin(), expected.end());
+
+        BOOST_REQUIRE_EQUAL(q.size(), expected.size());
+        while (!expected.empty()) {
+            BOOST_REQUIRE_EQUAL(q.top().value, expected.back());
+            q.pop();
+            expected.pop_back();
+        }
+    }
+}
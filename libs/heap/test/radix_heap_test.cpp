@@ -0,0 +1,147 @@
+/*=============================================================================
+    Copyright (C) 2026 agent <agent@local>
+
+    Use, modification and distribution is subject to the Boost Software
+    License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+    http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MAIN
+#ifdef BOOST_HEAP_INCLUDE_TESTS
+#include <boost/test/included/unit_test.hpp>
+#else
+#include <boost/test/unit_test.hpp>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include <boost/cstdint.hpp>
+#include <boost/heap/radix_heap.hpp>
+
+#include "common_heap_tests.hpp"
+#include "merge_heap_tests.hpp"
+
+/* the radix heap extracts the smallest keys first, so mapping the test data to decreasing keys gives the
+ * order of a max-heap, that is expected by the common tests */
+struct reversed_key
+{
+    typedef unsigned int result_type;
+
+    unsigned int operator()(int value) const
+    {
+        return 1024u - value;
+    }
+};
+
+BOOST_AUTO_TEST_CASE( radix_heap_test )
+{
+    typedef boost::heap::radix_heap<int, boost::heap::key_extractor<reversed_key> > pri_queue;
+
+    BOOST_CONCEPT_ASSERT((boost::heap::PriorityQueue<pri_queue>));
+
+    run_concept_check<pri_queue>();
+    run_common_heap_tests<pri_queue>();
+    run_iterator_heap_tests<pri_queue>();
+    run_copyable_heap_tests<pri_queue>();
+    run_moveable_heap_tests<pri_queue>();
+    run_merge_tests<pri_queue>();
+}
+
+template <typename Key>
+void run_radix_heap_monotone_test(void)
+{
+    typedef boost::heap::radix_heap<Key, boost::heap::allocator<std::allocator<Key> > > pri_queue;
+    typedef std::priority_queue<Key, std::vector<Key>, std::greater<Key> > reference_queue;
+
+    pri_queue q;
+    reference_queue r;
+
+    // interleave pushes of keys that are not smaller than the last extracted key with pops
+    Key last = (std::numeric_limits<Key>::max)() / 2;
+    for (int i = 0; i != 4096; ++i) {
+        const int pushes = std::rand() % 3;
+        for (int j = 0; j != pushes; ++j) {
+            const Key increment = Key(std::rand() % (1 << (i % 12)));
+            const Key k = last + (std::min)(increment, Key((std::numeric_limits<Key>::max)() - last));
+            q.push(k);
+            r.push(k);
+        }
+
+        BOOST_REQUIRE_EQUAL(q.size(), r.size());
+        if (!r.empty()) {
+            BOOST_REQUIRE_EQUAL(q.top(), r.top());
+            last = q.top();
+            q.pop();
+            r.pop();
+        }
+    }
+
+    while (!r.empty()) {
+        BOOST_REQUIRE_EQUAL(q.top(), r.top());
+        q.pop();
+        r.pop();
+    }
+    BOOST_REQUIRE(q.empty());
+
+    // an empty heap accepts smaller keys
+    q.push(1);
+    q.push(0);
+    BOOST_REQUIRE_EQUAL(q.top(), Key(0));
+}
+
+BOOST_AUTO_TEST_CASE( radix_heap_monotone_test )
+{
+    run_radix_heap_monotone_test<unsigned char>();
+    run_radix_heap_monotone_test<unsigned short>();
+    run_radix_heap_monotone_test<unsigned int>();
+    run_radix_heap_monotone_test<boost::uint64_t>();
+}
+
+typedef std::pair<unsigned int, int> distance_vertex;
+
+struct distance_of
+{
+    typedef unsigned int result_type;
+
+    unsigned int operator()(distance_vertex const & value) const
+    {
+        return value.first;
+    }
+};
+
+BOOST_AUTO_TEST_CASE( radix_heap_key_extractor_test )
+{
+    // shortest paths on a ring, where each vertex is connected to its successor and the one after it
+    const int vertices = 64;
+    std::vector<unsigned int> distances(vertices, ~0u);
+
+    boost::heap::radix_heap<distance_vertex, boost::heap::key_extractor<distance_of> > q;
+    q.push(distance_vertex(0, 0));
+    distances[0] = 0;
+
+    while (!q.empty()) {
+        const distance_vertex top = q.top();
+        q.pop();
+        if (top.first != distances[top.second])
+            continue;
+
+        const int v1 = (top.second + 1) % vertices;
+        const int v2 = (top.second + 2) % vertices;
+        if (top.first + 3 < distances[v1]) {
+            distances[v1] = top.first + 3;
+            q.push(distance_vertex(distances[v1], v1));
+        }
+        if (top.first + 5 < distances[v2]) {
+            distances[v2] = top.first + 5;
+            q.push(distance_vertex(distances[v2], v2));
+        }
+    }
+
+    for (int v = 0; v != vertices; ++v)
+        BOOST_REQUIRE_EQUAL(distances[v], (unsigned int)(v / 2 * 5 + v % 2 * 3));
+}
@@ -258,6 +258,92 @@ struct run_equivalence
 DEFINE_BENCHMARKS_SELECTOR(equivalence)
 
 
+template <typename pri_queue>
+struct run_monotone_push_pop
+{
+    run_monotone_push_pop(int size):
+        size(size)
+    {}
+
+    void prepare(int index)
+    {
+        test_data const & data = get_data(index);
+
+        q.clear();
+        for (int i = 0; i != size + 1; ++i)
+            q.push(data[i]);
+    }
+
+    // pushed keys are not smaller than the popped ones, like in dijkstra's algorithm or timer queues
+    no_inline void operator()(int index)
+    {
+        test_data const & data = get_data(index);
+
+        for (int i = 0; i != 16; ++i) {
+            typename pri_queue::value_type top = q.top();
+            q.pop();
+            q.push(top + data[(1<<max_data) + i]);
+        }
+    }
+
+    pri_queue q;
+    int size;
+};
+
+DEFINE_BENCHMARKS_SELECTOR(monotone_push_pop)
+
+template <typename pri_queue>
+struct run_range_push
+{
+    run_range_push(int size):
+        size(size)
+    {}
+
+    void prepare(int index)
+    {
+        q.clear();
+    }
+
+    no_inline void operator()(int index)
+    {
+        test_data const & data = get_data(index);
+
+        for (int i = 0; i != size; ++i)
+            q.push(data[(1<<max_data) + i]);
+    }
+
+    pri_queue q;
+    int size;
+};
+
+DEFINE_BENCHMARKS_SELECTOR(range_push)
+
+template <typename pri_queue>
+struct run_bulk_push
+{
+    run_bulk_push(int size):
+        size(size)
+    {}
+
+    void prepare(int index)
+    {
+        q.clear();
+    }
+
+    no_inline void operator()(int index)
+    {
+        test_data const & data = get_data(index);
+
+        q.push(data.begin() + (1<<max_data), data.begin() + (1<<max_data) + size);
+    }
+
+    pri_queue q;
+    int size;
+};
+
+DEFINE_BENCHMARKS_SELECTOR(bulk_push)
+
+
 template <typename benchmark>
 inline double run_benchmark(benchmark & b)
 {
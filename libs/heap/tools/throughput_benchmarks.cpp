@@ -15,11 +15,36 @@
 #include "../../../boost/heap/fibonacci_heap.hpp"
 #include "../../../boost/heap/binomial_heap.hpp"
 #include "../../../boost/heap/skew_heap.hpp"
+#include "../../../boost/heap/priority_queue.hpp"
+#include "../../../boost/heap/radix_heap.hpp"
 
 #include "heap_benchmarks.hpp"
 
 using namespace std;
 
+template <typename benchmark_selector, typename pri_queue>
+void run_benchmark_column(int size)
+{
+    typedef typename benchmark_selector::template rebind<pri_queue>::type benchmark_functor;
+    benchmark_functor benchmark(size);
+    double result = run_benchmark(benchmark);
+    cout << result << '\t';
+}
+
+inline int benchmark_size(int i, int j)
+{
+    int size = 1<<i;
+    if (j%4 == 1)
+        size += 1<<(i-3);
+    if (j%4 == 2)
+        size += 1<<(i-2);
+    if (j%4 == 3)
+        size += (1<<(i-3)) + (1<<(i-2));
+    if (j >= 4)
+        size += (1<<(i-1));
+    return size;
+}
+
 template <typename benchmark_selector>
 void run_benchmarks_immutable(void)
 {
@@ -90,6 +115,15 @@ void run_benchmarks_immutable(void)
                 cout << result << '\t';
             }
 
+            {
+                typedef typename benchmark_selector::
+                    template rebind<boost::heap::d_ary_heap<long, boost::heap::arity<8>, boost::heap::cache_aligned<true> > >
+                    ::type benchmark_functor;
+                benchmark_functor benchmark(size);
+                double result = run_benchmark(benchmark);
+                cout << result << '\t';
+            }
+
             {
                 typedef typename benchmark_selector::
                     template rebind<boost::heap::binomial_heap<long> >
@@ -128,7 +162,7 @@ void run_benchmarks_immutable(void)
 
             {
                 typedef typename benchmark_selector::
-                    template rebind<boost::heap::skew_heap<long> >
+                    template rebind<boost::heap::priority_queue<long> >
                     ::type benchmark_functor;
                 benchmark_functor benchmark(size);
                 double result = run_benchmark(benchmark);
@@ -224,6 +258,53 @@ void run_benchmarks_mutable(void)
     }
 }
 
+/* all heaps as min-heaps of unsigned keys, so that they can be compared with the radix heap */
+template <typename benchmark_selector>
+void run_benchmarks_monotone(void)
+{
+    typedef boost::heap::compare<std::greater<unsigned int> > min_heap;
+
+    for (int i = 4; i != max_data; ++i) {
+        for (int j = 0; j != 8; ++j) {
+            int size = benchmark_size(i, j);
+
+            cout << size << "\t";
+            run_benchmark_column<benchmark_selector, boost::heap::d_ary_heap<unsigned int, boost::heap::arity<2>, min_heap> >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::d_ary_heap<unsigned int, boost::heap::arity<4>, min_heap> >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::d_ary_heap<unsigned int, boost::heap::arity<8>, min_heap> >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::d_ary_heap<unsigned int, boost::heap::arity<16>, min_heap,
+                                                                             boost::heap::cache_aligned<true> > >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::binomial_heap<unsigned int, min_heap> >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::fibonacci_heap<unsigned int, min_heap> >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::pairing_heap<unsigned int, min_heap> >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::skew_heap<unsigned int, min_heap> >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::priority_queue<unsigned int, min_heap> >(size);
+            run_benchmark_column<benchmark_selector, boost::heap::radix_heap<unsigned int> >(size);
+            cout << endl;
+        }
+    }
+}
+
+/* filling an empty heap with bulk push compared to pushing the elements one by one */
+void run_benchmarks_bulk_push(void)
+{
+    for (int i = 4; i != max_data; ++i) {
+        for (int j = 0; j != 8; ++j) {
+            int size = benchmark_size(i, j);
+
+            cout << size << "\t";
+            run_benchmark_column<make_range_push, boost::heap::d_ary_heap<long, boost::heap::arity<2> > >(size);
+            run_benchmark_column<make_bulk_push,  boost::heap::d_ary_heap<long, boost::heap::arity<2> > >(size);
+            run_benchmark_column<make_range_push, boost::heap::d_ary_heap<long, boost::heap::arity<4> > >(size);
+            run_benchmark_column<make_bulk_push,  boost::heap::d_ary_heap<long, boost::heap::arity<4> > >(size);
+            run_benchmark_column<make_range_push, boost::heap::d_ary_heap<long, boost::heap::arity<8>, boost::heap::cache_aligned<true> > >(size);
+            run_benchmark_column<make_bulk_push,  boost::heap::d_ary_heap<long, boost::heap::arity<8>, boost::heap::cache_aligned<true> > >(size);
+            run_benchmark_column<make_range_push, boost::heap::priority_queue<long> >(size);
+            cout << endl;
+        }
+    }
+}
+
 int main()
 {
     cout << fixed << setprecision(12);
@@ -245,4 +326,10 @@ int main()
 
     cout << endl << "equivalence" << endl;
     run_benchmarks_immutable<make_equivalence>();
+
+    cout << endl << "monotone push pop" << endl;
+    run_benchmarks_monotone<make_monotone_push_pop>();
+
+    cout << endl << "bulk push" << endl;
+    run_benchmarks_bulk_push();
 }
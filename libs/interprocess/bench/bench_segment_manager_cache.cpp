@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/segment_manager_cache.hpp>
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "../test/get_process_id_name.hpp"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Several threads allocate and deallocate small blocks from the same
+// managed segment, either directly through the segment manager (each call
+// takes the lock of the memory algorithm, shared by every process and thread
+// using the segment) or through a per-thread segment_manager_cache.
+// Threads contend for the lock of the memory algorithm exactly as
+// processes mapping the same segment would.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+using namespace boost::interprocess;
+
+typedef managed_shared_memory::segment_manager  segment_manager_t;
+typedef segment_manager_cache<segment_manager_t> cache_t;
+
+#ifdef NDEBUG
+static const int NumIterations = 1000000;
+#else
+static const int NumIterations = 50000;
+#endif
+
+static const int LiveBlocks = 64;
+static const int MaxThreads = 8;
+
+static segment_manager_t *global_segment_mngr = 0;
+
+//Allocates and deallocates blocks keeping up to LiveBlocks alive
+template<class Allocator>
+void alloc_dealloc_loop(Allocator &a)
+{
+   void *blocks[LiveBlocks] = {};
+   unsigned n = 0;
+   for(int i = 0; i < NumIterations; ++i){
+      n = n*1103515245u + 12345u;
+      void *&slot = blocks[(n >> 8) % LiveBlocks];
+      if(slot){
+         a.deallocate(slot);
+      }
+      slot = a.allocate((n >> 16) % 256);
+   }
+   for(int i = 0; i < LiveBlocks; ++i){
+      a.deallocate(blocks[i]);
+   }
+}
+
+void direct_thread()
+{
+   alloc_dealloc_loop(*global_segment_mngr);
+}
+
+void cached_thread()
+{
+   cache_t cache(global_segment_mngr);
+   alloc_dealloc_loop(cache);
+}
+
+double measure(void (*thread_function)(), int num_threads)
+{
+   std::vector<ipcdetail::OS_thread_t> threads(num_threads);
+   boost::posix_time::ptime start = microsec_clock::universal_time();
+   for(int i = 0; i < num_threads; ++i){
+      ipcdetail::thread_launch(threads[i], thread_function);
+   }
+   for(int i = 0; i < num_threads; ++i){
+      ipcdetail::thread_join(threads[i]);
+   }
+   boost::posix_time::time_duration elapsed = microsec_clock::universal_time() - start;
+   //Nanoseconds per operation
+   return double(elapsed.total_microseconds())*1000.0/(double(NumIterations)*num_threads);
+}
+
+int main()
+{
+   const char *const shMemName = test::get_process_id_name();
+   shared_memory_object::remove(shMemName);
+   int ret = 0;
+   {
+      managed_shared_memory shm(create_only, shMemName, 64*1024*1024);
+      global_segment_mngr = shm.get_segment_manager();
+
+      std::cout << "threads  segment_manager (ns/op)  segment_manager_cache (ns/op)\n";
+      for(int num_threads = 1; num_threads <= MaxThreads; num_threads *= 2){
+         const double direct = measure(&direct_thread, num_threads);
+         const double cached = measure(&cached_thread, num_threads);
+         std::cout << num_threads << "        " << direct << "                   " << cached << std::endl;
+      }
+      if(!shm.all_memory_deallocated() || !shm.check_sanity()){
+         ret = 1;
+      }
+   }
+   shared_memory_object::remove(shMemName);
+   return ret;
+}
+
+#include <boost/interprocess/detail/config_end.hpp>
@@ -21,6 +21,11 @@
 #include <boost/interprocess/sync/spin/mutex.hpp>
 #endif
 
+#if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+#include <boost/interprocess/sync/futex/condition.hpp>
+#include <boost/interprocess/sync/futex/mutex.hpp>
+#endif
+
 using namespace boost::interprocess;
 
 int main ()
@@ -31,6 +36,10 @@ int main ()
       if(!test::do_test_condition<ipcdetail::spin_condition, ipcdetail::spin_mutex>())
          return 1;
    #endif
+   #if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+      if(!test::do_test_condition<ipcdetail::futex_condition, ipcdetail::futex_mutex>())
+         return 1;
+   #endif
    if(!test::do_test_condition<interprocess_condition, interprocess_mutex>())
       return 1;
 
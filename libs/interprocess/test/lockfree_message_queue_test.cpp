@@ -0,0 +1,249 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/ipc/lockfree_message_queue.hpp>
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <vector>
+#include <iostream>
+#include <cstddef>
+#include <cstring>
+#include "get_process_id_name.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//  This example tests the lock-free process shared message queues.           //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+using namespace boost::interprocess;
+
+//This test checks that messages are received in fifo order, that the capacity
+//is rounded to a power of two and that non-blocking and timed operations fail
+//on a full and on an empty queue
+template<class MessageQueue>
+bool test_fifo_order()
+{
+   MessageQueue::remove(test::get_process_id_name());
+   {
+      MessageQueue mq1
+         (open_or_create, test::get_process_id_name(), 100, sizeof(std::size_t)),
+         mq2
+         (open_or_create, test::get_process_id_name(), 100, sizeof(std::size_t));
+
+      if(mq1.get_max_msg() != 128 || mq2.get_max_msg_size() != sizeof(std::size_t)){
+         return false;
+      }
+
+      typename MessageQueue::size_type recvd = 0;
+      std::size_t tstamp;
+
+      //Several laps over the ring
+      for(std::size_t lap = 0; lap < 3; ++lap){
+         for(std::size_t i = 0; i < mq1.get_max_msg(); ++i){
+            tstamp = lap*1000 + i;
+            mq1.send(&tstamp, sizeof(tstamp));
+         }
+
+         if(mq2.get_num_msg() != mq1.get_max_msg()){
+            return false;
+         }
+
+         //The queue is full
+         if(mq1.try_send(&tstamp, sizeof(tstamp))){
+            return false;
+         }
+         if(mq1.timed_send(&tstamp, sizeof(tstamp),
+               microsec_clock::universal_time() + boost::posix_time::milliseconds(10))){
+            return false;
+         }
+
+         for(std::size_t i = 0; i < mq1.get_max_msg(); ++i){
+            mq2.receive(&tstamp, sizeof(tstamp), recvd);
+            if(recvd != sizeof(tstamp) || tstamp != lap*1000 + i){
+               return false;
+            }
+         }
+
+         //The queue is empty
+         if(mq2.get_num_msg() != 0 || mq2.try_receive(&tstamp, sizeof(tstamp), recvd)){
+            return false;
+         }
+         if(mq2.timed_receive(&tstamp, sizeof(tstamp), recvd,
+               microsec_clock::universal_time() + boost::posix_time::milliseconds(10))){
+            return false;
+         }
+      }
+
+      //Messages shorter than the maximum size keep their size
+      char small = 'a';
+      mq1.send(&small, 0);
+      mq1.send(&small, 1);
+      mq2.receive(&tstamp, sizeof(tstamp), recvd);
+      if(recvd != 0){
+         return false;
+      }
+      mq2.receive(&tstamp, sizeof(tstamp), recvd);
+      if(recvd != 1 || *reinterpret_cast<char*>(&tstamp) != 'a'){
+         return false;
+      }
+
+      //Size errors
+      char big[2*sizeof(std::size_t)];
+      try{
+         mq1.send(big, sizeof(big));
+         return false;
+      }
+      catch(interprocess_exception &e){
+         if(e.get_error_code() != size_error){
+            return false;
+         }
+      }
+      try{
+         mq2.try_receive(big, 1, recvd);
+         return false;
+      }
+      catch(interprocess_exception &e){
+         if(e.get_error_code() != size_error){
+            return false;
+         }
+      }
+   }
+   MessageQueue::remove(test::get_process_id_name());
+   return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// The single producer/consumer test sends a sequence through a small
+// queue so that both the sender and the receiver block often
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t SPSC_NUM_MSG = 100000;
+static spsc_message_queue *spsc_queue = 0;
+static bool spsc_ok = true;
+
+static void spsc_receiver()
+{
+   std::size_t expected = 0, msg;
+   spsc_message_queue::size_type recvd_size;
+   while(expected != SPSC_NUM_MSG){
+      spsc_queue->receive(&msg, sizeof(msg), recvd_size);
+      if(recvd_size != sizeof(msg) || msg != expected){
+         spsc_ok = false;
+      }
+      ++expected;
+   }
+}
+
+bool test_spsc_threads()
+{
+   spsc_message_queue::remove(test::get_process_id_name());
+   {
+      spsc_message_queue mq(create_only, test::get_process_id_name(), 4, sizeof(std::size_t));
+      spsc_queue = &mq;
+
+      ipcdetail::OS_thread_t thread;
+      ipcdetail::thread_launch(thread, &spsc_receiver);
+
+      for(std::size_t i = 0; i != SPSC_NUM_MSG; ++i){
+         mq.send(&i, sizeof(i));
+      }
+      ipcdetail::thread_join(thread);
+      if(mq.get_num_msg() != 0){
+         return false;
+      }
+   }
+   spsc_message_queue::remove(test::get_process_id_name());
+   return spsc_ok;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// The multi producer/consumer test launches several senders and receivers.
+// Each receiver adds the received values and stops when it receives
+// an empty message, so the total must match what was sent.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+static mpmc_message_queue *mpmc_queue = 0;
+static const int MULTI_NUM_MSG_PER_SENDER = 10000;
+static const int MULTI_THREAD_COUNT = 4;
+static volatile boost::uint32_t mpmc_sum = 0;
+
+static void mpmc_send()
+{
+   for (boost::uint32_t i = 1; i <= (boost::uint32_t)MULTI_NUM_MSG_PER_SENDER; i++) {
+      mpmc_queue->send(&i, sizeof(i));
+   }
+   const boost::uint32_t end = 0;
+   mpmc_queue->send(&end, 0);
+}
+
+static void mpmc_receive()
+{
+   boost::uint32_t msg, sum = 0;
+   mpmc_message_queue::size_type size;
+   while(1){
+      mpmc_queue->receive(&msg, sizeof(msg), size);
+      if(!size)
+         break;
+      sum += msg;
+   }
+   ipcdetail::atomic_add32(&mpmc_sum, sum);
+}
+
+bool test_mpmc_threads()
+{
+   mpmc_message_queue::remove(test::get_process_id_name());
+   {
+      mpmc_message_queue mq
+         (open_or_create, test::get_process_id_name(), 8, sizeof(boost::uint32_t));
+      mpmc_queue = &mq;
+      std::vector<ipcdetail::OS_thread_t> threads(MULTI_THREAD_COUNT*2);
+
+      for (int i = 0; i < MULTI_THREAD_COUNT; i++) {
+         ipcdetail::thread_launch(threads[i], &mpmc_send);
+         ipcdetail::thread_launch(threads[MULTI_THREAD_COUNT+i], &mpmc_receive);
+      }
+      for (int i = 0; i < MULTI_THREAD_COUNT*2; i++) {
+         ipcdetail::thread_join(threads[i]);
+      }
+   }
+   mpmc_message_queue::remove(test::get_process_id_name());
+   const boost::uint32_t per_sender =
+      boost::uint32_t(MULTI_NUM_MSG_PER_SENDER)*(MULTI_NUM_MSG_PER_SENDER + 1)/2;
+   return mpmc_sum == per_sender*MULTI_THREAD_COUNT;
+}
+
+int main ()
+{
+   if(!test_fifo_order<spsc_message_queue>()){
+      return 1;
+   }
+
+   if(!test_fifo_order<mpmc_message_queue>()){
+      return 1;
+   }
+
+   if(!test_spsc_threads()){
+      return 1;
+   }
+
+   if(!test_mpmc_threads()){
+      return 1;
+   }
+
+   return 0;
+}
+
+#include <boost/interprocess/detail/config_end.hpp>
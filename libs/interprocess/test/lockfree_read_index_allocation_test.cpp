@@ -0,0 +1,163 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/indexes/lockfree_read_index.hpp>
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+#include "named_allocation_test_template.hpp"
+
+using namespace boost::interprocess;
+
+typedef basic_managed_shared_memory
+   <char
+   ,rbtree_best_fit<mutex_family>
+   ,lockfree_read_index
+   > lockfree_managed_shared_memory;
+
+//Several threads search permanent objects while other threads construct
+//and destroy temporary objects, growing and shrinking the index.
+static lockfree_managed_shared_memory *global_segment = 0;
+static const int NumPermanent = 50;
+static const int NumThreads = 4;
+static const int NumIterations = 20000;
+static volatile bool thread_error = false;
+
+static void make_name(char *name, const char *prefix, int i)
+{
+   bufferstream formatter(name, 32);
+   formatter << prefix << i << std::ends;
+}
+
+static void finder_thread()
+{
+   char name[32];
+   for(int i = 0; i < NumIterations; ++i){
+      const int n = i % NumPermanent;
+      make_name(name, "permanent_", n);
+      std::pair<int*, std::size_t> r = global_segment->find<int>(name);
+      if(!r.first || *r.first != n || r.second != std::size_t(n + 1)){
+         thread_error = true;
+      }
+      make_name(name, "missing_", n);
+      if(global_segment->find<int>(name).first){
+         thread_error = true;
+      }
+   }
+}
+
+static volatile boost::uint32_t writer_count = 0;
+
+static void writer_thread()
+{
+   char name[32];
+   const int id = (int)ipcdetail::atomic_inc32(&writer_count);
+   for(int i = 0; i < NumIterations/10; ++i){
+      //Each writer constructs and destroys its own names
+      const int n = i % 100;
+      make_name(name, "temporary_", id*100 + n);
+      int *p = global_segment->construct<int>(name)[n+1](n);
+      std::pair<int*, std::size_t> r = global_segment->find<int>(name);
+      if(r.first != p || *r.first != n || r.second != std::size_t(n + 1)){
+         thread_error = true;
+      }
+      if(!global_segment->destroy<int>(name) || global_segment->find<int>(name).first){
+         thread_error = true;
+      }
+   }
+}
+
+bool test_concurrent_find()
+{
+   const char *const shMemName = test::get_process_id_name();
+   shared_memory_object::remove(shMemName);
+   {
+      lockfree_managed_shared_memory segment(create_only, shMemName, 1024*1024);
+      global_segment = &segment;
+      char name[32];
+      for(int i = 0; i < NumPermanent; ++i){
+         make_name(name, "permanent_", i);
+         segment.construct<int>(name)[i+1](i);
+      }
+
+      ipcdetail::OS_thread_t threads[NumThreads*2];
+      for(int i = 0; i < NumThreads; ++i){
+         ipcdetail::thread_launch(threads[i], &finder_thread);
+         ipcdetail::thread_launch(threads[NumThreads+i], &writer_thread);
+      }
+      for(int i = 0; i < NumThreads*2; ++i){
+         ipcdetail::thread_join(threads[i]);
+      }
+
+      for(int i = 0; i < NumPermanent; ++i){
+         make_name(name, "permanent_", i);
+         if(!segment.destroy<int>(name)){
+            thread_error = true;
+         }
+      }
+      segment.shrink_to_fit_indexes();
+      if(segment.get_num_named_objects() != 0 || !segment.all_memory_deallocated()){
+         thread_error = true;
+      }
+   }
+   shared_memory_object::remove(shMemName);
+   return !thread_error;
+}
+
+//A search must not block while other thread holds the lock of the segment
+static volatile bool found_while_locked = false;
+
+static void find_permanent_thread()
+{
+   found_while_locked = global_segment->find<int>("permanent").first != 0;
+}
+
+struct find_from_other_thread
+{
+   void operator()()
+   {
+      ipcdetail::OS_thread_t thread;
+      ipcdetail::thread_launch(thread, &find_permanent_thread);
+      ipcdetail::thread_join(thread);
+   }
+};
+
+bool test_find_while_locked()
+{
+   const char *const shMemName = test::get_process_id_name();
+   shared_memory_object::remove(shMemName);
+   {
+      lockfree_managed_shared_memory segment(create_only, shMemName, 65536);
+      global_segment = &segment;
+      segment.construct<int>("permanent")(0);
+      find_from_other_thread func;
+      segment.atomic_func(func);
+   }
+   shared_memory_object::remove(shMemName);
+   return found_while_locked;
+}
+
+int main ()
+{
+   if(!test::test_named_allocation<lockfree_read_index>()){
+      return 1;
+   }
+
+   if(!test_concurrent_find()){
+      return 1;
+   }
+
+   if(!test_find_while_locked()){
+      return 1;
+   }
+
+   return 0;
+}
+
+#include <boost/interprocess/detail/config_end.hpp>
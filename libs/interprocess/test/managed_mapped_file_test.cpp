@@ -96,6 +96,31 @@ int main ()
       if(!mfile_vect)
          return -1;
    }
+   {
+      //Map preexisting file again passing mapping options
+      #if defined(MAP_POPULATE)
+      managed_mapped_file mfile(open_only, FileName, 0, MAP_POPULATE);
+      #else
+      managed_mapped_file mfile(open_only, FileName, 0, default_map_options);
+      #endif
+
+      //Prefault the whole file and advise random access
+      if(!mfile.prefault())
+         return -1;
+      #if defined(POSIX_MADV_RANDOM) || defined(MADV_RANDOM)
+      if(!mfile.advise(mapped_region::advice_random))
+         return -1;
+      #endif
+
+      //Locking can fail if the process is not allowed to lock so much memory
+      if(mfile.lock() && !mfile.unlock())
+         return -1;
+
+      //Check vector is still there
+      MyVect *mfile_vect = mfile.find<MyVect>("MyVector").first;
+      if(!mfile_vect)
+         return -1;
+   }
 
    {
       {
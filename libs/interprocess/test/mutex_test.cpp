@@ -18,6 +18,10 @@
 #include <boost/interprocess/sync/spin/mutex.hpp>
 #endif
 
+#if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+#include <boost/interprocess/sync/futex/mutex.hpp>
+#endif
+
 int main ()
 {
    using namespace boost::interprocess;
@@ -29,6 +33,11 @@ int main ()
       test::test_all_mutex<ipcdetail::spin_mutex>();
    #endif
 
+   #if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+      test::test_all_lock<ipcdetail::futex_mutex>();
+      test::test_all_mutex<ipcdetail::futex_mutex>();
+   #endif
+
    test::test_all_lock<interprocess_mutex>();
    test::test_all_mutex<interprocess_mutex>();
    return 0;
@@ -0,0 +1,34 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+
+#if defined(BOOST_INTERPROCESS_LINUX_FUTEX)
+
+#include "robust_mutex_test.hpp"
+#include <boost/interprocess/sync/futex/mutex.hpp>
+
+int main(int argc, char *argv[])
+{
+   using namespace boost::interprocess;
+   return test::robust_mutex_test<ipcdetail::futex_mutex>(argc, argv);
+}
+
+#else
+
+int main()
+{
+   return 0;
+}
+
+#endif
+
+#include <boost/interprocess/detail/config_end.hpp>
@@ -51,9 +51,9 @@ int robust_mutex_test(int argc, char *argv[])
       //Construct managed shared memory
       managed_shared_memory segment(create_only, get_process_id_name(), 65536);
 
-      //Create two robust mutexes
+      //Create three robust mutexes
       RobustMutex *instance = segment.construct<RobustMutex>
-         ("robust mutex")[2]();
+         ("robust mutex")[3]();
 
       //Create a flag to notify that both mutexes are
       //locked and the owner is going to die soon.
@@ -0,0 +1,199 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (C) 2026 agent <agent@local>. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/segment_manager_cache.hpp>
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include "get_process_id_name.hpp"
+
+using namespace boost::interprocess;
+
+typedef managed_shared_memory::segment_manager  segment_manager_t;
+typedef segment_manager_cache<segment_manager_t> cache_t;
+
+//This test allocates blocks of all cached sizes and some bigger ones,
+//frees them through the cache and through the segment manager and
+//checks that the segment is intact when the cache is flushed
+bool test_allocate_deallocate(managed_shared_memory &shm)
+{
+   const managed_shared_memory::size_type free_memory = shm.get_free_memory();
+   {
+      cache_t cache(shm.get_segment_manager(), 8);
+      std::vector<void*> blocks;
+
+      for(int lap = 0; lap < 3; ++lap){
+         for(std::size_t size = 0; size <= 2*cache_t::NumSizeClasses*cache_t::Granularity; ++size){
+            void *ptr = cache.allocate(size);
+            if(shm.get_segment_manager()->size(ptr) < size){
+               return false;
+            }
+            std::memset(ptr, static_cast<int>(size), size);
+            blocks.push_back(ptr);
+         }
+         //Free half of them through the cache and the rest through the segment manager
+         for(std::size_t i = 0; i < blocks.size(); ++i){
+            if(i % 2){
+               cache.deallocate(blocks[i]);
+            }
+            else{
+               shm.deallocate(blocks[i]);
+            }
+         }
+         blocks.clear();
+         if(!shm.check_sanity()){
+            return false;
+         }
+      }
+
+      //Size classes never hold more than twice the batch
+      if(cache.get_num_cached_blocks() > 2*cache.get_batch_size()*cache_t::NumSizeClasses){
+         return false;
+      }
+
+      //Blocks allocated directly from the segment can go to the cache
+      void *ptr = shm.allocate(10);
+      cache.deallocate(ptr);
+      cache.deallocate(0);
+
+      cache.flush();
+      if(cache.get_num_cached_blocks() != 0){
+         return false;
+      }
+      if(shm.get_free_memory() != free_memory || !shm.all_memory_deallocated()){
+         return false;
+      }
+
+      //The destructor returns cached blocks
+      cache.deallocate(cache.allocate(20));
+   }
+   return shm.get_free_memory() == free_memory && shm.check_sanity();
+}
+
+//This test exhausts the segment through the cache
+bool test_exhaustion(managed_shared_memory &shm)
+{
+   const managed_shared_memory::size_type free_memory = shm.get_free_memory();
+   {
+      cache_t cache(shm.get_segment_manager());
+      std::vector<void*> blocks;
+      try{
+         while(1){
+            blocks.push_back(cache.allocate(100));
+         }
+      }
+      catch(boost::interprocess::bad_alloc &){}
+      if(blocks.empty() || cache.allocate(100, std::nothrow) != 0){
+         return false;
+      }
+      for(std::size_t i = 0; i < blocks.size(); ++i){
+         cache.deallocate(blocks[i]);
+      }
+   }
+   return shm.get_free_memory() == free_memory && shm.all_memory_deallocated();
+}
+
+//Several threads share a cache and use their own caches at the same time
+typedef segment_manager_cache<segment_manager_t, interprocess_mutex> shared_cache_t;
+
+static segment_manager_t *global_segment_mngr = 0;
+static shared_cache_t *global_shared_cache = 0;
+static const int NumThreads = 4;
+static const int NumIterations = 20000;
+static volatile bool thread_error = false;
+
+template<class Cache>
+void alloc_dealloc_loop(Cache &cache)
+{
+   void *blocks[16] = {};
+   unsigned n = 0;
+   for(int i = 0; i < NumIterations; ++i){
+      n = n*1103515245u + 12345u;
+      void *&slot = blocks[(n >> 8) % 16];
+      if(slot){
+         cache.deallocate(slot);
+         slot = 0;
+      }
+      else{
+         std::size_t size = (n >> 16) % 300;
+         slot = cache.allocate(size);
+         if(global_segment_mngr->size(slot) < size){
+            thread_error = true;
+         }
+      }
+   }
+   for(int i = 0; i < 16; ++i){
+      cache.deallocate(blocks[i]);
+   }
+}
+
+void own_cache_thread()
+{
+   cache_t cache(global_segment_mngr);
+   alloc_dealloc_loop(cache);
+}
+
+void shared_cache_thread()
+{
+   alloc_dealloc_loop(*global_shared_cache);
+}
+
+bool test_threads(managed_shared_memory &shm)
+{
+   const managed_shared_memory::size_type free_memory = shm.get_free_memory();
+   {
+      shared_cache_t shared_cache(shm.get_segment_manager());
+      global_segment_mngr = shm.get_segment_manager();
+      global_shared_cache = &shared_cache;
+
+      ipcdetail::OS_thread_t threads[NumThreads*2];
+      for(int i = 0; i < NumThreads; ++i){
+         ipcdetail::thread_launch(threads[i], &own_cache_thread);
+         ipcdetail::thread_launch(threads[NumThreads+i], &shared_cache_thread);
+      }
+      for(int i = 0; i < NumThreads*2; ++i){
+         ipcdetail::thread_join(threads[i]);
+      }
+   }
+   return !thread_error && shm.get_free_memory() == free_memory &&
+          shm.all_memory_deallocated() && shm.check_sanity();
+}
+
+int main ()
+{
+   const char *const shMemName = test::get_process_id_name();
+   shared_memory_object::remove(shMemName);
+   {
+      managed_shared_memory shm(create_only, shMemName, 4*1024*1024);
+
+      if(!test_allocate_deallocate(shm)){
+         shared_memory_object::remove(shMemName);
+         return 1;
+      }
+
+      if(!test_exhaustion(shm)){
+         shared_memory_object::remove(shMemName);
+         return 1;
+      }
+
+      if(!test_threads(shm)){
+         shared_memory_object::remove(shMemName);
+         return 1;
+      }
+   }
+   shared_memory_object::remove(shMemName);
+   return 0;
+}
+
+#include <boost/interprocess/detail/config_end.hpp>
@@ -175,6 +175,26 @@ int main ()
          }
          #endif
 
+         //Huge pages might not be supported by the system, just check it can be called
+         std::cout << "Advice 'huge page'" << std::endl;
+         region.advise(mapped_region::advice_hugepage);
+         region.advise(mapped_region::advice_nohugepage);
+
+         //Prefault
+         std::cout << "Prefault" << std::endl;
+         if(!region.prefault() || !region.prefault(1, 2) || region.prefault(region.get_size())){
+            return 1;
+         }
+
+         //Locking can fail if the process is not allowed to lock so much memory
+         std::cout << "Lock" << std::endl;
+         if(region.lock() && !region.unlock()){
+            return 1;
+         }
+         if(region.lock(region.get_size()) || region.unlock(region.get_size())){
+            return 1;
+         }
+
       }
       {
          //Check for busy address space
@@ -27,6 +27,7 @@
 #include <boost/range/iterator_range_core.hpp>
 #include <boost/move/core.hpp>
 #include <boost/move/utility.hpp>
+#include <boost/atomic/atomic.hpp>
 #include <boost/log/core/core.hpp>
 #include <boost/log/core/record.hpp>
 #include <boost/log/core/record_view.hpp>
@@ -242,6 +243,8 @@ public:
     volatile bool m_enabled;
     //! Global filter
     filter m_filter;
+    //! Filtering configuration version
+    boost::atomic< unsigned int > m_filter_version;
 
     //! Exception handler
     exception_handler_type m_exception_handler;
@@ -250,10 +253,17 @@ public:
     //! Constructor
     implementation() :
         m_default_sink(boost::make_shared< sinks::aux::default_sink >()),
-        m_enabled(true)
+        m_enabled(true),
+        m_filter_version(0u)
     {
     }
 
+    //! Changes the filtering configuration version. Must be called after the configuration is modified.
+    void invalidate_filter_caches() BOOST_NOEXCEPT
+    {
+        m_filter_version.fetch_add(1u, boost::memory_order_release);
+    }
+
     //! Invokes sink-specific filter and adds the sink to the record if the filter passes the log record
     void apply_sink_filter(shared_ptr< sinks::sink > const& sink, record& rec, attribute_value_set*& attr_values, uint32_t remaining_capacity)
     {
@@ -282,6 +292,8 @@ public:
             if (m_exception_handler.empty())
                 throw;
             m_exception_handler();
+            // The sink did not take the record because of the exception, this decision must not be cached
+            invalidate_filter_caches();
         }
     }
 
@@ -350,6 +362,8 @@ public:
                 throw;
 
             m_exception_handler();
+            // The record is rejected because of the exception, this decision must not be cached
+            invalidate_filter_caches();
         }
 
         return record();
@@ -429,6 +443,7 @@ BOOST_LOG_API bool core::set_logging_enabled(bool enabled)
     BOOST_LOG_EXPR_IF_MT(implementation::scoped_write_lock lock(m_impl->m_mutex);)
     const bool old_value = m_impl->m_enabled;
     m_impl->m_enabled = enabled;
+    m_impl->invalidate_filter_caches();
     return old_value;
 }
 
@@ -447,7 +462,10 @@ BOOST_LOG_API void core::add_sink(shared_ptr< sinks::sink > const& s)
     implementation::sink_list::iterator it =
         std::find(m_impl->m_sinks.begin(), m_impl->m_sinks.end(), s);
     if (it == m_impl->m_sinks.end())
+    {
         m_impl->m_sinks.push_back(s);
+        m_impl->invalidate_filter_caches();
+    }
 }
 
 //! The method removes the sink from the output
@@ -457,7 +475,10 @@ BOOST_LOG_API void core::remove_sink(shared_ptr< sinks::sink > const& s)
     implementation::sink_list::iterator it =
         std::find(m_impl->m_sinks.begin(), m_impl->m_sinks.end(), s);
     if (it != m_impl->m_sinks.end())
+    {
         m_impl->m_sinks.erase(it);
+        m_impl->invalidate_filter_caches();
+    }
 }
 
 //! The method removes all registered sinks from the output
@@ -465,6 +486,7 @@ BOOST_LOG_API void core::remove_all_sinks()
 {
     BOOST_LOG_EXPR_IF_MT(implementation::scoped_write_lock lock(m_impl->m_mutex);)
     m_impl->m_sinks.clear();
+    m_impl->invalidate_filter_caches();
 }
 
 
@@ -473,7 +495,9 @@ BOOST_LOG_API std::pair< attribute_set::iterator, bool >
 core::add_global_attribute(attribute_name const& name, attribute const& attr)
 {
     BOOST_LOG_EXPR_IF_MT(implementation::scoped_write_lock lock(m_impl->m_mutex);)
-    return m_impl->m_global_attributes.insert(name, attr);
+    std::pair< attribute_set::iterator, bool > res = m_impl->m_global_attributes.insert(name, attr);
+    m_impl->invalidate_filter_caches();
+    return res;
 }
 
 //! The method removes an attribute from the global attribute set
@@ -481,6 +505,7 @@ BOOST_LOG_API void core::remove_global_attribute(attribute_set::iterator it)
 {
     BOOST_LOG_EXPR_IF_MT(implementation::scoped_write_lock lock(m_impl->m_mutex);)
     m_impl->m_global_attributes.erase(it);
+    m_impl->invalidate_filter_caches();
 }
 
 //! The method returns the complete set of currently registered global attributes
@@ -495,6 +520,7 @@ BOOST_LOG_API void core::set_global_attributes(attribute_set const& attrs)
 {
     BOOST_LOG_EXPR_IF_MT(implementation::scoped_write_lock lock(m_impl->m_mutex);)
     m_impl->m_global_attributes = attrs;
+    m_impl->invalidate_filter_caches();
 }
 
 //! The method adds an attribute to the thread-specific attribute set
@@ -530,6 +556,7 @@ BOOST_LOG_API void core::set_filter(filter const& filter)
 {
     BOOST_LOG_EXPR_IF_MT(implementation::scoped_write_lock lock(m_impl->m_mutex);)
     m_impl->m_filter = filter;
+    m_impl->invalidate_filter_caches();
 }
 
 //! The method removes the global logging filter
@@ -537,6 +564,19 @@ BOOST_LOG_API void core::reset_filter()
 {
     BOOST_LOG_EXPR_IF_MT(implementation::scoped_write_lock lock(m_impl->m_mutex);)
     m_impl->m_filter.reset();
+    m_impl->invalidate_filter_caches();
+}
+
+//! The method returns the current version of the filtering configuration
+BOOST_LOG_API unsigned int core::get_filter_version() const
+{
+    return m_impl->m_filter_version.load(boost::memory_order_acquire);
+}
+
+//! The method invalidates filtering decisions cached by log sources
+BOOST_LOG_API void core::invalidate_filter_caches()
+{
+    m_impl->invalidate_filter_caches();
 }
 
 //! The method sets exception handler function
@@ -0,0 +1,323 @@
+/*
+ *          Copyright (C) 2026 agent <agent@local>.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   src_filter_cache.cpp
+ * \author agent
+ * \date   19.10.2026
+ *
+ * \brief  This header contains tests for the filtering decision cache logger feature.
+ */
+
+#define BOOST_TEST_MODULE src_filter_cache
+
+#include <cstddef>
+#include <string>
+#include <stdexcept>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/log/core/core.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/sources/basic_logger.hpp>
+#include <boost/log/sources/features.hpp>
+#include <boost/log/sources/threading_models.hpp>
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/log/detail/light_rw_mutex.hpp>
+#endif // !defined(BOOST_LOG_NO_THREADS)
+#include <boost/log/sources/severity_feature.hpp>
+#include <boost/log/sources/channel_feature.hpp>
+#include <boost/log/sources/filter_cache_feature.hpp>
+#include <boost/log/sources/exception_handler_feature.hpp>
+#include <boost/log/utility/exception_handler.hpp>
+#include <boost/log/keywords/channel.hpp>
+#include <boost/log/keywords/severity.hpp>
+#include "test_sink.hpp"
+
+namespace logging = boost::log;
+namespace attrs = logging::attributes;
+namespace src = logging::sources;
+namespace keywords = logging::keywords;
+
+namespace {
+
+//! Filter that counts its invocations and passes records with the severity level not less than the threshold
+struct counting_filter
+{
+    typedef bool result_type;
+
+    std::size_t* m_pCounter;
+    int m_Threshold;
+
+    counting_filter(std::size_t& counter, int threshold) : m_pCounter(&counter), m_Threshold(threshold) {}
+
+    result_type operator() (logging::attribute_value_set const& values) const
+    {
+        ++*m_pCounter;
+        return logging::extract_or_default< int >("Severity", values, 0) >= m_Threshold;
+    }
+};
+
+//! Logger with severity level and filter cache
+class cached_logger :
+    public src::basic_composite_logger<
+        char,
+        cached_logger,
+        src::single_thread_model,
+        src::features<
+            src::severity< int >,
+            src::filter_cache< 8 >
+        >
+    >
+{
+    BOOST_LOG_FORWARD_LOGGER_MEMBERS(cached_logger)
+};
+
+//! Filter that throws while the flag is set, otherwise behaves like counting_filter
+struct throwing_filter :
+    public counting_filter
+{
+    bool* m_pThrow;
+
+    throwing_filter(std::size_t& counter, int threshold, bool& throw_flag) : counting_filter(counter, threshold), m_pThrow(&throw_flag) {}
+
+    result_type operator() (logging::attribute_value_set const& values) const
+    {
+        result_type res = counting_filter::operator() (values);
+        if (*m_pThrow)
+            throw std::runtime_error("filter failure");
+        return res;
+    }
+};
+
+//! Logger with severity level, exception handler and filter cache
+class cached_handler_logger :
+    public src::basic_composite_logger<
+        char,
+        cached_handler_logger,
+        src::single_thread_model,
+        src::features<
+            src::severity< int >,
+            src::exception_handler,
+            src::filter_cache< 8 >
+        >
+    >
+{
+    BOOST_LOG_FORWARD_LOGGER_MEMBERS(cached_handler_logger)
+};
+
+//! Logger with severity level, channel and filter cache
+class cached_channel_logger :
+    public src::basic_composite_logger<
+        char,
+        cached_channel_logger,
+        src::single_thread_model,
+        src::features<
+            src::severity< int >,
+            src::channel< std::string >,
+            src::filter_cache< 8 >
+        >
+    >
+{
+    BOOST_LOG_FORWARD_LOGGER_MEMBERS(cached_channel_logger)
+};
+
+#if !defined(BOOST_LOG_NO_THREADS)
+
+//! Thread-safe logger with severity level and filter cache
+class cached_logger_mt :
+    public src::basic_composite_logger<
+        char,
+        cached_logger_mt,
+        src::multi_thread_model< logging::aux::light_rw_mutex >,
+        src::features<
+            src::severity< int >,
+            src::filter_cache< >
+        >
+    >
+{
+    BOOST_LOG_FORWARD_LOGGER_MEMBERS(cached_logger_mt)
+};
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
+//! The function tries to open a record and returns true if it succeeds
+template< typename LoggerT >
+bool try_open(LoggerT& lg, int level)
+{
+    logging::record rec = lg.open_record(keywords::severity = level);
+    return !!rec;
+}
+
+} // namespace
+
+// The test checks that rejected records are cached and the cache is invalidated on configuration changes
+BOOST_AUTO_TEST_CASE(rejection_caching)
+{
+    boost::shared_ptr< logging::core > pCore = logging::core::get();
+    boost::shared_ptr< test_sink > pSink(new test_sink());
+    pCore->add_sink(pSink);
+
+    std::size_t counter = 0;
+    pCore->set_filter(counting_filter(counter, 3));
+
+    cached_logger lg;
+
+    // The first rejected record is filtered as usual
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 1UL);
+
+    // The subsequent records with the same level are rejected without filtering
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 1UL);
+
+    // Other levels are filtered separately
+    BOOST_CHECK(!try_open(lg, 2));
+    BOOST_CHECK_EQUAL(counter, 2UL);
+    BOOST_CHECK(try_open(lg, 5));
+    BOOST_CHECK(try_open(lg, 5));
+    BOOST_CHECK_EQUAL(counter, 4UL);
+
+    // Levels outside the cache are always filtered
+    BOOST_CHECK(!try_open(lg, -1));
+    BOOST_CHECK(!try_open(lg, -1));
+    BOOST_CHECK_EQUAL(counter, 6UL);
+
+    // Changing the global filter invalidates the cache
+    counter = 0;
+    pCore->set_filter(counting_filter(counter, 1));
+    BOOST_CHECK(try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 1UL);
+
+    // Explicit invalidation
+    pCore->set_filter(counting_filter(counter, 3));
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 2UL);
+    pCore->invalidate_filter_caches();
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 3UL);
+
+    // Modifying logger attributes invalidates the cache
+    lg.add_attribute("Tag", attrs::constant< int >(10));
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 4UL);
+
+    // Copies of the logger start with an empty cache
+    cached_logger lg2(lg);
+    BOOST_CHECK(!try_open(lg2, 1));
+    BOOST_CHECK_EQUAL(counter, 5UL);
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 5UL);
+
+    pCore->reset_filter();
+    pCore->remove_sink(pSink);
+}
+
+#if !defined(BOOST_LOG_NO_THREADS)
+
+// The test checks that the thread-safe loggers use the cache
+BOOST_AUTO_TEST_CASE(rejection_caching_mt)
+{
+    boost::shared_ptr< logging::core > pCore = logging::core::get();
+    boost::shared_ptr< test_sink > pSink(new test_sink());
+    pCore->add_sink(pSink);
+
+    std::size_t counter = 0;
+    pCore->set_filter(counting_filter(counter, 3));
+
+    cached_logger_mt lg;
+
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 1UL);
+    BOOST_CHECK(try_open(lg, 4));
+    BOOST_CHECK_EQUAL(counter, 2UL);
+
+    pCore->set_logging_enabled(false);
+    pCore->set_logging_enabled(true);
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 3UL);
+
+    pCore->reset_filter();
+    pCore->remove_sink(pSink);
+}
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
+// The test checks that records rejected because of suppressed exceptions are not cached
+BOOST_AUTO_TEST_CASE(suppressed_exceptions)
+{
+    boost::shared_ptr< logging::core > pCore = logging::core::get();
+    boost::shared_ptr< test_sink > pSink(new test_sink());
+    pCore->add_sink(pSink);
+
+    std::size_t counter = 0;
+    bool throw_flag = true;
+    pCore->set_filter(throwing_filter(counter, 3, throw_flag));
+
+    // The exception is suppressed by the core
+    pCore->set_exception_handler(logging::make_exception_suppressor());
+    cached_logger lg;
+    BOOST_CHECK(!try_open(lg, 5));
+    BOOST_CHECK(!try_open(lg, 5));
+    BOOST_CHECK_EQUAL(counter, 2UL);
+    throw_flag = false;
+    BOOST_CHECK(try_open(lg, 5));
+    BOOST_CHECK_EQUAL(counter, 3UL);
+    pCore->set_exception_handler(logging::core::exception_handler_type());
+
+    // The exception is suppressed by the logger
+    throw_flag = true;
+    cached_handler_logger lg2;
+    lg2.set_exception_handler(logging::make_exception_suppressor());
+    BOOST_CHECK(!try_open(lg2, 5));
+    BOOST_CHECK(!try_open(lg2, 5));
+    BOOST_CHECK_EQUAL(counter, 5UL);
+    throw_flag = false;
+    BOOST_CHECK(try_open(lg2, 5));
+    BOOST_CHECK_EQUAL(counter, 6UL);
+
+    pCore->reset_filter();
+    pCore->remove_sink(pSink);
+}
+
+// The test checks that channel changes invalidate the cache
+BOOST_AUTO_TEST_CASE(channel_change)
+{
+    boost::shared_ptr< logging::core > pCore = logging::core::get();
+    boost::shared_ptr< test_sink > pSink(new test_sink());
+    pCore->add_sink(pSink);
+
+    std::size_t counter = 0;
+    pCore->set_filter(counting_filter(counter, 3));
+
+    cached_channel_logger lg(keywords::channel = "net");
+
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 1UL);
+
+    lg.channel("db");
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 2UL);
+
+    // Records that change the channel are never rejected from cache
+    {
+        logging::record rec = lg.open_record((keywords::severity = 1, keywords::channel = "io"));
+        BOOST_CHECK(!rec);
+    }
+    BOOST_CHECK_EQUAL(counter, 3UL);
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK(!try_open(lg, 1));
+    BOOST_CHECK_EQUAL(counter, 4UL);
+
+    pCore->reset_filter();
+    pCore->remove_sink(pSink);
+}
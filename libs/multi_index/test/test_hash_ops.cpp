@@ -32,31 +32,32 @@ void check_load_factor(const HashedContainer& hc)
   BOOST_TEST(lf<=hc.max_load_factor()+1.E-6);
 }
 
-typedef multi_index_container<
-  int,
-  indexed_by<
-    hashed_unique<identity<int> >
-  >
-> hash_container;
-
-void test_hash_ops()
+template<typename HashedIndexSpecifier>
+static void local_test_hash_ops()
 {
+  typedef multi_index_container<
+    int,
+    indexed_by<
+      HashedIndexSpecifier
+    >
+  > hash_container;
+
   hash_container hc;
 
   BOOST_TEST(hc.max_load_factor()==1.0f);
   BOOST_TEST(hc.bucket_count()<=hc.max_bucket_count());
 
   hc.insert(1000);
-  hash_container::size_type buc=hc.bucket(1000);
-  hash_container::local_iterator it0=hc.begin(buc);
-  hash_container::local_iterator it1=hc.end(buc);
+  typename hash_container::size_type buc=hc.bucket(1000);
+  typename hash_container::local_iterator it0=hc.begin(buc);
+  typename hash_container::local_iterator it1=hc.end(buc);
   BOOST_TEST(
-    (hash_container::size_type)std::distance(it0,it1)==hc.bucket_size(buc)&&
+    (typename hash_container::size_type)std::distance(it0,it1)==hc.bucket_size(buc)&&
     hc.bucket_size(buc)==1&&*it0==1000);
 
   hc.clear();
 
-  for(hash_container::size_type s=2*hc.bucket_count();s--;){
+  for(typename hash_container::size_type s=2*hc.bucket_count();s--;){
     hc.insert((int)s);
   }
   check_load_factor(hc);
@@ -75,7 +76,7 @@ void test_hash_ops()
   BOOST_TEST(hc.bucket_count()>=1);
   check_load_factor(hc);
 
-  hash_container::size_type bc=4*hc.bucket_count();
+  typename hash_container::size_type bc=4*hc.bucket_count();
   hc.max_load_factor(0.125f);
   hc.rehash(bc);
   BOOST_TEST(hc.bucket_count()>=bc);
@@ -103,7 +104,7 @@ void test_hash_ops()
   hc3.clear();
   hc3.max_load_factor(1.0f);
   hc3.reserve(1000);
-  hash_container::size_type bc3=hc3.bucket_count();
+  typename hash_container::size_type bc3=hc3.bucket_count();
   BOOST_TEST(bc3>=1000);
   std::vector<int> v;
   for(unsigned int n=0;n<bc3;++n)v.push_back(n);
@@ -113,6 +114,89 @@ void test_hash_ops()
   hc3.reserve(100);
   BOOST_TEST(hc3.bucket_count()>bc3);
   bc3=hc3.bucket_count();
-  hc3.reserve((hash_container::size_type)(3.0f*hc3.max_load_factor()*bc3));
+  hc3.reserve((typename hash_container::size_type)(3.0f*hc3.max_load_factor()*bc3));
   BOOST_TEST(hc3.bucket_count()>bc3);
 }
+
+/* Hash function mapping many keys to the same value, so that elements with
+ * equal hash codes but different keys share buckets.
+ */
+
+struct coarse_hash
+{
+  std::size_t operator()(int x)const{return boost::hash<int>()(x/4);}
+};
+
+struct assign_int
+{
+  assign_int(int n_):n(n_){}
+  void operator()(int& x)const{x=n;}
+  int n;
+};
+
+template<typename HashedNonUniqueIndexSpecifier,typename HashedIndexSpecifier>
+static void local_test_hash_consistency()
+{
+  typedef multi_index_container<
+    int,
+    indexed_by<
+      HashedNonUniqueIndexSpecifier,
+      HashedIndexSpecifier
+    >
+  > multi_hash_container;
+  typedef typename nth_index<
+    multi_hash_container,1>::type                 hash_container;
+  typedef typename nth_index<
+    multi_hash_container,0>::type                 non_unique_index;
+
+  std::vector<int> v;
+  for(int i=0;i<200;++i)v.push_back(i);
+  multi_hash_container mhc(v.begin(),v.end());
+  BOOST_TEST(mhc.size()==v.size());
+  BOOST_TEST(mhc.bucket_count()>=v.size()/mhc.max_load_factor());
+
+  hash_container&   hc=get<1>(mhc);
+  non_unique_index& nu=get<0>(mhc);
+  for(int i=0;i<200;++i){
+    BOOST_TEST(hc.count(i)==1);
+    BOOST_TEST(nu.count(i)==1);
+  }
+  BOOST_TEST(hc.count(200)==0);
+
+  hc.rehash(4*hc.bucket_count());
+  for(int i=0;i<200;++i)BOOST_TEST(hc.find(i)!=hc.end());
+
+  BOOST_TEST(hc.modify(hc.find(10),assign_int(-10)));
+  BOOST_TEST(hc.count(10)==0&&hc.count(-10)==1&&nu.count(-10)==1);
+  BOOST_TEST(!hc.modify(hc.find(11),assign_int(-10),assign_int(11)));
+  BOOST_TEST(!hc.replace(hc.find(12),-10));
+  BOOST_TEST(hc.count(11)==1&&hc.count(12)==1&&nu.count(11)==1);
+  BOOST_TEST(hc.replace(hc.find(12),-12));
+  BOOST_TEST(hc.count(12)==0&&hc.count(-12)==1&&nu.count(-12)==1);
+  hc.erase(199);
+  BOOST_TEST(hc.modify(hc.find(197),assign_int(199),assign_int(197)));
+  BOOST_TEST(hc.count(197)==0&&hc.count(199)==1&&nu.count(199)==1);
+
+  multi_hash_container mhc2(mhc);
+  mhc2.rehash(8*mhc2.bucket_count());
+  get<1>(mhc2).rehash(8*get<1>(mhc2).bucket_count());
+  for(int i=-20;i<200;++i){
+    BOOST_TEST(get<1>(mhc2).count(i)==hc.count(i));
+    BOOST_TEST(mhc2.count(i)==nu.count(i));
+  }
+
+  BOOST_TEST(hc.erase(-10)==1&&hc.erase(-10)==0);
+  BOOST_TEST(nu.count(-10)==0);
+}
+
+void test_hash_ops()
+{
+  local_test_hash_ops<hashed_unique<identity<int> > >();
+  local_test_hash_ops<hashed_unique_cached<identity<int> > >();
+  local_test_hash_consistency<
+    hashed_non_unique<identity<int>,coarse_hash>,
+    hashed_unique<identity<int>,coarse_hash> >();
+  local_test_hash_consistency<
+    hashed_non_unique_cached<identity<int>,coarse_hash>,
+    hashed_unique_cached<identity<int>,coarse_hash> >();
+}
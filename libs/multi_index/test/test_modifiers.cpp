@@ -11,6 +11,7 @@
 #include "test_modifiers.hpp"
 
 #include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <algorithm>
 #include <boost/detail/lightweight_test.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/move/core.hpp>
@@ -122,6 +123,113 @@ private:
 
 linked_object::impl_repository_t linked_object::impl_repository;
 
+struct throwing_less
+{
+  throwing_less(int n_=-1):n(n_){}
+
+  bool operator()(int x,int y)const
+  {
+    if(x==n||y==n)throw 0;
+    return x<y;
+  }
+
+  int n;
+};
+
+template<typename Container,typename Iterator>
+static bool ordered_as(const Container& c,Iterator first,Iterator last)
+{
+  std::vector<int> v(first,last);
+  std::sort(v.begin(),v.end());
+  return std::equal(c.begin(),c.end(),v.begin())&&c.size()==v.size();
+}
+
+static void test_bulk_loading()
+{
+  typedef multi_index_container<
+    int,
+    indexed_by<
+      sequenced<>,
+      ordered_unique<identity<int> >,
+      ordered_non_unique<identity<int> >
+    >
+  > int_container;
+
+  std::vector<int> v;
+  for(int n=0;n<70;++n){
+    int_container c(v.begin(),v.end());
+    BOOST_TEST(std::equal(c.begin(),c.end(),v.begin())&&c.size()==v.size());
+    BOOST_TEST(ordered_as(get<1>(c),v.begin(),v.end()));
+    BOOST_TEST(ordered_as(get<2>(c),v.begin(),v.end()));
+    BOOST_TEST(get<1>(c).find(n/2)!=get<1>(c).end()||n==0);
+    v.push_back(n);
+  }
+
+  std::vector<int> w;
+  for(int n=0;n<20;++n){
+    w.push_back(n);
+    w.push_back(n);
+  }
+  {
+    int_container c(w.begin(),w.end());
+    BOOST_TEST(c.size()==20);
+    BOOST_TEST(ordered_as(get<2>(c),v.begin(),v.begin()+20));
+  }
+
+  w.assign(v.begin(),v.end());
+  w.push_back(35);
+  w.push_back(-1);
+  w.push_back(100);
+  {
+    int_container c(w.begin(),w.end());
+    BOOST_TEST(c.size()==v.size()+2);
+    BOOST_TEST(ordered_as(get<1>(c),c.begin(),c.end()));
+    BOOST_TEST(ordered_as(get<2>(c),c.begin(),c.end()));
+    BOOST_TEST(*get<1>(c).begin()==-1&&*boost::prior(get<1>(c).end())==100);
+  }
+
+  {
+    int_container c;
+    get<2>(c).insert(w.begin(),w.end());
+    BOOST_TEST(c.size()==w.size()-1);
+    BOOST_TEST(ordered_as(get<2>(c),c.begin(),c.end()));
+    get<1>(c).insert(v.begin(),v.end());
+    BOOST_TEST(c.size()==v.size()+2);
+    get<1>(c).erase(get<1>(c).begin(),get<1>(c).find(60));
+    BOOST_TEST(ordered_as(get<2>(c),c.begin(),c.end()));
+    BOOST_TEST(c.size()==11);
+  }
+
+  typedef multi_index_container<
+    int,
+    indexed_by<
+      ordered_unique<identity<int>,throwing_less>
+    >
+  > throwing_container;
+
+  for(int n=0;n<20;++n){
+    try{
+      throwing_container c(
+        v.begin(),v.end(),
+        boost::make_tuple(
+          boost::make_tuple(identity<int>(),throwing_less(n))));
+      BOOST_TEST(false);
+    }
+    catch(int){}
+
+    throwing_container c(
+      boost::make_tuple(
+        boost::make_tuple(identity<int>(),throwing_less(n))));
+    try{
+      c.insert(v.begin(),v.end());
+      BOOST_TEST(false);
+    }
+    catch(int){}
+    BOOST_TEST(c.size()==static_cast<std::size_t>(n==0?1:n));
+    BOOST_TEST(std::equal(c.begin(),c.end(),v.begin()));
+  }
+}
+
 void test_modifiers()
 {
   employee_set              es;
@@ -455,6 +563,10 @@ void test_modifiers()
   BOOST_TEST(std::distance(c.begin(),c.insert(boost::prior(c.end()),1))==9);
   BOOST_TEST(std::distance(c.begin(),c.insert(c.end(),1))==10);
 
+  /* testcases for bulk loading of ordered indices */
+
+  test_bulk_loading();
+
   /* testcase for erase() reentrancy */
   {
     linked_object o1(1);
@@ -0,0 +1,83 @@
+// Copyright (C) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the scalability of singleton_pool, caching_singleton_pool and
+// malloc/free when several threads allocate and free chunks concurrently.
+
+#include <boost/pool/singleton_pool.hpp>
+#include <boost/pool/caching_singleton_pool.hpp>
+#include <boost/thread.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+#ifdef NDEBUG
+static const unsigned num_loops = 2000;
+#else
+static const unsigned num_loops = 50;
+#endif
+
+// Number of chunks each thread holds at once
+static const unsigned num_chunks = 1000;
+
+static const unsigned chunk_size = 32;
+
+struct singleton_tag { };
+struct caching_tag { };
+
+typedef boost::singleton_pool<singleton_tag, chunk_size> singleton_pool_t;
+typedef boost::caching_singleton_pool<caching_tag, chunk_size> caching_pool_t;
+
+struct malloc_free
+{
+  static void * malloc BOOST_PREVENT_MACRO_SUBSTITUTION()
+  { return (std::malloc)(chunk_size); }
+  static void free BOOST_PREVENT_MACRO_SUBSTITUTION(void * const ptr)
+  { (std::free)(ptr); }
+};
+
+template <typename Pool>
+void thread_func()
+{
+  std::vector<void *> v(num_chunks);
+  for (unsigned l = 0; l < num_loops; ++l)
+  {
+    for (unsigned i = 0; i < num_chunks; ++i)
+      v[i] = (Pool::malloc)();
+    for (unsigned i = 0; i < num_chunks; ++i)
+      (Pool::free)(v[i]);
+  }
+}
+
+template <typename Pool>
+double timing_test(const unsigned num_threads)
+{
+  const boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+  boost::thread_group threads;
+  for (unsigned i = 0; i < num_threads; ++i)
+    threads.create_thread(&thread_func<Pool>);
+  threads.join_all();
+  const boost::posix_time::time_duration elapsed =
+      boost::posix_time::microsec_clock::universal_time() - start;
+  return elapsed.total_microseconds() / 1000000.0;
+}
+
+int main()
+{
+  std::cout << "Each thread allocates and frees " << num_chunks << " chunks of "
+      << chunk_size << " bytes " << num_loops << " times" << std::endl;
+  std::cout << "Threads\tmalloc/free\tsingleton_pool\tcaching_singleton_pool" << std::endl;
+  for (unsigned num_threads = 1; num_threads <= 8; num_threads *= 2)
+  {
+    std::cout << num_threads << '\t'
+        << timing_test<malloc_free>(num_threads) << "\t\t"
+        << timing_test<singleton_pool_t>(num_threads) << "\t\t"
+        << timing_test<caching_pool_t>(num_threads) << std::endl;
+  }
+  return 0;
+}
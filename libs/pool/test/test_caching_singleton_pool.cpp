@@ -0,0 +1,163 @@
+/* Copyright (C) 2026 agent <agent@local>
+*
+* Use, modification and distribution is subject to the
+* Boost Software License, Version 1.0. (See accompanying
+* file LICENSE_1_0.txt or http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <boost/pool/caching_singleton_pool.hpp>
+#include <boost/thread.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+struct cached_tag { };
+struct threaded_tag { };
+
+// A multiple of the alignment of pointers and sizes, so that it's the partition size of the pool
+static const unsigned threaded_size = 24;
+
+// Counts the chunks of the blocks allocated by the underlying pool
+struct tracking_allocator
+{
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    static char * malloc BOOST_PREVENT_MACRO_SUBSTITUTION(const size_type bytes)
+    {
+        boost::mutex::scoped_lock lock(mtx());
+        // Each block also stores its size and a pointer to the next block
+        total() += bytes / threaded_size;
+        return new (std::nothrow) char[bytes];
+    }
+    static void free BOOST_PREVENT_MACRO_SUBSTITUTION(char * const block)
+    {
+        delete [] block;
+    }
+    static size_type & total()
+    {
+        static size_type t = 0;
+        return t;
+    }
+    static boost::mutex & mtx()
+    {
+        static boost::mutex m;
+        return m;
+    }
+};
+
+static const unsigned batch = 8;
+
+typedef boost::caching_singleton_pool<cached_tag, sizeof(int),
+    boost::default_user_allocator_new_delete,
+    boost::details::pool::default_mutex, 32, 0, batch> cached_pool;
+
+typedef boost::caching_singleton_pool<threaded_tag, threaded_size, tracking_allocator> threaded_pool;
+
+void test_single_thread()
+{
+    BOOST_TEST(cached_pool::thread_cache_size() == 0);
+
+    // The first allocation transfers a batch to the thread cache
+    void * const p = (cached_pool::malloc)();
+    BOOST_TEST(p != 0);
+    BOOST_TEST(cached_pool::is_from(p));
+    BOOST_TEST(cached_pool::thread_cache_size() == batch - 1);
+
+    // Chunks are reused in LIFO order
+    (cached_pool::free)(p);
+    BOOST_TEST(cached_pool::thread_cache_size() == batch);
+    BOOST_TEST((cached_pool::malloc)() == p);
+
+    // The cache never holds more than 2 * batch chunks
+    std::vector<void *> v;
+    for (unsigned i = 0; i != 10 * batch; ++i)
+    {
+        void * const c = (cached_pool::malloc)();
+        BOOST_TEST(c != 0 && c != p);
+        *static_cast<int *>(c) = static_cast<int>(i);
+        v.push_back(c);
+    }
+    std::sort(v.begin(), v.end());
+    BOOST_TEST(std::unique(v.begin(), v.end()) == v.end());
+    for (unsigned i = 0; i != v.size(); ++i)
+    {
+        (cached_pool::free)(v[i]);
+        BOOST_TEST(cached_pool::thread_cache_size() < 2 * batch);
+    }
+    (cached_pool::free)(p);
+
+    // Cached chunks are in use for the underlying pool until flushed
+    BOOST_TEST(cached_pool::thread_cache_size() != 0);
+    cached_pool::flush_thread_cache();
+    BOOST_TEST(cached_pool::thread_cache_size() == 0);
+
+    // Ordered allocations bypass the cache
+    void * const a = cached_pool::ordered_malloc(10);
+    BOOST_TEST(a != 0);
+    BOOST_TEST(cached_pool::thread_cache_size() == 0);
+    cached_pool::ordered_free(a, 10);
+
+    (cached_pool::malloc)();
+    BOOST_TEST(cached_pool::purge_memory());
+    BOOST_TEST(cached_pool::thread_cache_size() == 0);
+}
+
+void thread_func()
+{
+    std::vector<void *> v;
+    for (int round = 0; round != 100; ++round)
+    {
+        for (int i = 0; i != 200; ++i)
+        {
+            void * const p = (threaded_pool::malloc)();
+            BOOST_TEST(p != 0);
+            std::fill(static_cast<char *>(p), static_cast<char *>(p) + threaded_size, static_cast<char>(i));
+            v.push_back(p);
+        }
+        for (int i = 0; i != 200; ++i)
+        {
+            BOOST_TEST(*static_cast<char *>(v[i]) == static_cast<char>(i));
+        }
+        // Free half of the chunks in a different order
+        for (int i = 0; i != 100; ++i)
+        {
+            (threaded_pool::free)(v.back());
+            v.pop_back();
+            std::swap(v.front(), v[v.size() / 2]);
+        }
+        for (std::size_t i = 0; i != v.size(); ++i)
+            (threaded_pool::free)(v[i]);
+        v.clear();
+    }
+    // The cache of this thread is returned to the pool when it exits
+}
+
+void test_threads()
+{
+    boost::thread_group threads;
+    for (int i = 0; i != 8; ++i)
+        threads.create_thread(&thread_func);
+    threads.join_all();
+
+    // All chunks were returned by the exiting threads, so all the
+    // chunks of the underlying pool can be allocated from this thread
+    // without allocating more memory.
+    const std::size_t total = tracking_allocator::total();
+    std::vector<void *> v(total);
+    for (std::size_t i = 0; i != v.size(); ++i)
+        v[i] = (threaded_pool::malloc)();
+    BOOST_TEST(tracking_allocator::total() == total);
+    for (std::size_t i = 0; i != v.size(); ++i)
+        (threaded_pool::free)(v[i]);
+    threaded_pool::flush_thread_cache();
+    BOOST_TEST(threaded_pool::thread_cache_size() == 0);
+}
+
+int main()
+{
+    test_single_thread();
+    test_threads();
+    return boost::report_errors();
+}
@@ -0,0 +1,145 @@
+/* Copyright (C) 2026 agent <agent@local>
+*
+* Use, modification and distribution is subject to the
+* Boost Software License, Version 1.0. (See accompanying
+* file LICENSE_1_0.txt or http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <boost/pool/multi_pool.hpp>
+#include <boost/container/list.hpp>
+#include <boost/container/map.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "track_allocator.hpp"
+
+typedef boost::multi_pool<track_allocator> tracked_pool;
+
+void test_size_classes()
+{
+    boost::multi_pool<> mp(1000);
+    // Rounded up to the largest size class
+    BOOST_TEST(mp.max_pooled_size() >= 1000);
+    BOOST_TEST(mp.class_index(mp.max_pooled_size()) == mp.class_count() - 1);
+    BOOST_TEST(mp.class_index(mp.max_pooled_size() + 1) == mp.class_count());
+    BOOST_TEST(mp.class_index(0) == 0);
+    for (std::size_t bytes = 1; bytes <= mp.max_pooled_size(); ++bytes)
+    {
+        const std::size_t idx = mp.class_index(bytes);
+        BOOST_TEST(idx < mp.class_count());
+        // The smallest class that fits
+        BOOST_TEST(mp.class_size(idx) >= bytes);
+        BOOST_TEST(idx == 0 || mp.class_size(idx - 1) < bytes);
+        // Less than 25% is wasted
+        BOOST_TEST(mp.class_size(idx) - bytes < (std::max)(mp.class_size(0), mp.class_size(idx) / 4));
+    }
+}
+
+void test_malloc_free()
+{
+    {
+        tracked_pool mp(512, 1024);
+        std::vector<std::pair<char *, std::size_t> > v;
+        for (std::size_t i = 0; i != 2000; ++i)
+        {
+            const std::size_t bytes = (i * 37) % 700;
+            char * const p = static_cast<char *>((mp.malloc)(bytes));
+            BOOST_TEST(p != 0);
+            BOOST_TEST(reinterpret_cast<std::size_t>(p) % boost::alignment_of<void *>::value == 0);
+            std::memset(p, static_cast<int>(i & 0xFF), bytes);
+            v.push_back(std::make_pair(p, bytes));
+        }
+        // Chunks do not overlap
+        for (std::size_t i = 0; i != v.size(); ++i)
+        {
+            for (std::size_t j = 0; j != v[i].second; ++j)
+                BOOST_TEST(static_cast<unsigned char>(v[i].first[j]) == (i & 0xFF));
+        }
+        // Free in a different order
+        for (std::size_t i = 0; i != v.size(); ++i)
+            std::swap(v[i], v[(i * 7919) % v.size()]);
+        for (std::size_t i = 0; i != v.size(); ++i)
+            (mp.free)(v[i].first, v[i].second);
+
+        // Only one empty block per size class is kept
+        for (std::size_t i = 0; i != mp.class_count(); ++i)
+            BOOST_TEST(mp.block_count(i) <= 1);
+        BOOST_TEST(mp.release_memory());
+        BOOST_TEST(!mp.release_memory());
+        BOOST_TEST(track_allocator::ok());
+    }
+    BOOST_TEST(track_allocator::ok());
+}
+
+void test_empty_blocks_are_returned()
+{
+    tracked_pool mp(256, 256);
+    const std::size_t idx = mp.class_index(64);
+    std::vector<void *> v;
+    for (std::size_t i = 0; i != 100; ++i)
+        v.push_back((mp.malloc)(64));
+    const std::size_t blocks = mp.block_count(idx);
+    BOOST_TEST(blocks > 2);
+    // Freeing every chunk returns all but one block
+    for (std::size_t i = 0; i != v.size(); ++i)
+        (mp.free)(v[i], 64);
+    BOOST_TEST(mp.block_count(idx) == 1);
+    // The empty block is reused
+    void * const p = (mp.malloc)(60);
+    BOOST_TEST(mp.block_count(idx) == 1);
+    (mp.free)(p, 60);
+
+    // purge_memory frees everything
+    for (std::size_t i = 0; i != v.size(); ++i)
+        v[i] = (mp.malloc)(i);
+    BOOST_TEST(mp.purge_memory());
+    BOOST_TEST(track_allocator::ok());
+    for (std::size_t i = 0; i != mp.class_count(); ++i)
+        BOOST_TEST(mp.block_count(i) == 0);
+}
+
+void test_allocator()
+{
+    tracked_pool mp;
+    typedef boost::multi_pool_allocator<int, track_allocator> int_allocator;
+    int_allocator a(mp);
+    BOOST_TEST(&a.pool() == &mp);
+    boost::multi_pool_allocator<double, track_allocator> b(a);
+    BOOST_TEST(a == b);
+    tracked_pool other;
+    BOOST_TEST(a != int_allocator(other));
+
+    {
+        // Node containers
+        boost::container::list<int, int_allocator> l(a);
+        typedef std::pair<const int, int> value_type;
+        boost::container::map<int, int, std::less<int>,
+            boost::multi_pool_allocator<value_type, track_allocator> > m(std::less<int>(), mp);
+        // Contiguous containers
+        boost::container::vector<int, int_allocator> v(a);
+        for (int i = 0; i != 1000; ++i)
+        {
+            l.push_back(i);
+            m[i] = i;
+            v.push_back(i);
+        }
+        BOOST_TEST(l.size() == 1000 && m.size() == 1000 && v.size() == 1000);
+        BOOST_TEST(l.back() == 999 && m[500] == 500 && v[999] == 999);
+        BOOST_TEST(l.get_allocator().pool().class_count() == mp.class_count());
+    }
+    mp.release_memory();
+    BOOST_TEST(track_allocator::ok());
+}
+
+int main()
+{
+    test_size_classes();
+    test_malloc_free();
+    test_empty_blocks_are_returned();
+    test_allocator();
+    return boost::report_errors();
+}
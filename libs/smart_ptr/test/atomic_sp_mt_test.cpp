@@ -0,0 +1,146 @@
+#include <boost/config.hpp>
+
+//  atomic_sp_mt_test.cpp
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/detail/lightweight_thread.hpp>
+#include <boost/smart_ptr/atomic_shared_ptr.hpp>
+#include <boost/smart_ptr/detail/atomic_count.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/bind.hpp>
+
+//
+
+static boost::detail::atomic_count instances( 0 );
+
+struct X
+{
+    int id_;
+
+    explicit X( int id ): id_( id )
+    {
+        ++instances;
+    }
+
+    ~X()
+    {
+        id_ = -1;
+        --instances;
+    }
+};
+
+int const n = 4; // values in the pool
+int const m = 4; // threads
+int const k = 200000; // iterations per thread
+
+static boost::shared_ptr<X> values[ n + 1 ]; // the last one is empty
+static boost::atomic_shared_ptr<X> apx;
+static boost::detail::atomic_count errors( 0 );
+static boost::detail::atomic_count running( m );
+
+static bool valid( boost::shared_ptr<X> const & p )
+{
+    if( !p )
+    {
+        return p.use_count() == 0;
+    }
+
+    return p->id_ >= 0 && p->id_ < n && p == values[ p->id_ ];
+}
+
+static void worker( int t )
+{
+    unsigned r = t;
+
+    for( int i = 0; i < k; ++i )
+    {
+        r = r * 1103515245 + 12345;
+        boost::shared_ptr<X> const & v = values[ ( r >> 16 ) % ( n + 1 ) ];
+
+        switch( ( r >> 8 ) % 4 )
+        {
+        case 0:
+
+            if( !valid( apx.load() ) ) ++errors;
+            break;
+
+        case 1:
+
+            apx.store( v );
+            break;
+
+        case 2:
+
+            if( !valid( apx.exchange( v ) ) ) ++errors;
+            break;
+
+        default:
+
+            {
+                boost::shared_ptr<X> cmp = values[ ( r >> 4 ) % ( n + 1 ) ];
+                if( !apx.compare_exchange_strong( cmp, v ) && !valid( cmp ) ) ++errors;
+            }
+            break;
+        }
+    }
+
+    // A stale pin dropped on the empty value stored last would make the
+    // loads below spin forever
+
+    apx.store( boost::shared_ptr<X>() );
+    --running;
+
+    while( running != 0 )
+    {
+        if( !valid( apx.load() ) ) ++errors;
+    }
+
+    for( int i = 0; i < k / 100; ++i )
+    {
+        if( !valid( apx.load() ) ) ++errors;
+    }
+}
+
+int main()
+{
+    for( int i = 0; i < n; ++i )
+    {
+        values[ i ].reset( new X( i ) );
+    }
+
+    pthread_t a[ m ];
+
+    for( int i = 0; i < m; ++i )
+    {
+        boost::detail::lw_thread_create( a[ i ], boost::bind( worker, i ) );
+    }
+
+    for( int j = 0; j < m; ++j )
+    {
+        pthread_join( a[ j ], 0 );
+    }
+
+    BOOST_TEST( errors == 0 );
+    BOOST_TEST( valid( apx.load() ) );
+
+    // no snapshot has kept or released a reference it didn't own
+
+    apx.store( boost::shared_ptr<X>() );
+
+    for( int i = 0; i < n; ++i )
+    {
+        BOOST_TEST( values[ i ].use_count() == 1 );
+        values[ i ].reset();
+    }
+
+    BOOST_TEST( instances == 0 );
+
+    return boost::report_errors();
+}
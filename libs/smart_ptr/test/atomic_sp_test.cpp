@@ -0,0 +1,117 @@
+#include <boost/config.hpp>
+
+//  atomic_sp_test.cpp
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/smart_ptr/atomic_shared_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+//
+
+struct X
+{
+};
+
+#define BOOST_TEST_SP_EQ( p, q ) BOOST_TEST( p == q && !( p < q ) && !( q < p ) )
+
+int main()
+{
+    boost::shared_ptr<X> px( new X );
+
+    {
+        boost::atomic_shared_ptr<X> apx( px );
+
+        boost::shared_ptr<X> p2 = apx.load();
+        BOOST_TEST_SP_EQ( p2, px );
+
+        boost::shared_ptr<X> px2( new X );
+        apx.store( px2 );
+        BOOST_TEST_SP_EQ( apx.load(), px2 );
+
+        p2 = apx;
+        BOOST_TEST_SP_EQ( p2, px2 );
+
+        boost::shared_ptr<X> px3( new X );
+        boost::shared_ptr<X> p3 = apx.exchange( px3 );
+        BOOST_TEST_SP_EQ( p3, px2 );
+        BOOST_TEST_SP_EQ( apx.load(), px3 );
+
+        boost::shared_ptr<X> px4( new X );
+        boost::shared_ptr<X> cmp;
+
+        bool r = apx.compare_exchange_strong( cmp, px4 );
+        BOOST_TEST( !r );
+        BOOST_TEST_SP_EQ( apx.load(), px3 );
+        BOOST_TEST_SP_EQ( cmp, px3 );
+
+        r = apx.compare_exchange_strong( cmp, px4 );
+        BOOST_TEST( r );
+        BOOST_TEST_SP_EQ( apx.load(), px4 );
+
+        r = apx.compare_exchange_weak( cmp, px3, boost::memory_order_acq_rel, boost::memory_order_acquire );
+        BOOST_TEST( !r );
+        BOOST_TEST_SP_EQ( cmp, px4 );
+    }
+
+    // the stored value is released on destruction and on replacement
+
+    {
+        boost::weak_ptr<X> wp( px );
+
+        {
+            boost::atomic_shared_ptr<X> apx( px );
+            px.reset();
+            BOOST_TEST( !wp.expired() );
+        }
+
+        BOOST_TEST( wp.expired() );
+
+        px.reset( new X );
+        wp = px;
+
+        boost::atomic_shared_ptr<X> apx( px );
+        px.reset();
+
+        boost::shared_ptr<X> p2 = apx.load();
+        apx = boost::shared_ptr<X>();
+        BOOST_TEST( !wp.expired() );
+
+        p2.reset();
+        BOOST_TEST( wp.expired() );
+    }
+
+    // empty values
+
+    {
+        boost::atomic_shared_ptr<X> apx;
+
+        boost::shared_ptr<X> p2 = apx.load();
+        BOOST_TEST( p2.get() == 0 );
+        BOOST_TEST( p2.use_count() == 0 );
+
+        boost::shared_ptr<X> cmp;
+        boost::shared_ptr<X> px2( new X );
+
+        bool r = apx.compare_exchange_strong( cmp, px2 );
+        BOOST_TEST( r );
+        BOOST_TEST_SP_EQ( apx.load(), px2 );
+
+        boost::shared_ptr<X> p3 = apx.exchange( boost::shared_ptr<X>() );
+        BOOST_TEST_SP_EQ( p3, px2 );
+        BOOST_TEST( apx.load().get() == 0 );
+
+        r = apx.compare_exchange_strong( cmp, px2 );
+        BOOST_TEST( r );
+        BOOST_TEST_SP_EQ( apx.load(), px2 );
+    }
+
+    return boost::report_errors();
+}
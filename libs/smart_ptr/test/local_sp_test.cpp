@@ -0,0 +1,180 @@
+#include <boost/config.hpp>
+
+//  local_sp_test.cpp
+//
+//  Copyright (C) 2026 agent <agent@local>
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/smart_ptr/local_shared_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+//
+
+struct X
+{
+    static long instances;
+
+    X()
+    {
+        ++instances;
+    }
+
+    virtual ~X()
+    {
+        --instances;
+    }
+
+private:
+
+    X( X const & );
+    X & operator=( X const & );
+};
+
+long X::instances = 0;
+
+struct Y: public X
+{
+};
+
+struct deleter
+{
+    static int calls;
+
+    void operator()( X * p ) const
+    {
+        ++calls;
+        delete p;
+    }
+};
+
+int deleter::calls = 0;
+
+int main()
+{
+    {
+        boost::local_shared_ptr<X> p;
+        BOOST_TEST( p.get() == 0 );
+        BOOST_TEST( !p );
+        BOOST_TEST( p.local_use_count() == 0 );
+
+        boost::shared_ptr<X> sp = p;
+        BOOST_TEST( sp.get() == 0 );
+        BOOST_TEST( sp.use_count() == 0 );
+    }
+
+    {
+        boost::local_shared_ptr<X> p( new X );
+        BOOST_TEST( X::instances == 1 );
+        BOOST_TEST( p.local_use_count() == 1 );
+        BOOST_TEST( p.unique() );
+
+        boost::local_shared_ptr<X> p2( p );
+        BOOST_TEST( p2 == p );
+        BOOST_TEST( p.local_use_count() == 2 );
+
+        boost::local_shared_ptr<X> p3;
+        p3 = p2;
+        BOOST_TEST( p.local_use_count() == 3 );
+
+        p.reset();
+        p2.reset();
+        BOOST_TEST( X::instances == 1 );
+        BOOST_TEST( p3.local_use_count() == 1 );
+
+        p3.reset();
+        BOOST_TEST( X::instances == 0 );
+    }
+
+    // conversions from and to shared_ptr
+
+    {
+        boost::shared_ptr<X> sp( new X );
+        boost::weak_ptr<X> wp( sp );
+
+        boost::local_shared_ptr<X> p( sp );
+        BOOST_TEST( p.get() == sp.get() );
+        BOOST_TEST( sp.use_count() == 2 );
+
+        boost::local_shared_ptr<X> p2( p );
+        boost::local_shared_ptr<X> p3( p2 );
+        BOOST_TEST( sp.use_count() == 2 );
+        BOOST_TEST( p.local_use_count() == 3 );
+
+        BOOST_TEST( !p.owner_before( sp ) && !( p < p2 ) && !( p2 < p ) );
+
+        boost::shared_ptr<X> sp2 = p3;
+        BOOST_TEST( sp2 == sp );
+        BOOST_TEST( sp.use_count() == 3 );
+        BOOST_TEST( !sp2.owner_before( sp ) && !sp.owner_before( sp2 ) );
+
+        sp.reset();
+        sp2.reset();
+        BOOST_TEST( !wp.expired() );
+
+        p.reset();
+        p2.reset();
+        BOOST_TEST( !wp.expired() );
+
+        sp = p3;
+        p3.reset();
+        BOOST_TEST( !wp.expired() );
+        BOOST_TEST( sp.use_count() == 1 );
+
+        sp.reset();
+        BOOST_TEST( wp.expired() );
+        BOOST_TEST( X::instances == 0 );
+    }
+
+    // derived to base, casts and aliasing
+
+    {
+        boost::local_shared_ptr<Y> py( new Y );
+        boost::local_shared_ptr<X> px( py );
+        BOOST_TEST( px.get() == py.get() );
+        BOOST_TEST( py.local_use_count() == 2 );
+
+        boost::local_shared_ptr<Y> py2 = boost::dynamic_pointer_cast<Y>( px );
+        BOOST_TEST( py2 == py );
+        BOOST_TEST( py.local_use_count() == 3 );
+
+        boost::shared_ptr<X> sp = py2;
+        BOOST_TEST( sp.get() == px.get() );
+
+        static int const tag = 5;
+        boost::local_shared_ptr<int const> pa( py, &tag );
+        BOOST_TEST( pa.get() == &tag && *pa == 5 );
+        BOOST_TEST( py.local_use_count() == 4 );
+
+        px.reset();
+        py.reset();
+        py2.reset();
+        sp.reset();
+        BOOST_TEST( X::instances == 1 );
+
+        pa.reset();
+        BOOST_TEST( X::instances == 0 );
+    }
+
+    // custom deleter
+
+    {
+        boost::local_shared_ptr<X> p( new X, deleter() );
+        boost::shared_ptr<X> sp = p;
+        BOOST_TEST( boost::get_deleter<deleter>( sp ) != 0 );
+
+        p.reset();
+        BOOST_TEST( deleter::calls == 0 );
+
+        sp.reset();
+        BOOST_TEST( deleter::calls == 1 );
+        BOOST_TEST( X::instances == 0 );
+    }
+
+    return boost::report_errors();
+}
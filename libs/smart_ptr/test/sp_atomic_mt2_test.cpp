@@ -8,6 +8,7 @@
 #include <boost/config.hpp>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/smart_ptr/atomic_shared_ptr.hpp>
 #include <boost/bind.hpp>
 
 #include <boost/thread/shared_mutex.hpp>
@@ -54,6 +55,7 @@ struct X
 };
 
 static boost::shared_ptr<X> ps;
+static boost::atomic_shared_ptr<X> aps;
 
 static boost::detail::lightweight_mutex lm;
 static boost::shared_mutex rw;
@@ -62,7 +64,8 @@ enum prim_type
 {
     pt_mutex,
     pt_rwlock,
-    pt_atomics
+    pt_atomics,
+    pt_split
 };
 
 int read_access( prim_type pt )
@@ -86,6 +89,12 @@ int read_access( prim_type pt )
             boost::shared_ptr<X> p2 = boost::atomic_load( &ps );
             return p2->get();
         }
+
+    case pt_split:
+        {
+            boost::shared_ptr<X> p2 = aps.load();
+            return p2->get();
+        }
     }
 }
 
@@ -120,6 +129,20 @@ void write_access( prim_type pt )
             }
         }
         break;
+
+    case pt_split:
+        {
+            boost::shared_ptr<X> p1 = aps.load();
+
+            for( ;; )
+            {
+                boost::shared_ptr<X> p2( new X( *p1 ) );
+                p2->set();
+
+                if( aps.compare_exchange_weak( p1, p2 ) ) break;
+            }
+        }
+        break;
     }
 }
 
@@ -168,6 +191,10 @@ char const * pt_to_string( prim_type pt )
     case pt_atomics:
 
         return "atomics";
+
+    case pt_split:
+
+        return "split";
     }
 }
 
@@ -208,6 +235,7 @@ int main( int ac, char const * av[] )
         handle_pt_option( av[i], pt, pt_mutex );
         handle_pt_option( av[i], pt, pt_rwlock );
         handle_pt_option( av[i], pt, pt_atomics );
+        handle_pt_option( av[i], pt, pt_split );
 
         handle_int_option( av[i], "n=", n, 1, INT_MAX );
         handle_int_option( av[i], "size=", n, 1, INT_MAX );
@@ -225,6 +253,7 @@ int main( int ac, char const * av[] )
     printf( "%s: threads=%d size=%d iterations=%d ratio=%d %s\n\n", thmodel, m, n, k, r, pt_to_string( pt ) );
 
     ps.reset( new X( n ) );
+    aps.store( ps );
 
     clock_t t = clock();
 
@@ -0,0 +1,137 @@
+
+// Copyright (C) 2026 agent <agent@local>.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput of concurrent_unordered_map with 1 to 64 threads,
+// compared with an unordered_map protected by a single mutex. Each thread
+// does a mix of 80% lookups, 10% insertions and 10% erasures of random keys
+// from a range half filled before the threads start.
+//
+// Usage: bench_concurrent_map [max_threads]
+
+#include <boost/concurrent_unordered_map.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+
+using boost::timer::cpu_timer;
+
+typedef boost::uint64_t key_type;
+
+std::size_t const key_range = 1 << 20;
+std::size_t const total_operations = 1 << 24;
+
+// The same operations on the two containers.
+
+struct sharded
+{
+    boost::concurrent_unordered_map<key_type, key_type> map_;
+
+    bool find(key_type k) { return map_.contains(k); }
+    void insert(key_type k) { map_.try_emplace(k, k); }
+    void erase(key_type k) { map_.erase(k); }
+};
+
+struct locked
+{
+    boost::mutex mutex_;
+    boost::unordered_map<key_type, key_type> map_;
+
+    bool find(key_type k)
+    {
+        boost::mutex::scoped_lock lock(mutex_);
+        return map_.count(k) != 0;
+    }
+
+    void insert(key_type k)
+    {
+        boost::mutex::scoped_lock lock(mutex_);
+        map_.emplace(k, k);
+    }
+
+    void erase(key_type k)
+    {
+        boost::mutex::scoped_lock lock(mutex_);
+        map_.erase(k);
+    }
+};
+
+// xorshift, each thread has its own state.
+inline key_type next_random(key_type& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+template <class Map>
+void worker(Map& m, std::size_t operations, key_type seed,
+        std::size_t& found)
+{
+    key_type state = seed * 0x9e3779b97f4a7c15ull + 1;
+    std::size_t n = 0;
+
+    for (std::size_t i = 0; i < operations; ++i) {
+        key_type r = next_random(state);
+        key_type k = (r >> 8) % key_range;
+
+        switch (r % 10) {
+        case 0: m.insert(k); break;
+        case 1: m.erase(k); break;
+        default: n += m.find(k); break;
+        }
+    }
+
+    found = n;
+}
+
+template <class Map>
+double run(std::size_t threads)
+{
+    Map m;
+    for (key_type k = 0; k < key_range; k += 2) m.insert(k);
+
+    std::size_t const per_thread = total_operations / threads;
+    std::vector<std::size_t> found(threads);
+    boost::thread_group group;
+
+    cpu_timer t;
+    for (std::size_t i = 0; i < threads; ++i) {
+        group.create_thread(boost::bind(&worker<Map>, boost::ref(m),
+            per_thread, key_type(i), boost::ref(found[i])));
+    }
+    group.join_all();
+    t.stop();
+
+    // Millions of operations per second.
+    return static_cast<double>(per_thread * threads) * 1000.0 /
+        static_cast<double>(t.elapsed().wall);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t max_threads = 64;
+    if (argc > 1) max_threads = static_cast<std::size_t>(std::atoi(argv[1]));
+
+    std::cout << "Millions of operations per second ("
+        << boost::thread::hardware_concurrency() << " hardware threads)\n"
+        << std::setw(8) << "threads"
+        << std::setw(16) << "mutex"
+        << std::setw(16) << "concurrent" << '\n';
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        std::cout << std::setw(8) << threads << std::fixed
+            << std::setprecision(2)
+            << std::setw(16) << run<locked>(threads)
+            << std::setw(16) << run<sharded>(threads) << std::endl;
+    }
+}
@@ -0,0 +1,131 @@
+
+// Copyright (C) 2026 agent <agent@local>.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares unordered_flat_map with unordered_map for insertion, successful
+// and unsuccessful lookup and erasure with random 64-bit keys, for container
+// sizes from 1 thousand up to the size given on the command line (1 million
+// by default, up to 100 million).
+//
+// Usage: bench_flat_map [max_size]
+
+#include <boost/unordered_flat_map.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/cstdint.hpp>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <algorithm>
+
+using boost::timer::cpu_timer;
+using boost::timer::nanosecond_type;
+
+typedef boost::uint64_t key_type;
+
+// splitmix64, so that the keys don't depend on the quality of std::rand.
+static key_type next_key(key_type& state)
+{
+    key_type z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+struct results
+{
+    double insert, find_hit, find_miss, erase;
+};
+
+static double per_op(cpu_timer const& t, std::size_t ops)
+{
+    return static_cast<double>(t.elapsed().wall) / static_cast<double>(ops);
+}
+
+template <class Map>
+results run(std::vector<key_type> const& keys,
+    std::vector<key_type> const& missing, std::size_t repeats)
+{
+    results r = { 0, 0, 0, 0 };
+    std::size_t const n = keys.size();
+    std::size_t found = 0;
+
+    for (std::size_t rep = 0; rep < repeats; ++rep)
+    {
+        Map m;
+
+        cpu_timer t;
+        for (std::size_t i = 0; i < n; ++i) m[keys[i]] = i;
+        t.stop();
+        r.insert += per_op(t, n);
+
+        t.start();
+        for (std::size_t i = 0; i < n; ++i) found += m.count(keys[i]);
+        t.stop();
+        r.find_hit += per_op(t, n);
+
+        t.start();
+        for (std::size_t i = 0; i < n; ++i) found += m.count(missing[i]);
+        t.stop();
+        r.find_miss += per_op(t, n);
+
+        t.start();
+        for (std::size_t i = 0; i < n; ++i) m.erase(keys[i]);
+        t.stop();
+        r.erase += per_op(t, n);
+    }
+
+    // Make sure the lookups aren't optimised away.
+    if (found != n * repeats) std::cerr << "Unexpected lookup result\n";
+
+    r.insert /= static_cast<double>(repeats);
+    r.find_hit /= static_cast<double>(repeats);
+    r.find_miss /= static_cast<double>(repeats);
+    r.erase /= static_cast<double>(repeats);
+    return r;
+}
+
+static void print(char const* name, results const& r)
+{
+    std::cout << "  " << std::left << std::setw(20) << name << std::right
+        << std::fixed << std::setprecision(1)
+        << std::setw(10) << r.insert
+        << std::setw(10) << r.find_hit
+        << std::setw(10) << r.find_miss
+        << std::setw(10) << r.erase << '\n';
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t max_size = 1000000;
+    if (argc > 1) max_size = static_cast<std::size_t>(std::atof(argv[1]));
+
+    std::cout << "Nanoseconds per operation.\n  " << std::left
+        << std::setw(20) << "" << std::right
+        << std::setw(10) << "insert"
+        << std::setw(10) << "find hit"
+        << std::setw(10) << "find miss"
+        << std::setw(10) << "erase" << '\n';
+
+    for (std::size_t n = 1000; n <= max_size; n *= 10)
+    {
+        key_type state = 0;
+        std::vector<key_type> keys(n), missing(n);
+        for (std::size_t i = 0; i < n; ++i) keys[i] = next_key(state);
+        for (std::size_t i = 0; i < n; ++i) missing[i] = next_key(state);
+
+        // Repeat the small sizes, so that each run does at least 10 million
+        // operations of each kind.
+        std::size_t repeats = (std::max)(std::size_t(1), 10000000 / n);
+
+        std::cout << n << " elements:\n";
+        print("unordered_map",
+            run<boost::unordered_map<key_type, std::size_t> >(
+                keys, missing, repeats));
+        print("unordered_flat_map",
+            run<boost::unordered_flat_map<key_type, std::size_t> >(
+                keys, missing, repeats));
+    }
+}
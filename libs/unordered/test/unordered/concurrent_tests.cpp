@@ -0,0 +1,277 @@
+
+// Copyright (C) 2026 agent <agent@local>.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tests for concurrent_unordered_map, single threaded against std::map and
+// then from several threads at once.
+
+#include "../helpers/prefix.hpp"
+#include <boost/concurrent_unordered_map.hpp>
+#include "../helpers/postfix.hpp"
+
+#include "../helpers/test.hpp"
+#include "../objects/test.hpp"
+#include "../helpers/random_values.hpp"
+#include "../helpers/helpers.hpp"
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#include <map>
+#include <vector>
+#include <cstdlib>
+
+namespace concurrent_tests
+{
+
+test::seed_t initialize_seed(84327);
+
+typedef boost::concurrent_unordered_map<int, int> int_map;
+
+struct add_value
+{
+    int value_;
+    explicit add_value(int v) : value_(v) {}
+
+    void operator()(std::pair<const int, int>& x) const
+    {
+        x.second += value_;
+    }
+};
+
+struct check_value
+{
+    int expected_;
+    explicit check_value(int e) : expected_(e) {}
+
+    void operator()(std::pair<const int, int> const& x) const
+    {
+        BOOST_TEST(x.second == expected_);
+    }
+};
+
+struct collect
+{
+    std::map<int, int>* values_;
+    explicit collect(std::map<int, int>& v) : values_(&v) {}
+
+    void operator()(std::pair<const int, int> const& x) const
+    {
+        BOOST_TEST(values_->insert(x).second);
+    }
+};
+
+struct is_odd
+{
+    bool operator()(std::pair<const int, int> const& x) const
+    {
+        return x.first % 2 != 0;
+    }
+};
+
+struct is_even
+{
+    bool operator()(std::pair<const int, int> const& x) const
+    {
+        return x.first % 2 == 0;
+    }
+};
+
+void check_map(int_map const& x, std::map<int, int> const& m)
+{
+    BOOST_TEST(x.size() == m.size());
+    BOOST_TEST(x.empty() == m.empty());
+
+    std::map<int, int> values;
+    BOOST_TEST(x.cvisit_all(collect(values)) == m.size());
+    BOOST_TEST(values == m);
+
+    for (std::map<int, int>::const_iterator it = m.begin();
+            it != m.end(); ++it)
+    {
+        BOOST_TEST(x.cvisit(it->first, check_value(it->second)) == 1);
+    }
+}
+
+UNORDERED_AUTO_TEST(concurrent_single_thread)
+{
+    int_map x;
+    std::map<int, int> m;
+
+    check_map(x, m);
+
+    for (int i = 0; i < 20000; ++i) {
+        int k = std::rand() % 2000;
+
+        switch (std::rand() % 6) {
+        case 0:
+            BOOST_TEST(x.insert(std::make_pair(k, i)) ==
+                m.insert(std::make_pair(k, i)).second);
+            break;
+        case 1:
+            BOOST_TEST(x.erase(k) == m.erase(k));
+            break;
+        case 2: {
+            bool inserted = m.insert(std::make_pair(k, i)).second;
+            if (!inserted) m[k] += 1;
+            BOOST_TEST(x.try_emplace_or_visit(k, i, add_value(1)) ==
+                inserted);
+            break;
+        }
+        case 3:
+            BOOST_TEST(x.insert_or_assign(k, i) == !m.count(k));
+            m[k] = i;
+            break;
+        case 4: {
+            std::map<int, int>::iterator it = m.find(k);
+            if (it != m.end()) it->second += 2;
+            BOOST_TEST(x.visit(k, add_value(2)) == (it != m.end() ? 1 : 0));
+            break;
+        }
+        case 5:
+            BOOST_TEST(x.try_emplace(k) ==
+                m.insert(std::make_pair(k, 0)).second);
+            break;
+        }
+
+        BOOST_TEST(x.count(k) == m.count(k));
+    }
+
+    check_map(x, m);
+
+    int_map y(x);
+    check_map(y, m);
+
+    // Conditional erase, of one element and of all elements.
+    for (int k = 0; k < 100; ++k) {
+        std::size_t expected = m.count(k) && k % 2 == 0 ? 1 : 0;
+        BOOST_TEST(x.erase_if(k, is_even()) == expected);
+        if (expected) m.erase(k);
+    }
+    check_map(x, m);
+
+    std::size_t odd = 0;
+    for (std::map<int, int>::iterator it = m.begin(); it != m.end();) {
+        if (it->first % 2) {
+            m.erase(it++);
+            ++odd;
+        }
+        else {
+            ++it;
+        }
+    }
+    BOOST_TEST(x.erase_if(is_odd()) == odd);
+    check_map(x, m);
+
+    x.rehash(100000);
+    check_map(x, m);
+    x.reserve(0);
+    check_map(x, m);
+
+    x.swap(y);
+    BOOST_TEST(x.size() > y.size());
+    y = x;
+    BOOST_TEST(x.size() == y.size());
+
+    x.clear();
+    BOOST_TEST(x.empty());
+    BOOST_TEST(x.size() == 0);
+    BOOST_TEST(!x.contains(1));
+}
+
+// Several threads increment the same set of counters, inserting them as
+// they go, while other threads insert and erase their own keys.
+
+int const thread_count = 8;
+int const counter_count = 1000;
+int const iterations = 20000;
+
+void increment_counters(int_map& x)
+{
+    for (int i = 0; i < iterations; ++i)
+        x.try_emplace_or_visit(i % counter_count, 1, add_value(1));
+}
+
+void insert_and_erase(int_map& x, int id)
+{
+    int const base = (id + 1) * 1000000;
+
+    for (int i = 0; i < iterations; ++i) {
+        BOOST_TEST(x.insert(std::make_pair(base + i, i)));
+        if (i % 2) BOOST_TEST(x.erase(base + i - 1) == 1);
+    }
+
+    x.reserve(static_cast<std::size_t>(iterations) * 4);
+}
+
+UNORDERED_AUTO_TEST(concurrent_threads)
+{
+    int_map x;
+    boost::thread_group threads;
+
+    for (int i = 0; i < thread_count; ++i) {
+        threads.create_thread(boost::bind(increment_counters,
+            boost::ref(x)));
+        threads.create_thread(boost::bind(insert_and_erase,
+            boost::ref(x), i));
+    }
+
+    threads.join_all();
+
+    BOOST_TEST(x.size() == static_cast<std::size_t>(
+        counter_count + thread_count * iterations / 2));
+
+    for (int i = 0; i < counter_count; ++i) {
+        BOOST_TEST(x.cvisit(i,
+            check_value(thread_count * iterations / counter_count)) == 1);
+    }
+
+    for (int id = 0; id < thread_count; ++id) {
+        int const base = (id + 1) * 1000000;
+        for (int i = 0; i < iterations; ++i)
+            BOOST_TEST(x.count(base + i) == (i % 2 ? 1u : 0u));
+    }
+}
+
+// Check that elements are destroyed and memory released with the test
+// allocators.
+
+UNORDERED_AUTO_TEST(concurrent_objects)
+{
+    typedef boost::concurrent_unordered_map<test::object, test::object,
+        test::hash, test::equal_to,
+        test::allocator2<test::object> > object_map;
+
+    test::check_instances check_;
+
+    test::random_values<object_map> v(1000, test::generate_collisions);
+    {
+        object_map x(v.begin(), v.end());
+        object_map y(x);
+        BOOST_TEST(x.size() == y.size());
+
+        for (test::random_values<object_map>::iterator it = v.begin();
+                it != v.end(); ++it)
+        {
+            BOOST_TEST(x.contains(it->first));
+        }
+
+        // The mapped value is only constructed if it's inserted.
+        test::object_count count = test::global_object_count;
+        BOOST_TEST(!x.try_emplace(v.begin()->first));
+        BOOST_TEST(test::global_object_count == count);
+
+        for (test::random_values<object_map>::iterator it = v.begin();
+                it != v.end(); ++it)
+        {
+            x.erase(it->first);
+        }
+
+        BOOST_TEST(x.empty());
+        x = y;
+        BOOST_TEST(x.size() == y.size());
+    }
+}
+
+}
+
+RUN_TESTS()
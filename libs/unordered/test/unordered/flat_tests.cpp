@@ -0,0 +1,308 @@
+
+// Copyright (C) 2026 agent <agent@local>.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tests for the open addressing containers, checked against std::map and
+// std::set.
+
+#include "../helpers/prefix.hpp"
+#include <boost/unordered_flat_map.hpp>
+#include <boost/unordered_flat_set.hpp>
+#include "../helpers/postfix.hpp"
+
+#include "../helpers/test.hpp"
+#include "../objects/test.hpp"
+#include "../helpers/random_values.hpp"
+#include "../helpers/helpers.hpp"
+#include <map>
+#include <set>
+#include <string>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace flat_tests
+{
+
+test::seed_t initialize_seed(27463);
+
+// A hash function with lots of collisions, to exercise probing.
+struct bad_hash
+{
+    std::size_t operator()(int x) const
+    {
+        return static_cast<std::size_t>(x % 7);
+    }
+};
+
+template <class X, class Map>
+void check_map(X const& x, Map const& m)
+{
+    BOOST_TEST(x.size() == m.size());
+    BOOST_TEST(static_cast<std::size_t>(std::distance(x.begin(), x.end()))
+        == m.size());
+
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+    {
+        typename X::const_iterator pos = x.find(it->first);
+        BOOST_TEST(pos != x.end());
+        if (pos != x.end()) BOOST_TEST(pos->second == it->second);
+    }
+
+    for (typename X::const_iterator it = x.begin(); it != x.end(); ++it)
+    {
+        BOOST_TEST(m.count(it->first) == 1);
+    }
+}
+
+template <class X>
+void random_operations_test(X*)
+{
+    X x;
+    std::map<int, int> m;
+
+    for (int i = 0; i < 20000; ++i) {
+        int k = std::rand() % 2000;
+
+        switch (std::rand() % 4) {
+        case 0:
+        case 1: {
+            std::pair<typename X::iterator, bool> r =
+                x.insert(std::make_pair(k, i));
+            bool inserted = m.insert(std::make_pair(k, i)).second;
+            BOOST_TEST(r.second == inserted);
+            BOOST_TEST(r.first->first == k);
+            break;
+        }
+        case 2:
+            BOOST_TEST(x.erase(k) == m.erase(k));
+            break;
+        case 3:
+            x[k] = i;
+            m[k] = i;
+            break;
+        }
+
+        BOOST_TEST(x.size() == m.size());
+    }
+
+    check_map(x, m);
+
+    // Erasing with iterators while iterating.
+    for (typename X::iterator it = x.begin(); it != x.end();) {
+        if (it->first % 3 == 0) {
+            m.erase(it->first);
+            it = x.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    check_map(x, m);
+
+    X y(x);
+    check_map(y, m);
+    BOOST_TEST(x == y);
+
+    y[-1] = 5;
+    BOOST_TEST(x != y);
+
+    X z;
+    z = y;
+    BOOST_TEST(z == y);
+    z.swap(x);
+    check_map(z, m);
+
+    z.rehash(0);
+    check_map(z, m);
+    std::size_t n = z.size() * 4;
+    z.reserve(n);
+    BOOST_TEST(z.bucket_count() / 8 * 7 >= n);
+    check_map(z, m);
+
+    z.clear();
+    BOOST_TEST(z.empty());
+    BOOST_TEST(z.begin() == z.end());
+    BOOST_TEST(z.find(1) == z.end());
+}
+
+UNORDERED_AUTO_TEST(flat_map_random_operations)
+{
+    random_operations_test((boost::unordered_flat_map<int, int>*) 0);
+    random_operations_test(
+        (boost::unordered_flat_map<int, int, bad_hash>*) 0);
+}
+
+UNORDERED_AUTO_TEST(flat_map_tombstones)
+{
+    // Repeatedly inserting and erasing keys leaves deleted slots, which
+    // must not break lookups or make the table grow without bound.
+    boost::unordered_flat_map<int, int, bad_hash> x;
+    for (int i = 0; i < 100; ++i) x[i] = i;
+    std::size_t buckets = x.bucket_count();
+
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 100; i < 200; ++i) x[i + round * 100] = i;
+        for (int i = 100; i < 200; ++i) x.erase(i + round * 100);
+    }
+
+    BOOST_TEST(x.size() == 100u);
+    BOOST_TEST(x.bucket_count() <= buckets * 2);
+    for (int i = 0; i < 100; ++i) {
+        BOOST_TEST(x.count(i) == 1);
+        BOOST_TEST(x.at(i) == i);
+    }
+}
+
+UNORDERED_AUTO_TEST(flat_map_strings)
+{
+    boost::unordered_flat_map<std::string, std::string> x;
+    std::map<std::string, std::string> m;
+
+    for (int i = 0; i < 1000; ++i) {
+        std::string k(1, static_cast<char>('a' + i % 26));
+        k += std::string(static_cast<std::size_t>(i % 37), 'x');
+        x[k] += "y";
+        m[k] += "y";
+    }
+
+    check_map(x, m);
+
+    bool caught = false;
+    try {
+        x.at("not there");
+    }
+    catch (std::out_of_range&) {
+        caught = true;
+    }
+    BOOST_TEST(caught);
+}
+
+UNORDERED_AUTO_TEST(flat_set_test)
+{
+    boost::unordered_flat_set<int> x;
+    std::set<int> s;
+
+    for (int i = 0; i < 10000; ++i) {
+        int k = std::rand() % 3000;
+        if (std::rand() % 3) {
+            BOOST_TEST(x.insert(k).second == s.insert(k).second);
+        }
+        else {
+            BOOST_TEST(x.erase(k) == s.erase(k));
+        }
+    }
+
+    BOOST_TEST(x.size() == s.size());
+    for (std::set<int>::const_iterator it = s.begin(); it != s.end(); ++it)
+        BOOST_TEST(x.count(*it) == 1);
+    for (boost::unordered_flat_set<int>::const_iterator it = x.begin();
+            it != x.end(); ++it)
+        BOOST_TEST(s.count(*it) == 1);
+
+    boost::unordered_flat_set<int> y(s.begin(), s.end());
+    BOOST_TEST(x == y);
+}
+
+// Lookups in containers that have no storage, default constructed or
+// emptied and shrunk with rehash(0).
+
+template <class X>
+void check_no_storage(X& x)
+{
+    X const& cx = x;
+
+    BOOST_TEST(x.find(1) == x.end());
+    BOOST_TEST(cx.find(1) == cx.end());
+    BOOST_TEST(x.count(1) == 0);
+
+    std::pair<typename X::iterator, typename X::iterator> r =
+        x.equal_range(1);
+    BOOST_TEST(r.first == x.end());
+    BOOST_TEST(r.second == x.end());
+
+    std::pair<typename X::const_iterator, typename X::const_iterator> cr =
+        cx.equal_range(1);
+    BOOST_TEST(cr.first == cx.end());
+    BOOST_TEST(cr.second == cx.end());
+
+    BOOST_TEST(x.erase(1) == 0);
+    BOOST_TEST(x.erase(x.begin(), x.end()) == x.end());
+}
+
+template <class X>
+void no_storage_test(X*)
+{
+    X x;
+    check_no_storage(x);
+
+    x.insert(x.end(), typename X::value_type());
+    BOOST_TEST(x.count(typename X::key_type()) == 1);
+    x.clear();
+    x.rehash(0);
+    check_no_storage(x);
+}
+
+UNORDERED_AUTO_TEST(flat_no_storage)
+{
+    no_storage_test((boost::unordered_flat_map<int, int>*) 0);
+    no_storage_test((boost::unordered_flat_set<int>*) 0);
+}
+
+// Check that elements are destroyed and memory released with the test
+// allocators.
+
+template <class X>
+void object_test(X*, test::random_generator generator)
+{
+    test::check_instances check_;
+
+    test::random_values<X> v(1000, generator);
+    {
+        X x(v.begin(), v.end());
+
+        X y;
+        for (typename test::random_values<X>::iterator it = v.begin();
+                it != v.end(); ++it)
+        {
+            y.insert(*it);
+            BOOST_TEST(x.find(test::get_key<X>(*it)) != x.end());
+        }
+        BOOST_TEST(x.size() == y.size());
+
+        X z(x);
+        BOOST_TEST(z.size() == x.size());
+
+        for (typename test::random_values<X>::iterator it = v.begin();
+                it != v.end(); ++it)
+        {
+            z.erase(test::get_key<X>(*it));
+        }
+        BOOST_TEST(z.empty());
+
+        z = x;
+        BOOST_TEST(z.size() == x.size());
+        for (typename X::const_iterator it = x.begin(); it != x.end(); ++it)
+            BOOST_TEST(z.count(test::get_key<X>(*it)) == 1);
+    }
+}
+
+boost::unordered_flat_set<test::object,
+    test::hash, test::equal_to,
+    test::allocator1<test::object> >* test_set;
+boost::unordered_flat_map<test::object, test::object,
+    test::hash, test::equal_to,
+    test::allocator2<test::object> >* test_map;
+
+using test::default_generator;
+using test::generate_collisions;
+
+UNORDERED_TEST(object_test,
+    ((test_set)(test_map))
+    ((default_generator)(generate_collisions))
+)
+
+}
+
+RUN_TESTS()